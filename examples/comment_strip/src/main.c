@@ -163,7 +163,7 @@ static int setup_parser(
     if (0 == argc)
     {
         /* turn stdin into a stream. */
-        retval = input_stream_create_from_descriptor(&stream, 0);
+        retval = input_stream_create_from_buffered_descriptor(&stream, 0, 0);
         if (STATUS_SUCCESS != retval)
         {
             goto done;
@@ -203,7 +203,8 @@ static int setup_parser(
             }
 
             /* turn this descriptor into a stream. */
-            retval = input_stream_create_from_descriptor(&stream, desc);
+            retval =
+                input_stream_create_from_buffered_descriptor(&stream, desc, 0);
             if (STATUS_SUCCESS != retval)
             {
                 goto close_desc;
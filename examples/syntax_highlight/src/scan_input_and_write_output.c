@@ -11,6 +11,7 @@
 #include <libcparse/abstract_parser.h>
 #include <libcparse/event.h>
 #include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
 #include <libcparse/status_codes.h>
 #include <string.h>
 
@@ -20,6 +21,7 @@ CPARSE_IMPORT_abstract_parser;
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
 
 static int comment_scanner_event_callback(
     syntax_highlight_config* config, const event* ev);
@@ -44,6 +46,7 @@ int scan_input_and_write_output(syntax_highlight_config* config)
 {
     int retval, release_retval;
     event_handler ceh, peh;
+    event_reactor_filter comment_filter;
 
     /* create an event handler for comment scanner events. */
     retval =
@@ -54,8 +57,16 @@ int scan_input_and_write_output(syntax_highlight_config* config)
         goto done;
     }
 
+    /* we only care about comment begin / end events. */
+    event_reactor_filter_clear(&comment_filter);
+    event_reactor_filter_add_type_range(
+        &comment_filter, CPARSE_EVENT_TYPE_COMMENT_BLOCK_BEGIN,
+        CPARSE_EVENT_TYPE_COMMENT_LINE_END);
+
     /* subscribe to comment scanner events. */
-    retval = abstract_parser_comment_scanner_subscribe(config->ap, &ceh);
+    retval =
+        abstract_parser_comment_scanner_subscribe_filtered(
+            config->ap, &ceh, &comment_filter);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_ceh;
@@ -11,6 +11,7 @@
 #include <libcparse/status_codes.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
 
 #include "syntax_highlight_internal.h"
 
@@ -52,10 +53,10 @@ int syntax_highlight_config_release(syntax_highlight_config* config)
         }
     }
 
-    /* free input_string if set. */
+    /* unmap input_string if set. */
     if (NULL != config->input_string)
     {
-        free(config->input_string);
+        munmap((void*)config->input_string, config->input_size);
     }
 
     /* close out if open. */
@@ -42,8 +42,8 @@ int syntax_highlight_create_scanner_and_output(syntax_highlight_config* config)
         goto done;
     }
 
-    /* create an input stream from the input string. */
-    retval = input_stream_create_from_string(&stream, config->input_string);
+    /* create an input stream from the input file. */
+    retval = input_stream_create_from_file(&stream, config->input);
     if (STATUS_SUCCESS != retval)
     {
         fprintf(stderr, "Error creating input stream.\n");
@@ -32,7 +32,8 @@ struct syntax_highlight_config
     int state;
     CPARSE_SYM(preprocessor_scanner)* scanner;
     CPARSE_SYM(abstract_parser)* ap;
-    char* input_string;
+    const char* input_string;
+    size_t input_size;
     FILE* out;
     size_t count;
     source_line* head;
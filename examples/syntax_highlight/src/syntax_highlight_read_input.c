@@ -1,26 +1,32 @@
 /**
  * \file exmaples/syntax_highlight/src/syntax_highlight_read_input.c
  *
- * \brief Open the input file and read into an input string and source lines.
+ * \brief Map the input file and split it into source lines.
  *
  * \copyright 2023 Justin Handville.  Please see license.txt in this
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <fcntl.h>
 #include <libcparse/status_codes.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "syntax_highlight_internal.h"
 
-static int read_input_file(syntax_highlight_config* config);
+static int map_input_file(syntax_highlight_config* config);
 static int read_input_lines(syntax_highlight_config* config);
 static int create_lines_array(syntax_highlight_config* config);
 static void debug_output_parsed_lines(syntax_highlight_config* config);
 
 /**
- * \brief Open input file and read input file into an input string and source
- * lines.
+ * \brief Map the input file into memory and split it into source lines.
+ *
+ * The scanner reads the same file through its own memory-mapped input stream,
+ * so the file is never copied into a string.
  *
  * \param config        The config instance for this operation.
  *
@@ -32,8 +38,8 @@ int syntax_highlight_read_input(syntax_highlight_config* config)
 {
     int retval;
 
-    /* read the input file. */
-    retval = read_input_file(config);
+    /* map the input file. */
+    retval = map_input_file(config);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
@@ -111,16 +117,17 @@ static int read_input_lines(syntax_highlight_config* config)
     int retval;
     size_t start_offset = 0;
     size_t end_offset = 0;
-    char* input = config->input_string;
 
-    while (0 != *input)
+    while (start_offset < config->input_size)
     {
         end_offset = start_offset;
 
         /* scan to the next newline. */
-        while (0 != *input && '\n' != *input)
+        while (
+            end_offset < config->input_size
+         && '\n' != config->input_string[end_offset])
         {
-            ++input; ++end_offset;
+            ++end_offset;
         }
 
         /* compute the length of this line. */
@@ -135,13 +142,7 @@ static int read_input_lines(syntax_highlight_config* config)
             return retval;
         }
 
-        /* increment past the newline. */
-        if ('\n' == *input)
-        {
-            ++input;
-        }
-
-        /* update the offsets. */
+        /* skip past the newline. */
         start_offset = end_offset + 1;
     }
 
@@ -157,7 +158,7 @@ static int read_input_lines(syntax_highlight_config* config)
 }
 
 /**
- * \brief Read the input file.
+ * \brief Map the input file into memory.
  *
  * \param config        The config instance for this operation.
  *
@@ -165,66 +166,50 @@ static int read_input_lines(syntax_highlight_config* config)
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int read_input_file(syntax_highlight_config* config)
+static int map_input_file(syntax_highlight_config* config)
 {
     int retval, release_retval;
-    FILE* in = NULL;
+    struct stat st;
+    void* data;
+    int desc;
 
     /* open the input file for reading. */
-    in = fopen(config->input, "r");
-    if (NULL == in)
+    desc = open(config->input, O_RDONLY);
+    if (desc < 0)
     {
         retval = ERROR_LIBCPARSE_FILE_OPEN_ERROR;
         goto done;
     }
 
-    /* seek to the end of the file. */
-    retval = fseek(in, 0L, SEEK_END);
-    if (retval < 0)
-    {
-        retval = ERROR_LIBCPARSE_FILE_SEEK;
-        goto cleanup_in;
-    }
-
-    /* get the offset of the file at this location. */
-    long offset = ftell(in);
-    if (offset < 0)
-    {
-        retval = ERROR_LIBCPARSE_FILE_TELL;
-        goto cleanup_in;
-    }
-
-    /* allocate enough memory for the input string. */
-    config->input_string = (char*)malloc(offset + 1);
-    if (NULL == config->input_string)
+    /* get the size of the file. */
+    if (0 != fstat(desc, &st))
     {
-        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
-        goto cleanup_in;
+        retval = ERROR_LIBCPARSE_FILE_STAT;
+        goto cleanup_desc;
     }
 
-    /* seek to the start of the file. */
-    retval = fseek(in, 0L, SEEK_SET);
-    if (retval < 0)
+    /* an empty file has no lines, and can't be mapped. */
+    if (0 == st.st_size)
     {
-        return ERROR_LIBCPARSE_FILE_SEEK;
-        goto cleanup_in;
+        retval = STATUS_SUCCESS;
+        goto cleanup_desc;
     }
 
-    /* read the contents of the input file. */
-    size_t read_size = fread(config->input_string, 1, offset, in);
-    if (read_size < (size_t)offset)
+    /* map the contents of the input file. */
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, desc, 0);
+    if (MAP_FAILED == data)
     {
         retval = ERROR_LIBCPARSE_INPUT_STREAM_READ_ERROR;
-        goto cleanup_in;
+        goto cleanup_desc;
     }
 
-    /* ascii-zero the input string. */
-    config->input_string[offset] = 0;
+    config->input_string = (const char*)data;
+    config->input_size = (size_t)st.st_size;
     retval = STATUS_SUCCESS;
-    goto done;
+    goto cleanup_desc;
 
-cleanup_in:
-    release_retval = fclose(in);
+cleanup_desc:
+    release_retval = close(desc);
     if (0 != release_retval)
     {
         retval = ERROR_LIBCPARSE_FILE_CLOSE_ERROR;
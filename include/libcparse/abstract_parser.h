@@ -11,10 +11,15 @@
 #pragma once
 
 #include <libcparse/abstract_parser/detail.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/event_handler_fwd.h>
+#include <libcparse/event_reactor.h>
 #include <libcparse/function_decl.h>
 #include <libcparse/input_stream_fwd.h>
 #include <libcparse/message_handler_fwd.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -44,6 +49,26 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_init)(
     CPARSE_SYM(abstract_parser)* ap, const CPARSE_SYM(message_handler)* mh);
 
+/**
+ * \brief Initialize an \ref abstract_parser from a root \ref message_handler
+ * that uses the given allocator for its memory.
+ *
+ * Every parser stage built on this parser uses this allocator for its own
+ * instance and its internal components.
+ *
+ * \param ap                    The abstract parser instance to initialize.
+ * \param mh                    The root \ref message_handler for this parser.
+ * \param alloc                 The allocator for this parser, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_init_with_allocator)(
+    CPARSE_SYM(abstract_parser)* ap, const CPARSE_SYM(message_handler)* mh,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Dispose a \ref abstract_parser instance.
  *
@@ -73,6 +98,44 @@ CPARSE_SYM(abstract_parser_dispose)(
 int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_run)(CPARSE_SYM(abstract_parser)* ap);
 
+/**
+ * \brief Feed bytes to an abstract parser instance.
+ *
+ * This is the push-mode alternative to \ref abstract_parser_run. The bytes are
+ * scanned as soon as they are fed, and every stage keeps its state between
+ * feeds, so a token split across two feeds is reported once the second feed
+ * completes it. Fed input is named "(feed)" in event cursors. Call
+ * \ref abstract_parser_finish once all input has been fed.
+ *
+ * \note The bytes are copied; \p buf remains owned by the caller.
+ *
+ * \param ap                    The abstract parser instance for this operation.
+ * \param buf                   The bytes to feed.
+ * \param size                  The number of bytes in \p buf.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_feed)(
+    CPARSE_SYM(abstract_parser)* ap, const void* buf, size_t size);
+
+/**
+ * \brief Finish feeding an abstract parser instance.
+ *
+ * Any remaining input is scanned and EOF is broadcast. A later feed begins a
+ * new parse.
+ *
+ * \param ap                    The abstract parser instance for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_finish)(CPARSE_SYM(abstract_parser)* ap);
+
 /**
  * \brief Get the message handler for this abstract parser.
  *
@@ -114,6 +177,13 @@ CPARSE_SYM(abstract_parser_message_handler_override)(
  * \note Ownership of this \ref input_stream is passed to the \ref
  * abstract_parser.
  *
+ * \note When this parser is run or fed, and every raw character subscriber
+ * also accepts raw spans, input is scanned a block at a time. A stream pushed
+ * by a subscriber during such a scan, such as by an include handler, is only
+ * read after the rest of the current block has been scanned. When stepping,
+ * or when a raw character subscriber does not accept spans, the stream is read
+ * from the next character.
+ *
  * \param ap                The \ref abstract_parser to add this stream to.
  * \param name              The name of this stream.
  * \param stream            The stream to push onto the stack.
@@ -141,6 +211,60 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_raw_stack_scanner_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref raw_stack_scanner events, receiving only the event
+ * types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_raw_stack_scanner_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
+/**
+ * \brief Subscribe to \ref raw_stack_scanner raw span events.
+ *
+ * Span subscribers receive an \ref event_raw_span for each contiguous run of
+ * characters read from an input stream, instead of one raw character event per
+ * character, followed by the EOF event.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_raw_stack_scanner_span_subscribe)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
+
+/**
+ * \brief Subscribe to \ref raw_stack_scanner raw span events, receiving only
+ * the event types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_raw_stack_scanner_span_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref raw_file_line_override_filter events.
  *
@@ -155,6 +279,24 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_raw_file_line_override_filter_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref raw_file_line_override_filter events, receiving only
+ * the event types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_raw_file_line_override_filter_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref comment_scanner events.
  *
@@ -169,6 +311,24 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_comment_scanner_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref comment_scanner events, receiving only the event
+ * types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_comment_scanner_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref comment_filter events.
  *
@@ -183,6 +343,24 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_comment_filter_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref comment_filter events, receiving only the event
+ * types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_comment_filter_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref line_wrap_filter events.
  *
@@ -197,6 +375,24 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_line_wrap_filter_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref line_wrap_filter events, receiving only the event
+ * types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_line_wrap_filter_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref newline_preserving_whitespace_filter events.
  *
@@ -211,6 +407,25 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_newline_preserving_whitespace_filter_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref newline_preserving_whitespace_filter events,
+ * receiving only the event types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(
+    abstract_parser_newline_preserving_whitespace_filter_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Subscribe to \ref preprocessor_scanner events.
  *
@@ -225,12 +440,34 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_preprocessor_scanner_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Subscribe to \ref preprocessor_scanner events, receiving only the
+ * event types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_preprocessor_scanner_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Override the line number and file name in the file / line override
  * filter.
  *
  * \note This operation also overrides the column number, setting it to 1.
  *
+ * \note As with \ref abstract_parser_push_input_stream, an override made by a
+ * subscriber while a block of input is scanned as a span only takes effect
+ * after the rest of that block.
+ *
  * \param ap                The \ref abstract_parser for this operation.
  * \param line              The new line number.
  * \param file              The new file name, or NULL to keep it the same.
@@ -243,6 +480,103 @@ int FN_DECL_MUST_CHECK
 CPARSE_SYM(abstract_parser_file_line_override)(
     CPARSE_SYM(abstract_parser)* ap, unsigned int line, const char* file);
 
+/**
+ * \brief Save a checkpoint of every stage of this parser.
+ *
+ * A checkpoint can only be saved between two characters of input, such as
+ * after a step has yielded or fed input has run dry, and not from an event
+ * handler while a character is being scanned. Together with the input that
+ * follows its offset, a checkpoint is enough to resume scanning, in this
+ * parser or in another parser with the same stages, even after this parser is
+ * released.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param ap                The \ref abstract_parser for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG if a partial token does
+ *        not fit in the checkpoint.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does
+ *        not fit in the checkpoint.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_checkpoint_save)(
+    CPARSE_SYM(abstract_parser_checkpoint)* ckpt,
+    CPARSE_SYM(abstract_parser)* ap);
+
+/**
+ * \brief Restore a checkpoint to every stage of this parser.
+ *
+ * The input stream on top of the stack must hold the input that follows the
+ * checkpoint offset, and must not have been read yet. Scanning it then
+ * produces the same events as were produced after the checkpoint was saved.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint can't be
+ *        restored.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_checkpoint_restore)(
+    CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(abstract_parser_checkpoint)* ckpt);
+
+/**
+ * \brief Intern a file name in the file table for this parser.
+ *
+ * Each distinct file name is copied into the table once. The interned name and
+ * its ID remain valid until this parser is disposed, so a \ref cursor can refer
+ * to them without copying. File ID \ref CPARSE_CURSOR_FILE_ID_NONE is always
+ * "(null)".
+ *
+ * \param file              Pointer to receive the interned file name on
+ *                          success. This string is owned by the parser.
+ * \param file_id           Pointer to receive the file ID on success.
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param name              The file name to intern.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_file_intern)(
+    const char** file, uint32_t* file_id, CPARSE_SYM(abstract_parser)* ap,
+    const char* name);
+
+/**
+ * \brief Look up a file name by its ID in the file table for this parser.
+ *
+ * \param file              Pointer to receive the interned file name on
+ *                          success. This string is owned by the parser.
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param file_id           The file ID to look up.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL if this file ID has not been
+ *        assigned by this parser.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(abstract_parser_file_lookup)(
+    const char** file, CPARSE_SYM(abstract_parser)* ap, uint32_t file_id);
+
+/**
+ * \brief Get the allocator used by this parser.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ *
+ * \returns the allocator for this parser.
+ */
+const CPARSE_SYM(allocator)* CPARSE_SYM(abstract_parser_allocator_get)(
+    const CPARSE_SYM(abstract_parser)* ap);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -254,6 +588,11 @@ CPARSE_SYM(abstract_parser_file_line_override)(
         CPARSE_SYM(abstract_parser)* x, const CPARSE_SYM(message_handler)* y) {\
             return CPARSE_SYM(abstract_parser_init)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_init_with_allocator( \
+        CPARSE_SYM(abstract_parser)* x, const CPARSE_SYM(message_handler)* y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(abstract_parser_init_with_allocator)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_dispose( \
         CPARSE_SYM(abstract_parser)* x) { \
             return CPARSE_SYM(abstract_parser_dispose)(x); } \
@@ -261,6 +600,14 @@ CPARSE_SYM(abstract_parser_file_line_override)(
     sym ## abstract_parser_run( \
         CPARSE_SYM(abstract_parser)* x) { \
             return CPARSE_SYM(abstract_parser_run)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_feed( \
+        CPARSE_SYM(abstract_parser)* x, const void* y, size_t z) { \
+            return CPARSE_SYM(abstract_parser_feed)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_finish( \
+        CPARSE_SYM(abstract_parser)* x) { \
+            return CPARSE_SYM(abstract_parser_finish)(x); } \
     static inline CPARSE_SYM(message_handler)* \
     sym ## abstract_parser_message_handler_get( \
         CPARSE_SYM(abstract_parser)* x) { \
@@ -283,6 +630,28 @@ CPARSE_SYM(abstract_parser_file_line_override)(
                 CPARSE_SYM(abstract_parser_raw_stack_scanner_subscribe)( \
                     x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_raw_stack_scanner_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_raw_stack_scanner_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_raw_stack_scanner_span_subscribe( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
+            return \
+                CPARSE_SYM(abstract_parser_raw_stack_scanner_span_subscribe)( \
+                    x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_raw_stack_scanner_span_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_raw_stack_scanner_span_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_raw_file_line_override_filter_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
@@ -290,21 +659,53 @@ CPARSE_SYM(abstract_parser_file_line_override)(
                     abstract_parser_raw_file_line_override_filter_subscribe)( \
                     x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_raw_file_line_override_filter_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+            abstract_parser_raw_file_line_override_filter_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_comment_scanner_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
                 CPARSE_SYM(abstract_parser_comment_scanner_subscribe)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_comment_scanner_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_comment_scanner_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_comment_filter_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
                 CPARSE_SYM(abstract_parser_comment_filter_subscribe)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_comment_filter_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_comment_filter_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_line_wrap_filter_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
                 CPARSE_SYM(abstract_parser_line_wrap_filter_subscribe)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_line_wrap_filter_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_line_wrap_filter_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_newline_preserving_whitespace_filter_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
@@ -312,6 +713,15 @@ CPARSE_SYM(abstract_parser_file_line_override)(
               abstract_parser_newline_preserving_whitespace_filter_subscribe)( \
                     x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## \
+    abstract_parser_newline_preserving_whitespace_filter_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+     abstract_parser_newline_preserving_whitespace_filter_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_preprocessor_scanner_subscribe( \
         CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y) { \
             return \
@@ -319,9 +729,40 @@ CPARSE_SYM(abstract_parser_file_line_override)(
               abstract_parser_preprocessor_scanner_subscribe)( \
                     x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_preprocessor_scanner_subscribe_filtered( \
+        CPARSE_SYM(abstract_parser)* x, CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return \
+            CPARSE_SYM( \
+              abstract_parser_preprocessor_scanner_subscribe_filtered)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## abstract_parser_file_line_override( \
         CPARSE_SYM(abstract_parser)* x, unsigned int y, const char* z) { \
             return CPARSE_SYM(abstract_parser_file_line_override)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_checkpoint_save( \
+        CPARSE_SYM(abstract_parser_checkpoint)* x, \
+        CPARSE_SYM(abstract_parser)* y) { \
+            return CPARSE_SYM(abstract_parser_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_checkpoint_restore( \
+        CPARSE_SYM(abstract_parser)* x, \
+        const CPARSE_SYM(abstract_parser_checkpoint)* y) { \
+            return CPARSE_SYM(abstract_parser_checkpoint_restore)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_file_intern( \
+        const char** x, uint32_t* y, CPARSE_SYM(abstract_parser)* z, \
+        const char* w) { \
+            return CPARSE_SYM(abstract_parser_file_intern)(x,y,z,w); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## abstract_parser_file_lookup( \
+        const char** x, CPARSE_SYM(abstract_parser)* y, uint32_t z) { \
+            return CPARSE_SYM(abstract_parser_file_lookup)(x,y,z); } \
+    static inline const CPARSE_SYM(allocator)* \
+    sym ## abstract_parser_allocator_get( \
+        const CPARSE_SYM(abstract_parser)* x) { \
+            return CPARSE_SYM(abstract_parser_allocator_get)(x); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_abstract_parser_as(sym) \
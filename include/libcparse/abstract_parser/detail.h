@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <libcparse/allocator/detail.h>
+#include <libcparse/intern_table.h>
 #include <libcparse/message_handler/detail.h>
 
 /* C++ compatibility. */
@@ -18,7 +20,9 @@ extern "C" {
 
 struct CPARSE_SYM(abstract_parser)
 {
+    CPARSE_SYM(allocator) alloc;
     CPARSE_SYM(message_handler) mh;
+    CPARSE_SYM(intern_table)* files;
 };
 
 /* C++ compatibility. */
@@ -0,0 +1,168 @@
+/**
+ * \file libcparse/allocator.h
+ *
+ * \brief The \ref allocator provides the memory used by library objects.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/allocator/detail.h>
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Initialize an \ref allocator from a set of allocation functions and a
+ * context.
+ *
+ * An allocator is copied into each object created with it, so it does not need
+ * to outlive these objects, but its context does.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param allocate              The function used to allocate memory.
+ * \param reallocate            The function used to resize memory.
+ * \param free_fn               The function used to free memory.
+ * \param context               The allocator user context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(allocator_init)(
+    CPARSE_SYM(allocator)* alloc, CPARSE_SYM(allocator_allocate_fn) allocate,
+    CPARSE_SYM(allocator_reallocate_fn) reallocate,
+    CPARSE_SYM(allocator_free_fn) free_fn, void* context);
+
+/**
+ * \brief Initialize an \ref allocator that uses the C standard library heap.
+ *
+ * This is the allocator used by objects created without one.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(allocator_init_default)(
+    CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Initialize an \ref allocator by copying another \ref allocator.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param other                 The allocator to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(allocator_init_copy)(
+    CPARSE_SYM(allocator)* alloc, const CPARSE_SYM(allocator)* other);
+
+/**
+ * \brief Dispose an \ref allocator instance.
+ *
+ * \param alloc                 The allocator instance to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(allocator_dispose)(CPARSE_SYM(allocator)* alloc);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Allocate a block of memory from an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(allocator_allocate)(
+    const CPARSE_SYM(allocator)* alloc, size_t size);
+
+/**
+ * \brief Resize a block of memory from an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param block                 The block to resize, or NULL to allocate a new
+ *                              block.
+ * \param size                  The new size of the block.
+ *
+ * \returns the resized block on success, or NULL on failure, in which case the
+ * original block is left unchanged.
+ */
+void* CPARSE_SYM(allocator_reallocate)(
+    const CPARSE_SYM(allocator)* alloc, void* block, size_t size);
+
+/**
+ * \brief Return a block of memory to an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param block                 The block to free, or NULL.
+ */
+void CPARSE_SYM(allocator_free)(
+    const CPARSE_SYM(allocator)* alloc, void* block);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_CPARSE_IMPORT_allocator_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(allocator_allocate_fn) sym ## allocator_allocate_fn; \
+    typedef CPARSE_SYM(allocator_reallocate_fn) \
+        sym ## allocator_reallocate_fn; \
+    typedef CPARSE_SYM(allocator_free_fn) sym ## allocator_free_fn; \
+    typedef CPARSE_SYM(allocator) sym ## allocator; \
+    static inline int FN_DECL_MUST_CHECK sym ## allocator_init( \
+        CPARSE_SYM(allocator)* x, CPARSE_SYM(allocator_allocate_fn) y, \
+        CPARSE_SYM(allocator_reallocate_fn) z, \
+        CPARSE_SYM(allocator_free_fn) w, void* v) { \
+            return CPARSE_SYM(allocator_init)(x,y,z,w,v); } \
+    static inline int FN_DECL_MUST_CHECK sym ## allocator_init_default( \
+        CPARSE_SYM(allocator)* x) { \
+            return CPARSE_SYM(allocator_init_default)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## allocator_init_copy( \
+        CPARSE_SYM(allocator)* x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(allocator_init_copy)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## allocator_dispose( \
+        CPARSE_SYM(allocator)* x) { \
+            return CPARSE_SYM(allocator_dispose)(x); } \
+    static inline void* sym ## allocator_allocate( \
+        const CPARSE_SYM(allocator)* x, size_t y) { \
+            return CPARSE_SYM(allocator_allocate)(x,y); } \
+    static inline void* sym ## allocator_reallocate( \
+        const CPARSE_SYM(allocator)* x, void* y, size_t z) { \
+            return CPARSE_SYM(allocator_reallocate)(x,y,z); } \
+    static inline void sym ## allocator_free( \
+        const CPARSE_SYM(allocator)* x, void* y) { \
+            CPARSE_SYM(allocator_free)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_allocator_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_allocator_sym(sym ## _)
+#define CPARSE_IMPORT_allocator \
+    __INTERNAL_CPARSE_IMPORT_allocator_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
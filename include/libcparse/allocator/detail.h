@@ -0,0 +1,30 @@
+/**
+ * \file libcparse/allocator/detail.h
+ *
+ * \brief Internal details for \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+struct CPARSE_SYM(allocator)
+{
+    CPARSE_SYM(allocator_allocate_fn) allocate;
+    CPARSE_SYM(allocator_reallocate_fn) reallocate;
+    CPARSE_SYM(allocator_free_fn) deallocate;
+    void* context;
+};
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,63 @@
+/**
+ * \file libcparse/allocator_fwd.h
+ *
+ * \brief Forward declarations for \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Allocate a block of memory.
+ *
+ * \param context               A user-supplied context pointer given to the
+ *                              allocator.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+typedef void* (*CPARSE_SYM(allocator_allocate_fn))(void* context, size_t size);
+
+/**
+ * \brief Resize a block of memory, moving it if necessary.
+ *
+ * \param context               A user-supplied context pointer given to the
+ *                              allocator.
+ * \param block                 The block to resize, or NULL to allocate a new
+ *                              block.
+ * \param size                  The new size of the block.
+ *
+ * \returns the resized block on success, or NULL on failure, in which case the
+ * original block is left unchanged.
+ */
+typedef void* (*CPARSE_SYM(allocator_reallocate_fn))(
+    void* context, void* block, size_t size);
+
+/**
+ * \brief Free a block of memory.
+ *
+ * \param context               A user-supplied context pointer given to the
+ *                              allocator.
+ * \param block                 The block to free.
+ */
+typedef void (*CPARSE_SYM(allocator_free_fn))(void* context, void* block);
+
+/**
+ * \brief An allocator provides the memory used by library objects.
+ */
+typedef struct CPARSE_SYM(allocator) CPARSE_SYM(allocator);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
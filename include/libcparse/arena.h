@@ -0,0 +1,158 @@
+/**
+ * \file libcparse/arena.h
+ *
+ * \brief A bump allocator whose memory is released all at once.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The arena hands out memory by bumping an offset through large blocks.
+ *
+ * Individual frees are no-ops, except that the most recent allocation can be
+ * freed or grown in place. All of the memory in an arena is reclaimed at once
+ * when it is reset or released, which makes it a good fit for objects that all
+ * share the lifetime of a single parse.
+ */
+typedef struct CPARSE_SYM(arena) CPARSE_SYM(arena);
+
+/**
+ * \brief The default size of an arena block.
+ */
+#define CPARSE_ARENA_DEFAULT_BLOCK_SIZE 65536
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an \ref arena instance.
+ *
+ * \param a                     Pointer to the \ref arena pointer to set to the
+ *                              created instance on success.
+ * \param block_size            The size of each block, or 0 to use
+ *                              CPARSE_ARENA_DEFAULT_BLOCK_SIZE. Larger
+ *                              allocations get a block of their own.
+ * \param thread_safe           If true, every method on this arena is guarded
+ *                              by a lock, so that several threads can allocate
+ *                              from it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(arena_create)(
+    CPARSE_SYM(arena)** a, size_t block_size, bool thread_safe);
+
+/**
+ * \brief Release an \ref arena instance, along with every block of memory
+ * allocated from it.
+ *
+ * \param a                     The \ref arena instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(arena_release)(CPARSE_SYM(arena)* a);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Initialize an \ref allocator that allocates from the given arena.
+ *
+ * The arena must outlive every object created with this allocator.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param a                     The \ref arena to allocate from.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(arena_allocator_init)(
+    CPARSE_SYM(allocator)* alloc, CPARSE_SYM(arena)* a);
+
+/**
+ * \brief Allocate a block of memory from an \ref arena.
+ *
+ * The block is aligned for any type, and remains valid until the arena is
+ * reset or released.
+ *
+ * \param a                     The \ref arena for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(arena_allocate)(CPARSE_SYM(arena)* a, size_t size);
+
+/**
+ * \brief Reset an \ref arena, reclaiming all of the memory allocated from it.
+ *
+ * The most recent block is kept for reuse, and the rest are freed. Every
+ * pointer allocated from this arena is invalid after this call.
+ *
+ * \param a                     The \ref arena to reset.
+ */
+void CPARSE_SYM(arena_reset)(CPARSE_SYM(arena)* a);
+
+/**
+ * \brief Get the number of bytes currently allocated from an \ref arena.
+ *
+ * \param a                     The \ref arena to query.
+ *
+ * \returns the number of bytes allocated, including alignment and bookkeeping.
+ */
+size_t CPARSE_SYM(arena_used_get)(CPARSE_SYM(arena)* a);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_arena_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(arena) sym ## arena; \
+    static inline int FN_DECL_MUST_CHECK sym ## arena_create( \
+        CPARSE_SYM(arena)** x, size_t y, bool z) { \
+            return CPARSE_SYM(arena_create)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## arena_release( \
+        CPARSE_SYM(arena)* x) { \
+            return CPARSE_SYM(arena_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## arena_allocator_init( \
+        CPARSE_SYM(allocator)* x, CPARSE_SYM(arena)* y) { \
+            return CPARSE_SYM(arena_allocator_init)(x,y); } \
+    static inline void* sym ## arena_allocate( \
+        CPARSE_SYM(arena)* x, size_t y) { \
+            return CPARSE_SYM(arena_allocate)(x,y); } \
+    static inline void sym ## arena_reset(CPARSE_SYM(arena)* x) { \
+            CPARSE_SYM(arena_reset)(x); } \
+    static inline size_t sym ## arena_used_get(CPARSE_SYM(arena)* x) { \
+            return CPARSE_SYM(arena_used_get)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_arena_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_arena_sym(sym ## _)
+#define CPARSE_IMPORT_arena \
+    __INTERNAL_CPARSE_IMPORT_arena_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,272 @@
+/**
+ * \file libcparse/checkpoint.h
+ *
+ * \brief Checkpoints capture the state of each scanner stage between two
+ * characters of input, so that scanning can later resume from that point.
+ *
+ * Each checkpoint is plain data, and can be copied freely. Its positions hold
+ * a copy of their file names, rather than pointers into the file table of the
+ * parser that saved it, so a checkpoint can outlive this parser. The names are
+ * interned into the file table of the parser that restores it.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/abstract_parser_fwd.h>
+#include <libcparse/cursor.h>
+#include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The largest partial token that a preprocessor scanner checkpoint can
+ * hold.
+ */
+#define CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE 256
+
+/**
+ * \brief The largest file name, including its terminating NUL, that a
+ * checkpoint position can hold.
+ */
+#define CPARSE_CHECKPOINT_FILE_NAME_SIZE 256
+
+/**
+ * \brief A position saved to a checkpoint.
+ *
+ * The file of the position is always NULL, and its file id is only meaningful
+ * to the parser that saved it. The file name is copied instead.
+ */
+typedef struct CPARSE_SYM(checkpoint_cursor) CPARSE_SYM(checkpoint_cursor);
+
+struct CPARSE_SYM(checkpoint_cursor)
+{
+    /* true if the saved position has a file. */
+    bool has_file;
+
+    /* the saved position, whose file is NULL. */
+    CPARSE_SYM(cursor) pos;
+
+    /* the NUL terminated file name. */
+    char file[CPARSE_CHECKPOINT_FILE_NAME_SIZE];
+};
+
+/**
+ * \brief The state of a \ref raw_stack_scanner.
+ *
+ * Only the position of the input stream on top of the stack is captured. The
+ * streams themselves are not.
+ */
+typedef struct CPARSE_SYM(raw_stack_scanner_checkpoint)
+CPARSE_SYM(raw_stack_scanner_checkpoint);
+
+struct CPARSE_SYM(raw_stack_scanner_checkpoint)
+{
+    /* the byte offset of the next character to be read. */
+    size_t offset;
+
+    /* the position of the next character to be read. */
+    CPARSE_SYM(checkpoint_cursor) pos;
+};
+
+/**
+ * \brief The state of a \ref raw_file_line_override_filter.
+ */
+typedef struct CPARSE_SYM(raw_file_line_override_filter_checkpoint)
+CPARSE_SYM(raw_file_line_override_filter_checkpoint);
+
+struct CPARSE_SYM(raw_file_line_override_filter_checkpoint)
+{
+    bool use_pos;
+    CPARSE_SYM(checkpoint_cursor) pos;
+};
+
+/**
+ * \brief The state of a \ref line_wrap_filter.
+ *
+ * A cached position with no file is not set.
+ */
+typedef struct CPARSE_SYM(line_wrap_filter_checkpoint)
+CPARSE_SYM(line_wrap_filter_checkpoint);
+
+struct CPARSE_SYM(line_wrap_filter_checkpoint)
+{
+    int state;
+    CPARSE_SYM(checkpoint_cursor) cache;
+};
+
+/**
+ * \brief The state of a \ref comment_scanner.
+ *
+ * A cached position with no file is not set.
+ */
+typedef struct CPARSE_SYM(comment_scanner_checkpoint)
+CPARSE_SYM(comment_scanner_checkpoint);
+
+struct CPARSE_SYM(comment_scanner_checkpoint)
+{
+    int state;
+    CPARSE_SYM(checkpoint_cursor) cache;
+};
+
+/**
+ * \brief The state of a \ref comment_filter.
+ *
+ * A cached position with no file is not set.
+ */
+typedef struct CPARSE_SYM(comment_filter_checkpoint)
+CPARSE_SYM(comment_filter_checkpoint);
+
+struct CPARSE_SYM(comment_filter_checkpoint)
+{
+    int state;
+    CPARSE_SYM(checkpoint_cursor) cache;
+};
+
+/**
+ * \brief The state of a \ref newline_preserving_whitespace_filter.
+ *
+ * A cached position with no file is not set.
+ */
+typedef struct CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)
+CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint);
+
+struct CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)
+{
+    int state;
+    CPARSE_SYM(checkpoint_cursor) cache;
+};
+
+/**
+ * \brief The state of a \ref preprocessor_scanner, including the characters of
+ * a partial token.
+ *
+ * A cached position with no file is not set.
+ */
+typedef struct CPARSE_SYM(preprocessor_scanner_checkpoint)
+CPARSE_SYM(preprocessor_scanner_checkpoint);
+
+struct CPARSE_SYM(preprocessor_scanner_checkpoint)
+{
+    int state;
+    int preprocessor_state;
+    bool state_reset;
+    bool has_hex_digit;
+    CPARSE_SYM(checkpoint_cursor) cache;
+    CPARSE_SYM(checkpoint_cursor) newline_cache;
+    CPARSE_SYM(checkpoint_cursor) hash_cache;
+    size_t token_size;
+    char token[CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE];
+};
+
+/**
+ * \brief The state of every stage of an \ref abstract_parser.
+ *
+ * The parts for stages that are not in the parser are left zeroed.
+ */
+typedef struct CPARSE_SYM(abstract_parser_checkpoint)
+CPARSE_SYM(abstract_parser_checkpoint);
+
+struct CPARSE_SYM(abstract_parser_checkpoint)
+{
+    /* the byte offset of the next character to be read. */
+    size_t offset;
+
+    CPARSE_SYM(raw_stack_scanner_checkpoint) raw_stack_scanner;
+    CPARSE_SYM(raw_file_line_override_filter_checkpoint)
+        raw_file_line_override_filter;
+    CPARSE_SYM(line_wrap_filter_checkpoint) line_wrap_filter;
+    CPARSE_SYM(comment_scanner_checkpoint) comment_scanner;
+    CPARSE_SYM(comment_filter_checkpoint) comment_filter;
+    CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)
+        newline_preserving_whitespace_filter;
+    CPARSE_SYM(preprocessor_scanner_checkpoint) preprocessor_scanner;
+};
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Save a position to a checkpoint, copying its file name.
+ *
+ * A position with a NULL file is saved without a file name.
+ *
+ * \param ckpt              The checkpoint position to populate.
+ * \param pos               The position to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if the file name does
+ *        not fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(checkpoint_cursor_save)(
+    CPARSE_SYM(checkpoint_cursor)* ckpt, const CPARSE_SYM(cursor)* pos);
+
+/**
+ * \brief Restore a position from a checkpoint, interning its file name in the
+ * file table of the given parser.
+ *
+ * A position saved without a file name is restored with a NULL file.
+ *
+ * \param pos               The position to populate.
+ * \param ap                The parser whose file table receives the file.
+ * \param ckpt              The checkpoint position to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if the file name is not
+ *        terminated.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(checkpoint_cursor_restore)(
+    CPARSE_SYM(cursor)* pos, CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(checkpoint_cursor)* ckpt);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_CPARSE_IMPORT_checkpoint_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(checkpoint_cursor) sym ## checkpoint_cursor; \
+    typedef CPARSE_SYM(raw_stack_scanner_checkpoint) \
+    sym ## raw_stack_scanner_checkpoint; \
+    typedef CPARSE_SYM(raw_file_line_override_filter_checkpoint) \
+    sym ## raw_file_line_override_filter_checkpoint; \
+    typedef CPARSE_SYM(line_wrap_filter_checkpoint) \
+    sym ## line_wrap_filter_checkpoint; \
+    typedef CPARSE_SYM(comment_scanner_checkpoint) \
+    sym ## comment_scanner_checkpoint; \
+    typedef CPARSE_SYM(comment_filter_checkpoint) \
+    sym ## comment_filter_checkpoint; \
+    typedef CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint) \
+    sym ## newline_preserving_whitespace_filter_checkpoint; \
+    typedef CPARSE_SYM(preprocessor_scanner_checkpoint) \
+    sym ## preprocessor_scanner_checkpoint; \
+    typedef CPARSE_SYM(abstract_parser_checkpoint) \
+    sym ## abstract_parser_checkpoint; \
+    static inline int FN_DECL_MUST_CHECK sym ## checkpoint_cursor_save( \
+        CPARSE_SYM(checkpoint_cursor)* x, const CPARSE_SYM(cursor)* y) { \
+            return CPARSE_SYM(checkpoint_cursor_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## checkpoint_cursor_restore( \
+        CPARSE_SYM(cursor)* x, CPARSE_SYM(abstract_parser)* y, \
+        const CPARSE_SYM(checkpoint_cursor)* z) { \
+            return CPARSE_SYM(checkpoint_cursor_restore)(x,y,z); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_checkpoint_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_checkpoint_sym(sym ## _)
+#define CPARSE_IMPORT_checkpoint \
+    __INTERNAL_CPARSE_IMPORT_checkpoint_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
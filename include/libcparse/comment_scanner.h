@@ -34,6 +34,8 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/function_decl.h>
 
 /* C++ compatibility. */
@@ -68,6 +70,25 @@ CPARSE_SYM(comment_scanner);
 int FN_DECL_MUST_CHECK
 CPARSE_SYM(comment_scanner_create)(CPARSE_SYM(comment_scanner)** scanner);
 
+/**
+ * \brief Create a comment scanner that uses the given allocator for its memory.
+ *
+ * This filter automatically creates a file / line override filter and injects
+ * itself into the message chain for the parser stack.
+ *
+ * \param scanner           Pointer to the \ref comment_scanner pointer to be
+ *                          populated with the created comment scanner instance
+ *                          on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(comment_scanner_create_with_allocator)(
+    CPARSE_SYM(comment_scanner)** scanner, const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a comment scanner instance, releasing any internal resources
  * it may own.
@@ -95,6 +116,36 @@ CPARSE_SYM(comment_scanner_release)(CPARSE_SYM(comment_scanner)* scanner);
 CPARSE_SYM(abstract_parser)* CPARSE_SYM(comment_scanner_upcast)(
     CPARSE_SYM(comment_scanner)* scanner);
 
+/**
+ * \brief Save the state of a comment scanner to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref comment_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(comment_scanner_checkpoint_save)(
+    CPARSE_SYM(comment_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(comment_scanner)* scanner);
+
+/**
+ * \brief Restore the state of a comment scanner from a checkpoint.
+ *
+ * \param scanner           The \ref comment_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(comment_scanner_checkpoint_restore)(
+    CPARSE_SYM(comment_scanner)* scanner,
+    const CPARSE_SYM(comment_scanner_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -107,12 +158,26 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(comment_scanner_upcast)(
         CPARSE_SYM(comment_scanner)** x) { \
             return CPARSE_SYM(comment_scanner_create)(x); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## comment_scanner_create_with_allocator( \
+        CPARSE_SYM(comment_scanner)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(comment_scanner_create_with_allocator)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## comment_scanner_release( \
         CPARSE_SYM(comment_scanner)* x) { \
             return CPARSE_SYM(comment_scanner_release)(x); } \
     static inline CPARSE_SYM(abstract_parser)* sym ## comment_scanner_upcast( \
         CPARSE_SYM(comment_scanner)* x) { \
             return CPARSE_SYM(comment_scanner_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## comment_scanner_checkpoint_save( \
+        CPARSE_SYM(comment_scanner_checkpoint)* x, \
+        const CPARSE_SYM(comment_scanner)* y) { \
+            return CPARSE_SYM(comment_scanner_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## comment_scanner_checkpoint_restore( \
+        CPARSE_SYM(comment_scanner)* x, \
+        const CPARSE_SYM(comment_scanner_checkpoint)* y) { \
+            return CPARSE_SYM(comment_scanner_checkpoint_restore)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_comment_scanner_as(sym) \
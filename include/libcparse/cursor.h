@@ -10,24 +10,43 @@
 #pragma once
 
 #include <libcparse/function_decl.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
 extern "C" {
 # endif /*__cplusplus*/
 
+/**
+ * \brief The file ID of the unnamed file, "(null)".
+ */
+#define CPARSE_CURSOR_FILE_ID_NONE 0
+
 /**
  * \brief The cursor type describes location data for an event.
+ *
+ * The file name is interned in the file table of the parser that produced this
+ * cursor, and \p file_id is its ID in that table. The name is valid for as long
+ * as the parser is.
+ *
+ * \p begin_offset and \p end_offset are the byte offsets of the first and last
+ * characters of the event in the originating input, so the event covers
+ * \p end_offset - \p begin_offset + 1 bytes of that input. Like the columns,
+ * these are inclusive. Line and file overrides do not change these offsets.
  */
 typedef struct CPARSE_SYM(cursor) CPARSE_SYM(cursor);
 
 struct CPARSE_SYM(cursor)
 {
     const char* file;
+    uint32_t file_id;
     unsigned int begin_line;
     unsigned int begin_col;
     unsigned int end_line;
     unsigned int end_col;
+    size_t begin_offset;
+    size_t end_offset;
 };
 
 /******************************************************************************/
@@ -12,6 +12,8 @@
 #include <libcparse/cursor.h>
 #include <libcparse/event_fwd.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -31,6 +33,14 @@ struct CPARSE_SYM(event_raw_character)
     int raw_character;
 };
 
+struct CPARSE_SYM(event_raw_span)
+{
+    CPARSE_SYM(event) hdr;
+    const char* span;
+    size_t size;
+    size_t newline_count;
+};
+
 struct CPARSE_SYM(event_include)
 {
     CPARSE_SYM(event) hdr;
@@ -47,6 +57,7 @@ struct CPARSE_SYM(event_raw_string_token)
 {
     CPARSE_SYM(event) hdr;
     const char* str;
+    size_t size;
 };
 
 struct CPARSE_SYM(event_raw_character_literal)
@@ -59,6 +70,7 @@ struct CPARSE_SYM(event_identifier)
 {
     CPARSE_SYM(event) hdr;
     const char* id;
+    uint32_t symbol;
 };
 
 struct CPARSE_SYM(event_integer_token)
@@ -77,6 +89,7 @@ struct CPARSE_SYM(event_raw_integer_token)
     CPARSE_SYM(event) hdr;
     bool has_sign;
     const char* digits;
+    size_t size;
 };
 
 struct CPARSE_SYM(event_raw_float_token)
@@ -84,6 +97,7 @@ struct CPARSE_SYM(event_raw_float_token)
     CPARSE_SYM(event) hdr;
     bool has_sign;
     const char* val;
+    size_t size;
 };
 
 /* C++ compatibility. */
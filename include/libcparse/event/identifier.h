@@ -12,6 +12,8 @@
 #include <libcparse/cursor.h>
 #include <libcparse/event.h>
 #include <libcparse/function_decl.h>
+#include <libcparse/intern_table.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -45,6 +47,25 @@ CPARSE_SYM(event_identifier_init)(
     CPARSE_SYM(event_identifier)* ev, const CPARSE_SYM(cursor)* cursor,
     const char* id);
 
+/**
+ * \brief Perform an in-place initialization of an \ref event_identifier
+ * instance for an interned identifier.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param id                The interned identifier value for this event.
+ * \param symbol            The symbol ID of this identifier in its
+ *                          \ref intern_table.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_identifier_init_for_symbol)(
+    CPARSE_SYM(event_identifier)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* id, uint32_t symbol);
+
 /**
  * \brief Perform an in-place disposal of an \ref event_identifier instance.
  *
@@ -71,6 +92,17 @@ CPARSE_SYM(event_identifier_dispose)(CPARSE_SYM(event_identifier)* ev);
 const char* CPARSE_SYM(event_identifier_get)(
     const CPARSE_SYM(event_identifier)* ev);
 
+/**
+ * \brief Get the symbol ID for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the symbol ID of this identifier, or CPARSE_INTERN_TABLE_NO_SYMBOL
+ * if it was not interned.
+ */
+uint32_t CPARSE_SYM(event_identifier_symbol_get)(
+    const CPARSE_SYM(event_identifier)* ev);
+
 /**
  * \brief Attempt to downcast an \ref event to an \ref event_identifier.
  *
@@ -110,12 +142,20 @@ CPARSE_SYM(event)* CPARSE_SYM(event_identifier_upcast)(
         const char* z) { \
             return CPARSE_SYM(event_identifier_init)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## event_identifier_init_for_symbol( \
+        CPARSE_SYM(event_identifier)* x, const CPARSE_SYM(cursor)* y, \
+        const char* z, uint32_t w) { \
+            return CPARSE_SYM(event_identifier_init_for_symbol)(x,y,z,w); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## event_identifier_dispose( \
         CPARSE_SYM(event_identifier)* x) { \
             return CPARSE_SYM(event_identifier_dispose)(x); } \
     static inline const char* sym ## event_identifier_get( \
         const CPARSE_SYM(event_identifier)* x) { \
             return CPARSE_SYM(event_identifier_get)(x); } \
+    static inline uint32_t sym ## event_identifier_symbol_get( \
+        const CPARSE_SYM(event_identifier)* x) { \
+            return CPARSE_SYM(event_identifier_symbol_get)(x); } \
     static inline int FN_DECL_MUST_CHECK \
     sym ## event_downcast_to_event_identifier( \
         CPARSE_SYM(event_identifier)** x, CPARSE_SYM(event)* y) { \
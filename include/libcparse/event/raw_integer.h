@@ -23,6 +23,7 @@
 #include <libcparse/function_decl.h>
 #include <libcparse/integer_type.h>
 #include <libcparse/event/integer.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* C++ compatibility. */
@@ -57,6 +58,27 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_integer_token_init)(
     CPARSE_SYM(event_raw_integer_token)* ev, const CPARSE_SYM(cursor)* cursor,
     const char* val);
 
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_integer_token
+ * instance from a view of its value.
+ *
+ * The value is only valid for the duration of the broadcast of this event. Use
+ * \ref event_copy to keep an owned copy of it.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param val               The string representation of this token.
+ * \param size              The size of this representation in bytes, not
+ *                          counting its NUL terminator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_integer_token_init_for_view)(
+    CPARSE_SYM(event_raw_integer_token)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* val, size_t size);
+
 /**
  * \brief Perform an in-place disposal of an \ref event_raw_integer_token
  * instance.
@@ -84,6 +106,17 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_integer_token_dispose)(
 const char* CPARSE_SYM(event_raw_integer_token_string_get)(
     const CPARSE_SYM(event_raw_integer_token)* ev);
 
+/**
+ * \brief Get the size of the raw integer value.
+ *
+ * \param ev                The event for this operation.
+ *
+ * \returns the size of the raw integer value in bytes, not counting any NUL
+ * terminator.
+ */
+size_t CPARSE_SYM(event_raw_integer_token_size_get)(
+    const CPARSE_SYM(event_raw_integer_token)* ev);
+
 /**
  * \brief Set the sign flag.
  *
@@ -151,12 +184,21 @@ CPARSE_SYM(event)* CPARSE_SYM(event_raw_integer_token_upcast)(
         const char* z) { \
             return CPARSE_SYM(event_raw_integer_token_init)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## event_raw_integer_token_init_for_view( \
+        CPARSE_SYM(event_raw_integer_token)* v, const CPARSE_SYM(cursor)* w, \
+        const char* x, size_t y) { \
+            return \
+                CPARSE_SYM(event_raw_integer_token_init_for_view)(v,w,x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## event_raw_integer_token_dispose( \
         CPARSE_SYM(event_raw_integer_token)* x) { \
             return CPARSE_SYM(event_raw_integer_token_dispose)(x); } \
     static inline const char* sym ## event_raw_integer_token_string_get( \
         const CPARSE_SYM(event_raw_integer_token)* x) { \
             return CPARSE_SYM(event_raw_integer_token_string_get)(x); } \
+    static inline size_t sym ## event_raw_integer_token_size_get( \
+        const CPARSE_SYM(event_raw_integer_token)* x) { \
+            return CPARSE_SYM(event_raw_integer_token_size_get)(x); } \
     static inline int FN_DECL_MUST_CHECK \
     sym ## event_raw_integer_token_sign_set( \
         CPARSE_SYM(event_raw_integer_token)* x, bool y) { \
@@ -0,0 +1,170 @@
+/**
+ * \file libcparse/event/raw_span.h
+ *
+ * \brief The \ref event_raw_span type indicates the scan of a contiguous run of
+ * raw characters.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The raw span event type indicates the scan of a contiguous run of raw
+ * characters from a single input stream.
+ *
+ * The cursor for this event starts at the first character in the span and
+ * ends at the last character in the span.
+ */
+typedef struct CPARSE_SYM(event_raw_span) CPARSE_SYM(event_raw_span);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_span
+ * instance.
+ *
+ * \note The span is borrowed by this event, and must remain valid until this
+ * event is disposed. The number of newlines in the span is computed here.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param span              The start of the span for this event.
+ * \param size              The size of the span for this event.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_span_init)(
+    CPARSE_SYM(event_raw_span)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* span, size_t size);
+
+/**
+ * \brief Perform an in-place disposal of an \ref event_raw_span instance.
+ *
+ * \param ev                Pointer to the event to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_span_dispose)(
+    CPARSE_SYM(event_raw_span)* ev);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the start of the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the start of the span for this event.
+ */
+const char* CPARSE_SYM(event_raw_span_get)(
+    const CPARSE_SYM(event_raw_span)* ev);
+
+/**
+ * \brief Get the size of the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the size of the span for this event.
+ */
+size_t CPARSE_SYM(event_raw_span_size_get)(
+    const CPARSE_SYM(event_raw_span)* ev);
+
+/**
+ * \brief Get the number of newline characters in the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the number of newline characters in this span.
+ */
+size_t CPARSE_SYM(event_raw_span_newline_count_get)(
+    const CPARSE_SYM(event_raw_span)* ev);
+
+/**
+ * \brief Attempt to downcast an \ref event to an \ref event_raw_span.
+ *
+ * \param rs_ev             Pointer to the event pointer to receive the downcast
+ *                          instance on success.
+ * \param ev                The \ref event pointer to attempt to downcast to the
+ *                          derived type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_downcast_to_event_raw_span)(
+    CPARSE_SYM(event_raw_span)** rs_ev, CPARSE_SYM(event)* ev);
+
+/**
+ * \brief Upcast an \ref event_raw_span to an \ref event.
+ *
+ * \param ev                The \ref event_raw_span to upcast.
+ *
+ * \returns the \ref event instance for this event.
+ */
+CPARSE_SYM(event)* CPARSE_SYM(event_raw_span_upcast)(
+    CPARSE_SYM(event_raw_span)* ev);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_event_raw_span_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(event_raw_span) sym ## event_raw_span; \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_raw_span_init( \
+        CPARSE_SYM(event_raw_span)* w, const CPARSE_SYM(cursor)* x, \
+        const char* y, size_t z) { \
+            return CPARSE_SYM(event_raw_span_init)(w,x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_raw_span_dispose( \
+        CPARSE_SYM(event_raw_span)* x) { \
+            return CPARSE_SYM(event_raw_span_dispose)(x); } \
+    static inline const char* sym ## event_raw_span_get( \
+        const CPARSE_SYM(event_raw_span)* x) { \
+            return CPARSE_SYM(event_raw_span_get)(x); } \
+    static inline size_t sym ## event_raw_span_size_get( \
+        const CPARSE_SYM(event_raw_span)* x) { \
+            return CPARSE_SYM(event_raw_span_size_get)(x); } \
+    static inline size_t sym ## event_raw_span_newline_count_get( \
+        const CPARSE_SYM(event_raw_span)* x) { \
+            return CPARSE_SYM(event_raw_span_newline_count_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_downcast_to_event_raw_span( \
+        CPARSE_SYM(event_raw_span)** x, CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(event_downcast_to_event_raw_span)(x,y); } \
+    static inline CPARSE_SYM(event)* \
+    sym ## event_raw_span_upcast( \
+        CPARSE_SYM(event_raw_span)* x) { \
+            return CPARSE_SYM(event_raw_span_upcast)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_event_raw_span_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_event_raw_span_sym(sym ## _)
+#define CPARSE_IMPORT_event_raw_span \
+    __INTERNAL_CPARSE_IMPORT_event_raw_span_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
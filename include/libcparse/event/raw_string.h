@@ -14,6 +14,7 @@
 #include <libcparse/event.h>
 #include <libcparse/event/string.h>
 #include <libcparse/function_decl.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* C++ compatibility. */
@@ -65,6 +66,48 @@ CPARSE_SYM(event_raw_string_token_init_for_system_string)(
     CPARSE_SYM(event_raw_string_token)* ev, const CPARSE_SYM(cursor)* cursor,
     const char* val);
 
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_string_token
+ * instance from a view of its value.
+ *
+ * The value is only valid for the duration of the broadcast of this event. Use
+ * \ref event_copy to keep an owned copy of it.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param val               The raw string representation of this token.
+ * \param size              The size of this representation in bytes, not
+ *                          counting its NUL terminator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_string_token_init_for_view)(
+    CPARSE_SYM(event_raw_string_token)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* val, size_t size);
+
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_string_token
+ * instance for the system string type from a view of its value.
+ *
+ * The value is only valid for the duration of the broadcast of this event. Use
+ * \ref event_copy to keep an owned copy of it.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param val               The raw string representation of this token.
+ * \param size              The size of this representation in bytes, not
+ *                          counting its NUL terminator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_string_token_init_for_system_view)(
+    CPARSE_SYM(event_raw_string_token)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* val, size_t size);
+
 /**
  * \brief Perform an in-place disposal of an \ref event_raw_string_token
  * instance.
@@ -92,6 +135,17 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(event_raw_string_token_dispose)(
 const char* CPARSE_SYM(event_raw_string_token_get)(
     const CPARSE_SYM(event_raw_string_token)* ev);
 
+/**
+ * \brief Get the size of the raw string value.
+ *
+ * \param ev                The event for this operation.
+ *
+ * \returns the size of the raw string value in bytes, not counting any NUL
+ * terminator.
+ */
+size_t CPARSE_SYM(event_raw_string_token_size_get)(
+    const CPARSE_SYM(event_raw_string_token)* ev);
+
 /**
  * \brief Convert this token to a string token.
  *
@@ -153,12 +207,28 @@ CPARSE_SYM(event)* CPARSE_SYM(event_raw_string_token_upcast)(
                 CPARSE_SYM(event_raw_string_token_init_for_system_string)( \
                     x,y,z); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## event_raw_string_token_init_for_view( \
+        CPARSE_SYM(event_raw_string_token)* v, const CPARSE_SYM(cursor)* w, \
+        const char* x, size_t y) { \
+            return \
+                CPARSE_SYM(event_raw_string_token_init_for_view)(v,w,x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_raw_string_token_init_for_system_view( \
+        CPARSE_SYM(event_raw_string_token)* v, const CPARSE_SYM(cursor)* w, \
+        const char* x, size_t y) { \
+            return \
+                CPARSE_SYM(event_raw_string_token_init_for_system_view)( \
+                    v,w,x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## event_raw_string_token_dispose( \
         CPARSE_SYM(event_raw_string_token)* x) { \
             return CPARSE_SYM(event_raw_string_token_dispose)(x); } \
     static inline const char* sym ## event_raw_string_token_get( \
         const CPARSE_SYM(event_raw_string_token)* x) { \
             return CPARSE_SYM(event_raw_string_token_get)(x); } \
+    static inline size_t sym ## event_raw_string_token_size_get( \
+        const CPARSE_SYM(event_raw_string_token)* x) { \
+            return CPARSE_SYM(event_raw_string_token_size_get)(x); } \
     static inline int FN_DECL_MUST_CHECK \
     sym ## event_raw_string_token_convert( \
         CPARSE_SYM(event_string)* x, \
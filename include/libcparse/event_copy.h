@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <libcparse/allocator_fwd.h>
 #include <libcparse/event_fwd.h>
 #include <libcparse/function_decl.h>
 
@@ -41,6 +42,23 @@ typedef struct CPARSE_SYM(event_copy) CPARSE_SYM(event_copy);
 int FN_DECL_MUST_CHECK CPARSE_SYM(event_copy_create)(
     CPARSE_SYM(event_copy)** cpy, const CPARSE_SYM(event)* ev);
 
+/**
+ * \brief Create an event copy from the given event that uses the given
+ * allocator for its memory.
+ *
+ * \param cpy                   Pointer to the \ref event_copy pointer to
+ *                              receive this \ref event_copy on success.
+ * \param ev                    The event to copy.
+ * \param alloc                 The allocator for this copy, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_copy_create_with_allocator)(
+    CPARSE_SYM(event_copy)** cpy, const CPARSE_SYM(event)* ev,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release an \ref event_copy instance.
  *
@@ -77,6 +95,11 @@ const CPARSE_SYM(event)*  CPARSE_SYM(event_copy_get_event)(
     static inline int FN_DECL_MUST_CHECK sym ## event_copy_create( \
         CPARSE_SYM(event_copy)** x, const CPARSE_SYM(event)* y) { \
             return CPARSE_SYM(event_copy_create)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_copy_create_with_allocator( \
+        CPARSE_SYM(event_copy)** x, const CPARSE_SYM(event)* y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(event_copy_create_with_allocator)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK sym ## event_copy_release( \
         CPARSE_SYM(event_copy)* x) { \
             return CPARSE_SYM(event_copy_release)(x); } \
@@ -10,8 +10,12 @@
 
 #pragma once
 
+#include <libcparse/allocator_fwd.h>
 #include <libcparse/event_handler_fwd.h>
+#include <libcparse/event_type.h>
 #include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -23,6 +27,33 @@ extern "C" {
  */
 typedef struct CPARSE_SYM(event_reactor) CPARSE_SYM(event_reactor);
 
+/**
+ * \brief The number of event types that can be selected by an
+ * \ref event_reactor_filter. Every event type in \ref event_type, other than
+ * CPARSE_EVENT_TYPE_UNKNOWN, must be less than this value.
+ */
+#define CPARSE_EVENT_REACTOR_FILTER_TYPES 0x0300
+
+/**
+ * \brief The number of words in an \ref event_reactor_filter bitmap.
+ */
+#define CPARSE_EVENT_REACTOR_FILTER_WORDS \
+    ((CPARSE_EVENT_REACTOR_FILTER_TYPES + 63) / 64)
+
+/**
+ * \brief The event reactor filter is a bitmap of event types.
+ *
+ * An event handler added with a filter is only sent events whose types are set
+ * in this bitmap.
+ */
+typedef struct CPARSE_SYM(event_reactor_filter)
+CPARSE_SYM(event_reactor_filter);
+
+struct CPARSE_SYM(event_reactor_filter)
+{
+    uint64_t bits[CPARSE_EVENT_REACTOR_FILTER_WORDS];
+};
+
 /******************************************************************************/
 /* Start of constructors.                                                     */
 /******************************************************************************/
@@ -40,6 +71,22 @@ typedef struct CPARSE_SYM(event_reactor) CPARSE_SYM(event_reactor);
 int FN_DECL_MUST_CHECK
 CPARSE_SYM(event_reactor_create)(CPARSE_SYM(event_reactor)** er);
 
+/**
+ * \brief Create an \ref event_reactor instance that uses the given allocator
+ * for its memory.
+ *
+ * \param er                Pointer to the event reactor pointer to receive the
+ *                          created instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_reactor_create_with_allocator)(
+    CPARSE_SYM(event_reactor)** er, const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release an \ref event_reactor instance.
  *
@@ -69,6 +116,23 @@ CPARSE_SYM(event_reactor_release)(CPARSE_SYM(event_reactor)* er);
 int FN_DECL_MUST_CHECK CPARSE_SYM(event_reactor_add)(
     CPARSE_SYM(event_reactor)* er, const CPARSE_SYM(event_handler)* eh);
 
+/**
+ * \brief Add an \ref event_handler to the event reactor instance, which will
+ * only be sent events whose types are selected by the given filter.
+ *
+ * \param er                The event reactor for this operation.
+ * \param eh                The event handler to add to this reactor.
+ * \param filter            The filter for this handler, or NULL if this handler
+ *                          should receive all events. This filter is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(event_reactor_add_filtered)(
+    CPARSE_SYM(event_reactor)* er, const CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Broadcast an event to all event handlers in this event reactor.
  *
@@ -82,6 +146,69 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(event_reactor_add)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(event_reactor_broadcast)(
     CPARSE_SYM(event_reactor)* er, const CPARSE_SYM(event)* ev);
 
+/**
+ * \brief Check whether every handler in this event reactor accepts raw span
+ * events in place of raw character events.
+ *
+ * A handler accepts raw spans if it was added with a filter that selects
+ * CPARSE_EVENT_TYPE_RAW_SPAN, or with a filter that does not select
+ * CPARSE_EVENT_TYPE_RAW_CHARACTER. A handler added without a filter expects
+ * each character as its own event. Producers of raw characters use this check
+ * to decide whether a run of characters can be broadcast as a single span.
+ *
+ * \param er                The event reactor to query.
+ *
+ * \returns true if raw spans may be broadcast to this reactor, or false if
+ * each character must be broadcast on its own.
+ */
+bool CPARSE_SYM(event_reactor_accepts_raw_spans)(
+    const CPARSE_SYM(event_reactor)* er);
+
+/**
+ * \brief Clear an \ref event_reactor_filter, so that it selects no events.
+ *
+ * \param filter            The filter to clear.
+ */
+void CPARSE_SYM(event_reactor_filter_clear)(
+    CPARSE_SYM(event_reactor_filter)* filter);
+
+/**
+ * \brief Select an event type in an \ref event_reactor_filter.
+ *
+ * Event types outside of the range of the filter are ignored.
+ *
+ * \param filter            The filter to update.
+ * \param event_type        The event type to select.
+ */
+void CPARSE_SYM(event_reactor_filter_add_type)(
+    CPARSE_SYM(event_reactor_filter)* filter, int event_type);
+
+/**
+ * \brief Select an inclusive range of event types in an
+ * \ref event_reactor_filter.
+ *
+ * Related event types in \ref event_type are grouped together, so a range can
+ * be used to select a whole category of events, such as all comment events.
+ *
+ * \param filter            The filter to update.
+ * \param first             The first event type to select.
+ * \param last              The last event type to select.
+ */
+void CPARSE_SYM(event_reactor_filter_add_type_range)(
+    CPARSE_SYM(event_reactor_filter)* filter, int first, int last);
+
+/**
+ * \brief Check whether an event type is selected by an
+ * \ref event_reactor_filter.
+ *
+ * \param filter            The filter to query.
+ * \param event_type        The event type to check.
+ *
+ * \returns true if this event type is selected, or false otherwise.
+ */
+bool CPARSE_SYM(event_reactor_filter_has_type)(
+    const CPARSE_SYM(event_reactor_filter)* filter, int event_type);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -89,18 +216,42 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(event_reactor_broadcast)(
 #define __INTERNAL_CPARSE_IMPORT_event_reactor_sym(sym) \
     CPARSE_BEGIN_EXPORT \
     typedef CPARSE_SYM(event_reactor) sym ## event_reactor; \
+    typedef CPARSE_SYM(event_reactor_filter) sym ## event_reactor_filter; \
     static inline int FN_DECL_MUST_CHECK sym ## event_reactor_create( \
         CPARSE_SYM(event_reactor)** x) { \
             return CPARSE_SYM(event_reactor_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_reactor_create_with_allocator( \
+        CPARSE_SYM(event_reactor)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(event_reactor_create_with_allocator)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## event_reactor_release( \
         CPARSE_SYM(event_reactor)* x) { \
             return CPARSE_SYM(event_reactor_release)(x); } \
     static inline int FN_DECL_MUST_CHECK sym ## event_reactor_add( \
         CPARSE_SYM(event_reactor)* x, const CPARSE_SYM(event_handler)* y) { \
             return CPARSE_SYM(event_reactor_add)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## event_reactor_add_filtered( \
+        CPARSE_SYM(event_reactor)* x, const CPARSE_SYM(event_handler)* y, \
+        const CPARSE_SYM(event_reactor_filter)* z) { \
+            return CPARSE_SYM(event_reactor_add_filtered)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK sym ## event_reactor_broadcast( \
         CPARSE_SYM(event_reactor)* x, const CPARSE_SYM(event)* y) { \
             return CPARSE_SYM(event_reactor_broadcast)(x,y); } \
+    static inline bool sym ## event_reactor_accepts_raw_spans( \
+        const CPARSE_SYM(event_reactor)* x) { \
+            return CPARSE_SYM(event_reactor_accepts_raw_spans)(x); } \
+    static inline void sym ## event_reactor_filter_clear( \
+        CPARSE_SYM(event_reactor_filter)* x) { \
+            CPARSE_SYM(event_reactor_filter_clear)(x); } \
+    static inline void sym ## event_reactor_filter_add_type( \
+        CPARSE_SYM(event_reactor_filter)* x, int y) { \
+            CPARSE_SYM(event_reactor_filter_add_type)(x,y); } \
+    static inline void sym ## event_reactor_filter_add_type_range( \
+        CPARSE_SYM(event_reactor_filter)* x, int y, int z) { \
+            CPARSE_SYM(event_reactor_filter_add_type_range)(x,y,z); } \
+    static inline bool sym ## event_reactor_filter_has_type( \
+        const CPARSE_SYM(event_reactor_filter)* x, int y) { \
+            return CPARSE_SYM(event_reactor_filter_has_type)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_event_reactor_as(sym) \
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <libcparse/abstract_parser_fwd.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event_fwd.h>
 #include <libcparse/event_reactor_fwd.h>
@@ -44,6 +47,23 @@ typedef struct CPARSE_SYM(file_position_cache) CPARSE_SYM(file_position_cache);
 int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_create)(
     CPARSE_SYM(file_position_cache)** cache);
 
+/**
+ * \brief Create a file position cache instance that uses the given allocator
+ * for its memory.
+ *
+ * \param cache             Pointer to the \ref file_position_cache pointer to
+ *                          be populated with the created file position cache
+ *                          instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_create_with_allocator)(
+    CPARSE_SYM(file_position_cache)** cache,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a file position cache instance, releasing any internal
  * resources it may own.
@@ -64,6 +84,9 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_release)(
 /**
  * \brief Set the \ref file_position_cache file and position.
  *
+ * The file is not copied. It must remain valid for as long as it is cached,
+ * which holds for any file name interned in the parser's file table.
+ *
  * \param cache             The \ref file_position_cache instance for this
  *                          operation.
  * \param file              The file to cache.
@@ -86,6 +109,41 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_set)(
 void CPARSE_SYM(file_position_cache_clear)(
     CPARSE_SYM(file_position_cache)* cache);
 
+/**
+ * \brief Save the cached position to a checkpoint.
+ *
+ * \param ckpt              The checkpoint position to receive the cached
+ *                          position, which has no file if the cache is not
+ *                          set.
+ * \param cache             The \ref file_position_cache instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if the file name does
+ *        not fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_checkpoint_save)(
+    CPARSE_SYM(checkpoint_cursor)* ckpt,
+    const CPARSE_SYM(file_position_cache)* cache);
+
+/**
+ * \brief Restore the cached position from a checkpoint.
+ *
+ * The cache is cleared if \p ckpt has no file. Otherwise, its file is interned
+ * in the file table of \p ap and cached with this position.
+ *
+ * \param cache             The \ref file_position_cache instance to restore.
+ * \param ap                The parser whose file table receives the file.
+ * \param ckpt              The position saved to the checkpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(file_position_cache_checkpoint_restore)(
+    CPARSE_SYM(file_position_cache)* cache, CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(checkpoint_cursor)* ckpt);
+
 /**
  * \brief Get the cached file.
  *
@@ -210,6 +268,12 @@ CPARSE_SYM(file_position_cache_final_newline_token_broadcast)(
     static inline int FN_DECL_MUST_CHECK sym ## file_position_cache_create( \
         CPARSE_SYM(file_position_cache)** x) { \
             return CPARSE_SYM(file_position_cache_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## file_position_cache_create_with_allocator( \
+        CPARSE_SYM(file_position_cache)** x, \
+        const CPARSE_SYM(allocator)* y) { \
+            return \
+                CPARSE_SYM(file_position_cache_create_with_allocator)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## file_position_cache_release( \
         CPARSE_SYM(file_position_cache)* x) { \
             return CPARSE_SYM(file_position_cache_release)(x); } \
@@ -220,6 +284,17 @@ CPARSE_SYM(file_position_cache_final_newline_token_broadcast)(
     static inline void sym ## file_position_cache_clear( \
         CPARSE_SYM(file_position_cache)* x) { \
             CPARSE_SYM(file_position_cache_clear)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## file_position_cache_checkpoint_save( \
+        CPARSE_SYM(checkpoint_cursor)* x, \
+        const CPARSE_SYM(file_position_cache)* y) { \
+            return CPARSE_SYM(file_position_cache_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## file_position_cache_checkpoint_restore( \
+        CPARSE_SYM(file_position_cache)* x, CPARSE_SYM(abstract_parser)* y, \
+        const CPARSE_SYM(checkpoint_cursor)* z) { \
+            return \
+                CPARSE_SYM(file_position_cache_checkpoint_restore)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK sym ## file_position_cache_file_get( \
         CPARSE_SYM(file_position_cache)* x, const char** y) { \
             return CPARSE_SYM(file_position_cache_file_get)(x,y); } \
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <libcparse/function_decl.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -22,6 +23,11 @@ extern "C" {
  */
 typedef struct CPARSE_SYM(input_stream) CPARSE_SYM(input_stream);
 
+/**
+ * \brief The default buffer size for a buffered descriptor input stream.
+ */
+#define CPARSE_INPUT_STREAM_DEFAULT_BUFFER_SIZE (64 * 1024)
+
 /******************************************************************************/
 /* Start of constructors.                                                     */
 /******************************************************************************/
@@ -46,6 +52,60 @@ typedef struct CPARSE_SYM(input_stream) CPARSE_SYM(input_stream);
 int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_from_descriptor)(
     CPARSE_SYM(input_stream)** stream, int desc);
 
+/**
+ * \brief Create a buffered input stream instance from a Unix file descriptor.
+ *
+ * Unlike \ref input_stream_create_from_descriptor, this stream reads from the
+ * descriptor in blocks of up to \p buffer_size bytes, and serves characters
+ * from this block until it is exhausted. The EOF and error semantics are the
+ * same as the unbuffered descriptor stream.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed. This stream takes ownership of the Unix file descriptor
+ * provided in \p desc and will close it when it is released.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ * \param desc                  The Unix file descriptor for this stream.
+ * \param buffer_size           The size of the read buffer, or 0 to use
+ *                              \ref CPARSE_INPUT_STREAM_DEFAULT_BUFFER_SIZE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_from_buffered_descriptor)(
+    CPARSE_SYM(input_stream)** stream, int desc, size_t buffer_size);
+
+/**
+ * \brief Create an input stream instance from a file.
+ *
+ * If \p path names a non-empty regular file, then this file is mapped into
+ * memory read-only, and characters are served directly from the mapping. For
+ * pipes, zero-length files, special files, or files which cannot be mapped,
+ * this falls back to a buffered descriptor stream as created by
+ * \ref input_stream_create_from_buffered_descriptor.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ * \param path                  The path of the file to open.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_FILE_OPEN_ERROR if the file could not be opened.
+ *      - ERROR_LIBCPARSE_FILE_STAT if the file could not be queried.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_from_file)(
+    CPARSE_SYM(input_stream)** stream, const char* path);
+
 /**
  * \brief Create an input stream instance from a string.
  *
@@ -66,6 +126,30 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_from_descriptor)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_from_string)(
     CPARSE_SYM(input_stream)** stream, const char* str);
 
+/**
+ * \brief Create an input stream instance which is fed bytes by the caller.
+ *
+ * Bytes are appended to this stream with \ref input_stream_feed as they become
+ * available. When every fed byte has been read, reads fail with
+ * ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK until more bytes are fed, or with
+ * ERROR_LIBCPARSE_INPUT_STREAM_EOF once \ref input_stream_feed_finish has been
+ * called.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_create_for_feed)(
+    CPARSE_SYM(input_stream)** stream);
+
 /**
  * \brief Release an input stream instance, releasing any internal resources it
  * may own.
@@ -98,6 +182,69 @@ CPARSE_SYM(input_stream_release)(CPARSE_SYM(input_stream)* stream);
  */
 int CPARSE_SYM(input_stream_read)(CPARSE_SYM(input_stream)* stream, int* ch);
 
+/**
+ * \brief Read the next contiguous span of characters from the input stream.
+ *
+ * On success, \p span is set to the start of the next readable region of the
+ * stream, and \p size is set to the number of characters in this region, which
+ * is always at least one. These characters are consumed from the stream. The
+ * span is owned by the stream and remains valid until the next read from or
+ * release of this stream.
+ *
+ * Streams which do not provide a span read method are adapted so that each
+ * span contains a single character read via \ref input_stream_read.
+ *
+ * \param stream                    The input stream from which this span is
+ *                                  read.
+ * \param span                      Pointer to be populated with the start of
+ *                                  the span on success.
+ * \param size                      Pointer to be populated with the size of
+ *                                  the span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
+/**
+ * \brief Append bytes to an input stream created by
+ * \ref input_stream_create_for_feed.
+ *
+ * The bytes are copied; \p buf remains owned by the caller. Spans previously
+ * read from this stream remain valid until the next read.
+ *
+ * \param stream                    The feed stream for this operation.
+ * \param buf                       The bytes to append.
+ * \param size                      The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_BAD_CAST if \p stream is not a feed stream.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF if this stream has been finished.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_feed)(
+    CPARSE_SYM(input_stream)* stream, const void* buf, size_t size);
+
+/**
+ * \brief Mark the end of input for a stream created by
+ * \ref input_stream_create_for_feed.
+ *
+ * Once the bytes already fed have been read, this stream reports EOF.
+ *
+ * \param stream                    The feed stream for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_BAD_CAST if \p stream is not a feed stream.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(input_stream_feed_finish)(
+    CPARSE_SYM(input_stream)* stream);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -109,10 +256,24 @@ int CPARSE_SYM(input_stream_read)(CPARSE_SYM(input_stream)* stream, int* ch);
         CPARSE_SYM(input_stream)** x, int y) { \
             return CPARSE_SYM(input_stream_create_from_descriptor)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_create_from_buffered_descriptor( \
+        CPARSE_SYM(input_stream)** x, int y, size_t z) { \
+            return \
+                CPARSE_SYM(input_stream_create_from_buffered_descriptor)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_create_from_file( \
+        CPARSE_SYM(input_stream)** x, const char* y) { \
+            return CPARSE_SYM(input_stream_create_from_file)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## input_stream_create_from_string( \
         CPARSE_SYM(input_stream)** x, const char* y) { \
             return CPARSE_SYM(input_stream_create_from_string)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_create_for_feed( \
+        CPARSE_SYM(input_stream)** x) { \
+            return CPARSE_SYM(input_stream_create_for_feed)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## input_stream_release( \
         CPARSE_SYM(input_stream)* x) { \
             return CPARSE_SYM(input_stream_release)(x); } \
@@ -120,6 +281,18 @@ int CPARSE_SYM(input_stream_read)(CPARSE_SYM(input_stream)* stream, int* ch);
     sym ## input_stream_read( \
         CPARSE_SYM(input_stream)* x, int* y) { \
             return CPARSE_SYM(input_stream_read)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_read_span( \
+        CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+            return CPARSE_SYM(input_stream_read_span)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_feed( \
+        CPARSE_SYM(input_stream)* x, const void* y, size_t z) { \
+            return CPARSE_SYM(input_stream_feed)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## input_stream_feed_finish( \
+        CPARSE_SYM(input_stream)* x) { \
+            return CPARSE_SYM(input_stream_feed_finish)(x); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_input_stream_as(sym) \
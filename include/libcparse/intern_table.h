@@ -0,0 +1,186 @@
+/**
+ * \file libcparse/intern_table.h
+ *
+ * \brief Table of interned strings with dense symbol IDs.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The intern_table stores a single copy of each distinct string added
+ * to it, and assigns each such string a dense symbol ID.
+ *
+ * Symbol IDs are assigned in the order in which strings are first interned,
+ * starting at zero. Two strings are equal if and only if they have the same
+ * symbol ID in the same table. Interned strings are NUL-terminated, never move,
+ * and remain valid until the table is released.
+ */
+typedef struct CPARSE_SYM(intern_table) CPARSE_SYM(intern_table);
+
+/**
+ * \brief The symbol ID used for strings which have not been interned.
+ */
+#define CPARSE_INTERN_TABLE_NO_SYMBOL UINT32_MAX
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an \ref intern_table instance.
+ *
+ * \param table                 Pointer to the \ref intern_table pointer to set
+ *                              to the created instance on success.
+ * \param thread_safe           If true, every method on this table is guarded
+ *                              by a lock, so that parsers on several threads
+ *                              can share it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(intern_table_create)(
+    CPARSE_SYM(intern_table)** table, bool thread_safe);
+
+/**
+ * \brief Create an \ref intern_table instance that uses the given allocator
+ * for its memory.
+ *
+ * \param table                 Pointer to the \ref intern_table pointer to set
+ *                              to the created instance on success.
+ * \param thread_safe           If true, every method on this table is guarded
+ *                              by a lock, so that parsers on several threads
+ *                              can share it.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied. A thread safe table calls it under its
+ *                              lock.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(intern_table_create_with_allocator)(
+    CPARSE_SYM(intern_table)** table, bool thread_safe,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release an \ref intern_table instance, along with every string
+ * interned in it.
+ *
+ * \param table                 The \ref intern_table instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(intern_table_release)(CPARSE_SYM(intern_table)* table);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Intern a span of characters.
+ *
+ * If an equal string has already been interned, then its copy and symbol ID are
+ * returned. Otherwise, the span is copied into the table and given the next
+ * symbol ID.
+ *
+ * \param str                   Pointer to receive the interned string on
+ *                              success. This string is owned by the table.
+ * \param symbol                Pointer to receive the symbol ID on success.
+ * \param table                 The \ref intern_table for this operation.
+ * \param span                  The characters to intern.
+ * \param size                  The number of characters in \p span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(intern_table_intern)(
+    const char** str, uint32_t* symbol, CPARSE_SYM(intern_table)* table,
+    const char* span, size_t size);
+
+/**
+ * \brief Look up the interned string for a symbol ID.
+ *
+ * \param str                   Pointer to receive the interned string on
+ *                              success. This string is owned by the table.
+ * \param table                 The \ref intern_table for this operation.
+ * \param symbol                The symbol ID to look up.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL if this symbol ID has not
+ *        been assigned by this table.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(intern_table_lookup)(
+    const char** str, CPARSE_SYM(intern_table)* table, uint32_t symbol);
+
+/**
+ * \brief Get the number of distinct strings interned in this table.
+ *
+ * \param table                 The \ref intern_table to query.
+ *
+ * \returns the number of interned strings, which is also the next symbol ID.
+ */
+uint32_t CPARSE_SYM(intern_table_count)(CPARSE_SYM(intern_table)* table);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_intern_table_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(intern_table) sym ## intern_table; \
+    static inline int FN_DECL_MUST_CHECK sym ## intern_table_create( \
+        CPARSE_SYM(intern_table)** x, bool y) { \
+            return CPARSE_SYM(intern_table_create)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## intern_table_create_with_allocator( \
+        CPARSE_SYM(intern_table)** x, bool y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(intern_table_create_with_allocator)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## intern_table_release( \
+        CPARSE_SYM(intern_table)* x) { \
+            return CPARSE_SYM(intern_table_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## intern_table_intern( \
+        const char** w, uint32_t* x, CPARSE_SYM(intern_table)* y, \
+        const char* z, size_t a) { \
+            return CPARSE_SYM(intern_table_intern)(w,x,y,z,a); } \
+    static inline int FN_DECL_MUST_CHECK sym ## intern_table_lookup( \
+        const char** x, CPARSE_SYM(intern_table)* y, uint32_t z) { \
+            return CPARSE_SYM(intern_table_lookup)(x,y,z); } \
+    static inline uint32_t sym ## intern_table_count( \
+        CPARSE_SYM(intern_table)* x) { \
+            return CPARSE_SYM(intern_table_count)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_intern_table_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_intern_table_sym(sym ## _)
+#define CPARSE_IMPORT_intern_table \
+    __INTERNAL_CPARSE_IMPORT_intern_table_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/function_decl.h>
 
 /* C++ compatibility. */
@@ -51,6 +53,26 @@ CPARSE_SYM(line_wrap_filter);
 int FN_DECL_MUST_CHECK
 CPARSE_SYM(line_wrap_filter_create)(CPARSE_SYM(line_wrap_filter)** filter);
 
+/**
+ * \brief Create a line wrap filter that uses the given allocator for its
+ * memory.
+ *
+ * This filter automatically creates a raw file/line override filter and injects
+ * itself into the message chain for the parser stack.
+ *
+ * \param filter            Pointer to the \ref line_wrap_filter pointer to be
+ *                          populated with the created line wrap filter instance
+ *                          on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(line_wrap_filter_create_with_allocator)(
+    CPARSE_SYM(line_wrap_filter)** filter, const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a line wrap filter instance, releasing any internal resources
  * it may own.
@@ -78,6 +100,36 @@ CPARSE_SYM(line_wrap_filter_release)(CPARSE_SYM(line_wrap_filter)* filter);
 CPARSE_SYM(abstract_parser)* CPARSE_SYM(line_wrap_filter_upcast)(
     CPARSE_SYM(line_wrap_filter)* filter);
 
+/**
+ * \brief Save the state of a line wrap filter to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param filter            The \ref line_wrap_filter instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(line_wrap_filter_checkpoint_save)(
+    CPARSE_SYM(line_wrap_filter_checkpoint)* ckpt,
+    const CPARSE_SYM(line_wrap_filter)* filter);
+
+/**
+ * \brief Restore the state of a line wrap filter from a checkpoint.
+ *
+ * \param filter            The \ref line_wrap_filter instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(line_wrap_filter_checkpoint_restore)(
+    CPARSE_SYM(line_wrap_filter)* filter,
+    const CPARSE_SYM(line_wrap_filter_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -88,12 +140,26 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(line_wrap_filter_upcast)(
     static inline int FN_DECL_MUST_CHECK sym ## line_wrap_filter_create( \
         CPARSE_SYM(line_wrap_filter)** x) { \
             return CPARSE_SYM(line_wrap_filter_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## line_wrap_filter_create_with_allocator( \
+        CPARSE_SYM(line_wrap_filter)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(line_wrap_filter_create_with_allocator)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## line_wrap_filter_release( \
         CPARSE_SYM(line_wrap_filter)* x) { \
             return CPARSE_SYM(line_wrap_filter_release)(x); } \
     static inline CPARSE_SYM(abstract_parser)* sym ## line_wrap_filter_upcast( \
         CPARSE_SYM(line_wrap_filter)* x) { \
             return CPARSE_SYM(line_wrap_filter_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## line_wrap_filter_checkpoint_save( \
+        CPARSE_SYM(line_wrap_filter_checkpoint)* x, \
+        const CPARSE_SYM(line_wrap_filter)* y) { \
+            return CPARSE_SYM(line_wrap_filter_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## line_wrap_filter_checkpoint_restore( \
+        CPARSE_SYM(line_wrap_filter)* x, \
+        const CPARSE_SYM(line_wrap_filter_checkpoint)* y) { \
+            return CPARSE_SYM(line_wrap_filter_checkpoint_restore)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_line_wrap_filter_as(sym) \
@@ -0,0 +1,161 @@
+/**
+ * \file libcparse/message/checkpoint.h
+ *
+ * \brief Messages to save or restore a checkpoint of every parser stage.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/function_decl.h>
+#include <libcparse/message.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The checkpoint message travels down the message chain, so that each
+ * stage saves its state to, or restores its state from, its part of an
+ * \ref abstract_parser_checkpoint.
+ */
+typedef struct CPARSE_SYM(message_checkpoint)
+CPARSE_SYM(message_checkpoint);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Initialize a \ref message_checkpoint which saves each stage to the
+ * given checkpoint.
+ *
+ * \param msg               The message to initialize.
+ * \param ckpt              The checkpoint to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_checkpoint_init_for_save)(
+    CPARSE_SYM(message_checkpoint)* msg,
+    CPARSE_SYM(abstract_parser_checkpoint)* ckpt);
+
+/**
+ * \brief Initialize a \ref message_checkpoint which restores each stage from
+ * the given checkpoint.
+ *
+ * \param msg               The message to initialize.
+ * \param ckpt              The checkpoint to restore, which must outlive this
+ *                          message.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_checkpoint_init_for_restore)(
+    CPARSE_SYM(message_checkpoint)* msg,
+    const CPARSE_SYM(abstract_parser_checkpoint)* ckpt);
+
+/**
+ * \brief Dispose of a \ref message_checkpoint instance.
+ *
+ * \param msg               The message to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_checkpoint_dispose)(
+    CPARSE_SYM(message_checkpoint)* msg);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the checkpoint associated with a \ref message_checkpoint.
+ *
+ * \note A restore message must not modify this checkpoint.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the checkpoint associated with this message.
+ */
+CPARSE_SYM(abstract_parser_checkpoint)*
+CPARSE_SYM(message_checkpoint_get)(
+    const CPARSE_SYM(message_checkpoint)* msg);
+
+/**
+ * \brief Attempt to downcast a \ref message to a \ref message_checkpoint.
+ *
+ * \param ckpt_msg          Pointer to the message pointer to receive the
+ *                          downcast instance on success.
+ * \param msg               The \ref message pointer to attempt to downcast to
+ *                          the derived type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(message_downcast_to_message_checkpoint)(
+    CPARSE_SYM(message_checkpoint)** ckpt_msg, CPARSE_SYM(message)* msg);
+
+/**
+ * \brief Upcast a \ref message_checkpoint to a \ref message.
+ *
+ * \param msg               The \ref message_checkpoint to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_checkpoint_upcast)(
+    CPARSE_SYM(message_checkpoint)* msg);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_message_checkpoint_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(message_checkpoint) sym ## message_checkpoint; \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_checkpoint_init_for_save( \
+        CPARSE_SYM(message_checkpoint)* x, \
+        CPARSE_SYM(abstract_parser_checkpoint)* y) { \
+            return CPARSE_SYM(message_checkpoint_init_for_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_checkpoint_init_for_restore( \
+        CPARSE_SYM(message_checkpoint)* x, \
+        const CPARSE_SYM(abstract_parser_checkpoint)* y) { \
+            return CPARSE_SYM(message_checkpoint_init_for_restore)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_checkpoint_dispose( \
+        CPARSE_SYM(message_checkpoint)* x) { \
+            return CPARSE_SYM(message_checkpoint_dispose)(x); } \
+    static inline CPARSE_SYM(abstract_parser_checkpoint)* \
+    sym ## message_checkpoint_get( \
+        const CPARSE_SYM(message_checkpoint)* x) { \
+            return CPARSE_SYM(message_checkpoint_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_downcast_to_message_checkpoint( \
+        CPARSE_SYM(message_checkpoint)** x, CPARSE_SYM(message)* y) { \
+            return CPARSE_SYM(message_downcast_to_message_checkpoint)(x,y); } \
+    static inline CPARSE_SYM(message)* sym ## message_checkpoint_upcast( \
+        CPARSE_SYM(message_checkpoint)* x) { \
+            return CPARSE_SYM(message_checkpoint_upcast)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_message_checkpoint_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_message_checkpoint_sym(sym ## _)
+#define CPARSE_IMPORT_message_checkpoint \
+    __INTERNAL_CPARSE_IMPORT_message_checkpoint_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -9,10 +9,14 @@
 
 #pragma once
 
+#include <libcparse/checkpoint.h>
 #include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
 #include <libcparse/function_decl.h>
 #include <libcparse/input_stream.h>
 #include <libcparse/message.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -33,10 +37,24 @@ struct CPARSE_SYM(message_rss_add_input_stream)
     char* name;
 };
 
+struct CPARSE_SYM(message_rss_step)
+{
+    CPARSE_SYM(message) hdr;
+    const bool* yield;
+};
+
+struct CPARSE_SYM(message_rss_feed)
+{
+    CPARSE_SYM(message) hdr;
+    const void* buf;
+    size_t size;
+};
+
 struct CPARSE_SYM(message_subscribe)
 {
     CPARSE_SYM(message) hdr;
     CPARSE_SYM(event_handler) handler;
+    const CPARSE_SYM(event_reactor_filter)* filter;
 };
 
 struct CPARSE_SYM(message_run)
@@ -44,6 +62,11 @@ struct CPARSE_SYM(message_run)
     CPARSE_SYM(message) hdr;
 };
 
+struct CPARSE_SYM(message_rss_clear)
+{
+    CPARSE_SYM(message) hdr;
+};
+
 struct CPARSE_SYM(message_file_line_override)
 {
     CPARSE_SYM(message) hdr;
@@ -51,6 +74,12 @@ struct CPARSE_SYM(message_file_line_override)
     unsigned int line;
 };
 
+struct CPARSE_SYM(message_checkpoint)
+{
+    CPARSE_SYM(message) hdr;
+    CPARSE_SYM(abstract_parser_checkpoint)* ckpt;
+};
+
 /* C++ compatibility. */
 # ifdef   __cplusplus
 }
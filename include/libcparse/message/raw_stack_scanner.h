@@ -13,6 +13,7 @@
 #include <libcparse/input_stream.h>
 #include <libcparse/message.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -26,6 +27,27 @@ extern "C" {
 typedef struct CPARSE_SYM(message_rss_add_input_stream)
 CPARSE_SYM(message_rss_add_input_stream);
 
+/**
+ * \brief the rss_step message runs the \ref raw_stack_scanner until a yield
+ * flag is set, or until the end of input.
+ */
+typedef struct CPARSE_SYM(message_rss_step)
+CPARSE_SYM(message_rss_step);
+
+/**
+ * \brief the rss_feed message pushes bytes into the \ref raw_stack_scanner, or
+ * marks the end of fed input.
+ */
+typedef struct CPARSE_SYM(message_rss_feed)
+CPARSE_SYM(message_rss_feed);
+
+/**
+ * \brief the rss_clear message releases every input stream on the
+ * \ref raw_stack_scanner.
+ */
+typedef struct CPARSE_SYM(message_rss_clear)
+CPARSE_SYM(message_rss_clear);
+
 /******************************************************************************/
 /* Start of constructors.                                                     */
 /******************************************************************************/
@@ -61,6 +83,112 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_add_input_stream_init)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_add_input_stream_dispose)(
     CPARSE_SYM(message_rss_add_input_stream)* msg);
 
+/**
+ * \brief Initialize a \ref message_rss_step.
+ *
+ * The \ref raw_stack_scanner checks the yield flag before each character it
+ * scans. When the flag is set, the scanner returns, keeping its place in the
+ * input so that a later step or run message resumes where it left off. Once
+ * the input has been exhausted, the scanner broadcasts EOF as it would for a
+ * run message.
+ *
+ * \param msg               The message to initialize.
+ * \param yield             Pointer to the yield flag, which is typically set by
+ *                          an event handler downstream of the scanner.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_step_init)(
+    CPARSE_SYM(message_rss_step)* msg, const bool* yield);
+
+/**
+ * \brief Dispose of a \ref message_rss_step message.
+ *
+ * \param msg               The message to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_step_dispose)(
+    CPARSE_SYM(message_rss_step)* msg);
+
+/**
+ * \brief Initialize a \ref message_rss_feed.
+ *
+ * The \ref raw_stack_scanner appends these bytes to its feed stream, then scans
+ * until this stream runs dry. Any token left incomplete at the end of these
+ * bytes is resumed by the next feed message.
+ *
+ * \note The bytes are copied by the scanner; \p buf remains owned by the
+ * caller.
+ *
+ * \param msg               The message to initialize.
+ * \param buf               The bytes to feed to the scanner.
+ * \param size              The number of bytes in \p buf.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_feed_init)(
+    CPARSE_SYM(message_rss_feed)* msg, const void* buf, size_t size);
+
+/**
+ * \brief Initialize a \ref message_rss_feed which marks the end of fed input.
+ *
+ * The \ref raw_stack_scanner scans any remaining input and broadcasts EOF.
+ *
+ * \param msg               The message to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_feed_init_for_finish)(
+    CPARSE_SYM(message_rss_feed)* msg);
+
+/**
+ * \brief Dispose of a \ref message_rss_feed message.
+ *
+ * \param msg               The message to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_feed_dispose)(
+    CPARSE_SYM(message_rss_feed)* msg);
+
+/**
+ * \brief Initialize a \ref message_rss_clear.
+ *
+ * The \ref raw_stack_scanner releases every input stream on its stack,
+ * including its feed stream.
+ *
+ * \param msg               The message to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_clear_init)(
+    CPARSE_SYM(message_rss_clear)* msg);
+
+/**
+ * \brief Dispose of a \ref message_rss_clear message.
+ *
+ * \param msg               The message to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(message_rss_clear_dispose)(
+    CPARSE_SYM(message_rss_clear)* msg);
+
 /******************************************************************************/
 /* Start of public methods.                                                   */
 /******************************************************************************/
@@ -120,6 +248,100 @@ CPARSE_SYM(message_downcast_to_message_rss_add_input_stream)(
 CPARSE_SYM(message)* CPARSE_SYM(message_rss_add_input_stream_upcast)(
     CPARSE_SYM(message_rss_add_input_stream)* msg);
 
+/**
+ * \brief Get the yield flag for a \ref message_rss_step.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the yield flag pointer for this message.
+ */
+const bool* CPARSE_SYM(message_rss_step_yield_get)(
+    const CPARSE_SYM(message_rss_step)* msg);
+
+/**
+ * \brief Attempt to downcast a \ref message to a \ref message_rss_step.
+ *
+ * \param step_msg          Pointer to the message pointer to receive the
+ *                          downcast instance on success.
+ * \param msg               The \ref message pointer to attempt to downcast to
+ *                          the derived type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(message_downcast_to_message_rss_step)(
+    CPARSE_SYM(message_rss_step)** step_msg, CPARSE_SYM(message)* msg);
+
+/**
+ * \brief Upcast a \ref message_rss_step to a \ref message.
+ *
+ * \param msg               The \ref message_rss_step to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_rss_step_upcast)(
+    CPARSE_SYM(message_rss_step)* msg);
+
+/**
+ * \brief Get the buffer for a \ref message_rss_feed.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the buffer for this message, or NULL for a finish message.
+ */
+const void* CPARSE_SYM(message_rss_feed_buffer_get)(
+    const CPARSE_SYM(message_rss_feed)* msg);
+
+/**
+ * \brief Get the buffer size for a \ref message_rss_feed.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the size of the buffer for this message.
+ */
+size_t CPARSE_SYM(message_rss_feed_size_get)(
+    const CPARSE_SYM(message_rss_feed)* msg);
+
+/**
+ * \brief Attempt to downcast a \ref message to a \ref message_rss_feed.
+ *
+ * Both feed and finish messages downcast to this type.
+ *
+ * \param feed_msg          Pointer to the message pointer to receive the
+ *                          downcast instance on success.
+ * \param msg               The \ref message pointer to attempt to downcast to
+ *                          the derived type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(message_downcast_to_message_rss_feed)(
+    CPARSE_SYM(message_rss_feed)** feed_msg, CPARSE_SYM(message)* msg);
+
+/**
+ * \brief Upcast a \ref message_rss_feed to a \ref message.
+ *
+ * \param msg               The \ref message_rss_feed to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_rss_feed_upcast)(
+    CPARSE_SYM(message_rss_feed)* msg);
+
+/**
+ * \brief Upcast a \ref message_rss_clear to a \ref message.
+ *
+ * \param msg               The \ref message_rss_clear to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_rss_clear_upcast)(
+    CPARSE_SYM(message_rss_clear)* msg);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -156,6 +378,69 @@ CPARSE_SYM(message)* CPARSE_SYM(message_rss_add_input_stream_upcast)(
     sym ## message_rss_add_input_stream_upcast( \
         CPARSE_SYM(message_rss_add_input_stream)* x) { \
             return CPARSE_SYM(message_rss_add_input_stream_upcast)(x); } \
+    typedef CPARSE_SYM(message_rss_step) sym ## message_rss_step; \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_step_init( \
+        CPARSE_SYM(message_rss_step)* x, const bool* y) { \
+            return CPARSE_SYM(message_rss_step_init)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_step_dispose( \
+        CPARSE_SYM(message_rss_step)* x) { \
+            return CPARSE_SYM(message_rss_step_dispose)(x); } \
+    static inline const bool* \
+    sym ## message_rss_step_yield_get( \
+        const CPARSE_SYM(message_rss_step)* x) { \
+            return CPARSE_SYM(message_rss_step_yield_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_downcast_to_message_rss_step( \
+        CPARSE_SYM(message_rss_step)** x, CPARSE_SYM(message)* y) { \
+            return CPARSE_SYM(message_downcast_to_message_rss_step)(x,y); } \
+    static inline CPARSE_SYM(message)* \
+    sym ## message_rss_step_upcast( \
+        CPARSE_SYM(message_rss_step)* x) { \
+            return CPARSE_SYM(message_rss_step_upcast)(x); } \
+    typedef CPARSE_SYM(message_rss_feed) sym ## message_rss_feed; \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_feed_init( \
+        CPARSE_SYM(message_rss_feed)* x, const void* y, size_t z) { \
+            return CPARSE_SYM(message_rss_feed_init)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_feed_init_for_finish( \
+        CPARSE_SYM(message_rss_feed)* x) { \
+            return CPARSE_SYM(message_rss_feed_init_for_finish)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_feed_dispose( \
+        CPARSE_SYM(message_rss_feed)* x) { \
+            return CPARSE_SYM(message_rss_feed_dispose)(x); } \
+    static inline const void* \
+    sym ## message_rss_feed_buffer_get( \
+        const CPARSE_SYM(message_rss_feed)* x) { \
+            return CPARSE_SYM(message_rss_feed_buffer_get)(x); } \
+    static inline size_t \
+    sym ## message_rss_feed_size_get( \
+        const CPARSE_SYM(message_rss_feed)* x) { \
+            return CPARSE_SYM(message_rss_feed_size_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_downcast_to_message_rss_feed( \
+        CPARSE_SYM(message_rss_feed)** x, CPARSE_SYM(message)* y) { \
+            return CPARSE_SYM(message_downcast_to_message_rss_feed)(x,y); } \
+    static inline CPARSE_SYM(message)* \
+    sym ## message_rss_feed_upcast( \
+        CPARSE_SYM(message_rss_feed)* x) { \
+            return CPARSE_SYM(message_rss_feed_upcast)(x); } \
+    typedef CPARSE_SYM(message_rss_clear) sym ## message_rss_clear; \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_clear_init( \
+        CPARSE_SYM(message_rss_clear)* x) { \
+            return CPARSE_SYM(message_rss_clear_init)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## message_rss_clear_dispose( \
+        CPARSE_SYM(message_rss_clear)* x) { \
+            return CPARSE_SYM(message_rss_clear_dispose)(x); } \
+    static inline CPARSE_SYM(message)* \
+    sym ## message_rss_clear_upcast( \
+        CPARSE_SYM(message_rss_clear)* x) { \
+            return CPARSE_SYM(message_rss_clear_upcast)(x); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_message_raw_stack_scanner_as(sym) \
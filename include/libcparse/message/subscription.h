@@ -10,6 +10,7 @@
 #pragma once
 
 #include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
 #include <libcparse/function_decl.h>
 #include <libcparse/message.h>
 
@@ -127,6 +128,21 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(message_subscribe_init_for_rflo_filter)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(message_subscribe_init_for_raw_stack_scanner)(
     CPARSE_SYM(message_subscribe)* msg, CPARSE_SYM(event_handler)* handler);
 
+/**
+ * \brief Initialize a \ref message_subscribe instance for subscribing to raw
+ * span events from the raw stack scanner.
+ *
+ * \param msg               The message to initialize.
+ * \param handler           The \ref event_handler to add to this endpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(message_subscribe_init_for_raw_stack_scanner_spans)(
+    CPARSE_SYM(message_subscribe)* msg, CPARSE_SYM(event_handler)* handler);
+
 /**
  * \brief Dispose of a \ref message_subscribe instance.
  *
@@ -155,6 +171,34 @@ const CPARSE_SYM(event_handler)*
 CPARSE_SYM(message_subscribe_event_handler_get)(
     const CPARSE_SYM(message_subscribe)* msg);
 
+/**
+ * \brief Get the \ref event_reactor_filter associated with a
+ * \ref message_subscribe instance.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the \ref event_reactor_filter associated with this message, or NULL
+ * if the subscriber should receive all events.
+ */
+const CPARSE_SYM(event_reactor_filter)*
+CPARSE_SYM(message_subscribe_filter_get)(
+    const CPARSE_SYM(message_subscribe)* msg);
+
+/**
+ * \brief Set the \ref event_reactor_filter associated with a
+ * \ref message_subscribe instance.
+ *
+ * The filter is not owned by this message, and must remain valid until this
+ * message has been sent. The receiving reactor makes its own copy.
+ *
+ * \param msg               The message to update.
+ * \param filter            The filter to use, or NULL if the subscriber should
+ *                          receive all events.
+ */
+void CPARSE_SYM(message_subscribe_filter_set)(
+    CPARSE_SYM(message_subscribe)* msg,
+    const CPARSE_SYM(event_reactor_filter)* filter);
+
 /**
  * \brief Attempt to downcast a \ref message to a
  * \ref message_subscribe.
@@ -227,6 +271,13 @@ CPARSE_SYM(message)* CPARSE_SYM(message_subscribe_upcast)(
                 CPARSE_SYM(message_subscribe_init_for_raw_stack_scanner)( \
                     x,y); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## message_subscribe_init_for_raw_stack_scanner_spans(\
+        CPARSE_SYM(message_subscribe)* x, CPARSE_SYM(event_handler)* y) { \
+            return \
+                CPARSE_SYM( \
+                    message_subscribe_init_for_raw_stack_scanner_spans)( \
+                        x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## message_subscribe_dispose( \
         CPARSE_SYM(message_subscribe)* x) { \
             return CPARSE_SYM(message_subscribe_dispose)(x); } \
@@ -234,6 +285,14 @@ CPARSE_SYM(message)* CPARSE_SYM(message_subscribe_upcast)(
     sym ## message_subscribe_event_handler_get( \
         const CPARSE_SYM(message_subscribe)* x) { \
             return CPARSE_SYM(message_subscribe_event_handler_get)(x); } \
+    static inline const CPARSE_SYM(event_reactor_filter)* \
+    sym ## message_subscribe_filter_get( \
+        const CPARSE_SYM(message_subscribe)* x) { \
+            return CPARSE_SYM(message_subscribe_filter_get)(x); } \
+    static inline void sym ## message_subscribe_filter_set( \
+        CPARSE_SYM(message_subscribe)* x, \
+        const CPARSE_SYM(event_reactor_filter)* y) { \
+            CPARSE_SYM(message_subscribe_filter_set)(x,y); } \
     static inline int FN_DECL_MUST_CHECK \
     sym ## message_downcast_to_message_subscribe( \
         CPARSE_SYM(message_subscribe)** x, CPARSE_SYM(message)* y) { \
@@ -32,7 +32,14 @@ enum CPARSE_SYM(message_type)
     CPARSE_MESSAGE_TYPE_LINE_WRAP_FILTER_SUBSCRIBE =                     0x0007,
     CPARSE_MESSAGE_TYPE_NEWLINE_PRESERVING_WHITESPACE_FILTER_SUBSCRIBE = 0x0008,
     CPARSE_MESSAGE_TYPE_PREPROCESSOR_SCANNER_SUBSCRIBE =                 0x0009,
+    CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE =                             0x000A,
+    CPARSE_MESSAGE_TYPE_RSS_STEP =                                       0x000B,
+    CPARSE_MESSAGE_TYPE_RSS_FEED =                                       0x000C,
+    CPARSE_MESSAGE_TYPE_RSS_FEED_FINISH =                                0x000D,
+    CPARSE_MESSAGE_TYPE_RSS_CLEAR =                                      0x000E,
     CPARSE_MESSAGE_TYPE_RFLO_FILE_LINE_OVERRIDE =                        0x0030,
+    CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE =                                0x0040,
+    CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE =                             0x0041,
     CPARSE_MESSAGE_TYPE_UNKNOWN =                                        0xFFFF,
 };
 
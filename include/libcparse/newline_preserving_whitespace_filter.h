@@ -17,6 +17,8 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/function_decl.h>
 
 /* C++ compatibility. */
@@ -53,6 +55,27 @@ CPARSE_SYM(newline_preserving_whitespace_filter);
 int FN_DECL_MUST_CHECK CPARSE_SYM(newline_preserving_whitespace_filter_create)(
     CPARSE_SYM(newline_preserving_whitespace_filter)** filter);
 
+/**
+ * \brief Create a newline preserving whitespace filter that uses the given
+ * allocator for its memory.
+ *
+ * This filter automatically creates a comment filter and injects itself into
+ * the message chain for the parser stack.
+ *
+ * \param filter            Pointer to the
+ *                          \ref newline_preserving_whitespace_filter pointer to
+ *                          be populated with the filter instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(newline_preserving_whitespace_filter_create_with_allocator)(
+    CPARSE_SYM(newline_preserving_whitespace_filter)** filter,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a newline preserving whitespace filter instance, releasing any
  * internal resources it may own.
@@ -83,6 +106,42 @@ CPARSE_SYM(abstract_parser)*
 CPARSE_SYM(newline_preserving_whitespace_filter_upcast)(
     CPARSE_SYM(newline_preserving_whitespace_filter)* filter);
 
+/**
+ * \brief Save the state of a newline preserving whitespace filter to a
+ * checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param filter            The \ref newline_preserving_whitespace_filter
+ *                          instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint_save)(
+    CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)* ckpt,
+    const CPARSE_SYM(newline_preserving_whitespace_filter)* filter);
+
+/**
+ * \brief Restore the state of a newline preserving whitespace filter from a
+ * checkpoint.
+ *
+ * \param filter            The \ref newline_preserving_whitespace_filter
+ *                          instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint_restore)(
+    CPARSE_SYM(newline_preserving_whitespace_filter)* filter,
+    const CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -97,6 +156,13 @@ CPARSE_SYM(newline_preserving_whitespace_filter_upcast)(
             return \
                 CPARSE_SYM(newline_preserving_whitespace_filter_create)(x); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## newline_preserving_whitespace_filter_create_with_allocator( \
+        CPARSE_SYM(newline_preserving_whitespace_filter)** x, \
+        const CPARSE_SYM(allocator)* y) { \
+            return \
+                CPARSE_SYM(newline_preserving_whitespace_filter_create_with_allocator)( \
+                    x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## newline_preserving_whitespace_filter_release( \
         CPARSE_SYM(newline_preserving_whitespace_filter)* x) { \
             return \
@@ -106,6 +172,23 @@ CPARSE_SYM(newline_preserving_whitespace_filter_upcast)(
         CPARSE_SYM(newline_preserving_whitespace_filter)* x) { \
             return \
                 CPARSE_SYM(newline_preserving_whitespace_filter_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## newline_preserving_whitespace_filter_checkpoint_save( \
+        CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)* x, \
+        const CPARSE_SYM(newline_preserving_whitespace_filter)* y) { \
+            return \
+                CPARSE_SYM( \
+                    newline_preserving_whitespace_filter_checkpoint_save)( \
+                        x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## newline_preserving_whitespace_filter_checkpoint_restore( \
+        CPARSE_SYM(newline_preserving_whitespace_filter)* x, \
+        const CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)* \
+            y) { \
+            return \
+                CPARSE_SYM( \
+                    newline_preserving_whitespace_filter_checkpoint_restore)( \
+                        x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_newline_preserving_whitespace_filter_as(sym) \
@@ -0,0 +1,207 @@
+/**
+ * \file libcparse/parse_pool.h
+ *
+ * \brief The parse pool parses many independent files in parallel.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/function_decl.h>
+#include <libcparse/intern_table.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The parse_pool runs one independent parser stack per file on a set of
+ * worker threads.
+ *
+ * Each worker owns a queue of files. A worker that runs out of files steals
+ * work from the back of another worker's queue, so that a few large files do
+ * not leave the other workers idle.
+ *
+ * \note The library keeps no mutable static state; the keyword and prefix
+ * tables used by the scanners are read-only. Separate parser stacks can
+ * therefore run concurrently on separate threads. A single parser stack, and
+ * every handler subscribed to it, must only be used by one thread at a time.
+ */
+typedef struct CPARSE_SYM(parse_pool) CPARSE_SYM(parse_pool);
+
+/**
+ * \brief The order in which \ref parse_pool results are delivered.
+ */
+enum CPARSE_SYM(parse_pool_order)
+{
+    /* deliver results in the order that the paths were given. */
+    CPARSE_PARSE_POOL_ORDER_INPUT =                                      0x0000,
+    /* deliver results as soon as each file is parsed. */
+    CPARSE_PARSE_POOL_ORDER_COMPLETION =                                 0x0001,
+};
+
+/**
+ * \brief Set up the parser stack for a file.
+ *
+ * This callback is called on a worker thread, before the file is parsed. It
+ * should subscribe to the stages of the parser stack that it is interested in.
+ * Handlers subscribed here are only ever called on this worker thread.
+ *
+ * \param context           The user context passed to \ref parse_pool_run.
+ * \param ap                The \ref abstract_parser for this file.
+ * \param index             The index of this file in the path list.
+ * \param path              The path of this file.
+ *
+ * \returns a status code indicating success or failure. A failure skips
+ * parsing this file and is reported as the status of this file.
+ */
+typedef int (*CPARSE_SYM(parse_pool_setup_fn))(
+    void* context, CPARSE_SYM(abstract_parser)* ap, size_t index,
+    const char* path);
+
+/**
+ * \brief Receive the result of parsing a file.
+ *
+ * This callback is always called on the thread that called
+ * \ref parse_pool_run, one result at a time.
+ *
+ * \param context           The user context passed to \ref parse_pool_run.
+ * \param index             The index of this file in the path list.
+ * \param path              The path of this file.
+ * \param status            The status of setting up and parsing this file.
+ *
+ * \returns a status code indicating success or failure. A failure cancels
+ * the remaining files and is returned from \ref parse_pool_run.
+ */
+typedef int (*CPARSE_SYM(parse_pool_result_fn))(
+    void* context, size_t index, const char* path, int status);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a parse pool.
+ *
+ * \param pool              Pointer to the \ref parse_pool pointer to be
+ *                          populated with the created pool on success.
+ * \param threads           The number of worker threads to use, or 0 to use
+ *                          one worker per online processor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(parse_pool_create)(
+    CPARSE_SYM(parse_pool)** pool, size_t threads);
+
+/**
+ * \brief Release a parse pool.
+ *
+ * \param pool              The \ref parse_pool instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(parse_pool_release)(
+    CPARSE_SYM(parse_pool)* pool);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the number of worker threads used by this pool.
+ *
+ * \param pool              The \ref parse_pool instance to query.
+ *
+ * \returns the number of worker threads.
+ */
+size_t CPARSE_SYM(parse_pool_thread_count)(const CPARSE_SYM(parse_pool)* pool);
+
+/**
+ * \brief Get the thread safe \ref intern_table shared by every file parsed by
+ * this pool.
+ *
+ * Identifiers have the same symbol ID in every file parsed by this pool, and
+ * their strings remain valid until the pool is released.
+ *
+ * \param pool              The \ref parse_pool instance to query.
+ *
+ * \returns the shared \ref intern_table for this pool.
+ */
+CPARSE_SYM(intern_table)* CPARSE_SYM(parse_pool_intern_table_get)(
+    CPARSE_SYM(parse_pool)* pool);
+
+/**
+ * \brief Parse a list of files.
+ *
+ * Each file is parsed by its own \ref preprocessor_scanner stack on a worker
+ * thread. The setup callback is called for each file before it is parsed, and
+ * the result callback is called for each file after it is parsed, in the given
+ * order. This call returns once every file has been reported.
+ *
+ * \param pool              The \ref parse_pool instance for this operation.
+ * \param paths             The paths of the files to parse.
+ * \param count             The number of paths.
+ * \param order             The \ref parse_pool_order for results.
+ * \param setup             The setup callback.
+ * \param result            The result callback.
+ * \param context           The user context for both callbacks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success. Individual file failures are reported to
+ *        the result callback, and do not fail the run.
+ *      - ERROR_LIBCPARSE_PARSE_POOL_BAD_ORDER if the order is invalid.
+ *      - the first failure returned by the result callback.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(parse_pool_run)(
+    CPARSE_SYM(parse_pool)* pool, const char* const* paths, size_t count,
+    int order, CPARSE_SYM(parse_pool_setup_fn) setup,
+    CPARSE_SYM(parse_pool_result_fn) result, void* context);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_parse_pool_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(parse_pool) sym ## parse_pool; \
+    typedef CPARSE_SYM(parse_pool_setup_fn) sym ## parse_pool_setup_fn; \
+    typedef CPARSE_SYM(parse_pool_result_fn) sym ## parse_pool_result_fn; \
+    static inline int FN_DECL_MUST_CHECK sym ## parse_pool_create( \
+        CPARSE_SYM(parse_pool)** x, size_t y) { \
+            return CPARSE_SYM(parse_pool_create)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## parse_pool_release( \
+        CPARSE_SYM(parse_pool)* x) { \
+            return CPARSE_SYM(parse_pool_release)(x); } \
+    static inline size_t sym ## parse_pool_thread_count( \
+        const CPARSE_SYM(parse_pool)* x) { \
+            return CPARSE_SYM(parse_pool_thread_count)(x); } \
+    static inline CPARSE_SYM(intern_table)* \
+    sym ## parse_pool_intern_table_get( \
+        CPARSE_SYM(parse_pool)* x) { \
+            return CPARSE_SYM(parse_pool_intern_table_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## parse_pool_run( \
+        CPARSE_SYM(parse_pool)* v, const char* const* w, size_t x, int y, \
+        CPARSE_SYM(parse_pool_setup_fn) z1, \
+        CPARSE_SYM(parse_pool_result_fn) z2, void* z3) { \
+            return CPARSE_SYM(parse_pool_run)(v,w,x,y,z1,z2,z3); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_parse_pool_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_parse_pool_sym(sym ## _)
+#define CPARSE_IMPORT_parse_pool \
+    __INTERNAL_CPARSE_IMPORT_parse_pool_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -12,6 +12,11 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/arena.h>
+#include <libcparse/checkpoint.h>
+#include <libcparse/intern_table.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -25,6 +30,12 @@ extern "C" {
 typedef struct CPARSE_SYM(preprocessor_scanner)
 CPARSE_SYM(preprocessor_scanner);
 
+/**
+ * \brief The default number of in-flight events for a pipelined
+ * \ref preprocessor_scanner.
+ */
+#define CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY 4096
+
 /******************************************************************************/
 /* Start of constructors.                                                     */
 /******************************************************************************/
@@ -46,10 +57,132 @@ CPARSE_SYM(preprocessor_scanner);
 int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_create)(
     CPARSE_SYM(preprocessor_scanner)** scanner);
 
+/**
+ * \brief Create a preprocessor scanner that uses the given allocator for its
+ * memory.
+ *
+ * This scanner automatically creates a newline preserving whitespace filter and
+ * injects itself into the message chain for the parser stack.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(preprocessor_scanner_create_with_allocator)(
+    CPARSE_SYM(preprocessor_scanner)** scanner,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Create a preprocessor scanner that allocates itself and every stage
+ * under it from an arena owned by this scanner.
+ *
+ * Memory freed during a parse is only reclaimed when this scanner is released,
+ * which releases the arena and all of its blocks at once, without releasing
+ * each stage in turn. This suits short-lived parses of a single file. To reuse
+ * the same blocks across parses, see
+ * \ref preprocessor_scanner_create_in_arena.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param block_size        The size of each arena block, or 0 to use
+ *                          CPARSE_ARENA_DEFAULT_BLOCK_SIZE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_create_with_arena)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t block_size);
+
+/**
+ * \brief Create a preprocessor scanner that allocates itself and every stage
+ * under it from the given arena, which remains owned by the caller.
+ *
+ * Releasing this scanner only releases what lives outside of the arena, such
+ * as its input streams. The caller can then reset the arena with
+ * \ref arena_reset and create the scanner for the next parse in the same
+ * blocks, or release the arena.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param a                 The \ref arena to allocate from, which must outlive
+ *                          this scanner.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_create_in_arena)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, CPARSE_SYM(arena)* a);
+
+/**
+ * \brief Create a pipelined preprocessor scanner.
+ *
+ * This behaves like \ref preprocessor_scanner_create, except that a run
+ * message executes the character-level stages of the parser stack (the raw
+ * scanner through the newline preserving whitespace filter) on a producer
+ * thread. Their events are copied onto a lock-free ring and scanned on the
+ * thread that sent the run message, so preprocessor scanner subscribers see the
+ * same events in the same order, on the same thread, as in serial mode.
+ *
+ * Subscribers to the earlier stages are called on the producer thread. These
+ * must not send messages to the parser stack during a pipelined run. If a
+ * preprocessor scanner subscriber fails, the producer is stopped and the
+ * subscriber's status code is returned.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param capacity          The number of events that can be in flight between
+ *                          the two threads, or 0 to use
+ *                          CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_create_pipelined)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t capacity);
+
+/**
+ * \brief Create a pipelined preprocessor scanner that uses the given allocator
+ * for its memory.
+ *
+ * Event copies are allocated on the producer thread and released on the thread
+ * that sent the run message, so this allocator must be safe to call from both.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param capacity          The number of events that can be in flight between
+ *                          the two threads, or 0 to use
+ *                          CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(preprocessor_scanner_create_pipelined_with_allocator)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t capacity,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a preprocessor scanner instance, releasing any internal
  * resources it may own.
  *
+ * A scanner created in an arena only releases the resources that live outside
+ * of the arena, and then releases the arena if it owns it.
+ *
  * \param scanner           The \ref preprocessor_scanner instance to release.
  *
  * \returns a status code indicating success or failure.
@@ -73,6 +206,72 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_release)(
 CPARSE_SYM(abstract_parser)* CPARSE_SYM(preprocessor_scanner_upcast)(
     CPARSE_SYM(preprocessor_scanner)* scanner);
 
+/**
+ * \brief Get the \ref intern_table used by this scanner for identifiers.
+ *
+ * Identifier events carry strings owned by this table, along with their symbol
+ * IDs. By default, each scanner owns a table which is released with it.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to query.
+ *
+ * \returns the \ref intern_table for this scanner.
+ */
+CPARSE_SYM(intern_table)* CPARSE_SYM(preprocessor_scanner_intern_table_get)(
+    CPARSE_SYM(preprocessor_scanner)* scanner);
+
+/**
+ * \brief Use a shared \ref intern_table for identifiers.
+ *
+ * The scanner releases the table it owns and borrows the given table instead,
+ * so that several scanners can assign the same symbol IDs. The shared table
+ * must outlive this scanner, and must be thread safe if scanners on other
+ * threads use it. This must be called before any input is scanned.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to update.
+ * \param table             The shared \ref intern_table to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_intern_table_set)(
+    CPARSE_SYM(preprocessor_scanner)* scanner,
+    CPARSE_SYM(intern_table)* table);
+
+/**
+ * \brief Save the state of a preprocessor scanner to a checkpoint.
+ *
+ * This includes the characters of any partial token.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref preprocessor_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG if the partial token is
+ *        longer than \ref CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does
+ *        not fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_checkpoint_save)(
+    CPARSE_SYM(preprocessor_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(preprocessor_scanner)* scanner);
+
+/**
+ * \brief Restore the state of a preprocessor scanner from a checkpoint.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(preprocessor_scanner_checkpoint_restore)(
+    CPARSE_SYM(preprocessor_scanner)* scanner,
+    const CPARSE_SYM(preprocessor_scanner_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -84,6 +283,31 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(preprocessor_scanner_upcast)(
     sym ## preprocessor_scanner_create( \
         CPARSE_SYM(preprocessor_scanner)** x) { \
             return CPARSE_SYM(preprocessor_scanner_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_create_with_allocator( \
+        CPARSE_SYM(preprocessor_scanner)** x, \
+        const CPARSE_SYM(allocator)* y) { \
+            return \
+                CPARSE_SYM(preprocessor_scanner_create_with_allocator)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_create_pipelined( \
+        CPARSE_SYM(preprocessor_scanner)** x, size_t y) { \
+            return CPARSE_SYM(preprocessor_scanner_create_pipelined)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_create_pipelined_with_allocator( \
+        CPARSE_SYM(preprocessor_scanner)** x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return \
+                CPARSE_SYM(preprocessor_scanner_create_pipelined_with_allocator)( \
+                    x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_create_with_arena( \
+        CPARSE_SYM(preprocessor_scanner)** x, size_t y) { \
+            return CPARSE_SYM(preprocessor_scanner_create_with_arena)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_create_in_arena( \
+        CPARSE_SYM(preprocessor_scanner)** x, CPARSE_SYM(arena)* y) { \
+            return CPARSE_SYM(preprocessor_scanner_create_in_arena)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## preprocessor_scanner_release( \
         CPARSE_SYM(preprocessor_scanner)* x) { \
             return CPARSE_SYM(preprocessor_scanner_release)(x); } \
@@ -91,6 +315,24 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(preprocessor_scanner_upcast)(
     sym ## preprocessor_scanner_upcast( \
         CPARSE_SYM(preprocessor_scanner)* x) { \
             return CPARSE_SYM(preprocessor_scanner_upcast)(x); } \
+    static inline CPARSE_SYM(intern_table)* \
+    sym ## preprocessor_scanner_intern_table_get( \
+        CPARSE_SYM(preprocessor_scanner)* x) { \
+            return CPARSE_SYM(preprocessor_scanner_intern_table_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_intern_table_set( \
+        CPARSE_SYM(preprocessor_scanner)* x, CPARSE_SYM(intern_table)* y) { \
+            return CPARSE_SYM(preprocessor_scanner_intern_table_set)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_checkpoint_save( \
+        CPARSE_SYM(preprocessor_scanner_checkpoint)* x, \
+        const CPARSE_SYM(preprocessor_scanner)* y) { \
+            return CPARSE_SYM(preprocessor_scanner_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## preprocessor_scanner_checkpoint_restore( \
+        CPARSE_SYM(preprocessor_scanner)* x, \
+        const CPARSE_SYM(preprocessor_scanner_checkpoint)* y) { \
+            return CPARSE_SYM(preprocessor_scanner_checkpoint_restore)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_preprocessor_scanner_as(sym) \
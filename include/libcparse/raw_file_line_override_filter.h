@@ -15,6 +15,8 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/function_decl.h>
 
 /* C++ compatibility. */
@@ -49,6 +51,27 @@ CPARSE_SYM(raw_file_line_override_filter);
 int FN_DECL_MUST_CHECK CPARSE_SYM(raw_file_line_override_filter_create)(
     CPARSE_SYM(raw_file_line_override_filter)** filter);
 
+/**
+ * \brief Create a raw file/line override filter that uses the given allocator
+ * for its memory.
+ *
+ * This filter automatically creates a raw stack scanner and injects itself into
+ * the message chain for that scanner.
+ *
+ * \param filter            Pointer to the \ref raw_file_line_override_filter
+ *                          pointer to be populated with the created raw
+ *                          file/line override filter instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_file_line_override_filter_create_with_allocator)(
+    CPARSE_SYM(raw_file_line_override_filter)** filter,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a raw file/line override filter instance, releasing any
  * internal resources it may own.
@@ -78,6 +101,40 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(raw_file_line_override_filter_release)(
 CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_file_line_override_filter_upcast)(
     CPARSE_SYM(raw_file_line_override_filter)* filter);
 
+/**
+ * \brief Save the state of a raw file/line override filter to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param filter            The \ref raw_file_line_override_filter instance to
+ *                          save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_file_line_override_filter_checkpoint_save)(
+    CPARSE_SYM(raw_file_line_override_filter_checkpoint)* ckpt,
+    const CPARSE_SYM(raw_file_line_override_filter)* filter);
+
+/**
+ * \brief Restore the state of a raw file/line override filter from a
+ * checkpoint.
+ *
+ * \param filter            The \ref raw_file_line_override_filter instance to
+ *                          restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_file_line_override_filter_checkpoint_restore)(
+    CPARSE_SYM(raw_file_line_override_filter)* filter,
+    const CPARSE_SYM(raw_file_line_override_filter_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -91,6 +148,13 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_file_line_override_filter_upcast)(
         CPARSE_SYM(raw_file_line_override_filter)** x) { \
             return CPARSE_SYM(raw_file_line_override_filter_create)(x); } \
     static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_file_line_override_filter_create_with_allocator( \
+        CPARSE_SYM(raw_file_line_override_filter)** x, \
+        const CPARSE_SYM(allocator)* y) { \
+            return \
+                CPARSE_SYM(raw_file_line_override_filter_create_with_allocator)( \
+                    x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
     sym ## raw_file_line_override_filter_release( \
         CPARSE_SYM(raw_file_line_override_filter)* x) { \
             return CPARSE_SYM(raw_file_line_override_filter_release)(x); } \
@@ -98,6 +162,20 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_file_line_override_filter_upcast)(
     sym ## raw_file_line_override_filter_upcast( \
         CPARSE_SYM(raw_file_line_override_filter)* x) { \
             return CPARSE_SYM(raw_file_line_override_filter_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_file_line_override_filter_checkpoint_save( \
+        CPARSE_SYM(raw_file_line_override_filter_checkpoint)* x, \
+        const CPARSE_SYM(raw_file_line_override_filter)* y) { \
+            return \
+                CPARSE_SYM(raw_file_line_override_filter_checkpoint_save)( \
+                    x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_file_line_override_filter_checkpoint_restore( \
+        CPARSE_SYM(raw_file_line_override_filter)* x, \
+        const CPARSE_SYM(raw_file_line_override_filter_checkpoint)* y) { \
+            return \
+                CPARSE_SYM(raw_file_line_override_filter_checkpoint_restore)( \
+                    x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_raw_file_line_override_filter_as(sym) \
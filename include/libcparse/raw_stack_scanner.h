@@ -12,6 +12,8 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/checkpoint.h>
 #include <libcparse/event.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/event_type.h>
@@ -47,6 +49,24 @@ typedef struct CPARSE_SYM(raw_stack_scanner) CPARSE_SYM(raw_stack_scanner);
 int FN_DECL_MUST_CHECK CPARSE_SYM(raw_stack_scanner_create)(
     CPARSE_SYM(raw_stack_scanner)** scanner);
 
+/**
+ * \brief Create a raw stack scanner that uses the given allocator for its
+ * memory.
+ *
+ * \param scanner           Pointer to the \ref raw_stack_scanner pointer to be
+ *                          populated with the created raw stack scanner on
+ *                          success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_stack_scanner_create_with_allocator)(
+    CPARSE_SYM(raw_stack_scanner)** scanner,
+    const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a raw stack scanner instance, releasing any internal resources
  * it may own.
@@ -74,6 +94,42 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(raw_stack_scanner_release)(
 CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_stack_scanner_upcast)(
     CPARSE_SYM(raw_stack_scanner)* scanner);
 
+/**
+ * \brief Save the position of a raw stack scanner to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref raw_stack_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(raw_stack_scanner_checkpoint_save)(
+    CPARSE_SYM(raw_stack_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(raw_stack_scanner)* scanner);
+
+/**
+ * \brief Restore the position of a raw stack scanner from a checkpoint.
+ *
+ * The input stream on top of the stack must hold the input that follows the
+ * checkpoint offset. Its position is set to the checkpoint position, so that
+ * the events scanned from it have the same cursors as those scanned after the
+ * checkpoint was saved.
+ *
+ * \param scanner           The \ref raw_stack_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if there is no input stream, or if
+ *        characters already read from the top input stream are pending.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(raw_stack_scanner_checkpoint_restore)(
+    CPARSE_SYM(raw_stack_scanner)* scanner,
+    const CPARSE_SYM(raw_stack_scanner_checkpoint)* ckpt);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -83,6 +139,10 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_stack_scanner_upcast)(
     static inline int FN_DECL_MUST_CHECK sym ## raw_stack_scanner_create( \
         CPARSE_SYM(raw_stack_scanner)** x) { \
             return CPARSE_SYM(raw_stack_scanner_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_stack_scanner_create_with_allocator( \
+        CPARSE_SYM(raw_stack_scanner)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(raw_stack_scanner_create_with_allocator)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## raw_stack_scanner_release( \
         CPARSE_SYM(raw_stack_scanner)* x) { \
             return CPARSE_SYM(raw_stack_scanner_release)(x); } \
@@ -90,6 +150,16 @@ CPARSE_SYM(abstract_parser)* CPARSE_SYM(raw_stack_scanner_upcast)(
     sym ## raw_stack_scanner_upcast( \
         CPARSE_SYM(raw_stack_scanner)* x) { \
             return CPARSE_SYM(raw_stack_scanner_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_stack_scanner_checkpoint_save( \
+        CPARSE_SYM(raw_stack_scanner_checkpoint)* x, \
+        const CPARSE_SYM(raw_stack_scanner)* y) { \
+            return CPARSE_SYM(raw_stack_scanner_checkpoint_save)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## raw_stack_scanner_checkpoint_restore( \
+        CPARSE_SYM(raw_stack_scanner)* x, \
+        const CPARSE_SYM(raw_stack_scanner_checkpoint)* y) { \
+            return CPARSE_SYM(raw_stack_scanner_checkpoint_restore)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_raw_stack_scanner_as(sym) \
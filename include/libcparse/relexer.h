@@ -0,0 +1,215 @@
+/**
+ * \file libcparse/relexer.h
+ *
+ * \brief Incremental re-scanning of an edited document.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/event_fwd.h>
+#include <libcparse/event_handler_fwd.h>
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The relexer keeps a document along with the events that a
+ * \ref preprocessor_scanner produces for it, so that an edit to the document
+ * only re-scans the region that the edit affects.
+ *
+ * Every few events, the relexer saves a checkpoint of the scanner stages. An
+ * edit restores the last checkpoint at or before the edit and scans forward
+ * from it. As soon as the scanner reaches a checkpoint after the edit in the
+ * same state as before, the rest of the recorded events are kept, with their
+ * positions shifted by the edit. Only the events that were removed or added
+ * are reported.
+ */
+typedef struct CPARSE_SYM(relexer) CPARSE_SYM(relexer);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a \ref relexer instance with an empty document.
+ *
+ * \param rl                    Pointer to the \ref relexer pointer to set to
+ *                              the created instance on success.
+ * \param name                  The file name of the document, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(relexer_create)(CPARSE_SYM(relexer)** rl, const char* name);
+
+/**
+ * \brief Create a \ref relexer instance with an empty document that uses the
+ * given allocator.
+ *
+ * \param rl                    Pointer to the \ref relexer pointer to set to
+ *                              the created instance on success.
+ * \param name                  The file name of the document, which is
+ *                              copied.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(relexer_create_with_allocator)(
+    CPARSE_SYM(relexer)** rl, const char* name,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a \ref relexer instance, along with its document and events.
+ *
+ * \param rl                    The \ref relexer instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(relexer_release)(CPARSE_SYM(relexer)* rl);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Replace the document of a \ref relexer and scan all of it.
+ *
+ * The events recorded for the previous document are discarded without being
+ * reported. Every event of the new document, including its EOF event, is sent
+ * to \p added.
+ *
+ * \param rl                    The \ref relexer for this operation.
+ * \param data                  The new document, which is copied.
+ * \param size                  The size of the new document.
+ * \param added                 The handler for the events of the new document,
+ *                              or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from scanning or from a handler.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(relexer_scan)(
+    CPARSE_SYM(relexer)* rl, const void* data, size_t size,
+    CPARSE_SYM(event_handler)* added);
+
+/**
+ * \brief Replace a range of the document of a \ref relexer, and re-scan the
+ * region that this edit affects.
+ *
+ * The events that no longer occur are sent to \p removed, with the positions
+ * that they had before the edit. Then the events that replace them are sent
+ * to \p added, with their positions after the edit. Events that are unchanged
+ * are not reported, even if the edit moved them.
+ *
+ * If scanning the edited document fails, the document and its events are left
+ * as they were. If a handler fails, the edit has still been applied.
+ *
+ * \param rl                    The \ref relexer for this operation.
+ * \param offset                The byte offset of the edit.
+ * \param removed_size          The number of bytes removed at \p offset.
+ * \param inserted              The bytes inserted at \p offset, which are
+ *                              copied.
+ * \param inserted_size         The number of bytes inserted at \p offset.
+ * \param removed               The handler for removed events, or NULL.
+ * \param added                 The handler for added events, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_RELEXER_BAD_EDIT if the removed range is not within
+ *        the document.
+ *      - a non-zero error code from scanning or from a handler.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(relexer_edit)(
+    CPARSE_SYM(relexer)* rl, size_t offset, size_t removed_size,
+    const void* inserted, size_t inserted_size,
+    CPARSE_SYM(event_handler)* removed, CPARSE_SYM(event_handler)* added);
+
+/**
+ * \brief Get the number of events recorded for the document of a
+ * \ref relexer.
+ *
+ * \param rl                    The \ref relexer to query.
+ *
+ * \returns the number of events, including the EOF event once the document
+ * has been scanned.
+ */
+size_t CPARSE_SYM(relexer_event_count_get)(const CPARSE_SYM(relexer)* rl);
+
+/**
+ * \brief Get an event recorded for the document of a \ref relexer.
+ *
+ * The event remains valid until the next scan or edit.
+ *
+ * \param rl                    The \ref relexer to query.
+ * \param index                 The index of the event, which must be less than
+ *                              the event count.
+ *
+ * \returns the event at this index.
+ */
+const CPARSE_SYM(event)* CPARSE_SYM(relexer_event_get)(
+    const CPARSE_SYM(relexer)* rl, size_t index);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_relexer_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(relexer) sym ## relexer; \
+    static inline int FN_DECL_MUST_CHECK sym ## relexer_create( \
+        CPARSE_SYM(relexer)** x, const char* y) { \
+            return CPARSE_SYM(relexer_create)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## relexer_create_with_allocator( \
+        CPARSE_SYM(relexer)** x, const char* y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(relexer_create_with_allocator)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## relexer_release( \
+        CPARSE_SYM(relexer)* x) { \
+            return CPARSE_SYM(relexer_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## relexer_scan( \
+        CPARSE_SYM(relexer)* w, const void* x, size_t y, \
+        CPARSE_SYM(event_handler)* z) { \
+            return CPARSE_SYM(relexer_scan)(w,x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## relexer_edit( \
+        CPARSE_SYM(relexer)* t, size_t u, size_t v, const void* w, \
+        size_t x, CPARSE_SYM(event_handler)* y, \
+        CPARSE_SYM(event_handler)* z) { \
+            return CPARSE_SYM(relexer_edit)(t,u,v,w,x,y,z); } \
+    static inline size_t sym ## relexer_event_count_get( \
+        const CPARSE_SYM(relexer)* x) { \
+            return CPARSE_SYM(relexer_event_count_get)(x); } \
+    static inline const CPARSE_SYM(event)* sym ## relexer_event_get( \
+        const CPARSE_SYM(relexer)* x, size_t y) { \
+            return CPARSE_SYM(relexer_event_get)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_relexer_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_relexer_sym(sym ## _)
+#define CPARSE_IMPORT_relexer \
+    __INTERNAL_CPARSE_IMPORT_relexer_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
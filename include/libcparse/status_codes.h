@@ -46,4 +46,21 @@ enum CPARSE_SYM(status_code)
     ERROR_LIBCPARSE_OUT_OF_BOUNDS =                                     1029,
     ERROR_LIBCPARSE_EVENT_COPY_UNSUPPORTED_EVENT_CATEGORY =             1030,
     ERROR_LIBCPARSE_AVL_TREE_ELEMENT_NOT_FOUND =                        1031,
+    ERROR_LIBCPARSE_FILE_STAT =                                         1032,
+    ERROR_LIBCPARSE_EVENT_RING_CLOSED =                                 1033,
+    ERROR_LIBCPARSE_EVENT_RING_FINISHED =                               1034,
+    ERROR_LIBCPARSE_THREAD_CREATE =                                     1035,
+    ERROR_LIBCPARSE_PARSE_POOL_BAD_ORDER =                              1036,
+    ERROR_LIBCPARSE_TOKEN_ITERATOR_END =                                1037,
+    ERROR_LIBCPARSE_TOKEN_ITERATOR_OVERFLOW =                           1038,
+    ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK =                          1039,
+    ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL =                           1040,
+    ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT =                           1041,
+    ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION =                          1042,
+    ERROR_LIBCPARSE_TOKEN_STREAM_UNSUPPORTED_EVENT_CATEGORY =           1043,
+    ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR =                       1044,
+    ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG =                         1045,
+    ERROR_LIBCPARSE_CHECKPOINT_INVALID =                                1046,
+    ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG =                     1047,
+    ERROR_LIBCPARSE_RELEXER_BAD_EDIT =                                  1048,
 };
@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include <libcparse/allocator_fwd.h>
 #include <libcparse/function_decl.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -39,6 +41,25 @@ typedef struct CPARSE_SYM(string_builder) CPARSE_SYM(string_builder);
 int FN_DECL_MUST_CHECK
 CPARSE_SYM(string_builder_create)(CPARSE_SYM(string_builder)** builder);
 
+/**
+ * \brief Create a string builder instance that uses the given allocator for
+ * its memory.
+ *
+ * Strings returned by \ref string_builder_build are still allocated with
+ * malloc, since they are owned by the caller.
+ *
+ * \param builder           Pointer to the string builder pointer to receive
+ *                          this instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(string_builder_create_with_allocator)(
+    CPARSE_SYM(string_builder)** builder, const CPARSE_SYM(allocator)* alloc);
+
 /**
  * \brief Release a string builder instance, releasing any internal resources it
  * may own.
@@ -82,6 +103,20 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(string_builder_add_character)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(string_builder_add_string)(
     CPARSE_SYM(string_builder)* builder, const char* ch);
 
+/**
+ * \brief Add a span of characters to the string builder.
+ *
+ * \param builder           The string builder instance for this operation.
+ * \param span              The start of the span to add.
+ * \param size              The number of characters in this span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(string_builder_add_span)(
+    CPARSE_SYM(string_builder)* builder, const char* span, size_t size);
+
 /**
  * \brief Build a string from the current string builder.
  *
@@ -97,10 +132,38 @@ int FN_DECL_MUST_CHECK CPARSE_SYM(string_builder_add_string)(
 int FN_DECL_MUST_CHECK CPARSE_SYM(string_builder_build)(
     char** str, CPARSE_SYM(string_builder)* builder);
 
+/**
+ * \brief Get a borrowed view of the string in the current string builder.
+ *
+ * Unlike \ref string_builder_build, this does not allocate. The view is owned
+ * by the builder, and it is only valid until the builder is next modified,
+ * cleared, or released.
+ *
+ * \param builder           The string builder for this operation.
+ *
+ * \returns a NUL-terminated string owned by the builder.
+ */
+const char* CPARSE_SYM(string_builder_view)(
+    const CPARSE_SYM(string_builder)* builder);
+
+/**
+ * \brief Get the size of the string in the current string builder.
+ *
+ * \param builder           The string builder for this operation.
+ *
+ * \returns the number of characters added since the builder was created or
+ * last cleared.
+ */
+size_t CPARSE_SYM(string_builder_size)(
+    const CPARSE_SYM(string_builder)* builder);
+
 /**
  * \brief Clear the current string builder instance, returning its internal
  * state to empty.
  *
+ * The builder keeps its buffer, so that building the next string does not
+ * allocate unless it is longer than any string built before.
+ *
  * \param builder           The string builder for this operation.
  */
 void CPARSE_SYM(string_builder_clear)(CPARSE_SYM(string_builder)* builder);
@@ -115,6 +178,10 @@ void CPARSE_SYM(string_builder_clear)(CPARSE_SYM(string_builder)* builder);
     static inline int FN_DECL_MUST_CHECK sym ## string_builder_create( \
         CPARSE_SYM(string_builder)** x) { \
             return CPARSE_SYM(string_builder_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## string_builder_create_with_allocator( \
+        CPARSE_SYM(string_builder)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(string_builder_create_with_allocator)(x,y); } \
     static inline int FN_DECL_MUST_CHECK sym ## string_builder_release( \
         CPARSE_SYM(string_builder)* x) { \
             return CPARSE_SYM(string_builder_release)(x); } \
@@ -124,9 +191,18 @@ void CPARSE_SYM(string_builder_clear)(CPARSE_SYM(string_builder)* builder);
     static inline int FN_DECL_MUST_CHECK sym ## string_builder_add_string( \
         CPARSE_SYM(string_builder)* x, const char* y) { \
             return CPARSE_SYM(string_builder_add_string)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## string_builder_add_span( \
+        CPARSE_SYM(string_builder)* x, const char* y, size_t z) { \
+            return CPARSE_SYM(string_builder_add_span)(x,y,z); } \
     static inline int FN_DECL_MUST_CHECK sym ## string_builder_build( \
         char** x, CPARSE_SYM(string_builder)* y) { \
             return CPARSE_SYM(string_builder_build)(x,y); } \
+    static inline const char* sym ## string_builder_view( \
+        const CPARSE_SYM(string_builder)* x) { \
+            return CPARSE_SYM(string_builder_view)(x); } \
+    static inline size_t sym ## string_builder_size( \
+        const CPARSE_SYM(string_builder)* x) { \
+            return CPARSE_SYM(string_builder_size)(x); } \
     static inline void sym ## string_builder_clear( \
         CPARSE_SYM(string_builder)* x) { \
             CPARSE_SYM(string_builder_clear)(x); } \
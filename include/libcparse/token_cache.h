@@ -0,0 +1,214 @@
+/**
+ * \file libcparse/token_cache.h
+ *
+ * \brief A persistent, content-addressed cache of scanned token streams.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/function_decl.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The token cache stores the events scanned from each input in a
+ * directory, keyed by a hash of the input and the scanner configuration.
+ *
+ * Each entry is a \ref token_stream file. When an unchanged input is scanned
+ * again, its entry is mapped into memory and replayed instead of being
+ * scanned. The total size of the entries is bounded, and the least recently
+ * used entries are evicted to stay within this bound.
+ */
+typedef struct CPARSE_SYM(token_cache) CPARSE_SYM(token_cache);
+
+/**
+ * \brief Counters describing the effectiveness of a \ref token_cache.
+ */
+typedef struct CPARSE_SYM(token_cache_stats) CPARSE_SYM(token_cache_stats);
+
+struct CPARSE_SYM(token_cache_stats)
+{
+    /* the number of inputs replayed from the cache. */
+    uint64_t hits;
+
+    /* the number of inputs that were scanned. */
+    uint64_t misses;
+
+    /* the number of input bytes that did not need to be scanned. */
+    uint64_t bytes_saved;
+
+    /* the number of entries evicted to stay within the size bound. */
+    uint64_t evictions;
+
+    /* the number of entries that could not be written. */
+    uint64_t failed_writes;
+
+    /* the number of entries in the cache directory. */
+    uint64_t entries;
+
+    /* the total size of the entries in the cache directory. */
+    uint64_t size;
+};
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a \ref token_cache instance.
+ *
+ * The cache directory is created if it does not exist. Any entries already in
+ * the directory are indexed, ordered by their modification times, and the
+ * oldest entries are evicted if they exceed \p max_size. Temporary files left
+ * behind by an interrupted write are removed.
+ *
+ * \param cache                 Pointer to the \ref token_cache pointer to set
+ *                              to the created instance on success.
+ * \param dir                   The cache directory.
+ * \param max_size              The maximum total size of the entries, in
+ *                              bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_cache_create)(
+    CPARSE_SYM(token_cache)** cache, const char* dir, size_t max_size);
+
+/**
+ * \brief Create a \ref token_cache instance that uses the given allocator.
+ *
+ * \param cache                 Pointer to the \ref token_cache pointer to set
+ *                              to the created instance on success.
+ * \param dir                   The cache directory.
+ * \param max_size              The maximum total size of the entries, in
+ *                              bytes.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_cache_create_with_allocator)(
+    CPARSE_SYM(token_cache)** cache, const char* dir, size_t max_size,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a \ref token_cache instance.
+ *
+ * The cache directory and its entries are left in place.
+ *
+ * \param cache                 The \ref token_cache instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_cache_release)(CPARSE_SYM(token_cache)* cache);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Broadcast the events of a \ref preprocessor_scanner for an input,
+ * replaying them from the cache if possible.
+ *
+ * The input is hashed along with its name and the scanner configuration. On a
+ * hit, the cached entry is replayed to the subscribers of \p scanner, with
+ * identifiers interned in the scanner's intern table. On a miss, the input is
+ * scanned by a private scanner that shares this intern table, its events are
+ * forwarded to the subscribers of \p scanner, and the recorded events are
+ * written through to the cache. Each entry is written to a temporary file
+ * and renamed into place, so that a reader never sees a partial entry.
+ *
+ * Either way, the file names in event cursors are only valid during the
+ * broadcast. A cache entry that can't be written is counted in the
+ * statistics, but is not an error.
+ *
+ * \param cache                 The \ref token_cache for this operation.
+ * \param scanner               The \ref preprocessor_scanner whose subscribers
+ *                              receive the events. This scanner is not run.
+ * \param name                  The name of this input.
+ * \param data                  The input.
+ * \param size                  The size of the input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from scanning or from a subscriber.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_cache_preprocessor_scanner_run)(
+    CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const char* name,
+    const void* data, size_t size);
+
+/**
+ * \brief Get the statistics for a \ref token_cache.
+ *
+ * \param stats                 The statistics to populate.
+ * \param cache                 The \ref token_cache to query.
+ */
+void CPARSE_SYM(token_cache_stats_get)(
+    CPARSE_SYM(token_cache_stats)* stats,
+    const CPARSE_SYM(token_cache)* cache);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_cache_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(token_cache) sym ## token_cache; \
+    typedef CPARSE_SYM(token_cache_stats) sym ## token_cache_stats; \
+    static inline int FN_DECL_MUST_CHECK sym ## token_cache_create( \
+        CPARSE_SYM(token_cache)** x, const char* y, size_t z) { \
+            return CPARSE_SYM(token_cache_create)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_cache_create_with_allocator( \
+        CPARSE_SYM(token_cache)** w, const char* x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(token_cache_create_with_allocator)(w,x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_cache_release( \
+        CPARSE_SYM(token_cache)* x) { \
+            return CPARSE_SYM(token_cache_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_cache_preprocessor_scanner_run( \
+        CPARSE_SYM(token_cache)* v, CPARSE_SYM(preprocessor_scanner)* w, \
+        const char* x, const void* y, size_t z) { \
+            return \
+                CPARSE_SYM(token_cache_preprocessor_scanner_run)( \
+                    v,w,x,y,z); } \
+    static inline void sym ## token_cache_stats_get( \
+        CPARSE_SYM(token_cache_stats)* x, \
+        const CPARSE_SYM(token_cache)* y) { \
+            CPARSE_SYM(token_cache_stats_get)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_cache_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_cache_sym(sym ## _)
+#define CPARSE_IMPORT_token_cache \
+    __INTERNAL_CPARSE_IMPORT_token_cache_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
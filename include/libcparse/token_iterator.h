@@ -0,0 +1,157 @@
+/**
+ * \file libcparse/token_iterator.h
+ *
+ * \brief The token iterator pulls preprocessor tokens one at a time.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/function_decl.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The token_iterator provides a pull interface over a
+ * \ref preprocessor_scanner.
+ *
+ * Rather than running the parser stack to the end of input, each call to
+ * \ref token_iterator_next steps the \ref raw_stack_scanner only until the
+ * preprocessor scanner produces its next event. Events are held in a small
+ * internal buffer until they are pulled. Input that is never pulled is never
+ * scanned, so a caller can stop early by releasing the iterator.
+ */
+typedef struct CPARSE_SYM(token_iterator) CPARSE_SYM(token_iterator);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a token iterator.
+ *
+ * The iterator creates and owns its own \ref preprocessor_scanner stack. Input
+ * streams are pushed onto this stack through \ref token_iterator_upcast.
+ *
+ * \param it                Pointer to the \ref token_iterator pointer to be
+ *                          populated with the created iterator on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(token_iterator_create)(
+    CPARSE_SYM(token_iterator)** it);
+
+/**
+ * \brief Create a token iterator that uses the given allocator for its memory.
+ *
+ * The iterator, its parser stack, and the event copies it buffers are all
+ * allocated with this allocator. Copies returned by \ref token_iterator_next
+ * are released through the same allocator by \ref event_copy_release.
+ *
+ * \param it                Pointer to the \ref token_iterator pointer to be
+ *                          populated with the created iterator on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(token_iterator_create_with_allocator)(
+    CPARSE_SYM(token_iterator)** it, const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a token iterator, along with its parser stack and any events
+ * that have not been pulled.
+ *
+ * \param it                The \ref token_iterator instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(token_iterator_release)(
+    CPARSE_SYM(token_iterator)* it);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the \ref abstract_parser interface for this iterator's parser
+ * stack.
+ *
+ * \param it                The \ref token_iterator instance to query.
+ *
+ * \returns the \ref abstract_parser interface for this iterator.
+ */
+CPARSE_SYM(abstract_parser)* CPARSE_SYM(token_iterator_upcast)(
+    CPARSE_SYM(token_iterator)* it);
+
+/**
+ * \brief Pull the next event from the preprocessor scanner.
+ *
+ * The final event is the EOF event. After it has been returned, this method
+ * returns ERROR_LIBCPARSE_TOKEN_ITERATOR_END.
+ *
+ * \note On success, ownership of the copy passes to the caller, who must
+ * release it with \ref event_copy_release. Any other failure leaves the
+ * iterator in an undefined state; it can only be released.
+ *
+ * \param it                The \ref token_iterator instance for this
+ *                          operation.
+ * \param cpy               Pointer to the \ref event_copy pointer to receive
+ *                          the next event on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_ITERATOR_END if every event has been pulled.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK CPARSE_SYM(token_iterator_next)(
+    CPARSE_SYM(token_iterator)* it, CPARSE_SYM(event_copy)** cpy);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_iterator_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(token_iterator) sym ## token_iterator; \
+    static inline int FN_DECL_MUST_CHECK sym ## token_iterator_create( \
+        CPARSE_SYM(token_iterator)** x) { \
+            return CPARSE_SYM(token_iterator_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_iterator_create_with_allocator( \
+        CPARSE_SYM(token_iterator)** x, const CPARSE_SYM(allocator)* y) { \
+            return CPARSE_SYM(token_iterator_create_with_allocator)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_iterator_release( \
+        CPARSE_SYM(token_iterator)* x) { \
+            return CPARSE_SYM(token_iterator_release)(x); } \
+    static inline CPARSE_SYM(abstract_parser)* \
+    sym ## token_iterator_upcast( \
+        CPARSE_SYM(token_iterator)* x) { \
+            return CPARSE_SYM(token_iterator_upcast)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_iterator_next( \
+        CPARSE_SYM(token_iterator)* x, CPARSE_SYM(event_copy)** y) { \
+            return CPARSE_SYM(token_iterator_next)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_iterator_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_iterator_sym(sym ## _)
+#define CPARSE_IMPORT_token_iterator \
+    __INTERNAL_CPARSE_IMPORT_token_iterator_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
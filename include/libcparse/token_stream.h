@@ -0,0 +1,319 @@
+/**
+ * \file libcparse/token_stream.h
+ *
+ * \brief A compact, versioned binary encoding of an event stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/event_fwd.h>
+#include <libcparse/event_handler_fwd.h>
+#include <libcparse/event_reactor_fwd.h>
+#include <libcparse/function_decl.h>
+#include <libcparse/intern_table.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The token stream writer records events into the token stream format.
+ *
+ * A writer can be subscribed like any other event handler. Once the events
+ * of interest have been recorded, \ref token_stream_writer_build encodes them
+ * into a single buffer that can be written to disk and later mapped back into
+ * memory.
+ */
+typedef struct CPARSE_SYM(token_stream_writer)
+CPARSE_SYM(token_stream_writer);
+
+/**
+ * \brief A token stream is a read-only view of an encoded event stream.
+ *
+ * The encoding is columnar: event types and categories are stored in fixed
+ * width arrays, cursors are stored as variable length deltas from the previous
+ * cursor, and every string is stored once in a NUL-terminated string table.
+ * Replaying a token stream re-broadcasts its events, pointing each string
+ * directly into the encoded buffer, so no parsing work is repeated.
+ */
+typedef struct CPARSE_SYM(token_stream) CPARSE_SYM(token_stream);
+
+/**
+ * \brief The version of the token stream format written by this library.
+ *
+ * A token stream with any other version is rejected, so this must be bumped
+ * whenever the encoding or the meaning of an event changes.
+ */
+#define CPARSE_TOKEN_STREAM_VERSION 1
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a \ref token_stream_writer instance.
+ *
+ * \param writer                Pointer to the \ref token_stream_writer pointer
+ *                              to set to the created instance on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_create)(
+    CPARSE_SYM(token_stream_writer)** writer);
+
+/**
+ * \brief Create a \ref token_stream_writer instance that uses the given
+ * allocator.
+ *
+ * \param writer                Pointer to the \ref token_stream_writer pointer
+ *                              to set to the created instance on success.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_create_with_allocator)(
+    CPARSE_SYM(token_stream_writer)** writer,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a \ref token_stream_writer instance.
+ *
+ * \param writer                The \ref token_stream_writer instance to
+ *                              release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_release)(
+    CPARSE_SYM(token_stream_writer)* writer);
+
+/**
+ * \brief Create a \ref token_stream view of an encoded buffer.
+ *
+ * Every event in the buffer is decoded and checked, so that a corrupt buffer
+ * is rejected here rather than partway through a replay. The buffer is not
+ * copied. It must remain valid and unchanged until the token stream is
+ * released, which makes a read-only memory mapping of a token stream file a
+ * suitable buffer.
+ *
+ * \param stream                Pointer to the \ref token_stream pointer to set
+ *                              to the created instance on success.
+ * \param data                  The encoded buffer.
+ * \param size                  The size of the encoded buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if this buffer is not a valid
+ *        token stream.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION if this buffer was written
+ *        with a different version of the format.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_create)(
+    CPARSE_SYM(token_stream)** stream, const void* data, size_t size);
+
+/**
+ * \brief Create a \ref token_stream view of an encoded buffer that uses the
+ * given allocator.
+ *
+ * \param stream                Pointer to the \ref token_stream pointer to set
+ *                              to the created instance on success.
+ * \param data                  The encoded buffer.
+ * \param size                  The size of the encoded buffer.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if this buffer is not a valid
+ *        token stream.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION if this buffer was written
+ *        with a different version of the format.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_create_with_allocator)(
+    CPARSE_SYM(token_stream)** stream, const void* data, size_t size,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a \ref token_stream instance.
+ *
+ * The encoded buffer is not owned by the token stream, and is not released.
+ *
+ * \param stream                The \ref token_stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_release)(CPARSE_SYM(token_stream)* stream);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Record an event in a \ref token_stream_writer.
+ *
+ * \param writer                The \ref token_stream_writer for this
+ *                              operation.
+ * \param ev                    The event to record.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_UNSUPPORTED_EVENT_CATEGORY if this event
+ *        can't be encoded.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_add)(
+    CPARSE_SYM(token_stream_writer)* writer, const CPARSE_SYM(event)* ev);
+
+/**
+ * \brief Initialize an event handler that records each event it receives in a
+ * \ref token_stream_writer.
+ *
+ * \param eh                    The event handler to initialize.
+ * \param writer                The \ref token_stream_writer that receives the
+ *                              events, which must outlive this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_event_handler_init)(
+    CPARSE_SYM(event_handler)* eh, CPARSE_SYM(token_stream_writer)* writer);
+
+/**
+ * \brief Encode the events recorded by a \ref token_stream_writer.
+ *
+ * \param data                  Pointer to receive the encoded buffer on
+ *                              success. On success, this buffer is owned by
+ *                              the caller and must be freed when no longer
+ *                              needed.
+ * \param size                  Pointer to receive the size of the encoded
+ *                              buffer on success.
+ * \param writer                The \ref token_stream_writer for this
+ *                              operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_writer_build)(
+    void** data, size_t* size, CPARSE_SYM(token_stream_writer)* writer);
+
+/**
+ * \brief Get the number of events in a \ref token_stream.
+ *
+ * \param stream                The \ref token_stream to query.
+ *
+ * \returns the number of events in this stream.
+ */
+size_t CPARSE_SYM(token_stream_event_count_get)(
+    const CPARSE_SYM(token_stream)* stream);
+
+/**
+ * \brief Broadcast every event in a \ref token_stream to an event reactor, in
+ * the order in which the events were recorded.
+ *
+ * The strings and file names in each event point into the encoded buffer.
+ *
+ * Identifier symbol IDs are only meaningful in the intern table that assigned
+ * them. If \p symbols is not NULL, then each identifier is re-interned in that
+ * table, once per distinct string, and its event carries the new symbol ID and
+ * interned string. Otherwise, each identifier carries its recorded symbol ID.
+ *
+ * \param stream                The \ref token_stream to replay.
+ * \param reactor               The event reactor that receives the events.
+ * \param symbols               The intern table for identifiers, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from a subscriber, which stops the replay.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(token_stream_replay)(
+    const CPARSE_SYM(token_stream)* stream,
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(intern_table)* symbols);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_stream_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(token_stream_writer) sym ## token_stream_writer; \
+    typedef CPARSE_SYM(token_stream) sym ## token_stream; \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_writer_create( \
+        CPARSE_SYM(token_stream_writer)** x) { \
+            return CPARSE_SYM(token_stream_writer_create)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_stream_writer_create_with_allocator( \
+        CPARSE_SYM(token_stream_writer)** x, \
+        const CPARSE_SYM(allocator)* y) { \
+            return \
+                CPARSE_SYM(token_stream_writer_create_with_allocator)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_writer_release( \
+        CPARSE_SYM(token_stream_writer)* x) { \
+            return CPARSE_SYM(token_stream_writer_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_create( \
+        CPARSE_SYM(token_stream)** x, const void* y, size_t z) { \
+            return CPARSE_SYM(token_stream_create)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_stream_create_with_allocator( \
+        CPARSE_SYM(token_stream)** w, const void* x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(token_stream_create_with_allocator)(w,x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_release( \
+        CPARSE_SYM(token_stream)* x) { \
+            return CPARSE_SYM(token_stream_release)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_writer_add( \
+        CPARSE_SYM(token_stream_writer)* x, const CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(token_stream_writer_add)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## token_stream_writer_event_handler_init( \
+        CPARSE_SYM(event_handler)* x, CPARSE_SYM(token_stream_writer)* y) { \
+            return CPARSE_SYM(token_stream_writer_event_handler_init)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_writer_build( \
+        void** x, size_t* y, CPARSE_SYM(token_stream_writer)* z) { \
+            return CPARSE_SYM(token_stream_writer_build)(x,y,z); } \
+    static inline size_t sym ## token_stream_event_count_get( \
+        const CPARSE_SYM(token_stream)* x) { \
+            return CPARSE_SYM(token_stream_event_count_get)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## token_stream_replay( \
+        const CPARSE_SYM(token_stream)* x, CPARSE_SYM(event_reactor)* y, \
+        CPARSE_SYM(intern_table)* z) { \
+            return CPARSE_SYM(token_stream_replay)(x,y,z); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_stream_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_stream_sym(sym ## _)
+#define CPARSE_IMPORT_token_stream \
+    __INTERNAL_CPARSE_IMPORT_token_stream_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,107 @@
+/**
+ * \file libcparse/util/char_scan.h
+ *
+ * \brief Find runs of characters in a block.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The character classes that \ref char_scan_run can match.
+ */
+enum CPARSE_SYM(char_scan_class)
+{
+    /* letters, decimal digits, and underscores. */
+    CPARSE_CHAR_SCAN_CLASS_IDENTIFIER =                                 0,
+
+    /* decimal digits. */
+    CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT =                              1,
+
+    /* decimal digits, and the letters a through f in either case. */
+    CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT =                                  2,
+
+    /* spaces, tabs, vertical tabs, form feeds, and carriage returns. */
+    CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE =                           3,
+
+    /* horizontal whitespace and newlines. */
+    CPARSE_CHAR_SCAN_CLASS_SPACE =                                      4,
+};
+
+/**
+ * \brief The largest set of characters that \ref char_scan_any can search for.
+ */
+#define CPARSE_CHAR_SCAN_MAX_SET 8
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Find the length of the run of characters at the start of a block that
+ * all belong to the given character class.
+ *
+ * This scan is vectorized where the CPU supports it, falling back to a scalar
+ * scan otherwise. The implementation is chosen at runtime.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the number of characters at the start of this block that belong to
+ * this class, which is \p size if they all do.
+ */
+size_t CPARSE_SYM(char_scan_run)(
+    const char* block, size_t size, int char_class);
+
+/**
+ * \brief Find the first character in a block that is in the given set.
+ *
+ * This scan is vectorized where the CPU supports it, falling back to a scalar
+ * scan otherwise. The implementation is chosen at runtime.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set, from 1 to
+ *                      \ref CPARSE_CHAR_SCAN_MAX_SET.
+ *
+ * \returns the offset of the first character in this block that is in the set,
+ * or \p size if there is no such character.
+ */
+size_t CPARSE_SYM(char_scan_any)(
+    const char* block, size_t size, const char* set, size_t set_size);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_util_char_scan_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline size_t sym ## char_scan_run( \
+        const char* x, size_t y, int z) { \
+            return CPARSE_SYM(char_scan_run)(x,y,z); } \
+    static inline size_t sym ## char_scan_any( \
+        const char* x, size_t y, const char* z, size_t w) { \
+            return CPARSE_SYM(char_scan_any)(x,y,z,w); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_char_scan_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_char_scan_sym(sym ## _)
+#define CPARSE_IMPORT_util_char_scan \
+    __INTERNAL_CPARSE_IMPORT_util_char_scan_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
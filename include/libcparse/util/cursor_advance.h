@@ -0,0 +1,90 @@
+/**
+ * \file libcparse/util/cursor_advance.h
+ *
+ * \brief Advance a cursor over a block of characters.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/cursor.h>
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Count the newlines in a block of characters, and find the last one.
+ *
+ * This scan is vectorized where the CPU supports it, falling back to a scalar
+ * scan otherwise. The implementation is chosen at runtime.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan)(
+    const char* block, size_t size, size_t* last);
+
+/**
+ * \brief Advance a cursor over a block of characters.
+ *
+ * After this call, the begin and end positions of the cursor both point to the
+ * position just past the block, as if the cursor had been advanced one
+ * character at a time. The byte offsets of the cursor advance by \p size.
+ *
+ * \param pos           The cursor to advance.
+ * \param block         The block of characters to advance over.
+ * \param size          The size of this block.
+ */
+void CPARSE_SYM(cursor_advance)(
+    CPARSE_SYM(cursor)* pos, const char* block, size_t size);
+
+/**
+ * \brief Advance a cursor over a single character.
+ *
+ * The byte offsets of the cursor advance by one.
+ *
+ * \param pos           The cursor to advance.
+ * \param ch            The character to advance over.
+ */
+void CPARSE_SYM(cursor_advance_character)(CPARSE_SYM(cursor)* pos, int ch);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_util_cursor_advance_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline size_t sym ## newline_scan( \
+        const char* x, size_t y, size_t* z) { \
+            return CPARSE_SYM(newline_scan)(x,y,z); } \
+    static inline void sym ## cursor_advance( \
+        CPARSE_SYM(cursor)* x, const char* y, size_t z) { \
+            CPARSE_SYM(cursor_advance)(x,y,z); } \
+    static inline void sym ## cursor_advance_character( \
+        CPARSE_SYM(cursor)* x, int y) { \
+            CPARSE_SYM(cursor_advance_character)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_cursor_advance_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_cursor_advance_sym(sym ## _)
+#define CPARSE_IMPORT_util_cursor_advance \
+    __INTERNAL_CPARSE_IMPORT_util_cursor_advance_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,214 @@
+/**
+ * \file libcparse/util/event_ring.h
+ *
+ * \brief Single-producer / single-consumer ring of event copies.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator_fwd.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The event_ring is a bounded, lock-free queue of \ref event_copy
+ * pointers, which hands events from exactly one producer thread to exactly one
+ * consumer thread.
+ *
+ * The producer pushes copies and finally marks the ring as finished. The
+ * consumer pops copies until the ring is finished and empty. The consumer may
+ * close the ring to ask the producer to stop early; it must keep popping until
+ * the ring is finished so that no copies are leaked.
+ */
+typedef struct CPARSE_SYM(event_ring) CPARSE_SYM(event_ring);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an \ref event_ring instance.
+ *
+ * \param ring                  Pointer to the \ref event_ring pointer to set to
+ *                              the created instance on success.
+ * \param capacity              The minimum number of copies this ring can hold.
+ *                              This is rounded up to a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_ring_create)(
+    CPARSE_SYM(event_ring)** ring, size_t capacity);
+
+/**
+ * \brief Create an \ref event_ring instance that uses the given allocator for
+ * its slots.
+ *
+ * The instance itself is still allocated with aligned_alloc, so that the
+ * producer and consumer indices sit on their own cache lines.
+ *
+ * \param ring                  Pointer to the \ref event_ring pointer to set to
+ *                              the created instance on success.
+ * \param capacity              The minimum number of copies this ring can hold.
+ *                              This is rounded up to a power of two.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_ring_create_with_allocator)(
+    CPARSE_SYM(event_ring)** ring, size_t capacity,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Release an \ref event_ring instance, releasing any copies it still
+ * holds.
+ *
+ * \param ring                  The \ref event_ring instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_ring_release)(CPARSE_SYM(event_ring)* ring);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Reset an empty \ref event_ring so it can be used for another run.
+ *
+ * This clears the closed and finished flags. It must only be called while no
+ * producer or consumer is using the ring.
+ *
+ * \param ring                  The \ref event_ring instance to reset.
+ */
+void CPARSE_SYM(event_ring_reset)(CPARSE_SYM(event_ring)* ring);
+
+/**
+ * \brief Push a copy onto the ring, waiting for space if the ring is full.
+ *
+ * This may only be called by the producer. On success, ownership of the copy
+ * passes to the ring.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ * \param cpy                   The copy to push.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_EVENT_RING_CLOSED if the consumer closed this ring.
+ *        The caller retains ownership of the copy.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_ring_push)(
+    CPARSE_SYM(event_ring)* ring, CPARSE_SYM(event_copy)* cpy);
+
+/**
+ * \brief Pop a copy from the ring, waiting for the producer if the ring is
+ * empty.
+ *
+ * This may only be called by the consumer. On success, ownership of the copy
+ * passes to the caller.
+ *
+ * \param cpy                   Pointer to the \ref event_copy pointer to
+ *                              receive the copy on success.
+ * \param ring                  The \ref event_ring instance for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_EVENT_RING_FINISHED if the producer has finished and
+ *        every copy has been popped.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(event_ring_pop)(
+    CPARSE_SYM(event_copy)** cpy, CPARSE_SYM(event_ring)* ring);
+
+/**
+ * \brief Mark the ring as finished. The producer calls this after its last
+ * push.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ */
+void CPARSE_SYM(event_ring_finish)(CPARSE_SYM(event_ring)* ring);
+
+/**
+ * \brief Close the ring, asking the producer to stop pushing. The consumer
+ * calls this when it can no longer accept events.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ */
+void CPARSE_SYM(event_ring_close)(CPARSE_SYM(event_ring)* ring);
+
+/**
+ * \brief Return whether the consumer has closed the ring.
+ *
+ * \param ring                  The \ref event_ring instance to query.
+ *
+ * \returns true if the ring has been closed, or false otherwise.
+ */
+bool CPARSE_SYM(event_ring_is_closed)(const CPARSE_SYM(event_ring)* ring);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_util_event_ring_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(event_ring) sym ## event_ring; \
+    static inline int FN_DECL_MUST_CHECK sym ## event_ring_create( \
+        CPARSE_SYM(event_ring)** x, size_t y) { \
+            return CPARSE_SYM(event_ring_create)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## event_ring_create_with_allocator( \
+        CPARSE_SYM(event_ring)** x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(event_ring_create_with_allocator)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK sym ## event_ring_release( \
+        CPARSE_SYM(event_ring)* x) { \
+            return CPARSE_SYM(event_ring_release)(x); } \
+    static inline void sym ## event_ring_reset( \
+        CPARSE_SYM(event_ring)* x) { \
+            CPARSE_SYM(event_ring_reset)(x); } \
+    static inline int FN_DECL_MUST_CHECK sym ## event_ring_push( \
+        CPARSE_SYM(event_ring)* x, CPARSE_SYM(event_copy)* y) { \
+            return CPARSE_SYM(event_ring_push)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## event_ring_pop( \
+        CPARSE_SYM(event_copy)** x, CPARSE_SYM(event_ring)* y) { \
+            return CPARSE_SYM(event_ring_pop)(x,y); } \
+    static inline void sym ## event_ring_finish( \
+        CPARSE_SYM(event_ring)* x) { \
+            CPARSE_SYM(event_ring_finish)(x); } \
+    static inline void sym ## event_ring_close( \
+        CPARSE_SYM(event_ring)* x) { \
+            CPARSE_SYM(event_ring_close)(x); } \
+    static inline bool sym ## event_ring_is_closed( \
+        const CPARSE_SYM(event_ring)* x) { \
+            return CPARSE_SYM(event_ring_is_closed)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_event_ring_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_event_ring_sym(sym ## _)
+#define CPARSE_IMPORT_util_event_ring \
+    __INTERNAL_CPARSE_IMPORT_util_event_ring_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
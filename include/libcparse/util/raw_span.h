@@ -0,0 +1,113 @@
+/**
+ * \file libcparse/util/raw_span.h
+ *
+ * \brief Helpers for passing raw spans down the scanner chain.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/function_decl.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Set a cursor to the position of the first character of an event.
+ *
+ * A raw span event's cursor covers every character in the span. This method
+ * collapses such a cursor to its first character, so that it can be advanced
+ * through the span in pieces.
+ *
+ * \param pos           The cursor to set.
+ * \param ev            The event whose position is copied.
+ */
+void CPARSE_SYM(raw_span_start_position)(
+    CPARSE_SYM(cursor)* pos, const CPARSE_SYM(event)* ev);
+
+/**
+ * \brief Broadcast a piece of a span as a raw span event, and advance the
+ * given cursor past it.
+ *
+ * \param reactor       The reactor to which the event is broadcast.
+ * \param pos           The position of the first character of this piece. On
+ *                      return, this is the position of the character after
+ *                      it.
+ * \param span          The characters to broadcast.
+ * \param size          The number of characters to broadcast. An empty piece
+ *                      is not broadcast.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_span_broadcast)(
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(cursor)* pos,
+    const char* span, size_t size);
+
+/**
+ * \brief Send a piece of a span to an event callback one raw character event
+ * at a time, advancing the given cursor past it.
+ *
+ * This lets a stage that receives a span fall back to its per-character state
+ * machine.
+ *
+ * \param fn            The callback to which each event is sent.
+ * \param context       The context for this callback.
+ * \param pos           The position of the first character of this piece. On
+ *                      return, this is the position of the character after
+ *                      it.
+ * \param span          The characters to send.
+ * \param size          The number of characters to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+CPARSE_SYM(raw_span_send_characters)(
+    CPARSE_SYM(event_callback_fn) fn, void* context, CPARSE_SYM(cursor)* pos,
+    const char* span, size_t size);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_util_raw_span_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline void sym ## raw_span_start_position( \
+        CPARSE_SYM(cursor)* x, const CPARSE_SYM(event)* y) { \
+            CPARSE_SYM(raw_span_start_position)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK sym ## raw_span_broadcast( \
+        CPARSE_SYM(event_reactor)* x, CPARSE_SYM(cursor)* y, const char* z, \
+        size_t w) { \
+            return CPARSE_SYM(raw_span_broadcast)(x,y,z,w); } \
+    static inline int FN_DECL_MUST_CHECK sym ## raw_span_send_characters( \
+        CPARSE_SYM(event_callback_fn) x, void* y, CPARSE_SYM(cursor)* z, \
+        const char* w, size_t v) { \
+            return CPARSE_SYM(raw_span_send_characters)(x,y,z,w,v); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_raw_span_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_raw_span_sym(sym ## _)
+#define CPARSE_IMPORT_util_raw_span \
+    __INTERNAL_CPARSE_IMPORT_util_raw_span_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,23 @@
+/**
+ * \file src/abstract_parser/abstract_parser_allocator_get.c
+ *
+ * \brief Get the allocator used by an \ref abstract_parser.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+
+/**
+ * \brief Get the allocator used by this parser.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ *
+ * \returns the allocator for this parser.
+ */
+const CPARSE_SYM(allocator)* CPARSE_SYM(abstract_parser_allocator_get)(
+    const CPARSE_SYM(abstract_parser)* ap)
+{
+    return &ap->alloc;
+}
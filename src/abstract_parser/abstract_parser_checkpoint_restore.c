@@ -0,0 +1,64 @@
+/**
+ * \file src/abstract_parser/abstract_parser_checkpoint_restore.c
+ *
+ * \brief Restore a checkpoint to every stage of the parser.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/message/checkpoint.h>
+#include <libcparse/message_handler.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_message_checkpoint;
+CPARSE_IMPORT_message_handler;
+
+/**
+ * \brief Restore a checkpoint to every stage of this parser.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint can't be
+ *        restored.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(abstract_parser_checkpoint_restore)(
+    CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(abstract_parser_checkpoint)* ckpt)
+{
+    int retval, release_retval;
+    message_checkpoint msg;
+
+    /* initialize the message. */
+    retval = message_checkpoint_init_for_restore(&msg, ckpt);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the message. */
+    retval = message_handler_send(&ap->mh, message_checkpoint_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_checkpoint_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
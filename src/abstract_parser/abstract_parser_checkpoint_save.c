@@ -0,0 +1,70 @@
+/**
+ * \file src/abstract_parser/abstract_parser_checkpoint_save.c
+ *
+ * \brief Save a checkpoint of every stage of the parser.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/message/checkpoint.h>
+#include <libcparse/message_handler.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+CPARSE_IMPORT_message_checkpoint;
+CPARSE_IMPORT_message_handler;
+
+/**
+ * \brief Save a checkpoint of every stage of this parser.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param ap                The \ref abstract_parser for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG if a partial token does
+ *        not fit in the checkpoint.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does
+ *        not fit in the checkpoint.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(abstract_parser_checkpoint_save)(
+    CPARSE_SYM(abstract_parser_checkpoint)* ckpt,
+    CPARSE_SYM(abstract_parser)* ap)
+{
+    int retval, release_retval;
+    message_checkpoint msg;
+
+    /* the parts for missing stages are left zeroed. */
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    /* initialize the message. */
+    retval = message_checkpoint_init_for_save(&msg, ckpt);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the message. */
+    retval = message_handler_send(&ap->mh, message_checkpoint_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_checkpoint_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -9,12 +9,9 @@
  */
 
 #include <libcparse/abstract_parser.h>
-#include <libcparse/message/subscription.h>
-#include <libcparse/message_type.h>
-#include <libcparse/status_codes.h>
+#include <stddef.h>
 
-CPARSE_IMPORT_message_handler;
-CPARSE_IMPORT_message_subscription;
+CPARSE_IMPORT_abstract_parser;
 
 /**
  * \brief Subscribe to \ref comment_filter events.
@@ -30,34 +27,5 @@ int
 CPARSE_SYM(abstract_parser_comment_filter_subscribe)(
     CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh)
 {
-    int retval, release_retval;
-    message_subscribe msg;
-
-    /* initialize the message. */
-    retval = message_subscribe_init_for_comment_filter(&msg, eh);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
-
-    /* send the message. */
-    retval = message_handler_send(&ap->mh, message_subscribe_upcast(&msg));
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_msg;
-    }
-
-    /* success. */
-    retval = STATUS_SUCCESS;
-    goto cleanup_msg;
-
-cleanup_msg:
-    release_retval = message_subscribe_dispose(&msg);
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
-
-done:
-    return retval;
+    return abstract_parser_comment_filter_subscribe_filtered(ap, eh, NULL);
 }
@@ -0,0 +1,70 @@
+/**
+ * \file
+ * src/abstract_parser/abstract_parser_comment_scanner_subscribe_filtered.c
+ *
+ * \brief Send a filtered subscription request to the \ref comment_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/message/subscription.h>
+#include <libcparse/message_type.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_message_subscription;
+
+/**
+ * \brief Subscribe to \ref comment_scanner events, receiving only the event
+ * types selected by the given filter.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ * \param filter            The filter for this subscription, or NULL to receive
+ *                          all events.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int
+CPARSE_SYM(abstract_parser_comment_scanner_subscribe_filtered)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter)
+{
+    int retval, release_retval;
+    message_subscribe msg;
+
+    /* initialize the message. */
+    retval = message_subscribe_init_for_comment_scanner(&msg, eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* set the filter for this subscription. */
+    message_subscribe_filter_set(&msg, filter);
+
+    /* send the message. */
+    retval = message_handler_send(&ap->mh, message_subscribe_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_subscribe_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -8,9 +8,11 @@
  */
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/intern_table.h>
 #include <libcparse/status_codes.h>
 #include <string.h>
 
+CPARSE_IMPORT_intern_table;
 CPARSE_IMPORT_message_handler;
 
 /**
@@ -25,12 +27,24 @@ CPARSE_IMPORT_message_handler;
 int CPARSE_SYM(abstract_parser_dispose)(CPARSE_SYM(abstract_parser)* ap)
 {
     int mh_dispose_retval = STATUS_SUCCESS;
+    int files_release_retval = STATUS_SUCCESS;
 
     /* dispose the message handler. */
     mh_dispose_retval = message_handler_dispose(&ap->mh);
 
+    /* release the file table. */
+    if (NULL != ap->files)
+    {
+        files_release_retval = intern_table_release(ap->files);
+    }
+
     /* clear the structure. */
     memset(ap, 0, sizeof(*ap));
 
-    return mh_dispose_retval;
+    if (STATUS_SUCCESS != mh_dispose_retval)
+    {
+        return mh_dispose_retval;
+    }
+
+    return files_release_retval;
 }
@@ -0,0 +1,61 @@
+/**
+ * \file src/abstract_parser/abstract_parser_feed.c
+ *
+ * \brief Send a feed message to the \ref abstract_parser.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/message/raw_stack_scanner.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_message_raw_stack_scanner;
+
+/**
+ * \brief Feed bytes to an abstract parser instance.
+ *
+ * \param ap                    The abstract parser instance for this operation.
+ * \param buf                   The bytes to feed.
+ * \param size                  The number of bytes in \p buf.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(abstract_parser_feed)(
+    CPARSE_SYM(abstract_parser)* ap, const void* buf, size_t size)
+{
+    int retval, release_retval;
+    message_rss_feed msg;
+
+    /* initialize the message. */
+    retval = message_rss_feed_init(&msg, buf, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the message. */
+    retval = message_handler_send(&ap->mh, message_rss_feed_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_rss_feed_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
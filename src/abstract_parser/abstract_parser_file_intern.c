@@ -0,0 +1,40 @@
+/**
+ * \file src/abstract_parser/abstract_parser_file_intern.c
+ *
+ * \brief Intern a file name in the \ref abstract_parser file table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Intern a file name in the file table for this parser.
+ *
+ * Each distinct file name is copied into the table once. The interned name and
+ * its ID remain valid until this parser is disposed, so a \ref cursor can refer
+ * to them without copying. File ID \ref CPARSE_CURSOR_FILE_ID_NONE is always
+ * "(null)".
+ *
+ * \param file              Pointer to receive the interned file name on
+ *                          success. This string is owned by the parser.
+ * \param file_id           Pointer to receive the file ID on success.
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param name              The file name to intern.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(abstract_parser_file_intern)(
+    const char** file, uint32_t* file_id, CPARSE_SYM(abstract_parser)* ap,
+    const char* name)
+{
+    return intern_table_intern(file, file_id, ap->files, name, strlen(name));
+}
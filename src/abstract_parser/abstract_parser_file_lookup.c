@@ -0,0 +1,33 @@
+/**
+ * \file src/abstract_parser/abstract_parser_file_lookup.c
+ *
+ * \brief Look up a file name in the \ref abstract_parser file table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Look up a file name by its ID in the file table for this parser.
+ *
+ * \param file              Pointer to receive the interned file name on
+ *                          success. This string is owned by the parser.
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param file_id           The file ID to look up.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL if this file ID has not been
+ *        assigned by this parser.
+ */
+int CPARSE_SYM(abstract_parser_file_lookup)(
+    const char** file, CPARSE_SYM(abstract_parser)* ap, uint32_t file_id)
+{
+    return intern_table_lookup(file, ap->files, file_id);
+}
@@ -8,10 +8,11 @@
  */
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <string.h>
 
-CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
 
 /**
  * \brief Initialize an \ref abstract_parser from a root \ref message_handler.
@@ -27,21 +28,14 @@ int CPARSE_SYM(abstract_parser_init)(
     CPARSE_SYM(abstract_parser)* ap, const CPARSE_SYM(message_handler)* mh)
 {
     int retval;
+    allocator alloc;
 
-    /* clear the instance. */
-    memset(ap, 0, sizeof(*ap));
-
-    /* copy the message handler. */
-    retval = message_handler_init_copy(&ap->mh, mh);
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
     if (STATUS_SUCCESS != retval)
     {
-        goto done;
+        return retval;
     }
 
-    /* success. */
-    retval = STATUS_SUCCESS;
-    goto done;
-
-done:
-    return retval;
+    return abstract_parser_init_with_allocator(ap, mh, &alloc);
 }
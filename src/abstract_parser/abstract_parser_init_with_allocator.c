@@ -0,0 +1,89 @@
+/**
+ * \file src/abstract_parser/abstract_parser_init_with_allocator.c
+ *
+ * \brief Init method for the \ref abstract_parser type with an allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
+#include <libcparse/cursor.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_message_handler;
+
+/**
+ * \brief Initialize an \ref abstract_parser from a root \ref message_handler
+ * that uses the given allocator for its memory.
+ *
+ * This also creates the file table for this parser, in which the unnamed file
+ * is always interned first.
+ *
+ * \param ap                    The abstract parser instance to initialize.
+ * \param mh                    The root \ref message_handler for this parser.
+ * \param alloc                 The allocator for this parser, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(abstract_parser_init_with_allocator)(
+    CPARSE_SYM(abstract_parser)* ap, const CPARSE_SYM(message_handler)* mh,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    const char* file;
+    uint32_t file_id;
+
+    /* clear the instance. */
+    memset(ap, 0, sizeof(*ap));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&ap->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the file table. */
+    retval = intern_table_create_with_allocator(&ap->files, true, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the unnamed file always has the first file ID. */
+    retval = intern_table_intern(&file, &file_id, ap->files, "(null)", 6);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_files;
+    }
+
+    /* copy the message handler. */
+    retval = message_handler_init_copy(&ap->mh, mh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_files;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_files:
+    release_retval = intern_table_release(ap->files);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    ap->files = NULL;
+
+done:
+    return retval;
+}
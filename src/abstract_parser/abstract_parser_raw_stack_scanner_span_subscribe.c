@@ -0,0 +1,32 @@
+/**
+ * \file src/abstract_parser/abstract_parser_raw_stack_scanner_span_subscribe.c
+ *
+ * \brief Send a span subscription request to the \ref raw_stack_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <stddef.h>
+
+CPARSE_IMPORT_abstract_parser;
+
+/**
+ * \brief Subscribe to \ref raw_stack_scanner raw span events.
+ *
+ * \param ap                The \ref abstract_parser for this operation.
+ * \param eh                The event handler to add to the subscription list.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int
+CPARSE_SYM(abstract_parser_raw_stack_scanner_span_subscribe)(
+    CPARSE_SYM(abstract_parser)* ap, CPARSE_SYM(event_handler)* eh)
+{
+    return
+        abstract_parser_raw_stack_scanner_span_subscribe_filtered(
+            ap, eh, NULL);
+}
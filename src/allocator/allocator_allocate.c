@@ -0,0 +1,24 @@
+/**
+ * \file src/allocator/allocator_allocate.c
+ *
+ * \brief Allocate a block of memory from an \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+
+/**
+ * \brief Allocate a block of memory from an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(allocator_allocate)(
+    const CPARSE_SYM(allocator)* alloc, size_t size)
+{
+    return alloc->allocate(alloc->context, size);
+}
@@ -0,0 +1,30 @@
+/**
+ * \file src/allocator/allocator_dispose.c
+ *
+ * \brief Dispose an \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+/**
+ * \brief Dispose an \ref allocator instance.
+ *
+ * \param alloc                 The allocator instance to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(allocator_dispose)(CPARSE_SYM(allocator)* alloc)
+{
+    /* clear instance data. */
+    memset(alloc, 0, sizeof(*alloc));
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
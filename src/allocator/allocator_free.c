@@ -0,0 +1,25 @@
+/**
+ * \file src/allocator/allocator_free.c
+ *
+ * \brief Return a block of memory to an \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+
+/**
+ * \brief Return a block of memory to an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param block                 The block to free, or NULL.
+ */
+void CPARSE_SYM(allocator_free)(
+    const CPARSE_SYM(allocator)* alloc, void* block)
+{
+    if (NULL != block)
+    {
+        alloc->deallocate(alloc->context, block);
+    }
+}
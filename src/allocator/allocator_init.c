@@ -0,0 +1,47 @@
+/**
+ * \file src/allocator/allocator_init.c
+ *
+ * \brief Initialize an \ref allocator from a set of allocation functions.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+/**
+ * \brief Initialize an \ref allocator from a set of allocation functions and a
+ * context.
+ *
+ * An allocator is copied into each object created with it, so it does not need
+ * to outlive these objects, but its context does.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param allocate              The function used to allocate memory.
+ * \param reallocate            The function used to resize memory.
+ * \param free_fn               The function used to free memory.
+ * \param context               The allocator user context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(allocator_init)(
+    CPARSE_SYM(allocator)* alloc, CPARSE_SYM(allocator_allocate_fn) allocate,
+    CPARSE_SYM(allocator_reallocate_fn) reallocate,
+    CPARSE_SYM(allocator_free_fn) free_fn, void* context)
+{
+    /* clear instance. */
+    memset(alloc, 0, sizeof(*alloc));
+
+    /* set values. */
+    alloc->allocate = allocate;
+    alloc->reallocate = reallocate;
+    alloc->deallocate = free_fn;
+    alloc->context = context;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
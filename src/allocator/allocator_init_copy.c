@@ -0,0 +1,32 @@
+/**
+ * \file src/allocator/allocator_init_copy.c
+ *
+ * \brief Initialize an \ref allocator by copying another \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+/**
+ * \brief Initialize an \ref allocator by copying another \ref allocator.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param other                 The allocator to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(allocator_init_copy)(
+    CPARSE_SYM(allocator)* alloc, const CPARSE_SYM(allocator)* other)
+{
+    /* copy instance data. */
+    memcpy(alloc, other, sizeof(*alloc));
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
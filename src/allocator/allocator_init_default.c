@@ -0,0 +1,81 @@
+/**
+ * \file src/allocator/allocator_init_default.c
+ *
+ * \brief Initialize an \ref allocator that uses the C standard library heap.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <stdlib.h>
+
+CPARSE_IMPORT_allocator;
+
+/* forward decls. */
+static void* default_allocate(void* context, size_t size);
+static void* default_reallocate(void* context, void* block, size_t size);
+static void default_free(void* context, void* block);
+
+/**
+ * \brief Initialize an \ref allocator that uses the C standard library heap.
+ *
+ * This is the allocator used by objects created without one.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(allocator_init_default)(CPARSE_SYM(allocator)* alloc)
+{
+    return
+        allocator_init(
+            alloc, &default_allocate, &default_reallocate, &default_free,
+            NULL);
+}
+
+/**
+ * \brief Allocate a block of memory with malloc.
+ *
+ * \param context               Unused.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+static void* default_allocate(void* context, size_t size)
+{
+    (void)context;
+
+    return malloc(size);
+}
+
+/**
+ * \brief Resize a block of memory with realloc.
+ *
+ * \param context               Unused.
+ * \param block                 The block to resize, or NULL.
+ * \param size                  The new size of the block.
+ *
+ * \returns the resized block on success, or NULL on failure.
+ */
+static void* default_reallocate(void* context, void* block, size_t size)
+{
+    (void)context;
+
+    return realloc(block, size);
+}
+
+/**
+ * \brief Free a block of memory with free.
+ *
+ * \param context               Unused.
+ * \param block                 The block to free.
+ */
+static void default_free(void* context, void* block)
+{
+    (void)context;
+
+    free(block);
+}
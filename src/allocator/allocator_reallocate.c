@@ -0,0 +1,27 @@
+/**
+ * \file src/allocator/allocator_reallocate.c
+ *
+ * \brief Resize a block of memory from an \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+
+/**
+ * \brief Resize a block of memory from an \ref allocator.
+ *
+ * \param alloc                 The allocator for this operation.
+ * \param block                 The block to resize, or NULL to allocate a new
+ *                              block.
+ * \param size                  The new size of the block.
+ *
+ * \returns the resized block on success, or NULL on failure, in which case the
+ * original block is left unchanged.
+ */
+void* CPARSE_SYM(allocator_reallocate)(
+    const CPARSE_SYM(allocator)* alloc, void* block, size_t size)
+{
+    return alloc->reallocate(alloc->context, block, size);
+}
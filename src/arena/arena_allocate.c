@@ -0,0 +1,40 @@
+/**
+ * \file src/arena/arena_allocate.c
+ *
+ * \brief Allocate memory from an \ref arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_arena_internal;
+
+/**
+ * \brief Allocate a block of memory from an \ref arena.
+ *
+ * \param a                     The \ref arena for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(arena_allocate)(CPARSE_SYM(arena)* a, size_t size)
+{
+    void* ptr;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_lock(&a->lock);
+    }
+
+    ptr = arena_allocate_unlocked(a, size);
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_unlock(&a->lock);
+    }
+
+    return ptr;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file src/arena/arena_allocate_unlocked.c
+ *
+ * \brief Allocate memory from an \ref arena without taking its lock.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_arena_internal;
+
+/**
+ * \brief Allocate a block of memory from an \ref arena without taking its
+ * lock.
+ *
+ * \param a                     The \ref arena for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(arena_allocate_unlocked)(CPARSE_SYM(arena)* a, size_t size)
+{
+    arena_block* block = a->blocks;
+    size_t span;
+    char* ptr;
+
+    /* guard against overflow when adding the header and padding. */
+    if (size > SIZE_MAX - 2 * CPARSE_ARENA_HEADER_SIZE)
+    {
+        return NULL;
+    }
+
+    span = CPARSE_ARENA_HEADER_SIZE + CPARSE_ARENA_ALIGN(size);
+
+    /* start a new block if the current one is full. */
+    if (NULL == block || block->size - block->used < span)
+    {
+        size_t block_size = a->block_size;
+
+        /* large allocations get a block of their own. */
+        if (span > block_size)
+        {
+            block_size = span;
+        }
+
+        block = (arena_block*)malloc(sizeof(*block) + block_size);
+        if (NULL == block)
+        {
+            return NULL;
+        }
+
+        block->size = block_size;
+        block->used = 0;
+        block->next = a->blocks;
+        a->blocks = block;
+    }
+
+    /* bump the offset past this allocation. */
+    ptr = (char*)block->data + block->used;
+    block->used += span;
+    a->used += span;
+
+    /* record the size, so that this allocation can be resized. */
+    *(size_t*)ptr = size;
+
+    return ptr + CPARSE_ARENA_HEADER_SIZE;
+}
@@ -0,0 +1,190 @@
+/**
+ * \file src/arena/arena_allocator_init.c
+ *
+ * \brief Initialize an \ref allocator backed by an \ref arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_arena_internal;
+
+static void* arena_allocator_allocate(void* context, size_t size);
+static void* arena_allocator_reallocate(
+    void* context, void* block, size_t size);
+static void arena_allocator_free(void* context, void* block);
+static bool is_last_allocation(arena* a, const char* header, size_t span);
+
+/**
+ * \brief Initialize an \ref allocator that allocates from the given arena.
+ *
+ * \param alloc                 The allocator instance to initialize.
+ * \param a                     The \ref arena to allocate from.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(arena_allocator_init)(
+    CPARSE_SYM(allocator)* alloc, CPARSE_SYM(arena)* a)
+{
+    return
+        allocator_init(
+            alloc, &arena_allocator_allocate, &arena_allocator_reallocate,
+            &arena_allocator_free, a);
+}
+
+/**
+ * \brief Allocate a block of memory from the arena.
+ *
+ * \param context               The \ref arena.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+static void* arena_allocator_allocate(void* context, size_t size)
+{
+    return arena_allocate((arena*)context, size);
+}
+
+/**
+ * \brief Resize a block of memory allocated from the arena.
+ *
+ * The most recent allocation grows in place while there is room in its block.
+ * Any other allocation is copied to a new allocation, and the old one is left
+ * to be reclaimed with the rest of the arena.
+ *
+ * \param context               The \ref arena.
+ * \param block                 The block to resize, or NULL to allocate one.
+ * \param size                  The new size of the block.
+ *
+ * \returns the resized block on success, or NULL on failure.
+ */
+static void* arena_allocator_reallocate(
+    void* context, void* block, size_t size)
+{
+    arena* a = (arena*)context;
+    char* header;
+    size_t old_size, old_span, new_span;
+    void* ptr;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_lock(&a->lock);
+    }
+
+    /* a NULL block is a plain allocation. */
+    if (NULL == block)
+    {
+        ptr = arena_allocate_unlocked(a, size);
+        goto unlock;
+    }
+
+    /* guard against overflow when adding the header and padding. */
+    if (size > SIZE_MAX - 2 * CPARSE_ARENA_HEADER_SIZE)
+    {
+        ptr = NULL;
+        goto unlock;
+    }
+
+    header = (char*)block - CPARSE_ARENA_HEADER_SIZE;
+    old_size = *(size_t*)header;
+    old_span = CPARSE_ARENA_HEADER_SIZE + CPARSE_ARENA_ALIGN(old_size);
+    new_span = CPARSE_ARENA_HEADER_SIZE + CPARSE_ARENA_ALIGN(size);
+
+    /* grow or shrink the most recent allocation in place if it fits. */
+    if (
+        is_last_allocation(a, header, old_span)
+     && a->blocks->size - (a->blocks->used - old_span) >= new_span)
+    {
+        a->blocks->used = a->blocks->used - old_span + new_span;
+        a->used = a->used - old_span + new_span;
+        *(size_t*)header = size;
+        ptr = block;
+        goto unlock;
+    }
+
+    /* a smaller size always fits in the existing allocation. */
+    if (size <= old_size)
+    {
+        *(size_t*)header = size;
+        ptr = block;
+        goto unlock;
+    }
+
+    /* otherwise, copy it to a new allocation. */
+    ptr = arena_allocate_unlocked(a, size);
+    if (NULL != ptr)
+    {
+        memcpy(ptr, block, old_size);
+    }
+
+unlock:
+    if (a->thread_safe)
+    {
+        pthread_mutex_unlock(&a->lock);
+    }
+
+    return ptr;
+}
+
+/**
+ * \brief Free a block of memory allocated from the arena.
+ *
+ * Only the most recent allocation is reclaimed. Every other block is reclaimed
+ * when the arena is reset or released.
+ *
+ * \param context               The \ref arena.
+ * \param block                 The block to free.
+ */
+static void arena_allocator_free(void* context, void* block)
+{
+    arena* a = (arena*)context;
+    char* header = (char*)block - CPARSE_ARENA_HEADER_SIZE;
+    size_t span;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_lock(&a->lock);
+    }
+
+    span = CPARSE_ARENA_HEADER_SIZE + CPARSE_ARENA_ALIGN(*(size_t*)header);
+
+    /* roll back the most recent allocation. */
+    if (is_last_allocation(a, header, span))
+    {
+        a->blocks->used -= span;
+        a->used -= span;
+    }
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_unlock(&a->lock);
+    }
+}
+
+/**
+ * \brief Determine whether an allocation is the most recent one in an arena.
+ *
+ * \param a                     The \ref arena to check.
+ * \param header                The header of the allocation.
+ * \param span                  The span of the allocation, including its
+ *                              header.
+ *
+ * \returns true if this is the most recent allocation, or false otherwise.
+ */
+static bool is_last_allocation(arena* a, const char* header, size_t span)
+{
+    return
+        NULL != a->blocks
+     && header + span == (const char*)a->blocks->data + a->blocks->used;
+}
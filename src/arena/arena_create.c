@@ -0,0 +1,77 @@
+/**
+ * \file src/arena/arena_create.c
+ *
+ * \brief Create method for the \ref arena type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_arena;
+
+/**
+ * \brief Create an \ref arena instance.
+ *
+ * \param a                     Pointer to the \ref arena pointer to set to the
+ *                              created instance on success.
+ * \param block_size            The size of each block, or 0 to use
+ *                              CPARSE_ARENA_DEFAULT_BLOCK_SIZE. Larger
+ *                              allocations get a block of their own.
+ * \param thread_safe           If true, every method on this arena is guarded
+ *                              by a lock.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(arena_create)(
+    CPARSE_SYM(arena)** a, size_t block_size, bool thread_safe)
+{
+    int retval;
+    arena* tmp;
+
+    /* allocate memory for this instance. */
+    tmp = (arena*)malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* blocks are allocated on demand. */
+    tmp->block_size =
+        (0 == block_size) ? CPARSE_ARENA_DEFAULT_BLOCK_SIZE : block_size;
+
+    /* a shared arena needs a lock. */
+    if (thread_safe)
+    {
+        if (0 != pthread_mutex_init(&tmp->lock, NULL))
+        {
+            retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+            goto cleanup_tmp;
+        }
+
+        tmp->thread_safe = true;
+    }
+
+    /* success. */
+    *a = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+done:
+    return retval;
+}
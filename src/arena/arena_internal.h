@@ -0,0 +1,99 @@
+/**
+ * \file src/arena/arena_internal.h
+ *
+ * \brief Internal details for the \ref arena type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/arena.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Every allocation is aligned for any type.
+ */
+#define CPARSE_ARENA_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * \brief Round a size up to the arena alignment.
+ */
+#define CPARSE_ARENA_ALIGN(x) \
+    (((x) + CPARSE_ARENA_ALIGNMENT - 1) & ~(CPARSE_ARENA_ALIGNMENT - 1))
+
+/**
+ * \brief Each allocation is preceded by its size, so that it can be resized.
+ */
+#define CPARSE_ARENA_HEADER_SIZE CPARSE_ARENA_ALIGN(sizeof(size_t))
+
+typedef struct CPARSE_SYM(arena_block) CPARSE_SYM(arena_block);
+
+/**
+ * \brief A block of arena memory. Allocations are bumped through the data of
+ * the most recent block.
+ */
+struct CPARSE_SYM(arena_block)
+{
+    CPARSE_SYM(arena_block)* next;
+    size_t size;
+    size_t used;
+    max_align_t data[];
+};
+
+/**
+ * \brief The arena is a list of blocks, most recent first.
+ */
+struct CPARSE_SYM(arena)
+{
+    bool thread_safe;
+    pthread_mutex_t lock;
+    CPARSE_SYM(arena_block)* blocks;
+    size_t block_size;
+    size_t used;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Allocate a block of memory from an \ref arena without taking its
+ * lock.
+ *
+ * \param a                     The \ref arena for this operation.
+ * \param size                  The size of the block to allocate.
+ *
+ * \returns the block on success, or NULL on failure.
+ */
+void* CPARSE_SYM(arena_allocate_unlocked)(CPARSE_SYM(arena)* a, size_t size);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_arena_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(arena_block) sym ## arena_block; \
+    static inline void* sym ## arena_allocate_unlocked( \
+        CPARSE_SYM(arena)* x, size_t y) { \
+            return CPARSE_SYM(arena_allocate_unlocked)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_arena_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_arena_internal_sym(sym ## _)
+#define CPARSE_IMPORT_arena_internal \
+    __INTERNAL_CPARSE_IMPORT_arena_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
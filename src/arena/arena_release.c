@@ -0,0 +1,56 @@
+/**
+ * \file src/arena/arena_release.c
+ *
+ * \brief Release method for the \ref arena type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_arena_internal;
+
+/**
+ * \brief Release an \ref arena instance, along with every block of memory
+ * allocated from it.
+ *
+ * \param a                     The \ref arena instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(arena_release)(CPARSE_SYM(arena)* a)
+{
+    arena_block* block = a->blocks;
+
+    /* release every block in one pass. */
+    while (NULL != block)
+    {
+        arena_block* next = block->next;
+
+        memset(block, 0, sizeof(*block) + block->size);
+        free(block);
+        block = next;
+    }
+
+    /* release the lock. */
+    if (a->thread_safe)
+    {
+        pthread_mutex_destroy(&a->lock);
+    }
+
+    /* clear instance memory. */
+    memset(a, 0, sizeof(*a));
+
+    /* free instance memory. */
+    free(a);
+
+    return STATUS_SUCCESS;
+}
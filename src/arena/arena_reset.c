@@ -0,0 +1,55 @@
+/**
+ * \file src/arena/arena_reset.c
+ *
+ * \brief Reset an \ref arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena_internal.h"
+
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_arena_internal;
+
+/**
+ * \brief Reset an \ref arena, reclaiming all of the memory allocated from it.
+ *
+ * \param a                     The \ref arena to reset.
+ */
+void CPARSE_SYM(arena_reset)(CPARSE_SYM(arena)* a)
+{
+    arena_block* block;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_lock(&a->lock);
+    }
+
+    /* keep the most recent block, and release the rest. */
+    if (NULL != a->blocks)
+    {
+        block = a->blocks->next;
+        while (NULL != block)
+        {
+            arena_block* next = block->next;
+
+            memset(block, 0, sizeof(*block) + block->size);
+            free(block);
+            block = next;
+        }
+
+        a->blocks->next = NULL;
+        a->blocks->used = 0;
+    }
+
+    a->used = 0;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_unlock(&a->lock);
+    }
+}
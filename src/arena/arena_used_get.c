@@ -0,0 +1,36 @@
+/**
+ * \file src/arena/arena_used_get.c
+ *
+ * \brief Get the number of bytes allocated from an \ref arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "arena_internal.h"
+
+/**
+ * \brief Get the number of bytes currently allocated from an \ref arena.
+ *
+ * \param a                     The \ref arena to query.
+ *
+ * \returns the number of bytes allocated, including alignment and bookkeeping.
+ */
+size_t CPARSE_SYM(arena_used_get)(CPARSE_SYM(arena)* a)
+{
+    size_t used;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_lock(&a->lock);
+    }
+
+    used = a->used;
+
+    if (a->thread_safe)
+    {
+        pthread_mutex_unlock(&a->lock);
+    }
+
+    return used;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file checkpoint/checkpoint_cursor_restore.c
+ *
+ * \brief Restore a position from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/checkpoint.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+
+/**
+ * \brief Restore a position from a checkpoint, interning its file name in the
+ * file table of the given parser.
+ *
+ * A position saved without a file name is restored with a NULL file.
+ *
+ * \param pos               The position to populate.
+ * \param ap                The parser whose file table receives the file.
+ * \param ckpt              The checkpoint position to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if the file name is not
+ *        terminated.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(checkpoint_cursor_restore)(
+    CPARSE_SYM(cursor)* pos, CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(checkpoint_cursor)* ckpt)
+{
+    int retval;
+    cursor tmp;
+
+    memcpy(&tmp, &ckpt->pos, sizeof(tmp));
+    tmp.file = NULL;
+    tmp.file_id = CPARSE_CURSOR_FILE_ID_NONE;
+
+    /* a position saved without a file name has no file. */
+    if (!ckpt->has_file)
+    {
+        memcpy(pos, &tmp, sizeof(*pos));
+        return STATUS_SUCCESS;
+    }
+
+    /* the file name must be terminated within the checkpoint. */
+    if (NULL == memchr(ckpt->file, 0, sizeof(ckpt->file)))
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* intern the file in this parser. */
+    retval =
+        abstract_parser_file_intern(&tmp.file, &tmp.file_id, ap, ckpt->file);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(pos, &tmp, sizeof(*pos));
+
+    return STATUS_SUCCESS;
+}
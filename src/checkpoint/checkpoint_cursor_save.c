@@ -0,0 +1,57 @@
+/**
+ * \file checkpoint/checkpoint_cursor_save.c
+ *
+ * \brief Save a position to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+
+/**
+ * \brief Save a position to a checkpoint, copying its file name.
+ *
+ * A position with a NULL file is saved without a file name.
+ *
+ * \param ckpt              The checkpoint position to populate.
+ * \param pos               The position to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if the file name does
+ *        not fit in the checkpoint.
+ */
+int CPARSE_SYM(checkpoint_cursor_save)(
+    CPARSE_SYM(checkpoint_cursor)* ckpt, const CPARSE_SYM(cursor)* pos)
+{
+    size_t file_size;
+
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    /* the file pointer belongs to the parser that saves this position. */
+    memcpy(&ckpt->pos, pos, sizeof(ckpt->pos));
+    ckpt->pos.file = NULL;
+
+    if (NULL == pos->file)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* the name and its terminator must fit in the checkpoint. */
+    file_size = strlen(pos->file) + 1;
+    if (file_size > CPARSE_CHECKPOINT_FILE_NAME_SIZE)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG;
+    }
+
+    ckpt->has_file = true;
+    memcpy(ckpt->file, pos->file, file_size);
+
+    return STATUS_SUCCESS;
+}
@@ -10,8 +10,10 @@
 #include <libcparse/comment_filter.h>
 #include <libcparse/event.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/raw_span.h>
 #include <string.h>
 
 #include "comment_filter_internal.h"
@@ -21,10 +23,13 @@ CPARSE_IMPORT_comment_filter_internal;
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_util_raw_span;
 
 static int process_char_event(comment_filter* filter, const event* ev);
+static int process_span_event(comment_filter* filter, const event* ev);
 static int process_eof_event(comment_filter* filter, const event* ev);
 
 /**
@@ -53,6 +58,9 @@ int CPARSE_SYM(comment_filter_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return process_char_event(filter, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return process_span_event(filter, ev);
+
         case CPARSE_EVENT_TYPE_COMMENT_BLOCK_BEGIN:
             /* get the current position. */
             pos = event_get_cursor(ev);
@@ -142,3 +150,47 @@ static int process_char_event(comment_filter* filter, const event* ev)
             return ERROR_LIBCPARSE_COMMENT_BAD_STATE;
     }
 }
+
+/**
+ * \brief Process a raw span event.
+ *
+ * A span is forwarded or skipped as a whole, like a raw character. If a
+ * subscriber needs raw characters, then a forwarded span is broken up into
+ * character events.
+ *
+ * \param filter            The \ref comment_filter for this operation.
+ * \param ev                The raw span event to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int process_span_event(comment_filter* filter, const event* ev)
+{
+    int retval;
+    event_raw_span* rsev;
+    cursor pos;
+
+    /* break up a forwarded span if a subscriber needs characters. */
+    if (
+        CPARSE_COMMENT_FILTER_STATE_INIT == filter->state
+     && !event_reactor_accepts_raw_spans(filter->reactor))
+    {
+        /* dynamic cast the message. */
+        retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* start at the first character of the span. */
+        raw_span_start_position(&pos, ev);
+
+        return
+            raw_span_send_characters(
+                &comment_filter_event_callback, filter, &pos,
+                event_raw_span_get(rsev), event_raw_span_size_get(rsev));
+    }
+
+    return process_char_event(filter, ev);
+}
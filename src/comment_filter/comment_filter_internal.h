@@ -10,6 +10,7 @@
 #pragma once
 
 #include <libcparse/abstract_parser_fwd.h>
+#include <libcparse/allocator.h>
 #include <libcparse/comment_scanner.h>
 #include <libcparse/event_reactor_fwd.h>
 #include <libcparse/file_position_cache.h>
@@ -30,6 +31,7 @@ struct CPARSE_SYM(comment_filter)
     CPARSE_SYM(message_handler) parent_mh;
     CPARSE_SYM(file_position_cache)* cache;
     int state;
+    CPARSE_SYM(allocator) alloc;
 };
 
 enum CPARSE_SYM(comment_filter_state)
@@ -11,21 +11,25 @@
 #include <libcparse/event_handler.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message.h>
+#include <libcparse/message/checkpoint.h>
 #include <libcparse/message/subscription.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/status_codes.h>
 
 #include "comment_filter_internal.h"
 
+CPARSE_IMPORT_checkpoint;
 CPARSE_IMPORT_comment_filter;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_checkpoint;
 CPARSE_IMPORT_message_handler;
 CPARSE_IMPORT_message_subscription;
 
 static int subscribe(comment_filter* filter, const message* msg);
 
+static int checkpoint(comment_filter* filter, const message* msg);
 /**
  * \brief Message handler callback for \ref comment_filter.
  *
@@ -47,6 +51,10 @@ int CPARSE_SYM(comment_filter_message_callback)(
         case CPARSE_MESSAGE_TYPE_COMMENT_FILTER_SUBSCRIBE:
             return subscribe(filter, msg);
 
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE:
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE:
+            return checkpoint(filter, msg);
+
         default:
             return message_handler_send(&filter->parent_mh, msg);
     }
@@ -79,7 +87,9 @@ static int subscribe(comment_filter* filter, const message* msg)
     eh = message_subscribe_event_handler_get(m);
 
     /* add this handler to our reactor. */
-    retval = event_reactor_add(filter->reactor, eh);
+    retval =
+        event_reactor_add_filtered(
+            filter->reactor, eh, message_subscribe_filter_get(m));
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -92,3 +102,53 @@ static int subscribe(comment_filter* filter, const message* msg)
 done:
     return retval;
 }
+
+/**
+ * \brief Save or restore the part of a checkpoint for this filter.
+ *
+ * The parent stages are saved after this filter, and restored before it.
+ *
+ * \param filter            The filter for this operation.
+ * \param msg               The message for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int checkpoint(comment_filter* filter, const message* msg)
+{
+    int retval;
+    message_checkpoint* m;
+    abstract_parser_checkpoint* ckpt;
+
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_checkpoint(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ckpt = message_checkpoint_get(m);
+
+    /* save our state, then pass the message on to our parent. */
+    if (CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE == message_get_type(msg))
+    {
+        retval =
+            comment_filter_checkpoint_save(&ckpt->comment_filter, filter);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        return message_handler_send(&filter->parent_mh, msg);
+    }
+
+    /* restore our parent, then our state. */
+    retval = message_handler_send(&filter->parent_mh, msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return comment_filter_checkpoint_restore(filter, &ckpt->comment_filter);
+}
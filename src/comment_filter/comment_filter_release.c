@@ -7,14 +7,15 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "comment_filter_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_comment_filter_internal;
 CPARSE_IMPORT_comment_scanner;
 CPARSE_IMPORT_event_reactor;
@@ -37,6 +38,10 @@ int CPARSE_SYM(comment_filter_release)(CPARSE_SYM(comment_filter)* filter)
     int reactor_release_retval = STATUS_SUCCESS;
     int cache_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &filter->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != filter->parent)
@@ -63,7 +68,7 @@ int CPARSE_SYM(comment_filter_release)(CPARSE_SYM(comment_filter)* filter)
     memset(filter, 0, sizeof(*filter));
 
     /* free filter memory. */
-    free(filter);
+    allocator_free(&alloc, filter);
 
     /* decode return value. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -0,0 +1,55 @@
+/**
+ * \file src/comment_scanner/comment_scanner_checkpoint_restore.c
+ *
+ * \brief Restore the state of a \ref comment_scanner from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/comment_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "comment_scanner_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_comment_scanner;
+
+/**
+ * \brief Restore the state of a comment scanner from a checkpoint.
+ *
+ * \param scanner           The \ref comment_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(comment_scanner_checkpoint_restore)(
+    CPARSE_SYM(comment_scanner)* scanner,
+    const CPARSE_SYM(comment_scanner_checkpoint)* ckpt)
+{
+    int retval;
+
+    /* verify that this is one of our states. */
+    if (
+        ckpt->state < 0
+     || ckpt->state > CPARSE_COMMENT_SCANNER_STATE_IN_STRING_BACKSLASH)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* restore the cached position. */
+    retval =
+        file_position_cache_checkpoint_restore(
+            scanner->cache, scanner->base, &ckpt->cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    scanner->state = ckpt->state;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file src/comment_scanner/comment_scanner_checkpoint_save.c
+ *
+ * \brief Save the state of a \ref comment_scanner to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/comment_scanner.h>
+#include <string.h>
+
+#include "comment_scanner_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_comment_scanner;
+
+/**
+ * \brief Save the state of a comment scanner to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref comment_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int CPARSE_SYM(comment_scanner_checkpoint_save)(
+    CPARSE_SYM(comment_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(comment_scanner)* scanner)
+{
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    ckpt->state = scanner->state;
+
+    return file_position_cache_checkpoint_save(&ckpt->cache, scanner->cache);
+}
@@ -10,8 +10,11 @@
 #include <libcparse/comment_scanner.h>
 #include <libcparse/event.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/char_scan.h>
+#include <libcparse/util/raw_span.h>
 #include <string.h>
 
 #include "comment_scanner_internal.h"
@@ -21,10 +24,15 @@ CPARSE_IMPORT_comment_scanner_internal;
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_util_char_scan;
+CPARSE_IMPORT_util_raw_span;
 
 static int process_char_event(comment_scanner* scanner, const event* ev);
+static int process_span_event(comment_scanner* scanner, const event* ev);
+static const char* span_stop_set(int state, size_t* set_size);
 static int process_char_event_init(
     comment_scanner* scanner, const event_raw_character* ev, int ch);
 static int process_char_event_slash(
@@ -77,6 +85,9 @@ int CPARSE_SYM(comment_scanner_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return process_char_event(scanner, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return process_span_event(scanner, ev);
+
         default:
             return STATUS_SUCCESS;
     }
@@ -244,6 +255,129 @@ done:
     return retval;
 }
 
+/**
+ * \brief Process a span event.
+ *
+ * In states where most characters are passed on unchanged, the run of such
+ * characters is found with a vectorized search for the characters that change
+ * the state, and passed on as a span. Each character that stops a run, and
+ * each character in any other state, is processed as a character event. If
+ * any subscriber needs raw characters, then the whole span is processed one
+ * character at a time.
+ *
+ * \param scanner           The \ref comment_scanner for this operation.
+ * \param ev                The raw span event to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int process_span_event(comment_scanner* scanner, const event* ev)
+{
+    int retval;
+    event_raw_span* rsev;
+    const char* set;
+    size_t set_size, run;
+    cursor pos;
+
+    /* dynamic cast the message. */
+    retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    const char* span = event_raw_span_get(rsev);
+    size_t size = event_raw_span_size_get(rsev);
+
+    /* start at the first character of the span. */
+    raw_span_start_position(&pos, ev);
+
+    /* break up the span if a subscriber needs characters. */
+    if (!event_reactor_accepts_raw_spans(scanner->reactor))
+    {
+        return
+            raw_span_send_characters(
+                &comment_scanner_event_callback, scanner, &pos, span, size);
+    }
+
+    while (size > 0)
+    {
+        /* pass on the run of characters that leave our state as is. */
+        set = span_stop_set(scanner->state, &set_size);
+        if (NULL != set)
+        {
+            run = char_scan_any(span, size, set, set_size);
+
+            retval = raw_span_broadcast(scanner->reactor, &pos, span, run);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            span += run;
+            size -= run;
+            if (0 == size)
+            {
+                break;
+            }
+        }
+
+        /* process the next character on its own. */
+        retval =
+            raw_span_send_characters(
+                &comment_scanner_event_callback, scanner, &pos, span, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        span += 1;
+        size -= 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the set of characters that end a run in the given state.
+ *
+ * \param state             The scanner state.
+ * \param set_size          Pointer to receive the size of the set.
+ *
+ * \returns the set of characters, or NULL if characters must be processed one
+ * at a time in this state.
+ */
+static const char* span_stop_set(int state, size_t* set_size)
+{
+    switch (state)
+    {
+        case CPARSE_COMMENT_SCANNER_STATE_INIT:
+            *set_size = 3;
+            return "/\"'";
+
+        case CPARSE_COMMENT_SCANNER_STATE_IN_BLOCK_COMMENT:
+            *set_size = 1;
+            return "*";
+
+        case CPARSE_COMMENT_SCANNER_STATE_IN_LINE_COMMENT:
+            *set_size = 1;
+            return "\n";
+
+        case CPARSE_COMMENT_SCANNER_STATE_IN_STRING:
+            *set_size = 2;
+            return "\"\\";
+
+        case CPARSE_COMMENT_SCANNER_STATE_IN_CHAR_SEQUENCE:
+            *set_size = 2;
+            return "'\\";
+
+        default:
+            *set_size = 0;
+            return NULL;
+    }
+}
+
 /**
  * \brief Process a char event in init state.
  *
@@ -686,6 +820,7 @@ static int begin_block_comment_broadcast(
     /* update the end column and line. */
     pos.end_line = starpos->end_line;
     pos.end_col = starpos->end_col;
+    pos.end_offset = starpos->end_offset;
 
     /* initialize the begin block comment event. */
     retval = event_init_for_comment_block_begin(&bev, &pos);
@@ -755,6 +890,7 @@ static int end_block_comment_broadcast(
     /* update the end column and line. */
     pos.end_line = slashpos->end_line;
     pos.end_col = slashpos->end_col;
+    pos.end_offset = slashpos->end_offset;
 
     /* initialize the end block comment event. */
     retval = event_init_for_comment_block_end(&bev, &pos);
@@ -824,6 +960,7 @@ static int begin_line_comment_broadcast(
     /* update the end column and line. */
     pos.end_line = slashpos->end_line;
     pos.end_col = slashpos->end_col;
+    pos.end_offset = slashpos->end_offset;
 
     /* initialize the begin line comment event. */
     retval = event_init_for_comment_line_begin(&lev, &pos);
@@ -11,20 +11,24 @@
 #include <libcparse/event_handler.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message.h>
+#include <libcparse/message/checkpoint.h>
 #include <libcparse/message/subscription.h>
 #include <libcparse/status_codes.h>
 
 #include "comment_scanner_internal.h"
 
+CPARSE_IMPORT_checkpoint;
 CPARSE_IMPORT_comment_scanner;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_checkpoint;
 CPARSE_IMPORT_message_handler;
 CPARSE_IMPORT_message_subscription;
 
 static int subscribe(comment_scanner* scanner, const message* msg);
 
+static int checkpoint(comment_scanner* scanner, const message* msg);
 /**
  * \brief Message handler callback for \ref comment_scanner.
  *
@@ -46,6 +50,10 @@ int CPARSE_SYM(comment_scanner_message_callback)(
         case CPARSE_MESSAGE_TYPE_COMMENT_SCANNER_SUBSCRIBE:
             return subscribe(scanner, msg);
 
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE:
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE:
+            return checkpoint(scanner, msg);
+
         default:
             return message_handler_send(&scanner->parent_mh, msg);
     }
@@ -78,7 +86,9 @@ static int subscribe(comment_scanner* scanner, const message* msg)
     eh = message_subscribe_event_handler_get(m);
 
     /* add this handler to our reactor. */
-    retval = event_reactor_add(scanner->reactor, eh);
+    retval =
+        event_reactor_add_filtered(
+            scanner->reactor, eh, message_subscribe_filter_get(m));
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -91,3 +101,53 @@ static int subscribe(comment_scanner* scanner, const message* msg)
 done:
     return retval;
 }
+
+/**
+ * \brief Save or restore the part of a checkpoint for this scanner.
+ *
+ * The parent stages are saved after this scanner, and restored before it.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The message for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int checkpoint(comment_scanner* scanner, const message* msg)
+{
+    int retval;
+    message_checkpoint* m;
+    abstract_parser_checkpoint* ckpt;
+
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_checkpoint(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ckpt = message_checkpoint_get(m);
+
+    /* save our state, then pass the message on to our parent. */
+    if (CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE == message_get_type(msg))
+    {
+        retval =
+            comment_scanner_checkpoint_save(&ckpt->comment_scanner, scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        return message_handler_send(&scanner->parent_mh, msg);
+    }
+
+    /* restore our parent, then our state. */
+    retval = message_handler_send(&scanner->parent_mh, msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return comment_scanner_checkpoint_restore(scanner, &ckpt->comment_scanner);
+}
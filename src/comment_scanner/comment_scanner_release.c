@@ -7,14 +7,15 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "comment_scanner_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_comment_scanner_internal;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
@@ -37,6 +38,10 @@ int CPARSE_SYM(comment_scanner_release)(CPARSE_SYM(comment_scanner)* scanner)
     int reactor_release_retval = STATUS_SUCCESS;
     int cache_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &scanner->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != scanner->parent)
@@ -64,7 +69,7 @@ int CPARSE_SYM(comment_scanner_release)(CPARSE_SYM(comment_scanner)* scanner)
     memset(scanner, 0, sizeof(*scanner));
 
     /* free scanner memory. */
-    free(scanner);
+    allocator_free(&alloc, scanner);
 
     /* decode return value. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -48,6 +48,7 @@ int CPARSE_SYM(event_identifier_init)(
 
     /* initialize instance variables. */
     ev->id = id;
+    ev->symbol = CPARSE_INTERN_TABLE_NO_SYMBOL;
 
     /* success. */
     retval = STATUS_SUCCESS;
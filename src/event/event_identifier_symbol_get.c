@@ -0,0 +1,25 @@
+/**
+ * \file src/event/event_identifier_symbol_get.c
+ *
+ * \brief Get the symbol ID associated with this \ref event_identifier
+ * instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/identifier.h>
+
+/**
+ * \brief Get the symbol ID for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the symbol ID of this identifier, or CPARSE_INTERN_TABLE_NO_SYMBOL
+ * if it was not interned.
+ */
+uint32_t CPARSE_SYM(event_identifier_symbol_get)(
+    const CPARSE_SYM(event_identifier)* ev)
+{
+    return ev->symbol;
+}
@@ -8,12 +8,9 @@
  */
 
 #include <libcparse/event/raw_float.h>
-#include <libcparse/status_codes.h>
 #include <string.h>
 
-#include "event_internal.h"
-
-CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_event_raw_float;
 
 /**
  * \brief Perform an in-place initialization of an \ref event_raw_float_token
@@ -31,25 +28,7 @@ int CPARSE_SYM(event_raw_float_token_init)(
     CPARSE_SYM(event_raw_float_token)* ev, const CPARSE_SYM(cursor)* cursor,
     const char* val)
 {
-    int retval;
-
-    /* clear event memory. */
-    memset(ev, 0, sizeof(*ev));
-
-    /* initialize the base event. */
-    retval =
-        event_init(
-            &ev->hdr, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_FLOAT,
-            CPARSE_EVENT_CATEGORY_RAW_FLOAT_TOKEN, cursor);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* set the initial values. */
-    ev->has_sign = false;
-    ev->val = val;
-
-    /* success. */
-    return STATUS_SUCCESS;
+    return
+        event_raw_float_token_init_for_view(
+            ev, cursor, val, strlen(val));
 }
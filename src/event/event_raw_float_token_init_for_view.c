@@ -0,0 +1,58 @@
+/**
+ * \file src/event/event_raw_float_token_init_for_view.c
+ *
+ * \brief Initialize an \ref event_raw_float_token from a view.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_float.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "event_internal.h"
+
+CPARSE_IMPORT_event_internal;
+
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_float_token
+ * instance from a view of its value.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param val               The string representation of this token.
+ * \param size              The size of this representation in bytes, not
+ *                          counting its NUL terminator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int CPARSE_SYM(event_raw_float_token_init_for_view)(
+    CPARSE_SYM(event_raw_float_token)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* val, size_t size)
+{
+    int retval;
+
+    /* clear event memory. */
+    memset(ev, 0, sizeof(*ev));
+
+    /* initialize the base event. */
+    retval =
+        event_init(
+            &ev->hdr, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_FLOAT,
+            CPARSE_EVENT_CATEGORY_RAW_FLOAT_TOKEN, cursor);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* set the initial values. */
+    ev->has_sign = false;
+    ev->val = val;
+    ev->size = size;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
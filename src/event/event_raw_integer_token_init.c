@@ -9,12 +9,9 @@
 
 #include <libcparse/event.h>
 #include <libcparse/event/raw_integer.h>
-#include <libcparse/status_codes.h>
 #include <string.h>
 
-#include "event_internal.h"
-
-CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_event_raw_integer;
 
 /**
  * \brief Perform an in-place initialization of an \ref event_raw_integer_token
@@ -32,25 +29,7 @@ int CPARSE_SYM(event_raw_integer_token_init)(
     CPARSE_SYM(event_raw_integer_token)* ev, const CPARSE_SYM(cursor)* cursor,
     const char* val)
 {
-    int retval;
-
-    /* clear event memory. */
-    memset(ev, 0, sizeof(*ev));
-
-    /* initialize the base event. */
-    retval =
-        event_init(
-            &ev->hdr, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_INTEGER,
-            CPARSE_EVENT_CATEGORY_RAW_INTEGER_TOKEN, cursor);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* set the initial values. */
-    ev->has_sign = false;
-    ev->digits = val;
-
-    /* success. */
-    return STATUS_SUCCESS;
+    return
+        event_raw_integer_token_init_for_view(
+            ev, cursor, val, strlen(val));
 }
@@ -0,0 +1,25 @@
+/**
+ * \file src/event/event_raw_integer_token_size_get.c
+ *
+ * \brief Get the size of the value of this raw integer token.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event/raw_integer.h>
+
+/**
+ * \brief Get the size of the raw integer value.
+ *
+ * \param ev                The event for this operation.
+ *
+ * \returns the size of the raw integer value in bytes, not counting any NUL
+ * terminator.
+ */
+size_t CPARSE_SYM(event_raw_integer_token_size_get)(
+    const CPARSE_SYM(event_raw_integer_token)* ev)
+{
+    return ev->size;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file src/event/event_raw_span_get.c
+ *
+ * \brief Get the start of the span for this event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_span.h>
+
+/**
+ * \brief Get the start of the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the start of the span for this event.
+ */
+const char* CPARSE_SYM(event_raw_span_get)(
+    const CPARSE_SYM(event_raw_span)* ev)
+{
+    return ev->span;
+}
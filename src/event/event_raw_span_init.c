@@ -0,0 +1,77 @@
+/**
+ * \file src/event/event_raw_span_init.c
+ *
+ * \brief Initialize an \ref event_raw_span instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_span.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "event_internal.h"
+
+CPARSE_IMPORT_event_internal;
+
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_span
+ * instance.
+ *
+ * \note The span is borrowed by this event, and must remain valid until this
+ * event is disposed. The number of newlines in the span is computed here.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param span              The start of the span for this event.
+ * \param size              The size of the span for this event.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int CPARSE_SYM(event_raw_span_init)(
+    CPARSE_SYM(event_raw_span)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* span, size_t size)
+{
+    int retval;
+    const char* curr = span;
+    const char* end = span + size;
+
+    /* clear event memory. */
+    memset(ev, 0, sizeof(*ev));
+
+    /* initialize base type. */
+    retval =
+        event_init(&ev->hdr, CPARSE_EVENT_TYPE_RAW_SPAN,
+        CPARSE_EVENT_CATEGORY_RAW_SPAN, cursor);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* initialize instance variables. */
+    ev->span = span;
+    ev->size = size;
+
+    /* count the newlines in this span. */
+    while (curr < end)
+    {
+        curr = (const char*)memchr(curr, '\n', end - curr);
+        if (NULL == curr)
+        {
+            break;
+        }
+
+        ev->newline_count += 1;
+        curr += 1;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
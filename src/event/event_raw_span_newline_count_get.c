@@ -0,0 +1,23 @@
+/**
+ * \file src/event/event_raw_span_newline_count_get.c
+ *
+ * \brief Get the number of newline characters in the span for this event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_span.h>
+
+/**
+ * \brief Get the number of newline characters in the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the number of newline characters in this span.
+ */
+size_t CPARSE_SYM(event_raw_span_newline_count_get)(
+    const CPARSE_SYM(event_raw_span)* ev)
+{
+    return ev->newline_count;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file src/event/event_raw_span_size_get.c
+ *
+ * \brief Get the size of the span for this event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_span.h>
+
+/**
+ * \brief Get the size of the span for this event.
+ *
+ * \param ev                The event instance to query.
+ *
+ * \returns the size of the span for this event.
+ */
+size_t CPARSE_SYM(event_raw_span_size_get)(
+    const CPARSE_SYM(event_raw_span)* ev)
+{
+    return ev->size;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file src/event/event_raw_span_upcast.c
+ *
+ * \brief Upcast an \ref event_raw_span to an \ref event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event/raw_span.h>
+
+/**
+ * \brief Upcast an \ref event_raw_span to an \ref event.
+ *
+ * \param ev                The \ref event_raw_span to upcast.
+ *
+ * \returns the \ref event instance for this event.
+ */
+CPARSE_SYM(event)* CPARSE_SYM(event_raw_span_upcast)(
+    CPARSE_SYM(event_raw_span)* ev)
+{
+    return &ev->hdr;
+}
@@ -11,6 +11,7 @@
 
 #include <libcparse/event/string.h>
 #include <libcparse/function_decl.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -29,6 +30,7 @@ extern "C" {
  * \param event_type        The type of the string event to initialize.
  * \param cursor            The event cursor.
  * \param str               The string value for this event.
+ * \param size              The size of this string value.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -36,7 +38,7 @@ extern "C" {
  */
 int CPARSE_SYM(event_raw_string_token_init_internal)(
     CPARSE_SYM(event_raw_string_token)* ev, int event_type,
-    const CPARSE_SYM(cursor)* cursor, const char* str);
+    const CPARSE_SYM(cursor)* cursor, const char* str, size_t size);
 
 /******************************************************************************/
 /* Start of private exports.                                                  */
@@ -45,10 +47,11 @@ int CPARSE_SYM(event_raw_string_token_init_internal)(
 #define __INTERNAL_CPARSE_IMPORT_event_raw_string_internal_sym(sym) \
     CPARSE_BEGIN_EXPORT \
     static inline int sym ## event_raw_string_token_init_internal( \
-        CPARSE_SYM(event_raw_string_token)* w, int x, \
-        const CPARSE_SYM(cursor)* y, const char* z) { \
+        CPARSE_SYM(event_raw_string_token)* u, int v, \
+        const CPARSE_SYM(cursor)* w, const char* x, size_t y) { \
             return \
-                CPARSE_SYM(event_raw_string_token_init_internal)(w,x,y,z); } \
+                CPARSE_SYM(event_raw_string_token_init_internal)( \
+                    u,v,w,x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_event_raw_string_internal_as(sym) \
@@ -33,5 +33,6 @@ int CPARSE_SYM(event_raw_string_token_init_for_system_string)(
 {
     return
         event_raw_string_token_init_internal(
-            ev, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_SYSTEM_STRING, cursor, val);
+            ev, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_SYSTEM_STRING, cursor, val,
+            strlen(val));
 }
@@ -0,0 +1,39 @@
+/**
+ * \file src/event/event_raw_string_token_init_for_view.c
+ *
+ * \brief View init method for the \ref event_raw_string_token type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_string.h>
+#include <libcparse/status_codes.h>
+
+#include "event_raw_string_internal.h"
+
+CPARSE_IMPORT_event_raw_string_internal;
+
+/**
+ * \brief Perform an in-place initialization of an \ref event_raw_string_token
+ * instance from a view of its value.
+ *
+ * \param ev                Pointer to the event to initialize.
+ * \param cursor            The event cursor.
+ * \param val               The raw string representation of this token.
+ * \param size              The size of this representation in bytes, not
+ *                          counting its NUL terminator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero failure code on failure.
+ */
+int CPARSE_SYM(event_raw_string_token_init_for_view)(
+    CPARSE_SYM(event_raw_string_token)* ev, const CPARSE_SYM(cursor)* cursor,
+    const char* val, size_t size)
+{
+    return
+        event_raw_string_token_init_internal(
+            ev, CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_STRING, cursor, val,
+            size);
+}
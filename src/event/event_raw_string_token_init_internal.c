@@ -23,6 +23,7 @@ CPARSE_IMPORT_event_internal;
  * \param event_type        The type of the string event to initialize.
  * \param cursor            The event cursor.
  * \param str               The string value for this event.
+ * \param size              The size of this string value.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -30,7 +31,7 @@ CPARSE_IMPORT_event_internal;
  */
 int CPARSE_SYM(event_raw_string_token_init_internal)(
     CPARSE_SYM(event_raw_string_token)* ev, int event_type,
-    const CPARSE_SYM(cursor)* cursor, const char* str)
+    const CPARSE_SYM(cursor)* cursor, const char* str, size_t size)
 {
     int retval;
 
@@ -49,6 +50,7 @@ int CPARSE_SYM(event_raw_string_token_init_internal)(
 
     /* initialize instance variables. */
     ev->str = str;
+    ev->size = size;
 
     /* success. */
     retval = STATUS_SUCCESS;
@@ -0,0 +1,25 @@
+/**
+ * \file src/event/event_raw_string_token_size_get.c
+ *
+ * \brief Get the size of the value of this raw string token.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event/raw_string.h>
+
+/**
+ * \brief Get the size of the raw string value.
+ *
+ * \param ev                The event for this operation.
+ *
+ * \returns the size of the raw string value in bytes, not counting any NUL
+ * terminator.
+ */
+size_t CPARSE_SYM(event_raw_string_token_size_get)(
+    const CPARSE_SYM(event_raw_string_token)* ev)
+{
+    return ev->size;
+}
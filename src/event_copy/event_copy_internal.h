@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <libcparse/allocator.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event/detail.h>
 #include <libcparse/event/identifier.h>
@@ -47,4 +48,5 @@ struct CPARSE_SYM(event_copy)
     char* file;
     char* field1;
     CPARSE_SYM(cursor) cursor;
+    CPARSE_SYM(allocator) alloc;
 };
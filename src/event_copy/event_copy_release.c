@@ -7,6 +7,7 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event.h>
 #include <libcparse/event/identifier.h>
 #include <libcparse/event/include.h>
@@ -18,11 +19,12 @@
 #include <libcparse/event/raw_string.h>
 #include <libcparse/event/string.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
+#include <string.h>
 
 #include "../event/event_internal.h"
 #include "event_copy_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_copy;
 CPARSE_IMPORT_event_identifier;
@@ -59,6 +61,7 @@ int CPARSE_SYM(event_copy_release)(CPARSE_SYM(event_copy)* cpy)
 {
     int retval = STATUS_SUCCESS;
     int release_retval;
+    allocator alloc;
 
     /* release the event instance if initialized. */
     if (cpy->initialized)
@@ -117,20 +120,24 @@ int CPARSE_SYM(event_copy_release)(CPARSE_SYM(event_copy)* cpy)
         }
     }
 
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &cpy->alloc, sizeof(alloc));
+
     /* release file if initialized. */
     if (NULL != cpy->file)
     {
-        free(cpy->file);
+        allocator_free(&alloc, cpy->file);
     }
 
     /* release field1 if initialized. */
     if (NULL != cpy->field1)
     {
-        free(cpy->field1);
+        allocator_free(&alloc, cpy->field1);
     }
 
     /* release event copy instance. */
-    free(cpy);
+    memset(cpy, 0, sizeof(*cpy));
+    allocator_free(&alloc, cpy);
 
     /* return the decoded status. */
     return retval;
@@ -0,0 +1,27 @@
+/**
+ * \file src/event_handler/event_reactor_accepts_raw_spans.c
+ *
+ * \brief Check whether an event reactor accepts raw span events.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+
+#include "event_reactor_internal.h"
+
+/**
+ * \brief Check whether every handler in this event reactor accepts raw span
+ * events in place of raw character events.
+ *
+ * \param er                The event reactor to query.
+ *
+ * \returns true if raw spans may be broadcast to this reactor, or false if
+ * each character must be broadcast on its own.
+ */
+bool CPARSE_SYM(event_reactor_accepts_raw_spans)(
+    const CPARSE_SYM(event_reactor)* er)
+{
+    return !er->needs_characters;
+}
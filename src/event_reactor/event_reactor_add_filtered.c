@@ -0,0 +1,160 @@
+/**
+ * \file src/event_handler/event_reactor_add_filtered.c
+ *
+ * \brief Add a filtered event_handler to the reactor.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "event_reactor_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_event_reactor_internal;
+
+/* forward decls. */
+static int grow(event_reactor* er);
+
+_Static_assert(
+    CPARSE_EVENT_TYPE_EXP_COMMA_END < CPARSE_EVENT_REACTOR_FILTER_TYPES,
+    "All event types must fit in an event reactor filter.");
+
+/**
+ * \brief Add an \ref event_handler to the event reactor instance, which will
+ * only be sent events whose types are selected by the given filter.
+ *
+ * \param er                The event reactor for this operation.
+ * \param eh                The event handler to add to this reactor.
+ * \param filter            The filter for this handler, or NULL if this handler
+ *                          should receive all events. This filter is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_reactor_add_filtered)(
+    CPARSE_SYM(event_reactor)* er, const CPARSE_SYM(event_handler)* eh,
+    const CPARSE_SYM(event_reactor_filter)* filter)
+{
+    int retval;
+    event_reactor_entry* ent;
+
+    /* grow the handler arrays if they are full. */
+    if (er->count == er->capacity)
+    {
+        retval = grow(er);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* copy the handler to the end of the handler array. */
+    retval = event_handler_init_copy(&er->handlers[er->count], eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* copy the filter, if set. */
+    ent = &er->entries[er->count];
+    memset(ent, 0, sizeof(*ent));
+    if (NULL != filter)
+    {
+        ent->filtered = true;
+        memcpy(&ent->filter, filter, sizeof(ent->filter));
+    }
+
+    /* the handler is now part of this reactor. */
+    ++er->count;
+
+    /* once a filter is added, broadcasts use the per-type dispatch lists. */
+    if (ent->filtered || er->has_filters)
+    {
+        retval = event_reactor_dispatch_rebuild(er);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto remove_handler;
+        }
+
+        er->has_filters = true;
+    }
+
+    /* a handler that may be sent raw characters, but not raw spans, needs
+     * each character as its own event. */
+    if (
+        !ent->filtered
+     || (event_reactor_filter_has_type(
+                &ent->filter, CPARSE_EVENT_TYPE_RAW_CHARACTER)
+         && !event_reactor_filter_has_type(
+                &ent->filter, CPARSE_EVENT_TYPE_RAW_SPAN)))
+    {
+        er->needs_characters = true;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+remove_handler:
+    --er->count;
+    memset(&er->handlers[er->count], 0, sizeof(er->handlers[er->count]));
+    memset(ent, 0, sizeof(*ent));
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Double the capacity of the handler and entry arrays.
+ *
+ * \param er                The event reactor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int grow(event_reactor* er)
+{
+    size_t capacity;
+    event_handler* handlers;
+    event_reactor_entry* entries;
+
+    /* compute the new capacity. */
+    capacity =
+        (0 == er->capacity)
+            ? CPARSE_EVENT_REACTOR_INITIAL_CAPACITY : 2 * er->capacity;
+
+    /* grow the handler array. */
+    handlers =
+        (event_handler*)allocator_reallocate(
+            &er->alloc, er->handlers, capacity * sizeof(*handlers));
+    if (NULL == handlers)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    er->handlers = handlers;
+
+    /* grow the entry array. */
+    entries =
+        (event_reactor_entry*)allocator_reallocate(
+            &er->alloc, er->entries, capacity * sizeof(*entries));
+    if (NULL == entries)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    er->entries = entries;
+
+    /* both arrays now hold the new capacity. */
+    er->capacity = capacity;
+
+    return STATUS_SUCCESS;
+}
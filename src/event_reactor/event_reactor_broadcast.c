@@ -7,11 +7,13 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/event.h>
 #include <libcparse/status_codes.h>
 #include <stddef.h>
 
 #include "event_reactor_internal.h"
 
+CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_reactor_internal;
 
@@ -29,20 +31,54 @@ int CPARSE_SYM(event_reactor_broadcast)(
     CPARSE_SYM(event_reactor)* er, const CPARSE_SYM(event)* ev)
 {
     int retval;
-    event_reactor_entry* ent = er->head;
+    int type;
+    event_handler* handlers = er->handlers;
+    size_t count = er->count;
 
-    /* iterate through all entries. */
-    while (NULL != ent)
+    /* fast path: a single unfiltered subscriber. */
+    if (1 == count && !er->has_filters)
     {
-        /* broadcast to an assigned handler. */
-        retval = event_handler_send(&ent->handler, ev);
+        return handlers->event_callback(handlers->context, ev);
+    }
+
+    /* use the per-type dispatch list if this reactor has filters. */
+    if (er->has_filters)
+    {
+        type = event_get_type(ev);
+        if (type >= 0 && type < CPARSE_EVENT_REACTOR_FILTER_TYPES)
+        {
+            const size_t* dispatch = er->dispatch;
+            size_t end = er->dispatch_offsets[type + 1];
+
+            for (size_t i = er->dispatch_offsets[type]; i < end; ++i)
+            {
+                event_handler* eh = &handlers[dispatch[i]];
+
+                retval = eh->event_callback(eh->context, ev);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+
+            return STATUS_SUCCESS;
+        }
+    }
+
+    /* iterate through all handlers in subscription order. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* skip filtered handlers for types that can't be filtered. */
+        if (er->has_filters && er->entries[i].filtered)
+        {
+            continue;
+        }
+
+        retval = handlers[i].event_callback(handlers[i].context, ev);
         if (STATUS_SUCCESS != retval)
         {
             return retval;
         }
-
-        /* go to the next entry. */
-        ent = ent->next;
     }
 
     /* success. */
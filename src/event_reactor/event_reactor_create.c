@@ -7,12 +7,12 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
-#include <string.h>
 
 #include "event_reactor_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event_reactor;
 
 /**
@@ -27,20 +27,15 @@ CPARSE_IMPORT_event_reactor;
  */
 int CPARSE_SYM(event_reactor_create)(CPARSE_SYM(event_reactor)** er)
 {
-    event_reactor* tmp;
+    int retval;
+    allocator alloc;
 
-    /* allocate memory for this instance. */
-    tmp = (event_reactor*)malloc(sizeof(*tmp));
-    if (NULL == tmp)
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
     {
-        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        return retval;
     }
 
-    /* clear instance memory. */
-    memset(tmp, 0, sizeof(*tmp));
-
-    /* success. */
-    *er = tmp;
-    tmp = NULL;
-    return STATUS_SUCCESS;
+    return event_reactor_create_with_allocator(er, &alloc);
 }
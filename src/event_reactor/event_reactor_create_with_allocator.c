@@ -0,0 +1,60 @@
+/**
+ * \file src/event_handler/event_reactor_create_with_allocator.c
+ *
+ * \brief Create an \ref event_reactor that uses a given \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "event_reactor_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_reactor;
+
+/**
+ * \brief Create an \ref event_reactor instance that uses the given allocator
+ * for its memory.
+ *
+ * \param er                Pointer to the event reactor pointer to receive the
+ *                          created instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_reactor_create_with_allocator)(
+    CPARSE_SYM(event_reactor)** er, const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    event_reactor* tmp;
+
+    /* allocate memory for this instance. */
+    tmp = (event_reactor*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(*tmp));
+        allocator_free(alloc, tmp);
+        return retval;
+    }
+
+    /* success. */
+    *er = tmp;
+    tmp = NULL;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file src/event_handler/event_reactor_dispatch_rebuild.c
+ *
+ * \brief Rebuild the per-type dispatch lists for an event reactor.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "event_reactor_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_event_reactor_internal;
+
+static bool entry_accepts(const event_reactor_entry* ent, int type);
+
+/**
+ * \brief Rebuild the per-type dispatch lists for an \ref event_reactor.
+ *
+ * The dispatch lists are stored in a single array of handler indices, with the
+ * indices for event type \c t starting at \c dispatch_offsets[t] and ending
+ * before \c dispatch_offsets[t+1]. Indices in each list are in subscription
+ * order.
+ *
+ * \param er                The event reactor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_reactor_dispatch_rebuild)(CPARSE_SYM(event_reactor)* er)
+{
+    int retval;
+    size_t total = 0;
+    size_t offset = 0;
+    size_t offsets_size;
+    size_t* offsets;
+    size_t* dispatch;
+
+    /* first pass: count the number of entries in all dispatch lists. */
+    for (int type = 0; type < CPARSE_EVENT_REACTOR_FILTER_TYPES; ++type)
+    {
+        for (size_t i = 0; i < er->count; ++i)
+        {
+            if (entry_accepts(&er->entries[i], type))
+            {
+                ++total;
+            }
+        }
+    }
+
+    /* allocate memory for the offsets. */
+    offsets_size = sizeof(*offsets) * (CPARSE_EVENT_REACTOR_FILTER_TYPES + 1);
+    offsets = (size_t*)allocator_allocate(&er->alloc, offsets_size);
+    if (NULL == offsets)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* allocate memory for the dispatch lists. */
+    dispatch =
+        (size_t*)allocator_allocate(
+            &er->alloc, sizeof(*dispatch) * (total ? total : 1));
+    if (NULL == dispatch)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_offsets;
+    }
+
+    /* second pass: populate the dispatch lists. */
+    for (int type = 0; type < CPARSE_EVENT_REACTOR_FILTER_TYPES; ++type)
+    {
+        offsets[type] = offset;
+        for (size_t i = 0; i < er->count; ++i)
+        {
+            if (entry_accepts(&er->entries[i], type))
+            {
+                dispatch[offset++] = i;
+            }
+        }
+    }
+
+    offsets[CPARSE_EVENT_REACTOR_FILTER_TYPES] = offset;
+
+    /* replace the previous dispatch lists. */
+    event_reactor_dispatch_release(er);
+    er->dispatch = dispatch;
+    er->dispatch_offsets = offsets;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_offsets:
+    memset(offsets, 0, offsets_size);
+    allocator_free(&er->alloc, offsets);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the given entry should be sent the given event type.
+ */
+static bool entry_accepts(const event_reactor_entry* ent, int type)
+{
+    return !ent->filtered || event_reactor_filter_has_type(&ent->filter, type);
+}
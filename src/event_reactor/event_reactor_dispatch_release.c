@@ -0,0 +1,45 @@
+/**
+ * \file src/event_handler/event_reactor_dispatch_release.c
+ *
+ * \brief Release the per-type dispatch lists for an event reactor.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <string.h>
+
+#include "event_reactor_internal.h"
+
+CPARSE_IMPORT_allocator;
+
+/**
+ * \brief Release the per-type dispatch lists for an \ref event_reactor.
+ *
+ * \param er                The event reactor for this operation.
+ */
+void CPARSE_SYM(event_reactor_dispatch_release)(CPARSE_SYM(event_reactor)* er)
+{
+    if (NULL == er->dispatch)
+    {
+        return;
+    }
+
+    /* reclaim the dispatch lists. */
+    memset(
+        er->dispatch, 0,
+        sizeof(*er->dispatch)
+            * er->dispatch_offsets[CPARSE_EVENT_REACTOR_FILTER_TYPES]);
+    allocator_free(&er->alloc, er->dispatch);
+
+    /* reclaim the dispatch offsets. */
+    memset(
+        er->dispatch_offsets, 0,
+        sizeof(*er->dispatch_offsets)
+            * (CPARSE_EVENT_REACTOR_FILTER_TYPES + 1));
+    allocator_free(&er->alloc, er->dispatch_offsets);
+
+    er->dispatch = NULL;
+    er->dispatch_offsets = NULL;
+}
@@ -0,0 +1,30 @@
+/**
+ * \file src/event_handler/event_reactor_filter_add_type.c
+ *
+ * \brief Select an event type in an event reactor filter.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+
+/**
+ * \brief Select an event type in an \ref event_reactor_filter.
+ *
+ * Event types outside of the range of the filter are ignored.
+ *
+ * \param filter            The filter to update.
+ * \param event_type        The event type to select.
+ */
+void CPARSE_SYM(event_reactor_filter_add_type)(
+    CPARSE_SYM(event_reactor_filter)* filter, int event_type)
+{
+    /* ignore event types that can't be represented in this filter. */
+    if (event_type < 0 || event_type >= CPARSE_EVENT_REACTOR_FILTER_TYPES)
+    {
+        return;
+    }
+
+    filter->bits[event_type / 64] |= ((uint64_t)1) << (event_type % 64);
+}
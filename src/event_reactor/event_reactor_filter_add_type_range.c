@@ -0,0 +1,32 @@
+/**
+ * \file src/event_handler/event_reactor_filter_add_type_range.c
+ *
+ * \brief Select a range of event types in an event reactor filter.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+
+CPARSE_IMPORT_event_reactor;
+
+/**
+ * \brief Select an inclusive range of event types in an
+ * \ref event_reactor_filter.
+ *
+ * Related event types in \ref event_type are grouped together, so a range can
+ * be used to select a whole category of events, such as all comment events.
+ *
+ * \param filter            The filter to update.
+ * \param first             The first event type to select.
+ * \param last              The last event type to select.
+ */
+void CPARSE_SYM(event_reactor_filter_add_type_range)(
+    CPARSE_SYM(event_reactor_filter)* filter, int first, int last)
+{
+    for (int type = first; type <= last; ++type)
+    {
+        event_reactor_filter_add_type(filter, type);
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * \file src/event_handler/event_reactor_filter_clear.c
+ *
+ * \brief Clear an event reactor filter.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+#include <string.h>
+
+/**
+ * \brief Clear an \ref event_reactor_filter, so that it selects no events.
+ *
+ * \param filter            The filter to clear.
+ */
+void CPARSE_SYM(event_reactor_filter_clear)(
+    CPARSE_SYM(event_reactor_filter)* filter)
+{
+    memset(filter, 0, sizeof(*filter));
+}
@@ -0,0 +1,33 @@
+/**
+ * \file src/event_handler/event_reactor_filter_has_type.c
+ *
+ * \brief Check whether an event type is selected by an event reactor filter.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+
+/**
+ * \brief Check whether an event type is selected by an
+ * \ref event_reactor_filter.
+ *
+ * \param filter            The filter to query.
+ * \param event_type        The event type to check.
+ *
+ * \returns true if this event type is selected, or false otherwise.
+ */
+bool CPARSE_SYM(event_reactor_filter_has_type)(
+    const CPARSE_SYM(event_reactor_filter)* filter, int event_type)
+{
+    /* event types that can't be represented in this filter are never set. */
+    if (event_type < 0 || event_type >= CPARSE_EVENT_REACTOR_FILTER_TYPES)
+    {
+        return false;
+    }
+
+    uint64_t mask = ((uint64_t)1) << (event_type % 64);
+
+    return 0 != (filter->bits[event_type / 64] & mask);
+}
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/event_reactor.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -18,21 +21,69 @@ extern "C" {
 # endif /*__cplusplus*/
 
 /**
- * \brief An \ref event_handler entry in the \ref event_reactor.
+ * \brief The initial number of handler slots allocated by an
+ * \ref event_reactor.
+ */
+#define CPARSE_EVENT_REACTOR_INITIAL_CAPACITY 4
+
+/**
+ * \brief The subscription details for an \ref event_handler in the
+ * \ref event_reactor.
  */
 typedef struct CPARSE_SYM(event_reactor_entry) CPARSE_SYM(event_reactor_entry);
 
 struct CPARSE_SYM(event_reactor_entry)
 {
-    CPARSE_SYM(event_reactor_entry)* next;
-    CPARSE_SYM(event_handler) handler;
+    bool filtered;
+    CPARSE_SYM(event_reactor_filter) filter;
 };
 
+/**
+ * \brief The event reactor keeps its handlers in a contiguous array in
+ * subscription order, so that a broadcast walks linear memory. The entries
+ * array runs parallel to the handlers array, and is only consulted when the
+ * dispatch lists are rebuilt.
+ */
 struct CPARSE_SYM(event_reactor)
 {
-    CPARSE_SYM(event_reactor_entry)* head;
+    CPARSE_SYM(event_handler)* handlers;
+    CPARSE_SYM(event_reactor_entry)* entries;
+    size_t count;
+    size_t capacity;
+    bool has_filters;
+    bool needs_characters;
+    size_t* dispatch;
+    size_t* dispatch_offsets;
+    CPARSE_SYM(allocator) alloc;
 };
 
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Rebuild the per-type dispatch lists for an \ref event_reactor.
+ *
+ * The dispatch lists are stored in a single array of handler indices, with the
+ * indices for event type \c t starting at \c dispatch_offsets[t] and ending
+ * before \c dispatch_offsets[t+1]. Indices in each list are in subscription
+ * order.
+ *
+ * \param er                The event reactor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_reactor_dispatch_rebuild)(CPARSE_SYM(event_reactor)* er);
+
+/**
+ * \brief Release the per-type dispatch lists for an \ref event_reactor.
+ *
+ * \param er                The event reactor for this operation.
+ */
+void CPARSE_SYM(event_reactor_dispatch_release)(CPARSE_SYM(event_reactor)* er);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -40,6 +91,12 @@ struct CPARSE_SYM(event_reactor)
 #define __INTERNAL_CPARSE_IMPORT_event_reactor_internal_sym(sym) \
     CPARSE_BEGIN_EXPORT \
     typedef CPARSE_SYM(event_reactor_entry) sym ## event_reactor_entry; \
+    static inline int sym ## event_reactor_dispatch_rebuild( \
+        CPARSE_SYM(event_reactor)* x) { \
+            return CPARSE_SYM(event_reactor_dispatch_rebuild)(x); } \
+    static inline void sym ## event_reactor_dispatch_release( \
+        CPARSE_SYM(event_reactor)* x) { \
+            CPARSE_SYM(event_reactor_dispatch_release)(x); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_event_reactor_internal_as(sym) \
@@ -7,12 +7,13 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "event_reactor_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_event_reactor_internal;
 
@@ -27,26 +28,33 @@ CPARSE_IMPORT_event_reactor_internal;
  */
 int CPARSE_SYM(event_reactor_release)(CPARSE_SYM(event_reactor)* er)
 {
-    event_reactor_entry* ent = er->head;
+    allocator alloc;
 
-    /* reclaim all entries. */
-    while (NULL != ent)
-    {
-        event_reactor_entry* tmp = ent;
-        ent = ent->next;
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &er->alloc, sizeof(alloc));
 
-        /* clear entry memory. */
-        memset(tmp, 0, sizeof(*tmp));
+    /* reclaim the handlers. */
+    if (NULL != er->handlers)
+    {
+        memset(er->handlers, 0, sizeof(*er->handlers) * er->capacity);
+        allocator_free(&alloc, er->handlers);
+    }
 
-        /* reclaim entry memory. */
-        free(tmp);
+    /* reclaim the entries. */
+    if (NULL != er->entries)
+    {
+        memset(er->entries, 0, sizeof(*er->entries) * er->capacity);
+        allocator_free(&alloc, er->entries);
     }
 
+    /* reclaim the dispatch lists. */
+    event_reactor_dispatch_release(er);
+
     /* clear instance memory. */
     memset(er, 0, sizeof(*er));
 
     /* reclaim instance memory. */
-    free(er);
+    allocator_free(&alloc, er);
 
     /* success. */
     return STATUS_SUCCESS;
@@ -0,0 +1,52 @@
+/**
+ * \file file_position_cache/file_position_cache_checkpoint_restore.c
+ *
+ * \brief Restore the \ref file_position_cache from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "file_position_cache_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+
+/**
+ * \brief Restore the cached position from a checkpoint.
+ *
+ * The cache is cleared if \p ckpt has no file. Otherwise, its file is interned
+ * in the file table of \p ap and cached with this position.
+ *
+ * \param cache             The \ref file_position_cache instance to restore.
+ * \param ap                The parser whose file table receives the file.
+ * \param ckpt              The position saved to the checkpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(file_position_cache_checkpoint_restore)(
+    CPARSE_SYM(file_position_cache)* cache, CPARSE_SYM(abstract_parser)* ap,
+    const CPARSE_SYM(checkpoint_cursor)* ckpt)
+{
+    int retval;
+    cursor tmp;
+
+    /* intern the file in this parser, if the position has one. */
+    retval = checkpoint_cursor_restore(&tmp, ap, ckpt);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* cache this position, which clears the cache if it has no file. */
+    memcpy(&cache->pos, &tmp, sizeof(cache->pos));
+    cache->file = tmp.file;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file file_position_cache/file_position_cache_checkpoint_save.c
+ *
+ * \brief Save the \ref file_position_cache to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "file_position_cache_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+
+/**
+ * \brief Save the cached position to a checkpoint.
+ *
+ * \param ckpt              The checkpoint position to receive the cached
+ *                          position, which has no file if the cache is not
+ *                          set.
+ * \param cache             The \ref file_position_cache instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if the file name does
+ *        not fit in the checkpoint.
+ */
+int CPARSE_SYM(file_position_cache_checkpoint_save)(
+    CPARSE_SYM(checkpoint_cursor)* ckpt,
+    const CPARSE_SYM(file_position_cache)* cache)
+{
+    if (NULL == cache->file)
+    {
+        memset(ckpt, 0, sizeof(*ckpt));
+
+        return STATUS_SUCCESS;
+    }
+
+    return checkpoint_cursor_save(ckpt, &cache->pos);
+}
@@ -7,14 +7,10 @@
  * distribution for the license terms under which this software is distributed.
  */
 
-#include <libcparse/string_utils.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "file_position_cache_internal.h"
 
-CPARSE_IMPORT_string_utils;
-
 /**
  * \brief Clear the \ref file_position_cache.
  *
@@ -24,11 +20,6 @@ CPARSE_IMPORT_string_utils;
 void CPARSE_SYM(file_position_cache_clear)(
     CPARSE_SYM(file_position_cache)* cache)
 {
-    if (NULL != cache->file)
-    {
-        string_utils_string_release(cache->file);
-        cache->file = NULL;
-    }
-
+    cache->file = NULL;
     memset(&cache->pos, 0, sizeof(cache->pos));
 }
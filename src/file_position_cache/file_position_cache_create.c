@@ -7,13 +7,13 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/file_position_cache.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
-#include <string.h>
 
 #include "file_position_cache_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_file_position_cache;
 
 /**
@@ -31,25 +31,14 @@ int CPARSE_SYM(file_position_cache_create)(
     CPARSE_SYM(file_position_cache)** cache)
 {
     int retval;
-    file_position_cache* tmp;
+    allocator alloc;
 
-    /* allocate memory for instance. */
-    tmp = (file_position_cache*)malloc(sizeof(*tmp));
-    if (NULL == tmp)
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
     {
-        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
-        goto done;
+        return retval;
     }
 
-    /* clear instance memory. */
-    memset(tmp, 0, sizeof(*tmp));
-
-    /* success. */
-    retval = STATUS_SUCCESS;
-    *cache = tmp;
-    tmp = NULL;
-    goto done;
-
-done:
-    return retval;
+    return file_position_cache_create_with_allocator(cache, &alloc);
 }
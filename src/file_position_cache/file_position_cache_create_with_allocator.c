@@ -0,0 +1,70 @@
+/**
+ * \file file_position_cache/file_position_cache_create_with_allocator.c
+ *
+ * \brief Create a \ref file_position_cache that uses a given \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/file_position_cache.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "file_position_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_file_position_cache;
+
+/**
+ * \brief Create a file position cache instance that uses the given allocator
+ * for its memory.
+ *
+ * \param cache             Pointer to the \ref file_position_cache pointer to
+ *                          be populated with the created file position cache
+ *                          instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(file_position_cache_create_with_allocator)(
+    CPARSE_SYM(file_position_cache)** cache,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    file_position_cache* tmp;
+
+    /* allocate memory for instance. */
+    tmp = (file_position_cache*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *cache = tmp;
+    tmp = NULL;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
+
+done:
+    return retval;
+}
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <libcparse/allocator.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/function_decl.h>
@@ -22,8 +23,9 @@ typedef struct CPARSE_SYM(file_position_cache) CPARSE_SYM(file_position_cache);
 
 struct CPARSE_SYM(file_position_cache)
 {
-    char* file;
+    const char* file;
     CPARSE_SYM(cursor) pos;
+    CPARSE_SYM(allocator) alloc;
 };
 
 /******************************************************************************/
@@ -42,6 +42,7 @@ int CPARSE_SYM(file_position_cache_position_extend)(
     /* extend the position. */
     cache->pos.end_line = pos->end_line;
     cache->pos.end_col = pos->end_col;
+    cache->pos.end_offset = pos->end_offset;
 
     /* success. */
     return STATUS_SUCCESS;
@@ -7,13 +7,14 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/file_position_cache.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "file_position_cache_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_file_position_cache;
 
 /**
@@ -29,12 +30,17 @@ CPARSE_IMPORT_file_position_cache;
 int CPARSE_SYM(file_position_cache_release)(
     CPARSE_SYM(file_position_cache)* cache)
 {
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &cache->alloc, sizeof(alloc));
+
     /* clear the cache. */
     file_position_cache_clear(cache);
 
     /* clear and free our instance. */
     memset(cache, 0, sizeof(*cache));
-    free(cache);
+    allocator_free(&alloc, cache);
 
     return STATUS_SUCCESS;
 }
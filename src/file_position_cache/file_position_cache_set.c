@@ -8,7 +8,6 @@
  */
 
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "file_position_cache_internal.h"
@@ -16,6 +15,9 @@
 /**
  * \brief Set the \ref file_position_cache file and position.
  *
+ * The file is not copied. It must remain valid for as long as it is cached,
+ * which holds for any file name interned in the parser's file table.
+ *
  * \param cache             The \ref file_position_cache instance for this
  *                          operation.
  * \param file              The file to cache.
@@ -29,28 +31,18 @@ int CPARSE_SYM(file_position_cache_set)(
     CPARSE_SYM(file_position_cache)* cache, const char* file,
     const CPARSE_SYM(cursor)* position)
 {
-    char* tmp;
-
     /* if the file is already set, then return an error. */
     if (NULL != cache->file)
     {
         return ERROR_LIBCPARSE_FILE_POSITION_CACHE_ALREADY_SET;
     }
 
-    /* copy the file. */
-    tmp = strdup(file);
-    if (NULL == tmp)
-    {
-        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
-    }
-
     /* set the cache. */
     memcpy(&cache->pos, position, sizeof(cache->pos));
 
     /* set the file. */
-    cache->file = tmp;
-    cache->pos.file = tmp;
-    tmp = NULL;
+    cache->file = file;
+    cache->pos.file = file;
 
     /* success. */
     return STATUS_SUCCESS;
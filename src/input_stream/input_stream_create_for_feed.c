@@ -0,0 +1,65 @@
+/**
+ * \file src/input_stream/input_stream_create_for_feed.c
+ *
+ * \brief Create an input stream instance which is fed bytes by the caller.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Create an input stream instance which is fed bytes by the caller.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_create_for_feed)(
+    CPARSE_SYM(input_stream)** stream)
+{
+    int retval;
+    input_stream_for_feed* tmp = NULL;
+
+    /* allocate memory for this stream instance. */
+    tmp = (input_stream_for_feed*)malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* set instance data. The buffers are allocated on the first feed. The
+     * release method identifies feed streams, so it must be the exported
+     * symbol rather than an inline wrapper. */
+    tmp->hdr.input_stream_release_fn =
+        &CPARSE_SYM(input_stream_for_feed_release);
+    tmp->hdr.input_stream_read_fn = &input_stream_for_feed_read;
+    tmp->hdr.input_stream_read_span_fn = &input_stream_for_feed_read_span;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *stream = &tmp->hdr;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,96 @@
+/**
+ * \file src/input_stream/input_stream_create_from_buffered_descriptor.c
+ *
+ * \brief Create a buffered input stream from a descriptor.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Create a buffered input stream instance from a Unix file descriptor.
+ *
+ * Unlike \ref input_stream_create_from_descriptor, this stream reads from the
+ * descriptor in blocks of up to \p buffer_size bytes, and serves characters
+ * from this block until it is exhausted. The EOF and error semantics are the
+ * same as the unbuffered descriptor stream.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed. This stream takes ownership of the Unix file descriptor
+ * provided in \p desc and will close it when it is released.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ * \param desc                  The Unix file descriptor for this stream.
+ * \param buffer_size           The size of the read buffer, or 0 to use
+ *                              \ref CPARSE_INPUT_STREAM_DEFAULT_BUFFER_SIZE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_create_from_buffered_descriptor)(
+    CPARSE_SYM(input_stream)** stream, int desc, size_t buffer_size)
+{
+    int retval;
+    input_stream_from_buffered_descriptor* tmp = NULL;
+
+    /* use the default buffer size if none is specified. */
+    if (0 == buffer_size)
+    {
+        buffer_size = CPARSE_INPUT_STREAM_DEFAULT_BUFFER_SIZE;
+    }
+
+    /* allocate memory for the input stream. */
+    tmp = (input_stream_from_buffered_descriptor*)malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* allocate memory for the read buffer. */
+    tmp->buffer = (char*)malloc(buffer_size);
+    if (NULL == tmp->buffer)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    /* set instance data. */
+    tmp->hdr.input_stream_release_fn =
+        &input_stream_from_buffered_descriptor_release;
+    tmp->hdr.input_stream_read_fn = &input_stream_from_buffered_descriptor_read;
+    tmp->hdr.input_stream_read_span_fn =
+        &input_stream_from_buffered_descriptor_read_span;
+    tmp->desc = desc;
+    tmp->buffer_size = buffer_size;
+    tmp->curr = 0;
+    tmp->max = 0;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *stream = &tmp->hdr;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+done:
+    return retval;
+}
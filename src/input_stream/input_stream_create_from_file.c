@@ -0,0 +1,131 @@
+/**
+ * \file src/input_stream/input_stream_create_from_file.c
+ *
+ * \brief Create an input stream from a file.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <fcntl.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Create an input stream instance from a file.
+ *
+ * If \p path names a non-empty regular file, then this file is mapped into
+ * memory read-only, and characters are served directly from the mapping. For
+ * pipes, zero-length files, special files, or files which cannot be mapped,
+ * this falls back to a buffered descriptor stream as created by
+ * \ref input_stream_create_from_buffered_descriptor.
+ *
+ * \note This allocates the instance, storing the result in \p stream. This is a
+ * resource that must be released by calling \ref input_stream_release when it
+ * is no longer needed.
+ *
+ * \param stream                Pointer to the \ref input_stream pointer to be
+ *                              populated with the created input stream on
+ *                              success.
+ * \param path                  The path of the file to open.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_FILE_OPEN_ERROR if the file could not be opened.
+ *      - ERROR_LIBCPARSE_FILE_STAT if the file could not be queried.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_create_from_file)(
+    CPARSE_SYM(input_stream)** stream, const char* path)
+{
+    int retval;
+    int desc;
+    struct stat st;
+    void* data;
+    input_stream_from_mapped_file* tmp = NULL;
+
+    /* open the file. */
+    desc = open(path, O_RDONLY);
+    if (desc < 0)
+    {
+        retval = ERROR_LIBCPARSE_FILE_OPEN_ERROR;
+        goto done;
+    }
+
+    /* query the file. */
+    retval = fstat(desc, &st);
+    if (retval < 0)
+    {
+        retval = ERROR_LIBCPARSE_FILE_STAT;
+        goto close_desc;
+    }
+
+    /* only non-empty regular files can be mapped. */
+    if (!S_ISREG(st.st_mode) || st.st_size <= 0)
+    {
+        goto fallback;
+    }
+
+    /* map the file. */
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, desc, 0);
+    if (MAP_FAILED == data)
+    {
+        goto fallback;
+    }
+
+    /* we will be reading this mapping front to back. */
+    (void)madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    /* allocate memory for the input stream. */
+    tmp = (input_stream_from_mapped_file*)malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto unmap_data;
+    }
+
+    /* clear instance. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* set instance data. */
+    tmp->hdr.input_stream_release_fn = &input_stream_from_mapped_file_release;
+    tmp->hdr.input_stream_read_fn = &input_stream_from_mapped_file_read;
+    tmp->hdr.input_stream_read_span_fn =
+        &input_stream_from_mapped_file_read_span;
+    tmp->data = (char*)data;
+    tmp->curr = 0;
+    tmp->max = (size_t)st.st_size;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *stream = &tmp->hdr;
+    goto close_desc;
+
+fallback:
+    /* the buffered stream takes ownership of the descriptor. */
+    retval = input_stream_create_from_buffered_descriptor(stream, desc, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto close_desc;
+    }
+
+    goto done;
+
+unmap_data:
+    munmap(data, (size_t)st.st_size);
+
+close_desc:
+    close(desc);
+
+done:
+    return retval;
+}
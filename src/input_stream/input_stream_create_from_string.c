@@ -52,6 +52,8 @@ int CPARSE_SYM(input_stream_create_from_string)(
     /* set instance data. */
     tmp->hdr.input_stream_release_fn = &input_stream_from_string_release;
     tmp->hdr.input_stream_read_fn = &input_stream_from_string_read;
+    tmp->hdr.input_stream_read_span_fn =
+        &input_stream_from_string_read_span;
     tmp->curr = 0;
     tmp->max = strlen(str);
 
@@ -0,0 +1,96 @@
+/**
+ * \file src/input_stream/input_stream_feed.c
+ *
+ * \brief Append bytes to a feed input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief The minimum size of a feed buffer.
+ */
+#define FEED_BUFFER_MIN_SIZE 4096
+
+/**
+ * \brief Append bytes to an input stream created by
+ * \ref input_stream_create_for_feed.
+ *
+ * \param stream                    The feed stream for this operation.
+ * \param buf                       The bytes to append.
+ * \param size                      The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_BAD_CAST if \p stream is not a feed stream.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF if this stream has been finished.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_feed)(
+    CPARSE_SYM(input_stream)* stream, const void* buf, size_t size)
+{
+    input_stream_for_feed* fstream = (input_stream_for_feed*)stream;
+    size_t unread, buffer_size;
+    char* buffer;
+
+    /* verify that this is a feed stream. */
+    if (
+        &CPARSE_SYM(input_stream_for_feed_release)
+            != stream->input_stream_release_fn)
+    {
+        return ERROR_LIBCPARSE_BAD_CAST;
+    }
+
+    /* no more bytes can be fed once the stream is finished. */
+    if (fstream->finished)
+    {
+        return ERROR_LIBCPARSE_INPUT_STREAM_EOF;
+    }
+
+    /* move any unread bytes to the front of the buffer. */
+    unread = fstream->max - fstream->curr;
+    if (fstream->curr > 0)
+    {
+        memmove(fstream->buffer, fstream->buffer + fstream->curr, unread);
+        fstream->curr = 0;
+        fstream->max = unread;
+    }
+
+    /* grow the buffer if these bytes do not fit. */
+    if (unread + size > fstream->buffer_size)
+    {
+        buffer_size =
+            (fstream->buffer_size < FEED_BUFFER_MIN_SIZE)
+                ? FEED_BUFFER_MIN_SIZE : fstream->buffer_size;
+        while (buffer_size < unread + size)
+        {
+            buffer_size *= 2;
+        }
+
+        buffer = (char*)realloc(fstream->buffer, buffer_size);
+        if (NULL == buffer)
+        {
+            return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        }
+
+        fstream->buffer = buffer;
+        fstream->buffer_size = buffer_size;
+    }
+
+    /* append these bytes. */
+    if (size > 0)
+    {
+        memcpy(fstream->buffer + fstream->max, buf, size);
+        fstream->max += size;
+    }
+
+    return STATUS_SUCCESS;
+}
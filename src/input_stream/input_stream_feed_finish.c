@@ -0,0 +1,42 @@
+/**
+ * \file src/input_stream/input_stream_feed_finish.c
+ *
+ * \brief Mark the end of input for a feed input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Mark the end of input for a stream created by
+ * \ref input_stream_create_for_feed.
+ *
+ * \param stream                    The feed stream for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_BAD_CAST if \p stream is not a feed stream.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_feed_finish)(CPARSE_SYM(input_stream)* stream)
+{
+    input_stream_for_feed* fstream = (input_stream_for_feed*)stream;
+
+    /* verify that this is a feed stream. */
+    if (
+        &CPARSE_SYM(input_stream_for_feed_release)
+            != stream->input_stream_release_fn)
+    {
+        return ERROR_LIBCPARSE_BAD_CAST;
+    }
+
+    fstream->finished = true;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,50 @@
+/**
+ * \file src/input_stream/input_stream_for_feed_read.c
+ *
+ * \brief Read a character from a feed input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read a character from the input stream for feed instance.
+ *
+ * \param stream                The input stream from which this character is
+ *                              read.
+ * \param ch                    Pointer to be populated with the character read
+ *                              on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK if no bytes are available.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_read)(
+    CPARSE_SYM(input_stream)* stream, int* ch)
+{
+    input_stream_for_feed* fstream = (input_stream_for_feed*)stream;
+
+    /* can we read a character? */
+    if (fstream->curr < fstream->max)
+    {
+        *ch = fstream->buffer[fstream->curr];
+        fstream->curr += 1;
+        return STATUS_SUCCESS;
+    }
+    else if (fstream->finished)
+    {
+        return ERROR_LIBCPARSE_INPUT_STREAM_EOF;
+    }
+    else
+    {
+        return ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK;
+    }
+}
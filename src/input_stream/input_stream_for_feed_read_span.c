@@ -0,0 +1,65 @@
+/**
+ * \file src/input_stream/input_stream_for_feed_read_span.c
+ *
+ * \brief Read a span from a feed input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read the next contiguous span from the input stream for feed
+ * instance.
+ *
+ * The span is every byte fed since the last read. The buffer holding these
+ * bytes becomes the span buffer, so that further feeds do not move the span.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK if no bytes are available.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size)
+{
+    input_stream_for_feed* fstream = (input_stream_for_feed*)stream;
+    char* tmp;
+    size_t tmp_size;
+
+    /* is there anything left to read? */
+    if (fstream->curr >= fstream->max)
+    {
+        return
+            fstream->finished
+                ? ERROR_LIBCPARSE_INPUT_STREAM_EOF
+                : ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK;
+    }
+
+    /* consume the unread bytes. */
+    *span = fstream->buffer + fstream->curr;
+    *size = fstream->max - fstream->curr;
+
+    /* swap the buffers, so that new bytes are fed into the old span buffer. */
+    tmp = fstream->span;
+    tmp_size = fstream->span_size;
+    fstream->span = fstream->buffer;
+    fstream->span_size = fstream->buffer_size;
+    fstream->buffer = tmp;
+    fstream->buffer_size = tmp_size;
+    fstream->curr = fstream->max = 0;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file src/input_stream/input_stream_for_feed_release.c
+ *
+ * \brief Release an input stream for feed instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Release an input stream for feed instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_release)(
+    CPARSE_SYM(input_stream)* stream)
+{
+    input_stream_for_feed* fstream = (input_stream_for_feed*)stream;
+
+    /* clear and free the buffer. */
+    if (NULL != fstream->buffer)
+    {
+        memset(fstream->buffer, 0, fstream->buffer_size);
+        free(fstream->buffer);
+    }
+
+    /* clear and free the span buffer. */
+    if (NULL != fstream->span)
+    {
+        memset(fstream->span, 0, fstream->span_size);
+        free(fstream->span);
+    }
+
+    /* clear the instance. */
+    memset(fstream, 0, sizeof(*fstream));
+
+    /* free the instance. */
+    free(fstream);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/**
+ * \file src/input_stream/input_stream_from_buffered_descriptor_read.c
+ *
+ * \brief Read a character from a buffered descriptor input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <unistd.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read a character from the input stream from buffered descriptor
+ * instance.
+ *
+ * \param stream                The input stream from which this character is
+ *                              read.
+ * \param ch                    Pointer to be populated with the character read
+ *                              on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_read)(
+    CPARSE_SYM(input_stream)* stream, int* ch)
+{
+    ssize_t read_size;
+    input_stream_from_buffered_descriptor* bstream =
+        (input_stream_from_buffered_descriptor*)stream;
+
+    /* refill the buffer if it has been exhausted. */
+    if (bstream->curr >= bstream->max)
+    {
+        /* attempt to read a block. */
+        read_size = read(bstream->desc, bstream->buffer, bstream->buffer_size);
+        if (read_size < 0)
+        {
+            return ERROR_LIBCPARSE_INPUT_STREAM_READ_ERROR;
+        }
+        else if (0 == read_size)
+        {
+            return ERROR_LIBCPARSE_INPUT_STREAM_EOF;
+        }
+
+        /* reset the buffer offsets. */
+        bstream->curr = 0;
+        bstream->max = (size_t)read_size;
+    }
+
+    /* success. */
+    *ch = bstream->buffer[bstream->curr];
+    bstream->curr += 1;
+    return STATUS_SUCCESS;
+}
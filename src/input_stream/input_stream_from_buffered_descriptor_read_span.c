@@ -0,0 +1,67 @@
+/**
+ * \file src/input_stream/input_stream_from_buffered_descriptor_read_span.c
+ *
+ * \brief Read a span from a buffered descriptor input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <unistd.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read the next contiguous span from the input stream from buffered
+ * descriptor instance.
+ *
+ * The span is the unread remainder of the current block, refilling the block
+ * from the descriptor if it has been exhausted.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size)
+{
+    ssize_t read_size;
+    input_stream_from_buffered_descriptor* bstream =
+        (input_stream_from_buffered_descriptor*)stream;
+
+    /* refill the buffer if it has been exhausted. */
+    if (bstream->curr >= bstream->max)
+    {
+        /* attempt to read a block. */
+        read_size = read(bstream->desc, bstream->buffer, bstream->buffer_size);
+        if (read_size < 0)
+        {
+            return ERROR_LIBCPARSE_INPUT_STREAM_READ_ERROR;
+        }
+        else if (0 == read_size)
+        {
+            return ERROR_LIBCPARSE_INPUT_STREAM_EOF;
+        }
+
+        /* reset the buffer offsets. */
+        bstream->curr = 0;
+        bstream->max = (size_t)read_size;
+    }
+
+    /* consume the remainder of the block. */
+    *span = bstream->buffer + bstream->curr;
+    *size = bstream->max - bstream->curr;
+    bstream->curr = bstream->max;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/**
+ * \file src/input_stream/input_stream_from_buffered_descriptor_release.c
+ *
+ * \brief Release an input stream from buffered descriptor instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Release an input stream from buffered descriptor instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_release)(
+    CPARSE_SYM(input_stream)* stream)
+{
+    int descriptor_close_retval = STATUS_SUCCESS;
+    input_stream_from_buffered_descriptor* bstream =
+        (input_stream_from_buffered_descriptor*)stream;
+
+    /* close the file descriptor. */
+    if (bstream->desc >= 0)
+    {
+        descriptor_close_retval = close(bstream->desc);
+        if (descriptor_close_retval < 0)
+        {
+            descriptor_close_retval =
+                ERROR_LIBCPARSE_INPUT_STREAM_DESCRIPTOR_CLOSE;
+        }
+    }
+
+    /* clear and free the read buffer. */
+    if (NULL != bstream->buffer)
+    {
+        memset(bstream->buffer, 0, bstream->buffer_size);
+        free(bstream->buffer);
+    }
+
+    /* clear the structure. */
+    memset(bstream, 0, sizeof(*bstream));
+
+    /* release the structure. */
+    free(bstream);
+
+    return descriptor_close_retval;
+}
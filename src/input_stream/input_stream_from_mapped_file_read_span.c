@@ -0,0 +1,51 @@
+/**
+ * \file src/input_stream/input_stream_from_mapped_file_read_span.c
+ *
+ * \brief Read a span from a memory mapped file input stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read the next contiguous span from the input stream from memory
+ * mapped file instance.
+ *
+ * The span is the remainder of the mapping.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_mapped_file_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size)
+{
+    input_stream_from_mapped_file* mstream =
+        (input_stream_from_mapped_file*)stream;
+
+    /* is there anything left to read? */
+    if (mstream->curr >= mstream->max)
+    {
+        return ERROR_LIBCPARSE_INPUT_STREAM_EOF;
+    }
+
+    /* consume the remainder of the mapping. */
+    *span = mstream->data + mstream->curr;
+    *size = mstream->max - mstream->curr;
+    mstream->curr = mstream->max;
+
+    return STATUS_SUCCESS;
+}
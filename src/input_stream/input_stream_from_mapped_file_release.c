@@ -0,0 +1,47 @@
+/**
+ * \file src/input_stream/input_stream_from_mapped_file_release.c
+ *
+ * \brief Release an input stream from memory mapped file instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Release an input stream from memory mapped file instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_mapped_file_release)(
+    CPARSE_SYM(input_stream)* stream)
+{
+    input_stream_from_mapped_file* mstream =
+        (input_stream_from_mapped_file*)stream;
+
+    /* unmap the file. */
+    if (NULL != mstream->data)
+    {
+        munmap(mstream->data, mstream->max);
+    }
+
+    /* clear the instance. */
+    memset(mstream, 0, sizeof(*mstream));
+
+    /* free the instance. */
+    free(mstream);
+
+    return STATUS_SUCCESS;
+}
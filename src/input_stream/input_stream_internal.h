@@ -10,6 +10,7 @@
 #pragma once
 
 #include <libcparse/input_stream.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 /* C++ compatibility. */
@@ -21,6 +22,9 @@ struct CPARSE_SYM(input_stream)
 {
     int (*input_stream_release_fn)(CPARSE_SYM(input_stream)* stream);
     int (*input_stream_read_fn)(CPARSE_SYM(input_stream)* stream, int* ch);
+    int (*input_stream_read_span_fn)(
+        CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+    char span_ch;
 };
 
 /**
@@ -35,6 +39,36 @@ struct CPARSE_SYM(input_stream_from_descriptor)
     int desc;
 };
 
+/**
+ * \brief input stream from buffered descriptor derived type.
+ */
+typedef struct CPARSE_SYM(input_stream_from_buffered_descriptor)
+CPARSE_SYM(input_stream_from_buffered_descriptor);
+
+struct CPARSE_SYM(input_stream_from_buffered_descriptor)
+{
+    CPARSE_SYM(input_stream) hdr;
+    int desc;
+    char* buffer;
+    size_t buffer_size;
+    size_t curr;
+    size_t max;
+};
+
+/**
+ * \brief input stream from memory mapped file derived type.
+ */
+typedef struct CPARSE_SYM(input_stream_from_mapped_file)
+CPARSE_SYM(input_stream_from_mapped_file);
+
+struct CPARSE_SYM(input_stream_from_mapped_file)
+{
+    CPARSE_SYM(input_stream) hdr;
+    char* data;
+    size_t curr;
+    size_t max;
+};
+
 /**
  * \brief input stream from string derived type.
  */
@@ -49,6 +83,27 @@ struct CPARSE_SYM(input_stream_from_string)
     size_t max;
 };
 
+/**
+ * \brief input stream for feed derived type.
+ *
+ * Fed bytes are appended to the buffer. A span read swaps the buffer with the
+ * span buffer, so that the span remains valid while more bytes are fed.
+ */
+typedef struct CPARSE_SYM(input_stream_for_feed)
+CPARSE_SYM(input_stream_for_feed);
+
+struct CPARSE_SYM(input_stream_for_feed)
+{
+    CPARSE_SYM(input_stream) hdr;
+    char* buffer;
+    size_t buffer_size;
+    size_t curr;
+    size_t max;
+    char* span;
+    size_t span_size;
+    bool finished;
+};
+
 /**
  * \brief Release an input stream from descriptor instance.
  *
@@ -77,6 +132,100 @@ int CPARSE_SYM(input_stream_from_descriptor_release)(
 int CPARSE_SYM(input_stream_from_descriptor_read)(
     CPARSE_SYM(input_stream)* stream, int* ch);
 
+/**
+ * \brief Release an input stream from buffered descriptor instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_release)(
+    CPARSE_SYM(input_stream)* stream);
+
+/**
+ * \brief Read a character from the input stream from buffered descriptor
+ * instance.
+ *
+ * \param stream                The input stream from which this character is
+ *                              read.
+ * \param ch                    Pointer to be populated with the character read
+ *                              on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_read)(
+    CPARSE_SYM(input_stream)* stream, int* ch);
+
+/**
+ * \brief Read the next contiguous span from the input stream from buffered
+ * descriptor instance.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_buffered_descriptor_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
+/**
+ * \brief Release an input stream from memory mapped file instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_mapped_file_release)(
+    CPARSE_SYM(input_stream)* stream);
+
+/**
+ * \brief Read a character from the input stream from memory mapped file
+ * instance.
+ *
+ * \param stream                The input stream from which this character is
+ *                              read.
+ * \param ch                    Pointer to be populated with the character read
+ *                              on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_mapped_file_read)(
+    CPARSE_SYM(input_stream)* stream, int* ch);
+
+/**
+ * \brief Read the next contiguous span from the input stream from memory
+ * mapped file instance.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_mapped_file_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
 /**
  * \brief Release an input stream from string instance.
  *
@@ -105,6 +254,90 @@ int CPARSE_SYM(input_stream_from_string_release)(
 int CPARSE_SYM(input_stream_from_string_read)(
     CPARSE_SYM(input_stream)* stream, int* ch);
 
+/**
+ * \brief Read the next contiguous span from the input stream from string
+ * instance.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_from_string_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
+/**
+ * \brief Release an input stream for feed instance.
+ *
+ * \param stream                The input stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_release)(
+    CPARSE_SYM(input_stream)* stream);
+
+/**
+ * \brief Read a character from the input stream for feed instance.
+ *
+ * \param stream                The input stream from which this character is
+ *                              read.
+ * \param ch                    Pointer to be populated with the character read
+ *                              on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK if no bytes are available.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_read)(
+    CPARSE_SYM(input_stream)* stream, int* ch);
+
+/**
+ * \brief Read the next contiguous span from the input stream for feed
+ * instance.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK if no bytes are available.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_for_feed_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
+/**
+ * \brief Read a single character span from an input stream which does not
+ * provide a span read method.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_read_span_default)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -112,6 +345,10 @@ int CPARSE_SYM(input_stream_from_string_read)(
     CPARSE_BEGIN_EXPORT \
         typedef CPARSE_SYM(input_stream_from_descriptor) \
         sym ## input_stream_from_descriptor; \
+        typedef CPARSE_SYM(input_stream_from_buffered_descriptor) \
+        sym ## input_stream_from_buffered_descriptor; \
+        typedef CPARSE_SYM(input_stream_from_mapped_file) \
+        sym ## input_stream_from_mapped_file; \
         typedef CPARSE_SYM(input_stream_from_string) \
         sym ## input_stream_from_string; \
         static inline int sym ## input_stream_from_descriptor_release ( \
@@ -120,12 +357,62 @@ int CPARSE_SYM(input_stream_from_string_read)(
         static inline int sym ## input_stream_from_descriptor_read( \
             CPARSE_SYM(input_stream)* x, int* y) { \
                 return CPARSE_SYM(input_stream_from_descriptor_read)(x,y); } \
+        static inline int \
+        sym ## input_stream_from_buffered_descriptor_release( \
+            CPARSE_SYM(input_stream)* x) { \
+                return \
+                    CPARSE_SYM(input_stream_from_buffered_descriptor_release)( \
+                        x); } \
+        static inline int sym ## input_stream_from_buffered_descriptor_read( \
+            CPARSE_SYM(input_stream)* x, int* y) { \
+                return \
+                    CPARSE_SYM(input_stream_from_buffered_descriptor_read)( \
+                        x,y); } \
+        static inline int \
+        sym ## input_stream_from_buffered_descriptor_read_span( \
+            CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+                return \
+                    CPARSE_SYM( \
+                        input_stream_from_buffered_descriptor_read_span)( \
+                            x,y,z); } \
+        static inline int sym ## input_stream_from_mapped_file_release( \
+            CPARSE_SYM(input_stream)* x) { \
+                return CPARSE_SYM(input_stream_from_mapped_file_release)(x); } \
+        static inline int sym ## input_stream_from_mapped_file_read( \
+            CPARSE_SYM(input_stream)* x, int* y) { \
+                return CPARSE_SYM(input_stream_from_mapped_file_read)(x,y); } \
+        static inline int sym ## input_stream_from_mapped_file_read_span( \
+            CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+                return \
+                    CPARSE_SYM(input_stream_from_mapped_file_read_span)( \
+                        x,y,z); } \
         static inline int sym ## input_stream_from_string_release( \
             CPARSE_SYM(input_stream)* x) { \
                 return CPARSE_SYM(input_stream_from_string_release)(x); } \
         static inline int sym ## input_stream_from_string_read( \
             CPARSE_SYM(input_stream)* x, int* y) { \
                 return CPARSE_SYM(input_stream_from_string_read)(x,y); } \
+        static inline int sym ## input_stream_from_string_read_span( \
+            CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+                return \
+                    CPARSE_SYM(input_stream_from_string_read_span)( \
+                        x,y,z); } \
+        typedef CPARSE_SYM(input_stream_for_feed) \
+        sym ## input_stream_for_feed; \
+        static inline int sym ## input_stream_for_feed_release( \
+            CPARSE_SYM(input_stream)* x) { \
+                return CPARSE_SYM(input_stream_for_feed_release)(x); } \
+        static inline int sym ## input_stream_for_feed_read( \
+            CPARSE_SYM(input_stream)* x, int* y) { \
+                return CPARSE_SYM(input_stream_for_feed_read)(x,y); } \
+        static inline int sym ## input_stream_for_feed_read_span( \
+            CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+                return \
+                    CPARSE_SYM(input_stream_for_feed_read_span)( \
+                        x,y,z); } \
+        static inline int sym ## input_stream_read_span_default( \
+            CPARSE_SYM(input_stream)* x, const char** y, size_t* z) { \
+                return CPARSE_SYM(input_stream_read_span_default)(x,y,z); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_input_stream_internal_as(sym) \
@@ -0,0 +1,39 @@
+/**
+ * \file src/input_stream/input_stream_read_span.c
+ *
+ * \brief Read a span of characters from the \ref input_stream instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "input_stream_internal.h"
+
+CPARSE_IMPORT_input_stream_internal;
+
+/**
+ * \brief Read the next contiguous span of characters from the input stream.
+ *
+ * \param stream                    The input stream from which this span is
+ *                                  read.
+ * \param span                      Pointer to be populated with the start of
+ *                                  the span on success.
+ * \param size                      Pointer to be populated with the size of
+ *                                  the span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_read_span)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size)
+{
+    /* fall back to the per-character adapter if no span method is provided. */
+    if (NULL == stream->input_stream_read_span_fn)
+    {
+        return input_stream_read_span_default(stream, span, size);
+    }
+
+    return stream->input_stream_read_span_fn(stream, span, size);
+}
@@ -0,0 +1,50 @@
+/**
+ * \file src/input_stream/input_stream_read_span_default.c
+ *
+ * \brief Adapt a per-character input stream to the span read method.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "input_stream_internal.h"
+
+/**
+ * \brief Read a single character span from an input stream which does not
+ * provide a span read method.
+ *
+ * \param stream                The input stream from which this span is read.
+ * \param span                  Pointer to be populated with the start of the
+ *                              span on success.
+ * \param size                  Pointer to be populated with the size of the
+ *                              span on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(input_stream_read_span_default)(
+    CPARSE_SYM(input_stream)* stream, const char** span, size_t* size)
+{
+    int retval, ch;
+
+    /* read a single character. */
+    retval = stream->input_stream_read_fn(stream, &ch);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the span is this character, held by the stream. */
+    stream->span_ch = (char)ch;
+    *span = &stream->span_ch;
+    *size = 1;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
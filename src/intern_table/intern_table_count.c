@@ -0,0 +1,38 @@
+/**
+ * \file intern_table/intern_table_count.c
+ *
+ * \brief Get the number of strings in an intern table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Get the number of distinct strings interned in this table.
+ *
+ * \param table                 The \ref intern_table to query.
+ *
+ * \returns the number of interned strings, which is also the next symbol ID.
+ */
+uint32_t CPARSE_SYM(intern_table_count)(CPARSE_SYM(intern_table)* table)
+{
+    uint32_t count;
+
+    if (table->thread_safe)
+    {
+        pthread_mutex_lock(&table->lock);
+    }
+
+    count = table->count;
+
+    if (table->thread_safe)
+    {
+        pthread_mutex_unlock(&table->lock);
+    }
+
+    return count;
+}
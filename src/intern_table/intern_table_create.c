@@ -0,0 +1,44 @@
+/**
+ * \file intern_table/intern_table_create.c
+ *
+ * \brief Create an intern table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Create an \ref intern_table instance.
+ *
+ * \param table                 Pointer to the \ref intern_table pointer to set
+ *                              to the created instance on success.
+ * \param thread_safe           If true, every method on this table is guarded
+ *                              by a lock.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(intern_table_create)(
+    CPARSE_SYM(intern_table)** table, bool thread_safe)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return intern_table_create_with_allocator(table, thread_safe, &alloc);
+}
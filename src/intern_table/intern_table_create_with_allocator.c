@@ -0,0 +1,98 @@
+/**
+ * \file intern_table/intern_table_create_with_allocator.c
+ *
+ * \brief Create an intern table that uses a given allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Create an \ref intern_table instance that uses the given allocator
+ * for its memory.
+ *
+ * \param table                 Pointer to the \ref intern_table pointer to set
+ *                              to the created instance on success.
+ * \param thread_safe           If true, every method on this table is guarded
+ *                              by a lock.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(intern_table_create_with_allocator)(
+    CPARSE_SYM(intern_table)** table, bool thread_safe,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    intern_table* tmp;
+    size_t slots_size = CPARSE_INTERN_TABLE_INITIAL_SLOTS * sizeof(uint32_t);
+
+    /* allocate memory for this instance. */
+    tmp = (intern_table*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* allocate the empty hash slots. */
+    tmp->slots = (uint32_t*)allocator_allocate(alloc, slots_size);
+    if (NULL == tmp->slots)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    memset(tmp->slots, 0, slots_size);
+    tmp->slot_count = CPARSE_INTERN_TABLE_INITIAL_SLOTS;
+
+    /* a shared table needs a lock. */
+    if (thread_safe)
+    {
+        if (0 != pthread_mutex_init(&tmp->lock, NULL))
+        {
+            retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+            goto cleanup_slots;
+        }
+
+        tmp->thread_safe = true;
+    }
+
+    /* success. */
+    *table = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_slots:
+    memset(tmp->slots, 0, slots_size);
+    allocator_free(alloc, tmp->slots);
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
+
+done:
+    return retval;
+}
@@ -0,0 +1,346 @@
+/**
+ * \file intern_table/intern_table_intern.c
+ *
+ * \brief Intern a span of characters.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_intern_table_internal;
+
+static uint32_t hash_span(const char* span, size_t size);
+static uint32_t* find_slot(
+    intern_table* table, const char* span, size_t size, uint32_t hash);
+static int add_entry(
+    uint32_t* symbol, intern_table* table, const char* span, size_t size,
+    uint32_t hash);
+static int store_string(
+    const char** str, intern_table* table, const char* span, size_t size);
+static int grow_entries(intern_table* table);
+static int grow_slots(intern_table* table);
+
+/**
+ * \brief Intern a span of characters.
+ *
+ * \param str                   Pointer to receive the interned string on
+ *                              success.
+ * \param symbol                Pointer to receive the symbol ID on success.
+ * \param table                 The \ref intern_table for this operation.
+ * \param span                  The characters to intern.
+ * \param size                  The number of characters in \p span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(intern_table_intern)(
+    const char** str, uint32_t* symbol, CPARSE_SYM(intern_table)* table,
+    const char* span, size_t size)
+{
+    int retval;
+    uint32_t hash = hash_span(span, size);
+    uint32_t* slot;
+    uint32_t tmp;
+
+    if (table->thread_safe)
+    {
+        pthread_mutex_lock(&table->lock);
+    }
+
+    /* if this string has already been interned, use it. */
+    slot = find_slot(table, span, size, hash);
+    if (0 != *slot)
+    {
+        tmp = *slot - 1;
+        goto success;
+    }
+
+    /* otherwise, add a new entry. */
+    retval = add_entry(&tmp, table, span, size, hash);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto unlock;
+    }
+
+success:
+    *str = table->entries[tmp].str;
+    *symbol = tmp;
+    retval = STATUS_SUCCESS;
+    goto unlock;
+
+unlock:
+    if (table->thread_safe)
+    {
+        pthread_mutex_unlock(&table->lock);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Compute the FNV-1a hash of a span.
+ *
+ * \param span                  The span to hash.
+ * \param size                  The size of the span.
+ *
+ * \returns the hash of this span.
+ */
+static uint32_t hash_span(const char* span, size_t size)
+{
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= (unsigned char)span[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/**
+ * \brief Find the slot holding the given span, or the empty slot where it
+ * belongs.
+ *
+ * \param table                 The table to search.
+ * \param span                  The span to find.
+ * \param size                  The size of the span.
+ * \param hash                  The hash of the span.
+ *
+ * \returns the slot for this span.
+ */
+static uint32_t* find_slot(
+    intern_table* table, const char* span, size_t size, uint32_t hash)
+{
+    size_t mask = table->slot_count - 1;
+    size_t index = hash & mask;
+
+    for (;;)
+    {
+        uint32_t* slot = table->slots + index;
+        const intern_table_entry* entry;
+
+        if (0 == *slot)
+        {
+            return slot;
+        }
+
+        entry = table->entries + (*slot - 1);
+        if (
+            entry->hash == hash
+         && entry->size == size
+         && 0 == memcmp(entry->str, span, size))
+        {
+            return slot;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+/**
+ * \brief Add a new entry for the given span.
+ *
+ * \param symbol                Pointer to receive the new symbol ID.
+ * \param table                 The table to update.
+ * \param span                  The span to add.
+ * \param size                  The size of the span.
+ * \param hash                  The hash of the span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int add_entry(
+    uint32_t* symbol, intern_table* table, const char* span, size_t size,
+    uint32_t hash)
+{
+    int retval;
+    const char* str;
+    intern_table_entry* entry;
+
+    /* the last ID is reserved for strings without a symbol. */
+    if (CPARSE_INTERN_TABLE_NO_SYMBOL - 1 == table->count)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    /* keep the load factor at or below one half. */
+    if ((size_t)(table->count + 1) * 2 > table->slot_count)
+    {
+        retval = grow_slots(table);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* make room for the new entry. */
+    if (table->count == table->capacity)
+    {
+        retval = grow_entries(table);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* copy the string. */
+    retval = store_string(&str, table, span, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* add the entry. */
+    entry = table->entries + table->count;
+    entry->str = str;
+    entry->size = size;
+    entry->hash = hash;
+
+    /* the slot stores the symbol plus one, so that zero means empty. */
+    *symbol = table->count++;
+    *find_slot(table, span, size, hash) = table->count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Copy a span into the table's string storage.
+ *
+ * \param str                   Pointer to receive the stored string.
+ * \param table                 The table to update.
+ * \param span                  The span to store.
+ * \param size                  The size of the span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int store_string(
+    const char** str, intern_table* table, const char* span, size_t size)
+{
+    intern_table_block* block = table->blocks;
+    char* tmp;
+
+    /* start a new block if the current one is full. */
+    if (NULL == block || block->size - block->used < size + 1)
+    {
+        size_t block_size = CPARSE_INTERN_TABLE_BLOCK_SIZE;
+
+        if (size + 1 > block_size)
+        {
+            block_size = size + 1;
+        }
+
+        block =
+            (intern_table_block*)allocator_allocate(
+                &table->alloc, sizeof(*block) + block_size);
+        if (NULL == block)
+        {
+            return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        }
+
+        block->next = table->blocks;
+        block->size = block_size;
+        block->used = 0;
+        table->blocks = block;
+    }
+
+    /* copy the string. */
+    tmp = block->data + block->used;
+    memcpy(tmp, span, size);
+    tmp[size] = 0;
+    block->used += size + 1;
+
+    *str = tmp;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the capacity of the entry array.
+ *
+ * \param table                 The table to update.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int grow_entries(intern_table* table)
+{
+    uint32_t capacity = table->capacity;
+    intern_table_entry* entries;
+
+    capacity = (0 == capacity) ? CPARSE_INTERN_TABLE_INITIAL_SLOTS / 2
+                               : capacity * 2;
+
+    entries =
+        (intern_table_entry*)allocator_reallocate(
+            &table->alloc, table->entries, capacity * sizeof(*entries));
+    if (NULL == entries)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    table->entries = entries;
+    table->capacity = capacity;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the number of hash slots, rehashing every entry.
+ *
+ * \param table                 The table to update.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int grow_slots(intern_table* table)
+{
+    size_t slot_count = table->slot_count * 2;
+    size_t mask = slot_count - 1;
+    uint32_t* slots;
+
+    slots =
+        (uint32_t*)allocator_allocate(
+            &table->alloc, slot_count * sizeof(*slots));
+    if (NULL == slots)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    memset(slots, 0, slot_count * sizeof(*slots));
+
+    /* every entry is distinct, so only the hash is needed to place it. */
+    for (uint32_t i = 0; i < table->count; ++i)
+    {
+        size_t index = table->entries[i].hash & mask;
+
+        while (0 != slots[index])
+        {
+            index = (index + 1) & mask;
+        }
+
+        slots[index] = i + 1;
+    }
+
+    /* replace the old slots. */
+    memset(table->slots, 0, table->slot_count * sizeof(*table->slots));
+    allocator_free(&table->alloc, table->slots);
+    table->slots = slots;
+    table->slot_count = slot_count;
+
+    return STATUS_SUCCESS;
+}
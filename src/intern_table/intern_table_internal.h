@@ -0,0 +1,97 @@
+/**
+ * \file intern_table/intern_table_internal.h
+ *
+ * \brief Internal declarations and definitions for the intern table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator.h>
+#include <libcparse/intern_table.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The initial number of hash slots in an intern table.
+ */
+#define CPARSE_INTERN_TABLE_INITIAL_SLOTS 256
+
+/**
+ * \brief The size of a string storage block.
+ */
+#define CPARSE_INTERN_TABLE_BLOCK_SIZE 16384
+
+typedef struct CPARSE_SYM(intern_table_entry) CPARSE_SYM(intern_table_entry);
+typedef struct CPARSE_SYM(intern_table_block) CPARSE_SYM(intern_table_block);
+
+/**
+ * \brief An interned string, indexed by its symbol ID.
+ */
+struct CPARSE_SYM(intern_table_entry)
+{
+    const char* str;
+    size_t size;
+    uint32_t hash;
+};
+
+/**
+ * \brief A block of string storage. Strings are packed into blocks so that
+ * they never move once interned.
+ */
+struct CPARSE_SYM(intern_table_block)
+{
+    CPARSE_SYM(intern_table_block)* next;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
+/**
+ * \brief The intern table is an open addressing hash table of symbol IDs,
+ * backed by an array of entries and a list of storage blocks.
+ *
+ * Each slot holds a symbol ID plus one, so that zero marks an empty slot. The
+ * slot count is a power of two, and is kept at least twice the entry count.
+ */
+struct CPARSE_SYM(intern_table)
+{
+    bool thread_safe;
+    pthread_mutex_t lock;
+    CPARSE_SYM(intern_table_entry)* entries;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t* slots;
+    size_t slot_count;
+    CPARSE_SYM(intern_table_block)* blocks;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_intern_table_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(intern_table_entry) sym ## intern_table_entry; \
+    typedef CPARSE_SYM(intern_table_block) sym ## intern_table_block; \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_intern_table_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_intern_table_internal_sym(sym ## _)
+#define CPARSE_IMPORT_intern_table_internal \
+    __INTERNAL_CPARSE_IMPORT_intern_table_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,58 @@
+/**
+ * \file intern_table/intern_table_lookup.c
+ *
+ * \brief Look up the string for a symbol ID.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Look up the interned string for a symbol ID.
+ *
+ * \param str                   Pointer to receive the interned string on
+ *                              success.
+ * \param table                 The \ref intern_table for this operation.
+ * \param symbol                The symbol ID to look up.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL if this symbol ID has not
+ *        been assigned by this table.
+ */
+int CPARSE_SYM(intern_table_lookup)(
+    const char** str, CPARSE_SYM(intern_table)* table, uint32_t symbol)
+{
+    int retval;
+
+    if (table->thread_safe)
+    {
+        pthread_mutex_lock(&table->lock);
+    }
+
+    /* is this a valid symbol? */
+    if (symbol >= table->count)
+    {
+        retval = ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL;
+        goto unlock;
+    }
+
+    /* success. */
+    *str = table->entries[symbol].str;
+    retval = STATUS_SUCCESS;
+    goto unlock;
+
+unlock:
+    if (table->thread_safe)
+    {
+        pthread_mutex_unlock(&table->lock);
+    }
+
+    return retval;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file intern_table/intern_table_release.c
+ *
+ * \brief Release an intern table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "intern_table_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_intern_table_internal;
+
+/**
+ * \brief Release an \ref intern_table instance, along with every string
+ * interned in it.
+ *
+ * \param table                 The \ref intern_table instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(intern_table_release)(CPARSE_SYM(intern_table)* table)
+{
+    intern_table_block* block = table->blocks;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &table->alloc, sizeof(alloc));
+
+    /* release the storage blocks. */
+    while (NULL != block)
+    {
+        intern_table_block* next = block->next;
+        size_t block_size = sizeof(*block) + block->size;
+
+        memset(block, 0, block_size);
+        allocator_free(&alloc, block);
+        block = next;
+    }
+
+    /* release the entries. */
+    if (NULL != table->entries)
+    {
+        memset(table->entries, 0, table->capacity * sizeof(*table->entries));
+        allocator_free(&alloc, table->entries);
+    }
+
+    /* release the hash slots. */
+    if (NULL != table->slots)
+    {
+        memset(table->slots, 0, table->slot_count * sizeof(*table->slots));
+        allocator_free(&alloc, table->slots);
+    }
+
+    /* destroy the lock. */
+    if (table->thread_safe)
+    {
+        pthread_mutex_destroy(&table->lock);
+    }
+
+    /* clear and free the instance. */
+    memset(table, 0, sizeof(*table));
+    allocator_free(&alloc, table);
+
+    return STATUS_SUCCESS;
+}
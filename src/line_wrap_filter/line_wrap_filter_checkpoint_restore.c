@@ -0,0 +1,53 @@
+/**
+ * \file src/line_wrap_filter/line_wrap_filter_checkpoint_restore.c
+ *
+ * \brief Restore the state of a \ref line_wrap_filter from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/line_wrap_filter.h>
+#include <libcparse/status_codes.h>
+
+#include "line_wrap_filter_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_line_wrap_filter;
+
+/**
+ * \brief Restore the state of a line wrap filter from a checkpoint.
+ *
+ * \param filter            The \ref line_wrap_filter instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(line_wrap_filter_checkpoint_restore)(
+    CPARSE_SYM(line_wrap_filter)* filter,
+    const CPARSE_SYM(line_wrap_filter_checkpoint)* ckpt)
+{
+    int retval;
+
+    /* verify that this is one of our states. */
+    if (ckpt->state < 0 || ckpt->state > CPARSE_LINE_WRAP_FILTER_STATE_SLASH)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* restore the cached position. */
+    retval =
+        file_position_cache_checkpoint_restore(
+            filter->cache, filter->base, &ckpt->cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    filter->state = ckpt->state;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file src/line_wrap_filter/line_wrap_filter_checkpoint_save.c
+ *
+ * \brief Save the state of a \ref line_wrap_filter to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/line_wrap_filter.h>
+#include <string.h>
+
+#include "line_wrap_filter_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_line_wrap_filter;
+
+/**
+ * \brief Save the state of a line wrap filter to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param filter            The \ref line_wrap_filter instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int CPARSE_SYM(line_wrap_filter_checkpoint_save)(
+    CPARSE_SYM(line_wrap_filter_checkpoint)* ckpt,
+    const CPARSE_SYM(line_wrap_filter)* filter)
+{
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    ckpt->state = filter->state;
+
+    return file_position_cache_checkpoint_save(&ckpt->cache, filter->cache);
+}
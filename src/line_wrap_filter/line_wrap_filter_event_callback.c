@@ -8,20 +8,28 @@
  */
 
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/line_wrap_filter.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/char_scan.h>
+#include <libcparse/util/raw_span.h>
 
 #include "line_wrap_filter_internal.h"
 
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
 CPARSE_IMPORT_line_wrap_filter;
+CPARSE_IMPORT_line_wrap_filter_internal;
+CPARSE_IMPORT_util_char_scan;
+CPARSE_IMPORT_util_raw_span;
 
 static int process_char_event(line_wrap_filter* filter, const event* ev);
+static int process_span_event(line_wrap_filter* filter, const event* ev);
 static int process_eof_event(line_wrap_filter* filter, const event* ev);
 static int raw_character_broadcast(
     line_wrap_filter* filter, const event* ev, int ch);
@@ -52,6 +60,9 @@ int CPARSE_SYM(line_wrap_filter_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return process_char_event(filter, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return process_span_event(filter, ev);
+
         default:
             return STATUS_SUCCESS;
     }
@@ -164,6 +175,90 @@ static int process_char_event(line_wrap_filter* filter, const event* ev)
     }
 }
 
+/**
+ * \brief Process a span event.
+ *
+ * Backslashes, and the characters following them, are processed one at a time
+ * as character events. Every run of characters between them is passed on as a
+ * span. If any subscriber needs raw characters, then the whole span is
+ * processed one character at a time.
+ *
+ * \param filter            The \ref line_wrap_filter for this operation.
+ * \param ev                The raw span event to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int process_span_event(line_wrap_filter* filter, const event* ev)
+{
+    event_raw_span* rsev;
+    cursor pos;
+    size_t run;
+
+    /* get the raw span event. */
+    int retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    const char* span = event_raw_span_get(rsev);
+    size_t size = event_raw_span_size_get(rsev);
+
+    /* start at the first character of the span. */
+    raw_span_start_position(&pos, ev);
+
+    /* break up the span if a subscriber needs characters. */
+    if (!event_reactor_accepts_raw_spans(filter->reactor))
+    {
+        return
+            raw_span_send_characters(
+                &line_wrap_filter_event_callback, filter, &pos, span, size);
+    }
+
+    while (size > 0)
+    {
+        /* a backslash and the character after it are processed singly. */
+        if (
+            CPARSE_LINE_WRAP_FILTER_STATE_SLASH == filter->state
+         || '\\' == *span)
+        {
+            run = 1;
+            retval =
+                raw_span_send_characters(
+                    &line_wrap_filter_event_callback, filter, &pos, span, run);
+        }
+        /* everything up to the next backslash is passed on. */
+        else
+        {
+            run = char_scan_any(span, size, "\\", 1);
+
+            /* the state follows the last character of this run. */
+            if ('\n' == span[run - 1])
+            {
+                filter->state = CPARSE_LINE_WRAP_FILTER_STATE_INIT;
+            }
+            else
+            {
+                filter->state = CPARSE_LINE_WRAP_FILTER_STATE_CHAR;
+            }
+
+            retval = raw_span_broadcast(filter->reactor, &pos, span, run);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        span += run;
+        size -= run;
+    }
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * \brief Broadcast a raw character event.
  *
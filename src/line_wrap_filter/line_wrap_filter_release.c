@@ -7,14 +7,15 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "line_wrap_filter_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
 CPARSE_IMPORT_message_handler;
@@ -36,6 +37,10 @@ int CPARSE_SYM(line_wrap_filter_release)(CPARSE_SYM(line_wrap_filter)* filter)
     int reactor_release_retval = STATUS_SUCCESS;
     int cache_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &filter->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != filter->parent)
@@ -63,7 +68,7 @@ int CPARSE_SYM(line_wrap_filter_release)(CPARSE_SYM(line_wrap_filter)* filter)
     memset(filter, 0, sizeof(*filter));
 
     /* free filter memory. */
-    free(filter);
+    allocator_free(&alloc, filter);
 
     /* decode return values. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -0,0 +1,26 @@
+/**
+ * \file src/message/message_checkpoint_get.c
+ *
+ * \brief Get the checkpoint for a \ref message_checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/checkpoint.h>
+
+/**
+ * \brief Get the checkpoint associated with a \ref message_checkpoint.
+ *
+ * \note A restore message must not modify this checkpoint.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the checkpoint associated with this message.
+ */
+CPARSE_SYM(abstract_parser_checkpoint)*
+CPARSE_SYM(message_checkpoint_get)(
+    const CPARSE_SYM(message_checkpoint)* msg)
+{
+    return msg->ckpt;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file src/message/message_checkpoint_init_for_restore.c
+ *
+ * \brief Init method for a \ref message_checkpoint which restores a
+ * checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/checkpoint.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Initialize a \ref message_checkpoint which restores each stage from
+ * the given checkpoint.
+ *
+ * \param msg               The message to initialize.
+ * \param ckpt              The checkpoint to restore, which must outlive this
+ *                          message.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_checkpoint_init_for_restore)(
+    CPARSE_SYM(message_checkpoint)* msg,
+    const CPARSE_SYM(abstract_parser_checkpoint)* ckpt)
+{
+    /* clear the message instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* set the checkpoint; restoring stages only read from it. */
+    msg->ckpt = (CPARSE_SYM(abstract_parser_checkpoint)*)ckpt;
+
+    /* initialize the base message. */
+    return
+        message_init(&msg->hdr, CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE);
+}
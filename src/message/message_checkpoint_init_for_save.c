@@ -0,0 +1,41 @@
+/**
+ * \file src/message/message_checkpoint_init_for_save.c
+ *
+ * \brief Init method for a \ref message_checkpoint which saves a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/checkpoint.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Initialize a \ref message_checkpoint which saves each stage to the
+ * given checkpoint.
+ *
+ * \param msg               The message to initialize.
+ * \param ckpt              The checkpoint to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_checkpoint_init_for_save)(
+    CPARSE_SYM(message_checkpoint)* msg,
+    CPARSE_SYM(abstract_parser_checkpoint)* ckpt)
+{
+    /* clear the message instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* set the checkpoint. */
+    msg->ckpt = ckpt;
+
+    /* initialize the base message. */
+    return
+        message_init(&msg->hdr, CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE);
+}
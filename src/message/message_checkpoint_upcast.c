@@ -0,0 +1,24 @@
+/**
+ * \file src/message/message_checkpoint_upcast.c
+ *
+ * \brief Upcast this \ref message_checkpoint instance to the base \ref message
+ * instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/checkpoint.h>
+
+/**
+ * \brief Upcast a \ref message_checkpoint to a \ref message.
+ *
+ * \param msg               The \ref message_checkpoint to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_checkpoint_upcast)(
+    CPARSE_SYM(message_checkpoint)* msg)
+{
+    return &msg->hdr;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file src/message/message_downcast_to_message_checkpoint.c
+ *
+ * \brief Attempt to downcast a \ref message to a \ref message_checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/checkpoint.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_checkpoint;
+
+/**
+ * \brief Attempt to downcast a \ref message to a \ref message_checkpoint.
+ *
+ * \param ckpt_msg          Pointer to the message pointer to receive the
+ *                          downcast instance on success.
+ * \param msg               The \ref message pointer to attempt to downcast to
+ *                          the derived type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_downcast_to_message_checkpoint)(
+    CPARSE_SYM(message_checkpoint)** ckpt_msg, CPARSE_SYM(message)* msg)
+{
+    /* verify that the message type matches the derived type. */
+    switch (message_get_type(msg))
+    {
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE:
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE:
+            break;
+
+        default:
+            return ERROR_LIBCPARSE_BAD_CAST;
+    }
+
+    /* reinterpret cast the message. */
+    *ckpt_msg = (message_checkpoint*)msg;
+    return STATUS_SUCCESS;
+}
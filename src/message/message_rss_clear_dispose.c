@@ -0,0 +1,38 @@
+/**
+ * \file src/message/message_rss_clear_dispose.c
+ *
+ * \brief Dispose method for the \ref message_rss_clear type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Dispose of a \ref message_rss_clear instance.
+ *
+ * \param msg               The message to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_rss_clear_dispose)(CPARSE_SYM(message_rss_clear)* msg)
+{
+    int message_dispose_retval;
+
+    /* dispose the base message type. */
+    message_dispose_retval = message_dispose(&msg->hdr);
+
+    /* clear this instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* return the result of disposing the base message. */
+    return message_dispose_retval;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file src/message/message_rss_feed_buffer_get.c
+ *
+ * \brief Get the buffer for a \ref message_rss_feed.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+
+/**
+ * \brief Get the buffer for a \ref message_rss_feed.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the buffer for this message, or NULL for a finish message.
+ */
+const void* CPARSE_SYM(message_rss_feed_buffer_get)(
+    const CPARSE_SYM(message_rss_feed)* msg)
+{
+    return msg->buf;
+}
@@ -0,0 +1,41 @@
+/**
+ * \file src/message/message_rss_feed_init.c
+ *
+ * \brief Init method for the \ref message_rss_feed type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Initialize a \ref message_rss_feed.
+ *
+ * \param msg               The message to initialize.
+ * \param buf               The bytes to feed to the scanner.
+ * \param size              The number of bytes in \p buf.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_rss_feed_init)(
+    CPARSE_SYM(message_rss_feed)* msg, const void* buf, size_t size)
+{
+    /* clear the message instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* set the buffer. */
+    msg->buf = buf;
+    msg->size = size;
+
+    /* initialize the base message. */
+    return
+        message_init(&msg->hdr, CPARSE_MESSAGE_TYPE_RSS_FEED);
+}
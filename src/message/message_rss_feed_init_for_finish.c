@@ -0,0 +1,35 @@
+/**
+ * \file src/message/message_rss_feed_init_for_finish.c
+ *
+ * \brief Init method for a finish \ref message_rss_feed.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Initialize a \ref message_rss_feed which marks the end of fed input.
+ *
+ * \param msg               The message to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_rss_feed_init_for_finish)(
+    CPARSE_SYM(message_rss_feed)* msg)
+{
+    /* clear the message instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* initialize the base message. */
+    return
+        message_init(&msg->hdr, CPARSE_MESSAGE_TYPE_RSS_FEED_FINISH);
+}
@@ -0,0 +1,40 @@
+/**
+ * \file src/message/message_rss_step_init.c
+ *
+ * \brief Init method for the \ref message_rss_step type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+#include <string.h>
+
+#include "message_internal.h"
+
+CPARSE_IMPORT_message_internal;
+
+/**
+ * \brief Initialize a \ref message_rss_step.
+ *
+ * \param msg               The message to initialize.
+ * \param yield             Pointer to the yield flag, which is typically set by
+ *                          an event handler downstream of the scanner.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(message_rss_step_init)(
+    CPARSE_SYM(message_rss_step)* msg, const bool* yield)
+{
+    /* clear the message instance. */
+    memset(msg, 0, sizeof(*msg));
+
+    /* set the yield flag. */
+    msg->yield = yield;
+
+    /* initialize the base message. */
+    return
+        message_init(&msg->hdr, CPARSE_MESSAGE_TYPE_RSS_STEP);
+}
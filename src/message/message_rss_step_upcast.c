@@ -0,0 +1,24 @@
+/**
+ * \file src/message/message_rss_step_upcast.c
+ *
+ * \brief Upcast this \ref message_rss_step instance to the base \ref message
+ * instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+
+/**
+ * \brief Upcast a \ref message_rss_step to a \ref message.
+ *
+ * \param msg               The \ref message_rss_step to upcast.
+ *
+ * \returns the \ref message instance for this message.
+ */
+CPARSE_SYM(message)* CPARSE_SYM(message_rss_step_upcast)(
+    CPARSE_SYM(message_rss_step)* msg)
+{
+    return &msg->hdr;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file src/message/message_rss_step_yield_get.c
+ *
+ * \brief Get the yield flag for a \ref message_rss_step.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/raw_stack_scanner.h>
+
+/**
+ * \brief Get the yield flag for a \ref message_rss_step.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the yield flag pointer for this message.
+ */
+const bool* CPARSE_SYM(message_rss_step_yield_get)(
+    const CPARSE_SYM(message_rss_step)* msg)
+{
+    return msg->yield;
+}
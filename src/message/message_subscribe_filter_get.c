@@ -0,0 +1,27 @@
+/**
+ * \file src/message/message_subscribe_filter_get.c
+ *
+ * \brief Get the \ref event_reactor_filter for a \ref message_subscribe
+ * instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/subscription.h>
+
+/**
+ * \brief Get the \ref event_reactor_filter associated with a
+ * \ref message_subscribe instance.
+ *
+ * \param msg               The message to query.
+ *
+ * \returns the \ref event_reactor_filter associated with this message, or NULL
+ * if the subscriber should receive all events.
+ */
+const CPARSE_SYM(event_reactor_filter)*
+CPARSE_SYM(message_subscribe_filter_get)(
+    const CPARSE_SYM(message_subscribe)* msg)
+{
+    return msg->filter;
+}
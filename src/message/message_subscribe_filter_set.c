@@ -0,0 +1,29 @@
+/**
+ * \file src/message/message_subscribe_filter_set.c
+ *
+ * \brief Set the \ref event_reactor_filter for a \ref message_subscribe
+ * instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/message/subscription.h>
+
+/**
+ * \brief Set the \ref event_reactor_filter associated with a
+ * \ref message_subscribe instance.
+ *
+ * The filter is not owned by this message, and must remain valid until this
+ * message has been sent. The receiving reactor makes its own copy.
+ *
+ * \param msg               The message to update.
+ * \param filter            The filter to use, or NULL if the subscriber should
+ *                          receive all events.
+ */
+void CPARSE_SYM(message_subscribe_filter_set)(
+    CPARSE_SYM(message_subscribe)* msg,
+    const CPARSE_SYM(event_reactor_filter)* filter)
+{
+    msg->filter = filter;
+}
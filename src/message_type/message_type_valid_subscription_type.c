@@ -28,6 +28,7 @@ bool CPARSE_SYM(message_type_valid_subscription_type)(int msg_type)
         case CPARSE_MESSAGE_TYPE_LINE_WRAP_FILTER_SUBSCRIBE:
         case CPARSE_MESSAGE_TYPE_NEWLINE_PRESERVING_WHITESPACE_FILTER_SUBSCRIBE:
         case CPARSE_MESSAGE_TYPE_PREPROCESSOR_SCANNER_SUBSCRIBE:
+        case CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE:
             return true;
 
         default:
@@ -0,0 +1,59 @@
+/**
+ * \file
+ * src/newline_preserving_whitespace_filter/newline_preserving_whitespace_filter_checkpoint_restore.c
+ *
+ * \brief Restore the state of a \ref newline_preserving_whitespace_filter
+ * from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/newline_preserving_whitespace_filter.h>
+#include <libcparse/status_codes.h>
+
+#include "newline_preserving_whitespace_filter_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_newline_preserving_whitespace_filter;
+
+/**
+ * \brief Restore the state of a newline preserving whitespace filter from a
+ * checkpoint.
+ *
+ * \param filter            The \ref newline_preserving_whitespace_filter
+ *                          instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint_restore)(
+    CPARSE_SYM(newline_preserving_whitespace_filter)* filter,
+    const CPARSE_SYM(newline_preserving_whitespace_filter_checkpoint)* ckpt)
+{
+    int retval;
+
+    /* verify that this is one of our states. */
+    if (
+        ckpt->state < 0
+     || ckpt->state > CPARSE_NL_WHITESPACE_FILTER_STATE_IN_WHITESPACE)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* restore the cached position. */
+    retval =
+        file_position_cache_checkpoint_restore(
+            filter->cache, filter->base, &ckpt->cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    filter->state = ckpt->state;
+
+    return STATUS_SUCCESS;
+}
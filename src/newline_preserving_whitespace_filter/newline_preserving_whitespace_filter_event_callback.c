@@ -12,22 +12,33 @@
 #include <libcparse/cursor.h>
 #include <libcparse/event.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/file_position_cache.h>
 #include <libcparse/newline_preserving_whitespace_filter.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/char_scan.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
 
 #include "newline_preserving_whitespace_filter_internal.h"
 
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
 CPARSE_IMPORT_newline_preserving_whitespace_filter;
+CPARSE_IMPORT_newline_preserving_whitespace_filter_internal;
+CPARSE_IMPORT_util_char_scan;
+CPARSE_IMPORT_util_cursor_advance;
+CPARSE_IMPORT_util_raw_span;
 
 static int process_char_event(
     newline_preserving_whitespace_filter* filter, const event* ev);
+static int process_span_event(
+    newline_preserving_whitespace_filter* filter, const event* ev);
 static int process_char_event_init_state(
     newline_preserving_whitespace_filter* filter, const event_raw_character* ev,
     int ch);
@@ -117,6 +128,9 @@ int CPARSE_SYM(newline_preserving_whitespace_filter_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return process_char_event(filter, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return process_span_event(filter, ev);
+
         default:
             return STATUS_SUCCESS;
     }
@@ -208,6 +222,129 @@ static int process_char_event(
     }
 }
 
+/**
+ * \brief Process a raw span event.
+ *
+ * Runs of characters that are forwarded unchanged, and runs of whitespace that
+ * are compressed, are found with vectorized scans. A forwarded run is passed
+ * on as a span. A compressed run is skipped, except for its last character,
+ * which extends the cached whitespace position. Each character that ends a run
+ * is processed as a character event. If any subscriber needs raw characters,
+ * then the whole span is processed one character at a time.
+ *
+ * \param filter            The filter for this operation.
+ * \param ev                The raw span event to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int process_span_event(
+    newline_preserving_whitespace_filter* filter, const event* ev)
+{
+    int retval;
+    event_raw_span* rsev;
+    cursor pos;
+    size_t run;
+
+    /* downcast the span event. */
+    retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    const char* span = event_raw_span_get(rsev);
+    size_t size = event_raw_span_size_get(rsev);
+
+    /* start at the first character of the span. */
+    raw_span_start_position(&pos, ev);
+
+    /* break up the span if a subscriber needs characters. */
+    if (!event_reactor_accepts_raw_spans(filter->reactor))
+    {
+        return
+            raw_span_send_characters(
+                &newline_preserving_whitespace_filter_event_callback, filter,
+                &pos, span, size);
+    }
+
+    while (size > 0)
+    {
+        switch (filter->state)
+        {
+            /* forward everything up to whitespace or a quote. */
+            case CPARSE_NL_WHITESPACE_FILTER_STATE_INIT:
+                run = char_scan_any(span, size, " \t\n\v\f\r\"'", 8);
+                retval = raw_span_broadcast(filter->reactor, &pos, span, run);
+                break;
+
+            /* forward string characters up to a quote or an escape. */
+            case CPARSE_NL_WHITESPACE_FILTER_STATE_IN_STRING:
+                run = char_scan_any(span, size, "\"\\", 2);
+                retval = raw_span_broadcast(filter->reactor, &pos, span, run);
+                break;
+
+            /* forward sequence characters up to a tick or an escape. */
+            case CPARSE_NL_WHITESPACE_FILTER_STATE_IN_CHARACTER_SEQUENCE:
+                run = char_scan_any(span, size, "'\\", 2);
+                retval = raw_span_broadcast(filter->reactor, &pos, span, run);
+                break;
+
+            /* skip all but the last of the horizontal whitespace. */
+            case CPARSE_NL_WHITESPACE_FILTER_STATE_IN_WHITESPACE:
+                run =
+                    char_scan_run(
+                        span, size, CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE);
+                run = (run > 1) ? run - 1 : 0;
+                cursor_advance(&pos, span, run);
+                retval = STATUS_SUCCESS;
+                break;
+
+            /* skip all but the last of the whitespace after a newline. */
+            case CPARSE_NL_WHITESPACE_FILTER_STATE_IN_NEWLINE:
+                run = char_scan_run(span, size, CPARSE_CHAR_SCAN_CLASS_SPACE);
+                run = (run > 1) ? run - 1 : 0;
+                cursor_advance(&pos, span, run);
+                retval = STATUS_SUCCESS;
+                break;
+
+            /* escapes are processed one character at a time. */
+            default:
+                run = 0;
+                retval = STATUS_SUCCESS;
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        span += run;
+        size -= run;
+        if (0 == size)
+        {
+            break;
+        }
+
+        /* process the next character on its own. */
+        retval =
+            raw_span_send_characters(
+                &newline_preserving_whitespace_filter_event_callback, filter,
+                &pos, span, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        span += 1;
+        size -= 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * \brief Process a raw character event in the init state.
  *
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
 #include <libcparse/comment_filter.h>
 #include <libcparse/event_reactor_fwd.h>
 #include <libcparse/file_position_cache.h>
@@ -31,6 +32,7 @@ struct CPARSE_SYM(newline_preserving_whitespace_filter)
     CPARSE_SYM(message_handler) parent_mh;
     CPARSE_SYM(file_position_cache)* cache;
     int state;
+    CPARSE_SYM(allocator) alloc;
 };
 
 enum CPARSE_SYM(newline_preserving_whitespace_filter_state)
@@ -8,17 +8,18 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/comment_filter.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/file_position_cache.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/newline_preserving_whitespace_filter.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "newline_preserving_whitespace_filter_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_comment_filter;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
@@ -42,6 +43,10 @@ int CPARSE_SYM(newline_preserving_whitespace_filter_release)(
     int reactor_release_retval = STATUS_SUCCESS;
     int cache_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &filter->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != filter->parent)
@@ -68,7 +73,7 @@ int CPARSE_SYM(newline_preserving_whitespace_filter_release)(
     memset(filter, 0, sizeof(*filter));
 
     /* free filter memory. */
-    free(filter);
+    allocator_free(&alloc, filter);
 
     /* decode return value. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -0,0 +1,116 @@
+/**
+ * \file src/parse_pool/parse_pool_create.c
+ *
+ * \brief Create a \ref parse_pool instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/intern_table.h>
+#include <libcparse/parse_pool.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "parse_pool_internal.h"
+
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_parse_pool;
+CPARSE_IMPORT_parse_pool_internal;
+
+/**
+ * \brief Create a parse pool.
+ *
+ * \param pool              Pointer to the \ref parse_pool pointer to be
+ *                          populated with the created pool on success.
+ * \param threads           The number of worker threads to use, or 0 to use
+ *                          one worker per online processor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(parse_pool_create)(
+    CPARSE_SYM(parse_pool)** pool, size_t threads)
+{
+    int retval, release_retval;
+    parse_pool* tmp;
+    long online;
+
+    /* default to one worker per online processor. */
+    if (0 == threads)
+    {
+        online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (size_t)online : 1;
+    }
+
+    /* allocate memory for this instance. */
+    tmp = (parse_pool*)malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* create the intern table shared by every file. */
+    retval = intern_table_create(&tmp->intern, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* allocate the workers. */
+    tmp->workers = (parse_pool_worker*)malloc(threads * sizeof(*tmp->workers));
+    if (NULL == tmp->workers)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_intern;
+    }
+
+    /* initialize the workers. */
+    memset(tmp->workers, 0, threads * sizeof(*tmp->workers));
+    while (tmp->thread_count < threads)
+    {
+        parse_pool_worker* worker = &tmp->workers[tmp->thread_count];
+
+        worker->pool = tmp;
+        worker->id = tmp->thread_count;
+        if (0 != pthread_mutex_init(&worker->lock, NULL))
+        {
+            retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+            goto cleanup_workers;
+        }
+
+        ++tmp->thread_count;
+    }
+
+    /* success. */
+    *pool = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_workers:
+    while (tmp->thread_count > 0)
+    {
+        --tmp->thread_count;
+        pthread_mutex_destroy(&tmp->workers[tmp->thread_count].lock);
+    }
+    memset(tmp->workers, 0, threads * sizeof(*tmp->workers));
+    free(tmp->workers);
+
+cleanup_intern:
+    release_retval = intern_table_release(tmp->intern);
+    (void)release_retval;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+done:
+    return retval;
+}
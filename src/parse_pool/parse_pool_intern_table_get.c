@@ -0,0 +1,26 @@
+/**
+ * \file src/parse_pool/parse_pool_intern_table_get.c
+ *
+ * \brief Get the intern table shared by a \ref parse_pool.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/parse_pool.h>
+
+#include "parse_pool_internal.h"
+
+/**
+ * \brief Get the thread safe \ref intern_table shared by every file parsed by
+ * this pool.
+ *
+ * \param pool              The \ref parse_pool instance to query.
+ *
+ * \returns the shared \ref intern_table for this pool.
+ */
+CPARSE_SYM(intern_table)* CPARSE_SYM(parse_pool_intern_table_get)(
+    CPARSE_SYM(parse_pool)* pool)
+{
+    return pool->intern;
+}
@@ -0,0 +1,149 @@
+/**
+ * \file parse_pool/parse_pool_internal.h
+ *
+ * \brief Internal declarations and definitions for the parse pool.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/intern_table.h>
+#include <libcparse/parse_pool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+typedef struct CPARSE_SYM(parse_pool_job) CPARSE_SYM(parse_pool_job);
+typedef struct CPARSE_SYM(parse_pool_worker) CPARSE_SYM(parse_pool_worker);
+
+/**
+ * \brief A single run of the pool over a list of paths.
+ */
+struct CPARSE_SYM(parse_pool_job)
+{
+    const char* const* paths;
+    size_t count;
+    CPARSE_SYM(parse_pool_setup_fn) setup;
+    void* context;
+    CPARSE_SYM(intern_table)* intern;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int* status;
+    bool* done;
+    size_t* completed;
+    size_t completed_count;
+    atomic_bool cancelled;
+};
+
+/**
+ * \brief A worker and its queue.
+ *
+ * Worker \p id of \p n owns the files at indices id, id + n, id + 2n, and so
+ * on. Its queue holds the range [head, tail) of multipliers for these indices.
+ * The worker takes from the head of its queue, and other workers steal from
+ * the tail.
+ */
+struct CPARSE_SYM(parse_pool_worker)
+{
+    CPARSE_SYM(parse_pool)* pool;
+    size_t id;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    size_t head;
+    size_t tail;
+};
+
+struct CPARSE_SYM(parse_pool)
+{
+    size_t thread_count;
+    CPARSE_SYM(parse_pool_worker)* workers;
+    CPARSE_SYM(parse_pool_job)* job;
+    CPARSE_SYM(intern_table)* intern;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Take the next file from the head of a worker's own queue.
+ *
+ * \param index             Pointer to receive the file index on success.
+ * \param worker            The worker whose queue is used.
+ *
+ * \returns true if a file was taken, or false if the queue is empty.
+ */
+bool CPARSE_SYM(parse_pool_worker_take)(
+    size_t* index, CPARSE_SYM(parse_pool_worker)* worker);
+
+/**
+ * \brief Steal a file from the tail of another worker's queue.
+ *
+ * \param index             Pointer to receive the file index on success.
+ * \param victim            The worker to steal from.
+ *
+ * \returns true if a file was stolen, or false if the queue is empty.
+ */
+bool CPARSE_SYM(parse_pool_worker_steal)(
+    size_t* index, CPARSE_SYM(parse_pool_worker)* victim);
+
+/**
+ * \brief The worker thread entry point.
+ *
+ * \param context           The \ref parse_pool_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* CPARSE_SYM(parse_pool_worker_thread)(void* context);
+
+/**
+ * \brief Set up and parse a single file.
+ *
+ * \param job               The job for this operation.
+ * \param index             The index of the file to parse.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(parse_pool_parse_file)(
+    CPARSE_SYM(parse_pool_job)* job, size_t index);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_parse_pool_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(parse_pool_job) sym ## parse_pool_job; \
+    typedef CPARSE_SYM(parse_pool_worker) sym ## parse_pool_worker; \
+    static inline bool sym ## parse_pool_worker_take( \
+        size_t* x, CPARSE_SYM(parse_pool_worker)* y) { \
+            return CPARSE_SYM(parse_pool_worker_take)(x,y); } \
+    static inline bool sym ## parse_pool_worker_steal( \
+        size_t* x, CPARSE_SYM(parse_pool_worker)* y) { \
+            return CPARSE_SYM(parse_pool_worker_steal)(x,y); } \
+    static inline void* sym ## parse_pool_worker_thread(void* x) { \
+            return CPARSE_SYM(parse_pool_worker_thread)(x); } \
+    static inline int sym ## parse_pool_parse_file( \
+        CPARSE_SYM(parse_pool_job)* x, size_t y) { \
+            return CPARSE_SYM(parse_pool_parse_file)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_parse_pool_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_parse_pool_internal_sym(sym ## _)
+#define CPARSE_IMPORT_parse_pool_internal \
+    __INTERNAL_CPARSE_IMPORT_parse_pool_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,96 @@
+/**
+ * \file src/parse_pool/parse_pool_parse_file.c
+ *
+ * \brief Parse a single file for a \ref parse_pool.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "parse_pool_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+
+/**
+ * \brief Set up and parse a single file.
+ *
+ * \param job               The job for this operation.
+ * \param index             The index of the file to parse.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(parse_pool_parse_file)(
+    CPARSE_SYM(parse_pool_job)* job, size_t index)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner;
+    abstract_parser* ap;
+    input_stream* stream;
+    const char* path = job->paths[index];
+
+    /* create a parser stack for this file. */
+    retval = preprocessor_scanner_create(&scanner);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* share the pool's symbols with this stack. */
+    retval = preprocessor_scanner_intern_table_set(scanner, job->intern);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    /* let the caller subscribe to this stack. */
+    ap = preprocessor_scanner_upcast(scanner);
+    retval = job->setup(job->context, ap, index, path);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    /* open the file. */
+    retval = input_stream_create_from_file(&stream, path);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    /* push the file onto the stack; the stack takes ownership of it. */
+    retval = abstract_parser_push_input_stream(ap, path, stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    /* parse the file. */
+    retval = abstract_parser_run(ap);
+    goto cleanup_scanner;
+
+cleanup_stream:
+    release_retval = input_stream_release(stream);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_scanner:
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file src/parse_pool/parse_pool_release.c
+ *
+ * \brief Release a \ref parse_pool instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/intern_table.h>
+#include <libcparse/parse_pool.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parse_pool_internal.h"
+
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_parse_pool;
+CPARSE_IMPORT_parse_pool_internal;
+
+/**
+ * \brief Release a parse pool.
+ *
+ * \param pool              The \ref parse_pool instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(parse_pool_release)(CPARSE_SYM(parse_pool)* pool)
+{
+    int retval;
+
+    /* destroy the worker locks. */
+    for (size_t i = 0; i < pool->thread_count; ++i)
+    {
+        pthread_mutex_destroy(&pool->workers[i].lock);
+    }
+
+    /* reclaim the workers. */
+    memset(pool->workers, 0, pool->thread_count * sizeof(*pool->workers));
+    free(pool->workers);
+
+    /* release the shared intern table. */
+    retval = intern_table_release(pool->intern);
+
+    /* clear instance memory. */
+    memset(pool, 0, sizeof(*pool));
+
+    /* reclaim instance memory. */
+    free(pool);
+
+    return retval;
+}
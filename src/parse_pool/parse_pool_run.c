@@ -0,0 +1,281 @@
+/**
+ * \file src/parse_pool/parse_pool_run.c
+ *
+ * \brief Parse a list of files with a \ref parse_pool.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/parse_pool.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parse_pool_internal.h"
+
+CPARSE_IMPORT_parse_pool;
+CPARSE_IMPORT_parse_pool_internal;
+
+static int job_init(
+    parse_pool_job* job, const char* const* paths, size_t count,
+    parse_pool_setup_fn setup, void* context);
+static void job_dispose(parse_pool_job* job);
+static void queues_init(parse_pool* pool, size_t count);
+static int deliver(
+    parse_pool_job* job, int order, parse_pool_result_fn result,
+    void* context);
+
+/**
+ * \brief Parse a list of files.
+ *
+ * \param pool              The \ref parse_pool instance for this operation.
+ * \param paths             The paths of the files to parse.
+ * \param count             The number of paths.
+ * \param order             The \ref parse_pool_order for results.
+ * \param setup             The setup callback.
+ * \param result            The result callback.
+ * \param context           The user context for both callbacks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success. Individual file failures are reported to
+ *        the result callback, and do not fail the run.
+ *      - ERROR_LIBCPARSE_PARSE_POOL_BAD_ORDER if the order is invalid.
+ *      - the first failure returned by the result callback.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(parse_pool_run)(
+    CPARSE_SYM(parse_pool)* pool, const char* const* paths, size_t count,
+    int order, CPARSE_SYM(parse_pool_setup_fn) setup,
+    CPARSE_SYM(parse_pool_result_fn) result, void* context)
+{
+    int retval;
+    parse_pool_job job;
+    size_t started;
+
+    /* verify the order. */
+    if (
+        CPARSE_PARSE_POOL_ORDER_INPUT != order
+     && CPARSE_PARSE_POOL_ORDER_COMPLETION != order)
+    {
+        retval = ERROR_LIBCPARSE_PARSE_POOL_BAD_ORDER;
+        goto done;
+    }
+
+    /* there is nothing to do for an empty list. */
+    if (0 == count)
+    {
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* set up the job. */
+    retval = job_init(&job, paths, count, setup, context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* every file shares the pool's intern table. */
+    job.intern = pool->intern;
+
+    /* deal the files out to the workers. */
+    pool->job = &job;
+    queues_init(pool, count);
+
+    /* start the workers. */
+    for (started = 0; started < pool->thread_count; ++started)
+    {
+        if (
+            0 != pthread_create(
+                    &pool->workers[started].thread, NULL,
+                    &parse_pool_worker_thread, &pool->workers[started]))
+        {
+            retval = ERROR_LIBCPARSE_THREAD_CREATE;
+            atomic_store(&job.cancelled, true);
+            goto join_workers;
+        }
+    }
+
+    /* deliver results on this thread. */
+    retval = deliver(&job, order, result, context);
+    goto join_workers;
+
+join_workers:
+    while (started > 0)
+    {
+        --started;
+        pthread_join(pool->workers[started].thread, NULL);
+    }
+
+    pool->job = NULL;
+    job_dispose(&job);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Initialize a job.
+ *
+ * \param job               The job to initialize.
+ * \param paths             The paths of the files to parse.
+ * \param count             The number of paths.
+ * \param setup             The setup callback.
+ * \param context           The user context for the setup callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int job_init(
+    parse_pool_job* job, const char* const* paths, size_t count,
+    parse_pool_setup_fn setup, void* context)
+{
+    memset(job, 0, sizeof(*job));
+    job->paths = paths;
+    job->count = count;
+    job->setup = setup;
+    job->context = context;
+    atomic_init(&job->cancelled, false);
+
+    /* allocate the per-file results. */
+    job->status = (int*)calloc(count, sizeof(*job->status));
+    job->done = (bool*)calloc(count, sizeof(*job->done));
+    job->completed = (size_t*)calloc(count, sizeof(*job->completed));
+    if (NULL == job->status || NULL == job->done || NULL == job->completed)
+    {
+        goto cleanup_results;
+    }
+
+    if (0 != pthread_mutex_init(&job->lock, NULL))
+    {
+        goto cleanup_results;
+    }
+
+    if (0 != pthread_cond_init(&job->cond, NULL))
+    {
+        goto cleanup_lock;
+    }
+
+    return STATUS_SUCCESS;
+
+cleanup_lock:
+    pthread_mutex_destroy(&job->lock);
+
+cleanup_results:
+    free(job->status);
+    free(job->done);
+    free(job->completed);
+    memset(job, 0, sizeof(*job));
+
+    return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+}
+
+/**
+ * \brief Dispose of a job.
+ *
+ * \param job               The job to dispose.
+ */
+static void job_dispose(parse_pool_job* job)
+{
+    pthread_cond_destroy(&job->cond);
+    pthread_mutex_destroy(&job->lock);
+
+    memset(job->status, 0, job->count * sizeof(*job->status));
+    free(job->status);
+    memset(job->done, 0, job->count * sizeof(*job->done));
+    free(job->done);
+    memset(job->completed, 0, job->count * sizeof(*job->completed));
+    free(job->completed);
+
+    memset(job, 0, sizeof(*job));
+}
+
+/**
+ * \brief Deal files out to the worker queues round-robin, so that every worker
+ * starts near the front of the list.
+ *
+ * \param pool              The pool for this operation.
+ * \param count             The number of files.
+ */
+static void queues_init(parse_pool* pool, size_t count)
+{
+    size_t n = pool->thread_count;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        parse_pool_worker* worker = &pool->workers[i];
+
+        worker->head = 0;
+        worker->tail = (i < count) ? (count - i + n - 1) / n : 0;
+    }
+}
+
+/**
+ * \brief Deliver results to the result callback until every file has been
+ * reported, or until the callback fails.
+ *
+ * \param job               The job for this operation.
+ * \param order             The \ref parse_pool_order for results.
+ * \param result            The result callback.
+ * \param context           The user context for the result callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int deliver(
+    parse_pool_job* job, int order, parse_pool_result_fn result,
+    void* context)
+{
+    int retval = STATUS_SUCCESS;
+    size_t delivered = 0;
+    size_t index;
+    int status;
+
+    pthread_mutex_lock(&job->lock);
+
+    while (delivered < job->count)
+    {
+        /* find the next result to deliver, if it is ready. */
+        if (CPARSE_PARSE_POOL_ORDER_INPUT == order)
+        {
+            index = delivered;
+            if (!job->done[index])
+            {
+                pthread_cond_wait(&job->cond, &job->lock);
+                continue;
+            }
+        }
+        else
+        {
+            if (delivered == job->completed_count)
+            {
+                pthread_cond_wait(&job->cond, &job->lock);
+                continue;
+            }
+
+            index = job->completed[delivered];
+        }
+
+        /* call the result callback without holding the lock. */
+        status = job->status[index];
+        pthread_mutex_unlock(&job->lock);
+        retval = result(context, index, job->paths[index], status);
+        pthread_mutex_lock(&job->lock);
+
+        /* on failure, stop the workers from taking any more files. */
+        if (STATUS_SUCCESS != retval)
+        {
+            atomic_store(&job->cancelled, true);
+            break;
+        }
+
+        ++delivered;
+    }
+
+    pthread_mutex_unlock(&job->lock);
+
+    return retval;
+}
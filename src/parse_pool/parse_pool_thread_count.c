@@ -0,0 +1,24 @@
+/**
+ * \file src/parse_pool/parse_pool_thread_count.c
+ *
+ * \brief Get the number of worker threads in a \ref parse_pool.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/parse_pool.h>
+
+#include "parse_pool_internal.h"
+
+/**
+ * \brief Get the number of worker threads used by this pool.
+ *
+ * \param pool              The \ref parse_pool instance to query.
+ *
+ * \returns the number of worker threads.
+ */
+size_t CPARSE_SYM(parse_pool_thread_count)(const CPARSE_SYM(parse_pool)* pool)
+{
+    return pool->thread_count;
+}
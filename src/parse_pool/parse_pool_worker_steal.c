@@ -0,0 +1,38 @@
+/**
+ * \file src/parse_pool/parse_pool_worker_steal.c
+ *
+ * \brief Steal a file from another worker's queue.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "parse_pool_internal.h"
+
+/**
+ * \brief Steal a file from the tail of another worker's queue.
+ *
+ * \param index             Pointer to receive the file index on success.
+ * \param victim            The worker to steal from.
+ *
+ * \returns true if a file was stolen, or false if the queue is empty.
+ */
+bool CPARSE_SYM(parse_pool_worker_steal)(
+    size_t* index, CPARSE_SYM(parse_pool_worker)* victim)
+{
+    bool retval = false;
+
+    pthread_mutex_lock(&victim->lock);
+
+    /* steal from the tail, away from the files the victim will parse next. */
+    if (victim->head < victim->tail)
+    {
+        --victim->tail;
+        *index = victim->id + victim->tail * victim->pool->thread_count;
+        retval = true;
+    }
+
+    pthread_mutex_unlock(&victim->lock);
+
+    return retval;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file src/parse_pool/parse_pool_worker_take.c
+ *
+ * \brief Take a file from a worker's own queue.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "parse_pool_internal.h"
+
+/**
+ * \brief Take the next file from the head of a worker's own queue.
+ *
+ * \param index             Pointer to receive the file index on success.
+ * \param worker            The worker whose queue is used.
+ *
+ * \returns true if a file was taken, or false if the queue is empty.
+ */
+bool CPARSE_SYM(parse_pool_worker_take)(
+    size_t* index, CPARSE_SYM(parse_pool_worker)* worker)
+{
+    bool retval = false;
+
+    pthread_mutex_lock(&worker->lock);
+
+    /* take from the head, so that this worker proceeds in input order. */
+    if (worker->head < worker->tail)
+    {
+        *index = worker->id + worker->head * worker->pool->thread_count;
+        ++worker->head;
+        retval = true;
+    }
+
+    pthread_mutex_unlock(&worker->lock);
+
+    return retval;
+}
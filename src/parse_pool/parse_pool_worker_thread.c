@@ -0,0 +1,83 @@
+/**
+ * \file src/parse_pool/parse_pool_worker_thread.c
+ *
+ * \brief The \ref parse_pool worker thread.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/parse_pool.h>
+
+#include "parse_pool_internal.h"
+
+CPARSE_IMPORT_parse_pool;
+CPARSE_IMPORT_parse_pool_internal;
+
+static bool next_file(size_t* index, parse_pool_worker* worker);
+
+/**
+ * \brief The worker thread entry point.
+ *
+ * \param context           The \ref parse_pool_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* CPARSE_SYM(parse_pool_worker_thread)(void* context)
+{
+    parse_pool_worker* worker = (parse_pool_worker*)context;
+    parse_pool_job* job = worker->pool->job;
+    size_t index;
+    int status;
+
+    while (
+        !atomic_load_explicit(&job->cancelled, memory_order_relaxed)
+     && next_file(&index, worker))
+    {
+        /* parse this file. */
+        status = parse_pool_parse_file(job, index);
+
+        /* report the result to the delivering thread. */
+        pthread_mutex_lock(&job->lock);
+        job->status[index] = status;
+        job->done[index] = true;
+        job->completed[job->completed_count++] = index;
+        pthread_cond_signal(&job->cond);
+        pthread_mutex_unlock(&job->lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Get the next file for this worker, stealing if its queue is empty.
+ *
+ * \param index             Pointer to receive the file index on success.
+ * \param worker            The worker for this operation.
+ *
+ * \returns true if a file was found, or false if every queue is empty.
+ */
+static bool next_file(size_t* index, parse_pool_worker* worker)
+{
+    parse_pool* pool = worker->pool;
+
+    /* prefer our own queue. */
+    if (parse_pool_worker_take(index, worker))
+    {
+        return true;
+    }
+
+    /* otherwise, steal from the other workers in turn. */
+    for (size_t i = 1; i < pool->thread_count; ++i)
+    {
+        size_t victim = (worker->id + i) % pool->thread_count;
+
+        if (parse_pool_worker_steal(index, &pool->workers[victim]))
+        {
+            return true;
+        }
+    }
+
+    /* queues only shrink, so there is no more work. */
+    return false;
+}
@@ -0,0 +1,91 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_checkpoint_restore.c
+ *
+ * \brief Restore the state of a \ref preprocessor_scanner from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_string_builder;
+
+/**
+ * \brief Restore the state of a preprocessor scanner from a checkpoint.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if this checkpoint has a bad state.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_checkpoint_restore)(
+    CPARSE_SYM(preprocessor_scanner)* scanner,
+    const CPARSE_SYM(preprocessor_scanner_checkpoint)* ckpt)
+{
+    int retval;
+
+    /* verify that these are our states, and that the token fits. */
+    if (
+        ckpt->state < 0
+     || ckpt->state >= CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT
+     || ckpt->preprocessor_state < 0
+     || ckpt->preprocessor_state > CPARSE_PREPROCESSOR_DIRECTIVE_STATE_DISABLED
+     || ckpt->token_size > CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* restore the cached positions. */
+    retval =
+        file_position_cache_checkpoint_restore(
+            scanner->cache, scanner->base, &ckpt->cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        file_position_cache_checkpoint_restore(
+            scanner->newline_cache, scanner->base, &ckpt->newline_cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        file_position_cache_checkpoint_restore(
+            scanner->hash_cache, scanner->base, &ckpt->hash_cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* restore the partial token. */
+    string_builder_clear(scanner->builder);
+    if (ckpt->token_size > 0)
+    {
+        retval =
+            string_builder_add_span(
+                scanner->builder, ckpt->token, ckpt->token_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    scanner->state = ckpt->state;
+    scanner->preprocessor_state = ckpt->preprocessor_state;
+    scanner->state_reset = ckpt->state_reset;
+    scanner->has_hex_digit = ckpt->has_hex_digit;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_checkpoint_save.c
+ *
+ * \brief Save the state of a \ref preprocessor_scanner to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_string_builder;
+
+/**
+ * \brief Save the state of a preprocessor scanner to a checkpoint.
+ *
+ * This includes the characters of any partial token.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref preprocessor_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG if the partial token is
+ *        longer than \ref CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does
+ *        not fit in the checkpoint.
+ */
+int CPARSE_SYM(preprocessor_scanner_checkpoint_save)(
+    CPARSE_SYM(preprocessor_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(preprocessor_scanner)* scanner)
+{
+    int retval;
+    size_t token_size = string_builder_size(scanner->builder);
+
+    /* the partial token must fit in the checkpoint. */
+    if (token_size > CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG;
+    }
+
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    ckpt->state = scanner->state;
+    ckpt->preprocessor_state = scanner->preprocessor_state;
+    ckpt->state_reset = scanner->state_reset;
+    ckpt->has_hex_digit = scanner->has_hex_digit;
+    ckpt->token_size = token_size;
+    memcpy(ckpt->token, string_builder_view(scanner->builder), token_size);
+
+    retval =
+        file_position_cache_checkpoint_save(&ckpt->cache, scanner->cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        file_position_cache_checkpoint_save(
+            &ckpt->newline_cache, scanner->newline_cache);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        file_position_cache_checkpoint_save(
+            &ckpt->hash_cache, scanner->hash_cache);
+}
@@ -0,0 +1,66 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_in_arena.c
+ *
+ * \brief Create method for a \ref preprocessor_scanner in a caller's arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/arena.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+/**
+ * \brief Create a preprocessor scanner that allocates itself and every stage
+ * under it from the given arena, which remains owned by the caller.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param a                 The \ref arena to allocate from.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_in_arena)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, CPARSE_SYM(arena)* a)
+{
+    int retval;
+    allocator alloc;
+    preprocessor_scanner* tmp;
+
+    /* allocate from this arena. */
+    retval = arena_allocator_init(&alloc, a);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the scanner stack in this arena. */
+    retval = preprocessor_scanner_create_internal(&tmp, 0, &alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* releasing the scanner skips everything in this arena. */
+    tmp->arena = a;
+
+    /* success. */
+    *scanner = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,238 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_internal.c
+ *
+ * \brief Shared create method for serial and pipelined
+ * \ref preprocessor_scanner instances.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_newline_preserving_whitespace_filter;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+CPARSE_IMPORT_string_builder;
+CPARSE_IMPORT_util_event_ring;
+
+/**
+ * \brief Create a preprocessor scanner, optionally in pipelined mode.
+ *
+ * This scanner automatically creates a newline preserving whitespace filter and
+ * injects itself into the message chain for the parser stack.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param pipeline_capacity The capacity of the pipeline ring, or 0 if this
+ *                          scanner should run serially.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_internal)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t pipeline_capacity,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    preprocessor_scanner* tmp;
+    message_handler mh;
+    event_handler eh;
+    event_reactor_filter filter_types;
+    event_callback_fn event_callback = &preprocessor_scanner_event_callback;
+
+    /* allocate memory for this instance. */
+    tmp = (preprocessor_scanner*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(*tmp));
+        allocator_free(alloc, tmp);
+        goto done;
+    }
+
+    /* create parent instance. */
+    retval =
+        newline_preserving_whitespace_filter_create_with_allocator(
+            &tmp->parent, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create event reactor. */
+    retval = event_reactor_create_with_allocator(&tmp->reactor, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the cache. */
+    retval = file_position_cache_create_with_allocator(&tmp->cache, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the newline cache. */
+    retval =
+        file_position_cache_create_with_allocator(&tmp->newline_cache, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the hash cache. */
+    retval =
+        file_position_cache_create_with_allocator(&tmp->hash_cache, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the string builder. */
+    retval = string_builder_create_with_allocator(&tmp->builder, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the intern table for identifiers. */
+    retval = intern_table_create_with_allocator(&tmp->intern, false, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    tmp->owns_intern = true;
+
+    /* in pipelined mode, the parent's events are copied onto a ring. */
+    if (pipeline_capacity > 0)
+    {
+        retval =
+            event_ring_create_with_allocator(
+                &tmp->ring, pipeline_capacity, alloc);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tmp;
+        }
+
+        event_callback = &preprocessor_scanner_pipeline_event_callback;
+    }
+
+    /* get the abstract parser instance for the parent. */
+    tmp->base = newline_preserving_whitespace_filter_upcast(tmp->parent);
+
+    /* initialize our message handler. */
+    retval =
+        message_handler_init(
+            &mh, &preprocessor_scanner_message_callback, tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* initialize our event handler. */
+    retval = event_handler_init(&eh, event_callback, tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mh;
+    }
+
+    /* override the newline preserving whitespace filter message handler with
+     * ours. */
+    retval =
+        abstract_parser_message_handler_override(
+            &tmp->parent_mh, tmp->base, &mh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* we handle EOF, raw character, raw span, and whitespace events. */
+    event_reactor_filter_clear(&filter_types);
+    event_reactor_filter_add_type(&filter_types, CPARSE_EVENT_TYPE_EOF);
+    event_reactor_filter_add_type(
+        &filter_types, CPARSE_EVENT_TYPE_RAW_CHARACTER);
+    event_reactor_filter_add_type(&filter_types, CPARSE_EVENT_TYPE_RAW_SPAN);
+    event_reactor_filter_add_type(
+        &filter_types, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE);
+    event_reactor_filter_add_type(
+        &filter_types, CPARSE_EVENT_TYPE_TOKEN_NEWLINE);
+
+    /* subscribe to the newline preserving whitespace filter. The pipeline
+     * copies each event onto its ring, so it only takes raw characters. */
+    retval =
+        abstract_parser_newline_preserving_whitespace_filter_subscribe_filtered(
+            tmp->base, &eh, (pipeline_capacity > 0) ? NULL : &filter_types);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* we start in the initial state. */
+    tmp->state = CPARSE_PREPROCESSOR_SCANNER_STATE_INIT;
+    /* we set the state_reset flag to true, forcing us into the begin line state
+     * after the first event. */
+    tmp->state_reset = true;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *scanner = tmp;
+    tmp = NULL;
+    goto cleanup_eh;
+
+cleanup_eh:
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_mh:
+    release_retval = message_handler_dispose(&mh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_tmp:
+    if (NULL != tmp)
+    {
+        release_retval = preprocessor_scanner_release(tmp);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_pipelined.c
+ *
+ * \brief Create method for a pipelined \ref preprocessor_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_preprocessor_scanner;
+
+/**
+ * \brief Create a pipelined preprocessor scanner.
+ *
+ * A pipelined scanner runs the character-level stages of the parser stack on a
+ * producer thread, and hands their events to this scanner on the thread that
+ * runs the parser through a lock-free single-producer / single-consumer ring.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param capacity          The number of events that can be in flight between
+ *                          the two threads, or 0 to use
+ *                          CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_pipelined)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t capacity)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        preprocessor_scanner_create_pipelined_with_allocator(
+            scanner, capacity, &alloc);
+}
@@ -0,0 +1,46 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_pipelined_with_allocator.c
+ *
+ * \brief Create method for a pipelined \ref preprocessor_scanner with an
+ * allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/preprocessor_scanner.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+/**
+ * \brief Create a pipelined preprocessor scanner that uses the given allocator
+ * for its memory.
+ *
+ * Event copies are allocated on the producer thread and released on the thread
+ * that sent the run message, so this allocator must be safe to call from both.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param capacity          The number of events that can be in flight between
+ *                          the two threads, or 0 to use
+ *                          CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_pipelined_with_allocator)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t capacity,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    if (0 == capacity)
+    {
+        capacity = CPARSE_PREPROCESSOR_SCANNER_PIPELINE_CAPACITY;
+    }
+
+    return preprocessor_scanner_create_internal(scanner, capacity, alloc);
+}
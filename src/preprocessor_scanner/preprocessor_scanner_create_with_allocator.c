@@ -0,0 +1,35 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_with_allocator.c
+ *
+ * \brief Create method for the \ref preprocessor_scanner type with an
+ * allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/preprocessor_scanner.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+/**
+ * \brief Create a preprocessor scanner that uses the given allocator for its
+ * memory.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_with_allocator)(
+    CPARSE_SYM(preprocessor_scanner)** scanner,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    return preprocessor_scanner_create_internal(scanner, 0, alloc);
+}
@@ -0,0 +1,72 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_create_with_arena.c
+ *
+ * \brief Create method for a \ref preprocessor_scanner that owns an arena.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/arena.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+/**
+ * \brief Create a preprocessor scanner that allocates itself and every stage
+ * under it from an arena owned by this scanner.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param block_size        The size of each arena block, or 0 to use
+ *                          CPARSE_ARENA_DEFAULT_BLOCK_SIZE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_with_arena)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t block_size)
+{
+    int retval, release_retval;
+    arena* a;
+    preprocessor_scanner* tmp;
+
+    /* a serial scanner only allocates from one thread. */
+    retval = arena_create(&a, block_size, false);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the scanner stack in this arena. */
+    retval = preprocessor_scanner_create_in_arena(&tmp, a);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_arena;
+    }
+
+    /* the scanner releases the arena when it is released. */
+    tmp->owns_arena = true;
+
+    /* success. */
+    *scanner = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_arena:
+    release_retval = arena_release(a);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
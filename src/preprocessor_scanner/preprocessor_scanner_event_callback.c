@@ -7,7 +7,6 @@
  * distribution for the license terms under which this software is distributed.
  */
 
-#include <ctype.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event.h>
 #include <libcparse/event/identifier.h>
@@ -15,13 +14,17 @@
 #include <libcparse/event/raw_character_literal.h>
 #include <libcparse/event/raw_float.h>
 #include <libcparse/event/raw_integer.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event/raw_string.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/file_position_cache.h>
+#include <libcparse/intern_table.h>
 #include <libcparse/preprocessor_scanner.h>
 #include <libcparse/status_codes.h>
 #include <libcparse/string_builder.h>
-#include <libcparse/string_utils.h>
+#include <libcparse/util/char_scan.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -34,24 +37,20 @@ CPARSE_IMPORT_event_raw_character;
 CPARSE_IMPORT_event_raw_character_literal;
 CPARSE_IMPORT_event_raw_float;
 CPARSE_IMPORT_event_raw_integer;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_raw_string;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_intern_table;
 CPARSE_IMPORT_preprocessor_scanner;
 CPARSE_IMPORT_preprocessor_scanner_internal;
 CPARSE_IMPORT_string_builder;
-CPARSE_IMPORT_string_utils;
+CPARSE_IMPORT_util_char_scan;
+CPARSE_IMPORT_util_cursor_advance;
+CPARSE_IMPORT_util_raw_span;
 
 typedef int (*simple_event_ctor)(event*, const cursor*);
 typedef int (*scanner_variable_updater)(preprocessor_scanner*);
-typedef int (*bsearch_compare_func)(const void*, const void*);
-typedef struct keyword_ctor keyword_ctor;
-struct keyword_ctor
-{
-    const char* keyword;
-    simple_event_ctor ctor;
-    scanner_variable_updater var_update;
-};
 
 static int process_eof_event(
     preprocessor_scanner* scanner, const event* ev);
@@ -61,43 +60,24 @@ static int process_newline_event(
     preprocessor_scanner* scanner, const event* ev);
 static int process_raw_character(
     preprocessor_scanner* scanner, const event* ev);
-static bool char_is_alpha_underscore(const int ch);
-static bool char_is_identifier(const int ch);
-static bool char_is_decimal_digit(const int ch);
-static bool char_is_octal_digit(const int ch);
-static bool char_is_non_zero_digit(const int ch);
-static bool char_is_unsigned_specifier(const int ch);
-static bool char_is_long_specifier(const int ch);
-static bool char_is_float_suffix(const int ch);
+static int process_raw_span(
+    preprocessor_scanner* scanner, const event* ev);
+static size_t scan_run(int run, const char* span, size_t size);
 static bool is_hex_state(const preprocessor_scanner* scanner);
 static int start_hash(
     preprocessor_scanner* scanner, const event* ev);
 static int end_hash(
     preprocessor_scanner* scanner, const event* ev, bool process_event);
-static int start_identifier(
-    preprocessor_scanner* scanner, const event* ev, int ch);
-static int continue_identifier(
+static int start_token(
+    preprocessor_scanner* scanner, const event* ev, int ch, int state);
+static int continue_token(
     preprocessor_scanner* scanner, const event* ev, int ch);
 static int end_identifier(preprocessor_scanner* scanner, const event* ev);
-static int start_string(
-    preprocessor_scanner* scanner, const event* ev, int ch);
-static int continue_string(
-    preprocessor_scanner* scanner, const event* ev, int ch);
 static int end_string(preprocessor_scanner* scanner, const event* ev, int ch);
-static int start_char(
-    preprocessor_scanner* scanner, const event* ev, int ch);
-static int continue_char(
-    preprocessor_scanner* scanner, const event* ev, int ch);
 static int end_char(preprocessor_scanner* scanner, const event* ev, int ch);
-static int start_decimal_integer(
-    preprocessor_scanner* scanner, const event* ev, int ch);
 static int start_zero_integer(
     preprocessor_scanner* scanner, const event* ev, int ch);
-static int continue_integer(
-    preprocessor_scanner* scanner, const event* ev, int ch);
 static int end_integer(preprocessor_scanner* scanner, const event* ev);
-static int continue_float(
-    preprocessor_scanner* scanner, const event* ev, int ch);
 static int end_float(preprocessor_scanner* scanner, const event* ev);
 static int start_state(
     preprocessor_scanner* scanner, const event* ev, int state);
@@ -110,19 +90,17 @@ static int broadcast_compound_token(
 static int broadcast_cached_token_and_continue(
     preprocessor_scanner* scanner, const event* ev, simple_event_ctor ctor);
 static int broadcast_pp_end(preprocessor_scanner* scanner);
-static int keyword_compare(const char* key, const keyword_ctor* entry);
-static int keyword_search(const keyword_ctor** keyword_entry, const char* str);
 static int keyword_event_broadcast(
-    preprocessor_scanner* scanner, const keyword_ctor* keyword_entry,
-    const cursor* pos);
-static int preprocessor_keyword_search(
-    const keyword_ctor** keyword_entry, const char* str);
+    preprocessor_scanner* scanner, simple_event_ctor ctor,
+    scanner_variable_updater var_update, const cursor* pos);
 static int preprocessor_include_update_state(
     preprocessor_scanner* scanner);
 static int broadcast_double_hash_token(
     preprocessor_scanner* scanner, const event* ev);
-static bool is_string(const char* str, const event* ev, int* ch);
-static bool is_char(const char* str, const event* ev, int* ch);
+static bool is_string(
+    const preprocessor_scanner_keyword* keyword, const event* ev, int* ch);
+static bool is_char(
+    const preprocessor_scanner_keyword* keyword, const event* ev, int* ch);
 static int upgrade_dot_state_to_float(
     preprocessor_scanner* scanner, const event* ev, int ch);
 
@@ -180,6 +158,9 @@ int CPARSE_SYM(preprocessor_scanner_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return process_raw_character(scanner, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return process_raw_span(scanner, ev);
+
         default:
             return STATUS_SUCCESS;
     }
@@ -757,6 +738,10 @@ static int process_newline_event(
 /**
  * \brief Process a raw character event.
  *
+ * The character is classified with a single table lookup, and the transition
+ * for the current state and this class selects the action to perform. Both
+ * tables are generated by tools/lexer_table_gen.
+ *
  * \param scanner           The scanner for this operation.
  * \param ev                The raw character event to process.
  *
@@ -769,6 +754,7 @@ static int process_raw_character(
 {
     int retval;
     event_raw_character* rev;
+    const preprocessor_scanner_transition* t;
 
     /* get the raw character event. */
     retval = event_downcast_to_event_raw_character(&rev, (event*)ev);
@@ -780,1968 +766,356 @@ static int process_raw_character(
     /* get the raw character value. */
     int ch = event_raw_character_get(rev);
 
-    /* decode the state. */
-    switch (scanner->state)
-    {
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_BEGIN_LINE:
-            if ('#' == ch)
-            {
-                return start_hash(scanner, ev);
-            }
-            else
-            {
-                /* for any other character, break out of begin line and process
-                 * as normal. */
-                scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_INIT;
-                return process_raw_character(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_INIT:
-            if (char_is_alpha_underscore(ch))
-            {
-                return start_identifier(scanner, ev, ch);
-            }
-            else if (char_is_non_zero_digit(ch))
-            {
-                return start_decimal_integer(scanner, ev, ch);
-            }
-            else
-            {
-                switch (ch)
-                {
-                    case '0':
-                        return
-                            start_zero_integer(scanner, ev, ch);
-
-                    case '(':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_left_paren);
-
-                    case ')':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_right_paren);
-
-                    case '{':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_left_brace);
-
-                    case '}':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_right_brace);
-
-                    case '[':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev,
-                                &event_init_for_token_left_bracket);
-
-                    case ']':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev,
-                                &event_init_for_token_right_bracket);
-
-                    case ',':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_comma);
-
-                    case ':':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_COLON);
-
-                    case ';':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_semicolon);
-
-                    case '.':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT);
-
-                    case '-':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DASH);
-
-                    case '+':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PLUS);
-
-                    case '*':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STAR);
-
-                    case '/':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_SLASH);
-
-                    case '%':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT);
-
-                    case '&':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_AMPERSAND);
-
-                    case '|':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PIPE);
-
-                    case '^':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CARET);
-
-                    case '~':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_TILDE);
-
-                    case '?':
-                        return
-                            broadcast_simple_token(
-                                scanner, ev, &event_init_for_token_question);
-
-                    case '=':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_EQUAL);
-
-                    case '!':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_NOT);
-
-                    case '<':
-                        if (
-                            CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE
-                                == scanner->preprocessor_state)
-                        {
-                            scanner->preprocessor_state =
-                                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING;
-                            return start_string(scanner, ev, ch);
-                        }
-                        else
-                        {
-                            return
-                                start_state(
-                                    scanner, ev,
-                                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT);
-                        }
-
-                    case '>':
-                        return
-                            start_state(
-                                scanner, ev,
-                                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT);
-
-                    case '"':
-                        return start_string(scanner, ev, ch);
-
-                    case '\'':
-                        return start_char(scanner, ev, ch);
-
-                    case '#':
-                        retval = start_hash(scanner, ev);
-                        if (STATUS_SUCCESS != retval)
-                        {
-                            return retval;
-                        }
-
-                        /* If we aren't yet in a preprocessor directive... */
-                        if (
-                            CPARSE_PREPROCESSOR_DIRECTIVE_STATE_INIT
-                                == scanner->preprocessor_state)
-                        {
-                            /* Then we can't be. */
-                            scanner->preprocessor_state =
-                                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_DISABLED;
-                        }
-
-                        return STATUS_SUCCESS;
-
-                    default:
-                        return
-                            ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-                }
-            }
-            break;
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HASH:
-            if (char_is_alpha_underscore(ch))
-            {
-                if (
-                    CPARSE_PREPROCESSOR_DIRECTIVE_STATE_INIT
-                        == scanner->preprocessor_state)
-                {
-                    /* we might be in a preprocessor directive. */
-                    scanner->preprocessor_state =
-                        CPARSE_PREPROCESSOR_DIRECTIVE_STATE_MAYBE;
-                }
-
-                return start_identifier(scanner, ev, ch);
-            }
-            else if ('#' == ch)
-            {
-                return broadcast_double_hash_token(scanner, ev);
-            }
-            else
-            {
-                return end_hash(scanner, ev, true);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT:
-            if (char_is_decimal_digit(ch))
-            {
-                return upgrade_dot_state_to_float(scanner, ev, ch);
-            }
-            switch (ch)
-            {
-                case '.':
-                    return
-                        transition_state(
-                            scanner, ev,
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT_DOT);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_dot);
-            }
-            break;
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT_DOT:
-            switch (ch)
-            {
-                case '.':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_ellipsis);
-
-                default:
-                    return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DASH:
-            switch (ch)
-            {
-                case '>':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_arrow);
-
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_minus_equal);
-
-                case '-':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_decrement);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_minus);
-            }
-            break;
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_COLON:
-            switch (ch)
-            {
-                case '>':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_right_bracket);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_colon);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PLUS:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_plus_equal);
-
-                case '+':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_increment);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_plus);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STAR:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_times_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_star);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_SLASH:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_div_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_forward_slash);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_mod_equal);
-
-                case '>':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_right_brace);
-
-                case ':':
-                    return
-                        transition_state(
-                            scanner, ev,
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_percent);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON:
-            switch (ch)
-            {
-                case '%':
-                    return
-                        transition_state(
-                            scanner, ev,
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON_PERCENT);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev,
-                            &event_init_for_token_preprocessor_hash);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON_PERCENT:
-            switch (ch)
-            {
-                case ':':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev,
-                            &event_init_for_token_preprocessor_string_concat);
-
-                default:
-                    return
-                        ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_AMPERSAND:
-            switch (ch)
-            {
-                case '&':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_logical_and);
-
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_and_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_ampersand);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PIPE:
-            switch (ch)
-            {
-                case '|':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_logical_or);
-
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_or_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_pipe);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CARET:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_xor_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_caret);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_TILDE:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_compl_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_tilde);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_EQUAL:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_equal_compare);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_equal_assign);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_NOT:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev,
-                            &event_init_for_token_not_equal_compare);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_not);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT:
-            switch (ch)
-            {
-                case '<':
-                    return
-                        transition_state(
-                            scanner, ev,
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT_LT);
-
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_less_than_equal);
-
-                case ':':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_left_bracket);
-
-                case '%':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev, &event_init_for_token_left_brace);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_less_than);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT_LT:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev,
-                            &event_init_for_token_left_shift_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_bitshift_left);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT:
-            switch (ch)
-            {
-                case '>':
-                    return
-                        transition_state(
-                            scanner, ev,
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT_GT);
-
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev,
-                            &event_init_for_token_greater_than_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_greater_than);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT_GT:
-            switch (ch)
-            {
-                case '=':
-                    return
-                        broadcast_compound_token(
-                            scanner, ev,
-                            &event_init_for_token_right_shift_equal);
-
-                default:
-                    return
-                        broadcast_cached_token_and_continue(
-                            scanner, ev, &event_init_for_token_bitshift_right);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER:
-            if (char_is_identifier(ch))
-            {
-                return continue_identifier(scanner, ev, ch);
-            }
-            else
-            {
-                return end_identifier(scanner, ev);
-            }
-            break;
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING:
-            switch (ch)
-            {
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH;
-                    return continue_string(scanner, ev, ch);
-
-                case '"':
-                    if (
-                        CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING
-                            == scanner->preprocessor_state)
-                    {
-                        return continue_string(scanner, ev, ch);
-                    }
-                    else
-                    {
-                      return end_string(scanner, ev, ch);
-                    }
-
-                case '>':
-                    if (
-                        CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING
-                            == scanner->preprocessor_state)
-                    {
-                        return end_string(scanner, ev, ch);
-                    }
-                    else
-                    {
-                        return continue_string(scanner, ev, ch);
-                    }
-
-                default:
-                    return continue_string(scanner, ev, ch);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR:
-            switch (ch)
-            {
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH;
-                    return continue_char(scanner, ev, ch);
+    /* look up the transition for this state and character class. */
+    t =
+        &CPARSE_SYM(preprocessor_scanner_transitions)
+            [scanner->state]
+            [CPARSE_SYM(preprocessor_scanner_char_class)[(uint8_t)ch]];
 
-                case '\'':
-                    return end_char(scanner, ev, ch);
+    /* perform the action for this transition. */
+    switch (t->action)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN:
+            return start_token(scanner, ev, ch, t->state);
 
-                default:
-                    return continue_char(scanner, ev, ch);
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN:
+            scanner->state = t->state;
+            return continue_token(scanner, ev, ch);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH:
-            switch (ch)
-            {
-                case '\'':
-                case '"':
-                case '?':
-                case '\\':
-                case 'a':
-                case 'b':
-                case 'f':
-                case 'n':
-                case 'r':
-                case 't':
-                case 'v':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                    return continue_string(scanner, ev, ch);
-
-                case 'x':
-                case 'X':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX;
-                    return continue_string(scanner, ev, ch);
-
-                case 'u':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U;
-                    return continue_string(scanner, ev, ch);
-
-                case 'U':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U;
-                    return continue_string(scanner, ev, ch);
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_1;
-                    return continue_string(scanner, ev, ch);
-
-                default:
-                    return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_IDENTIFIER:
+            return end_identifier(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH:
-            switch (ch)
-            {
-                case '\'':
-                case '"':
-                case '?':
-                case '\\':
-                case 'a':
-                case 'b':
-                case 'f':
-                case 'n':
-                case 'r':
-                case 't':
-                case 'v':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                    return continue_char(scanner, ev, ch);
-
-                case 'x':
-                case 'X':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX;
-                    return continue_char(scanner, ev, ch);
-
-                case 'u':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U;
-                    return continue_char(scanner, ev, ch);
-
-                case 'U':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U;
-                    return continue_char(scanner, ev, ch);
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_1;
-                    return continue_char(scanner, ev, ch);
-
-                default:
-                    return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_STRING:
+            return end_string(scanner, ev, ch);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U1;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_CHAR:
+            return end_char(scanner, ev, ch);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U1:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U2;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_INTEGER:
+            return end_integer(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U2:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U3;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_FLOAT:
+            return end_float(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U3:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U4;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_SIMPLE_TOKEN:
+            return
+                broadcast_simple_token(
+                    scanner, ev,
+                    CPARSE_SYM(preprocessor_scanner_token_ctors)[t->token]);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U4:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U5;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_COMPOUND_TOKEN:
+            return
+                broadcast_compound_token(
+                    scanner, ev,
+                    CPARSE_SYM(preprocessor_scanner_token_ctors)[t->token]);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U5:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U6;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_CACHED_TOKEN:
+            return
+                broadcast_cached_token_and_continue(
+                    scanner, ev,
+                    CPARSE_SYM(preprocessor_scanner_token_ctors)[t->token]);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U6:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U7;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_STATE:
+            return start_state(scanner, ev, t->state);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U7:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_TRANSITION_STATE:
+            return transition_state(scanner, ev, t->state);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U1;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_BEGIN_LINE:
+            /* for any character other than a hash, break out of begin line and
+             * process as normal. */
+            scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_INIT;
+            return process_raw_character(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U1:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U2;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_HASH:
+            return start_hash(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U2:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U3;
-                return continue_string(scanner, ev, ch);
-            }
-            else
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_INLINE_HASH:
+            retval = start_hash(scanner, ev);
+            if (STATUS_SUCCESS != retval)
             {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
+                return retval;
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U3:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                return continue_string(scanner, ev, ch);
-            }
-            else
+            /* If we aren't yet in a preprocessor directive... */
+            if (
+                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_INIT
+                    == scanner->preprocessor_state)
             {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
+                /* Then we can't be. */
+                scanner->preprocessor_state =
+                    CPARSE_PREPROCESSOR_DIRECTIVE_STATE_DISABLED;
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_1:
-            switch (ch)
-            {
-                case '"':
-                    return end_string(scanner, ev, ch);
-
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH;
-                    return continue_string(scanner, ev, ch);
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_2;
-                    return continue_string(scanner, ev, ch);
-
-                default:
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                    return continue_string(scanner, ev, ch);
-            }
+            return STATUS_SUCCESS;
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_2:
-            switch (ch)
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_HASH_IDENTIFIER:
+            if (
+                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_INIT
+                    == scanner->preprocessor_state)
             {
-                case '"':
-                    return end_string(scanner, ev, ch);
-
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH;
-                    return continue_string(scanner, ev, ch);
-
-                default:
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                    return continue_string(scanner, ev, ch);
+                /* we might be in a preprocessor directive. */
+                scanner->preprocessor_state =
+                    CPARSE_PREPROCESSOR_DIRECTIVE_STATE_MAYBE;
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX_OPT;
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
+            return
+                start_token(
+                    scanner, ev, ch,
+                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX_OPT:
-            if (isxdigit(ch))
-            {
-                return continue_string(scanner, ev, ch);
-            }
-            else
-            {
-                switch (ch)
-                {
-                    case '"':
-                        return end_string(scanner, ev, ch);
-
-                    case '\\':
-                        scanner->state =
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH;
-                        return continue_string(scanner, ev, ch);
-
-                    default:
-                        scanner->state =
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-                        return continue_string(scanner, ev, ch);
-                }
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_DOUBLE_HASH:
+            return broadcast_double_hash_token(scanner, ev);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_1:
-            switch (ch)
-            {
-                case '\'':
-                    return end_char(scanner, ev, ch);
-
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH;
-                    return continue_char(scanner, ev, ch);
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_2;
-                    return continue_char(scanner, ev, ch);
-
-                default:
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                    return continue_char(scanner, ev, ch);
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_END_HASH:
+            return end_hash(scanner, ev, true);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_2:
-            switch (ch)
-            {
-                case '\'':
-                    return end_char(scanner, ev, ch);
-
-                case '\\':
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH;
-                    return continue_char(scanner, ev, ch);
-
-                default:
-                    scanner->state =
-                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                    return continue_char(scanner, ev, ch);
-            }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_ZERO_INTEGER:
+            return start_zero_integer(scanner, ev, ch);
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX:
-            if (isxdigit(ch))
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_START_LT:
+            if (
+                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE
+                    == scanner->preprocessor_state)
             {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX_OPT;
-                return continue_char(scanner, ev, ch);
+                scanner->preprocessor_state =
+                    CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING;
+                return
+                    start_token(
+                        scanner, ev, ch,
+                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING);
             }
             else
             {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
+                return
+                    start_state(
+                        scanner, ev, CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT);
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX_OPT:
-            if (isxdigit(ch))
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_QUOTE:
+            if (
+                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING
+                    == scanner->preprocessor_state)
             {
-                return continue_char(scanner, ev, ch);
+                return continue_token(scanner, ev, ch);
             }
             else
             {
-                switch (ch)
-                {
-                    case '\'':
-                        return end_char(scanner, ev, ch);
-
-                    case '\\':
-                        scanner->state =
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH;
-                        return continue_char(scanner, ev, ch);
-
-                    default:
-                        scanner->state =
-                            CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                        return continue_char(scanner, ev, ch);
-                }
+                return end_string(scanner, ev, ch);
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U1;
-                return continue_char(scanner, ev, ch);
-            }
-            else
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_GT:
+            if (
+                CPARSE_PREPROCESSOR_DIRECTIVE_STATE_ENABLED_INCLUDE_SYSTEM_STRING
+                    == scanner->preprocessor_state)
             {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
+                return end_string(scanner, ev, ch);
+            }
+            else
+            {
+                return continue_token(scanner, ev, ch);
             }
 
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U1:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U2;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U2:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U3;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U3:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U1;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U1:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U2;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U2:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U3;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U3:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U4;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U4:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U5;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U5:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U6;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U6:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U7;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U7:
-            if (isxdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-                return continue_char(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT:
-            if (char_is_decimal_digit(ch))
-            {
-                return continue_float(scanner, ev, ch);
-            }
-            else if ('E' == ch || 'e' == ch)
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_EXPECT_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else if (char_is_float_suffix(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return end_float(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX:
-            if (isxdigit(ch) || isalpha(ch))
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-            }
-            else
-            {
-                return end_float(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_EXPECT_DIGIT:
-            if (char_is_decimal_digit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else if ('+' == ch || '-' == ch)
-            {
-                scanner->state =
-                 CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_SIGN_EXPECT_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_SIGN_EXPECT_DIGIT:
-            if (char_is_decimal_digit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT:
-            if (char_is_decimal_digit(ch))
-            {
-                return continue_float(scanner, ev, ch);
-            }
-            else if (char_is_float_suffix(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return end_float(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER:
-            if (char_is_decimal_digit(ch))
-            {
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if ('.' == ch)
-            {
-                scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-            break;
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U:
-            if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL:
-            if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END:
-            return end_integer(scanner, ev);
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L:
-            if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL:
-            if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER:
-            if (char_is_octal_digit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if ('x' == ch || 'X' == ch)
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if ('.' == ch)
-            {
-                scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER:
-            if (char_is_octal_digit(ch))
-            {
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER:
-            if (isxdigit(ch))
-            {
-                scanner->has_hex_digit = true;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if ('p' == ch || 'P' == ch)
-            {
-                if (scanner->has_hex_digit)
-                {
-                  scanner->state =
-                  CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT;
-                  return continue_float(scanner, ev, ch);
-                }
-                else
-                {
-                    return ERROR_LIBCPARSE_PP_SCANNER_HEX_P_EXPECTING_DIGIT;
-                }
-            }
-            else if ('.' == ch)
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT;
-                return continue_float(scanner, ev, ch);
-            }
-            else if (char_is_unsigned_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U;
-                return continue_integer(scanner, ev, ch);
-            }
-            else if (char_is_long_specifier(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L;
-                return continue_integer(scanner, ev, ch);
-            }
-            else
-            {
-                return end_integer(scanner, ev);
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT:
-            if (isxdigit(ch))
-            {
-                return continue_float(scanner, ev, ch);
-            }
-            else if ('p' == ch || 'P' == ch)
-            {
-                scanner->state =
-                  CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_HEX_FLOAT_EXPECTING_P;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT:
-            if (isdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else if ('+' == ch || '-' == ch)
-            {
-                scanner->state =
-                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_S_EXPECT_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_S_EXPECT_DIGIT:
-            if (isdigit(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT;
-            }
-
-        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT:
-            if (isdigit(ch))
-            {
-                return continue_float(scanner, ev, ch);
-            }
-            else if (char_is_float_suffix(ch))
-            {
-                scanner->state =
-                    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX;
-                return continue_float(scanner, ev, ch);
-            }
-            else
-            {
-                return end_float(scanner, ev);
-            }
-
-        default:
-            return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
-    }
-}
-
-/**
- * \brief Return true if this is an alpha or underscore character.
- */
-static bool char_is_alpha_underscore(const int ch)
-{
-    if (isalpha(ch) || '_' == ch)
-    {
-        return true;
-    }
-
-    return false;
-}
-
-/**
- * \brief Return true if this is an identifier character.
- */
-static bool char_is_identifier(const int ch)
-{
-    if (char_is_alpha_underscore(ch) || isdigit(ch))
-    {
-        return true;
-    }
-
-    return false;
-}
-
-/**
- * \brief Return true if this is a decimal digit.
- */
-static bool char_is_decimal_digit(const int ch)
-{
-    if (isdigit(ch))
-    {
-        return true;
-    }
-
-    return false;
-}
-
-/**
- * \brief Return true if this is a octal digit.
- */
-static bool char_is_octal_digit(const int ch)
-{
-    if (isdigit(ch) && '9' != ch && '8' != ch)
-    {
-        return true;
-    }
-
-    return false;
-}
-
-/**
- * \brief Return true if this is a non-zero digit.
- */
-static bool char_is_non_zero_digit(const int ch)
-{
-    if (isdigit(ch) && '0' != ch)
-    {
-        return true;
-    }
-
-    return false;
-}
-
-/**
- * \brief Return true if this is a long specifier digit.
- */
-static bool char_is_long_specifier(const int ch)
-{
-    switch (ch)
-    {
-        case 'L':
-        case 'l':
-            return true;
-
-        default:
-            return false;
-    }
-}
-
-/**
- * \brief Return true if this is a float suffix.
- */
-static bool char_is_float_suffix(const int ch)
-{
-    switch (ch)
-    {
-        case 'F':
-        case 'L':
-        case 'f':
-        case 'l':
-            return true;
-
-        default:
-            return false;
-    }
-}
-
-/**
- * \brief Return true if this is an unsigned specifier digit.
- */
-static bool char_is_unsigned_specifier(const int ch)
-{
-    switch (ch)
-    {
-        case 'U':
-        case 'u':
-            return true;
-
-        default:
-            return false;
-    }
-}
-
-/**
- * \brief Start the hash state, and record the hash position.
- *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int start_hash(
-    preprocessor_scanner* scanner, const event* ev)
-{
-    int retval;
-
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
-
-    /* save this location. */
-    retval = file_position_cache_set(scanner->hash_cache, pos->file, pos);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* we are now in the hash state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HASH;
-
-    return STATUS_SUCCESS;
-}
-
-
-/**
- * \brief Start an identifier token.
- *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The character for this identifier.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int start_identifier(
-    preprocessor_scanner* scanner, const event* ev, int ch)
-{
-    int retval;
-
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
-
-    /* cache the location for the start of this event. */
-    retval = file_position_cache_set(scanner->cache, pos->file, pos);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* we are now in the identifier state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER;
-
-    return STATUS_SUCCESS;
-}
-
-/**
- * \brief Start a string token.
- *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The character for this string.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int start_string(
-    preprocessor_scanner* scanner, const event* ev, int ch)
-{
-    int retval;
-
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
-
-    /* cache the location for the start of this event. */
-    retval = file_position_cache_set(scanner->cache, pos->file, pos);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* we are now in the identifier state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-
-    return STATUS_SUCCESS;
-}
-
-/**
- * \brief Start a char token.
- *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The character for this character literal.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int start_char(
-    preprocessor_scanner* scanner, const event* ev, int ch)
-{
-    int retval;
-
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
-
-    /* cache the location for the start of this event. */
-    retval = file_position_cache_set(scanner->cache, pos->file, pos);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
-    /* we are now in the char state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-
-    return STATUS_SUCCESS;
-}
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_DIGIT:
+            scanner->has_hex_digit = true;
+            return continue_token(scanner, ev, ch);
 
-/**
- * \brief Start a decimal integer token.
- *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The digit for this integer.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int start_decimal_integer(
-    preprocessor_scanner* scanner, const event* ev, int ch)
-{
-    int retval;
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_EXPONENT:
+            if (scanner->has_hex_digit)
+            {
+                scanner->state = t->state;
+                return continue_token(scanner, ev, ch);
+            }
+            else
+            {
+                return ERROR_LIBCPARSE_PP_SCANNER_HEX_P_EXPECTING_DIGIT;
+            }
 
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_UPGRADE_DOT:
+            return upgrade_dot_state_to_float(scanner, ev, ch);
 
-    /* cache the location for the start of this event. */
-    retval = file_position_cache_set(scanner->cache, pos->file, pos);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_CHARACTER:
+            return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_CHARACTER;
 
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_DIGIT:
+            return ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT;
 
-    /* we are now in the decimal integer state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER;
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_FLOAT_EXPECTING_P:
+            return ERROR_LIBCPARSE_PP_SCANNER_HEX_FLOAT_EXPECTING_P;
 
-    return STATUS_SUCCESS;
+        case CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER:
+        default:
+            return ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER;
+    }
 }
 
 /**
- * \brief Start a zero integer token.
+ * \brief Process a raw span event.
+ *
+ * While a token is in progress, the run of characters that continues it in the
+ * current state is found with a vectorized scan and appended to the token at
+ * once. The last character of each run, and every character outside of a run,
+ * is processed as a raw character event, so that it extends the cached token
+ * position and performs any side effects of its transition.
  *
  * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The digit for this integer.
+ * \param ev                The raw span event to process.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int start_zero_integer(
-    preprocessor_scanner* scanner, const event* ev, int ch)
+static int process_raw_span(
+    preprocessor_scanner* scanner, const event* ev)
 {
     int retval;
+    event_raw_span* rsev;
+    cursor pos;
+    size_t run;
 
-    /* get the cursor for this event. */
-    const cursor* pos = event_get_cursor(ev);
-
-    /* cache the location for the start of this event. */
-    retval = file_position_cache_set(scanner->cache, pos->file, pos);
+    /* downcast the span event. */
+    retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
     }
 
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
+    const char* span = event_raw_span_get(rsev);
+    size_t size = event_raw_span_size_get(rsev);
+
+    /* start at the first character of the span. */
+    raw_span_start_position(&pos, ev);
+
+    while (size > 0)
     {
-        return retval;
-    }
+        /* find the run that continues the current token. */
+        run =
+            scan_run(
+                CPARSE_SYM(preprocessor_scanner_runs)[scanner->state],
+                span, size);
 
-    /* we are now in the zero integer state. */
-    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER;
+        /* add all but the last character of this run to the token. */
+        if (run > 1)
+        {
+            retval = string_builder_add_span(scanner->builder, span, run - 1);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
 
-    /* reset the hex digit state. */
-    scanner->has_hex_digit = false;
+            cursor_advance(&pos, span, run - 1);
+            span += run - 1;
+            size -= run - 1;
+        }
+
+        /* process the next character on its own. */
+        retval =
+            raw_span_send_characters(
+                &preprocessor_scanner_event_callback, scanner, &pos, span, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        span += 1;
+        size -= 1;
+    }
 
     return STATUS_SUCCESS;
 }
 
 /**
- * \brief Continue an identifier token.
+ * \brief Find the length of the run at the start of a span.
  *
- * \param scanner           The scanner for this operation.
- * \param ev                The raw character event to process.
- * \param ch                The character for this identifier.
+ * \param run               The \ref preprocessor_scanner_run to find.
+ * \param span              The span to scan.
+ * \param size              The size of this span.
  *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ * \returns the length of the run, which is 0 if there is no run to find.
  */
-static int continue_identifier(
-    preprocessor_scanner* scanner, const event* ev, int ch)
+static size_t scan_run(int run, const char* span, size_t size)
 {
-    int retval;
-
-    /* extend the cached position to cover this character. */
-    retval = file_position_cache_position_extend(scanner->cache, ev);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-    
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
-    if (STATUS_SUCCESS != retval)
+    switch (run)
     {
-        return retval;
-    }
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_IDENTIFIER:
+            return char_scan_run(span, size, CPARSE_CHAR_SCAN_CLASS_IDENTIFIER);
 
-    return STATUS_SUCCESS;
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_DECIMAL:
+            return
+                char_scan_run(span, size, CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT);
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_HEX:
+            return char_scan_run(span, size, CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT);
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_STRING:
+            return char_scan_any(span, size, "\"\\\n>", 4);
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_CHAR:
+            return char_scan_any(span, size, "'\\\n", 3);
+
+        default:
+            return 0;
+    }
 }
 
 /**
- * \brief Continue a string token.
+ * \brief Start the hash state, and record the hash position.
  *
  * \param scanner           The scanner for this operation.
  * \param ev                The raw character event to process.
- * \param ch                The character for this string.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int continue_string(
-    preprocessor_scanner* scanner, const event* ev, int ch)
+static int start_hash(
+    preprocessor_scanner* scanner, const event* ev)
 {
     int retval;
 
-    /* extend the cached position to cover this character. */
-    retval = file_position_cache_position_extend(scanner->cache, ev);
-    if (STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-    
-    /* add this character to the string builder. */
-    retval = string_builder_add_character(scanner->builder, ch);
+    /* get the cursor for this event. */
+    const cursor* pos = event_get_cursor(ev);
+
+    /* save this location. */
+    retval = file_position_cache_set(scanner->hash_cache, pos->file, pos);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
     }
 
+    /* we are now in the hash state. */
+    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HASH;
+
     return STATUS_SUCCESS;
 }
 
 /**
- * \brief Continue a char token.
+ * \brief Start a token in the given state.
  *
  * \param scanner           The scanner for this operation.
  * \param ev                The raw character event to process.
- * \param ch                The character for this character literal.
+ * \param ch                The first character of this token.
+ * \param state             The state for this token.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int continue_char(
-    preprocessor_scanner* scanner, const event* ev, int ch)
+static int start_token(
+    preprocessor_scanner* scanner, const event* ev, int ch, int state)
 {
     int retval;
 
-    /* extend the cached position to cover this character. */
-    retval = file_position_cache_position_extend(scanner->cache, ev);
+    /* get the cursor for this event. */
+    const cursor* pos = event_get_cursor(ev);
+
+    /* cache the location for the start of this event. */
+    retval = file_position_cache_set(scanner->cache, pos->file, pos);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
     }
-    
+
     /* add this character to the string builder. */
     retval = string_builder_add_character(scanner->builder, ch);
     if (STATUS_SUCCESS != retval)
@@ -2749,11 +1123,14 @@ static int continue_char(
         return retval;
     }
 
+    /* we are now in the token state. */
+    scanner->state = state;
+
     return STATUS_SUCCESS;
 }
 
 /**
- * \brief Continue an integer token.
+ * \brief Start a zero integer token.
  *
  * \param scanner           The scanner for this operation.
  * \param ev                The raw character event to process.
@@ -2763,40 +1140,49 @@ static int continue_char(
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int continue_integer(
+static int start_zero_integer(
     preprocessor_scanner* scanner, const event* ev, int ch)
 {
     int retval;
 
-    /* extend the cached position to cover this character. */
-    retval = file_position_cache_position_extend(scanner->cache, ev);
+    /* get the cursor for this event. */
+    const cursor* pos = event_get_cursor(ev);
+
+    /* cache the location for the start of this event. */
+    retval = file_position_cache_set(scanner->cache, pos->file, pos);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
     }
 
-    /* add this digit to the string builder. */
+    /* add this character to the string builder. */
     retval = string_builder_add_character(scanner->builder, ch);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
     }
 
+    /* we are now in the zero integer state. */
+    scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER;
+
+    /* reset the hex digit state. */
+    scanner->has_hex_digit = false;
+
     return STATUS_SUCCESS;
 }
 
 /**
- * \brief Continue a float token.
+ * \brief Continue a token.
  *
  * \param scanner           The scanner for this operation.
  * \param ev                The raw character event to process.
- * \param ch                The digit for this float.
+ * \param ch                The next character of this token.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int continue_float(
+static int continue_token(
     preprocessor_scanner* scanner, const event* ev, int ch)
 {
     int retval;
@@ -2808,7 +1194,7 @@ static int continue_float(
         return retval;
     }
 
-    /* add this digit to the string builder. */
+    /* add this character to the string builder. */
     retval = string_builder_add_character(scanner->builder, ch);
     if (STATUS_SUCCESS != retval)
     {
@@ -2818,223 +1204,36 @@ static int continue_float(
     return STATUS_SUCCESS;
 }
 
-/**
- * \brief This is the list of C keywords with event constructors.
- */
-static const keyword_ctor keywords[] = {
-    { "_Alignas", &event_init_for_token_keyword__Alignas, NULL },
-    { "_Alignof", &event_init_for_token_keyword__Alignof, NULL },
-    { "_Atomic", &event_init_for_token_keyword__Atomic, NULL },
-    { "_Bool", &event_init_for_token_keyword__Bool, NULL },
-    { "_Complex", &event_init_for_token_keyword__Complex, NULL },
-    { "_Generic", &event_init_for_token_keyword__Generic, NULL },
-    { "_Imaginary", &event_init_for_token_keyword__Imaginary, NULL },
-    { "_Noreturn", &event_init_for_token_keyword__Noreturn, NULL },
-    { "_Static_assert", &event_init_for_token_keyword__Static_assert, NULL },
-    { "_Thread_local", &event_init_for_token_keyword__Thread_local, NULL },
-    { "auto", &event_init_for_token_keyword_auto, NULL },
-    { "break", &event_init_for_token_keyword_break, NULL },
-    { "case", &event_init_for_token_keyword_case, NULL },
-    { "char", &event_init_for_token_keyword_char, NULL },
-    { "const", &event_init_for_token_keyword_const, NULL },
-    { "continue", &event_init_for_token_keyword_continue, NULL },
-    { "default", &event_init_for_token_keyword_default, NULL },
-    { "do", &event_init_for_token_keyword_do, NULL },
-    { "double", &event_init_for_token_keyword_double, NULL },
-    { "else", &event_init_for_token_keyword_else, NULL },
-    { "enum", &event_init_for_token_keyword_enum, NULL },
-    { "extern", &event_init_for_token_keyword_extern, NULL },
-    { "float", &event_init_for_token_keyword_float, NULL },
-    { "for", &event_init_for_token_keyword_for, NULL },
-    { "goto", &event_init_for_token_keyword_goto, NULL },
-    { "if", &event_init_for_token_keyword_if, NULL },
-    { "inline", &event_init_for_token_keyword_inline, NULL },
-    { "int", &event_init_for_token_keyword_int, NULL },
-    { "long", &event_init_for_token_keyword_long, NULL },
-    { "register", &event_init_for_token_keyword_register, NULL },
-    { "restrict", &event_init_for_token_keyword_restrict, NULL },
-    { "return", &event_init_for_token_keyword_return, NULL },
-    { "short", &event_init_for_token_keyword_short, NULL },
-    { "signed", &event_init_for_token_keyword_signed, NULL },
-    { "sizeof", &event_init_for_token_keyword_sizeof, NULL },
-    { "static", &event_init_for_token_keyword_static, NULL },
-    { "struct", &event_init_for_token_keyword_struct, NULL },
-    { "switch", &event_init_for_token_keyword_switch, NULL },
-    { "typedef", &event_init_for_token_keyword_typedef, NULL },
-    { "union", &event_init_for_token_keyword_union, NULL },
-    { "unsigned", &event_init_for_token_keyword_unsigned, NULL },
-    { "void", &event_init_for_token_keyword_void, NULL },
-    { "volatile", &event_init_for_token_keyword_volatile, NULL },
-    { "while", &event_init_for_token_keyword_while, NULL },
-};
-
-/**
- * \brief This is the list of C preprocessor keywords with event constructors.
- */
-static const keyword_ctor preprocessor_keywords[] = {
-    { "define", &event_init_for_token_preprocessor_id_define, NULL },
-    { "elif", &event_init_for_token_preprocessor_id_elif, NULL },
-    { "else", &event_init_for_token_preprocessor_id_else, NULL },
-    { "endif", &event_init_for_token_preprocessor_id_endif, NULL },
-    { "error", &event_init_for_token_preprocessor_id_error, NULL },
-    { "if", &event_init_for_token_preprocessor_id_if, NULL },
-    { "ifdef", &event_init_for_token_preprocessor_id_ifdef, NULL },
-    { "ifndef", &event_init_for_token_preprocessor_id_ifndef, NULL },
-    { "include", &event_init_for_token_preprocessor_id_include,
-      &preprocessor_include_update_state },
-    { "line", &event_init_for_token_preprocessor_id_line, NULL },
-    { "pragma", &event_init_for_token_preprocessor_id_pragma, NULL },
-    { "undef", &event_init_for_token_preprocessor_id_undef, NULL },
-};
-
-/**
- * \brief This is the list of C string prefixes.
- */
-static const char* string_prefixes[] = {
-    "L",
-    "U",
-    "u",
-    "u8",
-};
-
-/**
- * \brief This is the list of C char prefixes.
- */
-static const char* char_prefixes[] = {
-    "L",
-    "U",
-    "u",
-};
-
-/**
- * \brief Compare a keyword entry with the key.
- *
- * \param key               The key to compare.
- * \param entry             The entry to compare.
- *
- * \returns the comparison result.
- *      - a negative value if key < entry.
- *      - a positive value if key > entry.
- *      - zero if key == entry.
- */
-static int keyword_compare(const char* key, const keyword_ctor* entry)
-{
-    return strcmp(key, entry->keyword);
-}
-
-/**
- * \brief Compare a string prefixes entry with the key.
- *
- * \param key               The key to compare.
- * \param entry             The entry to compare.
- *
- * \returns the comparison result.
- *      - a negative value if key < entry.
- *      - a positive value if key > entry.
- *      - zero if key == entry.
- */
-static int string_prefix_compare(const char* key, const char** entry)
-{
-    return strcmp(key, *entry);
-}
-
-/**
- * \brief Search the keyword list for a given string, returning success and
- * populating the entry if found.
- *
- * \param keyword_entry     Pointer to keyword entry pointer to populate on
- *                          success.
- * \param str               The string to search.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int keyword_search(const keyword_ctor** keyword_entry, const char* str)
-{
-    const size_t entry_size = sizeof(keyword_ctor);
-    const size_t entry_count = sizeof(keywords) / entry_size;
-
-    /* perform a binary search on the keyword array. */
-    *keyword_entry =
-        bsearch(
-            str, keywords, entry_count, entry_size,
-            (bsearch_compare_func)&keyword_compare);
-
-    /* if the search succeeded, return success. */
-    if (NULL != *keyword_entry)
-    {
-        return STATUS_SUCCESS;
-    }
-    else
-    {
-        return ERROR_LIBCPARSE_ENTRY_NOT_FOUND;
-    }
-}
-
-/**
- * \brief Search the preprocessor keyword list for a given string, returning
- * success and populating the entry if found.
- *
- * \param keyword_entry     Pointer to keyword entry pointer to populate on
- *                          success.
- * \param str               The string to search.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static int preprocessor_keyword_search(
-    const keyword_ctor** keyword_entry, const char* str)
-{
-    const size_t entry_size = sizeof(keyword_ctor);
-    const size_t entry_count = sizeof(preprocessor_keywords) / entry_size;
-
-    /* perform a binary search on the keyword array. */
-    *keyword_entry =
-        bsearch(
-            str, preprocessor_keywords, entry_count, entry_size,
-            (bsearch_compare_func)&keyword_compare);
-
-    /* if the search succeeded, return success. */
-    if (NULL != *keyword_entry)
-    {
-        return STATUS_SUCCESS;
-    }
-    else
-    {
-        return ERROR_LIBCPARSE_ENTRY_NOT_FOUND;
-    }
-}
-
 /**
  * \brief Broadcast a keyword event.
  *
  * \param scanner           The scanner for this operation.
- * \param keyword_entry     The entry for this operation.
+ * \param ctor              The constructor for the keyword event.
+ * \param var_update        Optional updater for scanner variables, or NULL.
+ * \param pos               The position of the keyword.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static int keyword_event_broadcast(
-    preprocessor_scanner* scanner, const keyword_ctor* keyword_entry,
-    const cursor* pos)
+    preprocessor_scanner* scanner, simple_event_ctor ctor,
+    scanner_variable_updater var_update, const cursor* pos)
 {
     int retval, release_retval;
     event ev;
 
     /* initialize the token event. */
-    retval = (keyword_entry->ctor)(&ev, pos);
+    retval = (ctor)(&ev, pos);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
     /* update scanner variables if updater set. */
-    if (NULL != keyword_entry->var_update)
+    if (NULL != var_update)
     {
-        retval = (keyword_entry->var_update)(scanner);
+        retval = (var_update)(scanner);
         if (STATUS_SUCCESS != retval)
         {
             goto cleanup_ev;
@@ -3068,22 +1267,16 @@ done:
  *
  * The quote character is populated if this is a string.
  */
-static bool is_string(const char* str, const event* ev, int* ch)
+static bool is_string(
+    const preprocessor_scanner_keyword* keyword, const event* ev, int* ch)
 {
-    const size_t entry_size = sizeof(const char*);
-    const size_t entry_count = sizeof(string_prefixes) / entry_size;
-    const char* prefix;
     int retval;
     event_raw_character* rev;
 
-    /* perform a binary search on the string prefix list. */
-    prefix =
-        bsearch(
-            str, string_prefixes, entry_count, entry_size,
-            (bsearch_compare_func)&string_prefix_compare);
-
     /* If this is not a string prefix, then this isn't a string. */
-    if (NULL == prefix)
+    if (
+        NULL == keyword
+     || !(keyword->flags & CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX))
     {
         return false;
     }
@@ -3115,22 +1308,16 @@ static bool is_string(const char* str, const event* ev, int* ch)
  *
  * The quote character is populated if this is a char.
  */
-static bool is_char(const char* str, const event* ev, int* ch)
+static bool is_char(
+    const preprocessor_scanner_keyword* keyword, const event* ev, int* ch)
 {
-    const size_t entry_size = sizeof(const char*);
-    const size_t entry_count = sizeof(char_prefixes) / entry_size;
-    const char* prefix;
     int retval;
     event_raw_character* rev;
 
-    /* perform a binary search on the string prefix list. */
-    prefix =
-        bsearch(
-            str, char_prefixes, entry_count, entry_size,
-            (bsearch_compare_func)&string_prefix_compare);
-
     /* If this is not a char prefix, then this isn't a char. */
-    if (NULL == prefix)
+    if (
+        NULL == keyword
+     || !(keyword->flags & CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX))
     {
         return false;
     }
@@ -3301,10 +1488,12 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
 {
     int retval, release_retval;
     const cursor* pos;
-    char* str;
-    const keyword_ctor* keyword_entry;
+    const char* str;
+    size_t size;
+    const preprocessor_scanner_keyword* keyword;
     event_identifier iev;
     bool iev_initialized = false;
+    uint32_t symbol;
     int ch;
 
     /* get the cached position. */
@@ -3314,12 +1503,12 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
         goto done;
     }
 
-    /* Build a string for the identifier. */
-    retval = string_builder_build(&str, scanner->builder);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* view the string for the identifier. */
+    str = string_builder_view(scanner->builder);
+    size = string_builder_size(scanner->builder);
+
+    /* classify the identifier. */
+    keyword = preprocessor_scanner_keyword_lookup(str, size);
 
     /* could this be a preprocessor keyword? */
     if (
@@ -3327,8 +1516,7 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
             == scanner->preprocessor_state)
     {
         /* is this a preprocessor keyword? */
-        retval = preprocessor_keyword_search(&keyword_entry, str);
-        if (STATUS_SUCCESS == retval)
+        if (NULL != keyword && NULL != keyword->preprocessor_ctor)
         {
             /* we are now in a preprocessor directive. */
             scanner->preprocessor_state =
@@ -3341,7 +1529,7 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
                     scanner->hash_cache, &hash_pos);
             if (STATUS_SUCCESS != retval)
             {
-                goto cleanup_str;
+                goto done;
             }
 
             /* update the position to include the hash begin. */
@@ -3350,9 +1538,18 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
             broadcast_pos.begin_line = hash_pos->begin_line;
             broadcast_pos.begin_col = hash_pos->begin_col;
 
+            /* an include directive changes how the scanner reads names. */
+            scanner_variable_updater var_update = NULL;
+            if (keyword->flags & CPARSE_PREPROCESSOR_SCANNER_KEYWORD_INCLUDE)
+            {
+                var_update = &preprocessor_include_update_state;
+            }
+
             /* send the keyword event. */
             retval =
-                keyword_event_broadcast(scanner, keyword_entry, &broadcast_pos);
+                keyword_event_broadcast(
+                    scanner, keyword->preprocessor_ctor, var_update,
+                    &broadcast_pos);
 
             /* reset the hash cache. */
             file_position_cache_clear(scanner->hash_cache);
@@ -3366,7 +1563,7 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
             retval = end_hash(scanner, ev, false);
             if (STATUS_SUCCESS != retval)
             {
-                goto cleanup_str;
+                goto done;
             }
 
             /* we are not in a preprocessor directive. */
@@ -3376,39 +1573,46 @@ static int end_identifier(preprocessor_scanner* scanner, const event* ev)
     }
 
     /* is this a keyword? */
-    retval = keyword_search(&keyword_entry, str);
-    if (STATUS_SUCCESS == retval)
+    if (NULL != keyword && NULL != keyword->keyword_ctor)
     {
         /* send the keyword event. */
-        retval = keyword_event_broadcast(scanner, keyword_entry, pos);
+        retval =
+            keyword_event_broadcast(scanner, keyword->keyword_ctor, NULL, pos);
 
         /* we are done, so just clean up the string and reset state. */
         goto reset_state;
     }
 
     /* is this a string prefix? */
-    if (is_string(str, ev, &ch))
+    if (is_string(keyword, ev, &ch))
     {
         scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING;
-        retval = continue_string(scanner, ev, ch);
-        string_utils_string_release(str);
+        retval = continue_token(scanner, ev, ch);
         return retval;
     }
 
     /* is this a char prefix? */
-    if (is_char(str, ev, &ch))
+    if (is_char(keyword, ev, &ch))
     {
         scanner->state = CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR;
-        retval = continue_char(scanner, ev, ch);
-        string_utils_string_release(str);
+        retval = continue_token(scanner, ev, ch);
         return retval;
     }
 
+    /* intern the identifier, so that its string outlives the builder. */
+    retval =
+        intern_table_intern(
+            &str, &symbol, scanner->intern, str, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
     /* initialize the identifier event. */
-    retval = event_identifier_init(&iev, pos, str);
+    retval = event_identifier_init_for_symbol(&iev, pos, str, symbol);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_str;
+        goto done;
     }
 
     /* the event was initialized. */
@@ -3446,9 +1650,6 @@ cleanup_iev:
         }
     }
 
-cleanup_str:
-    string_utils_string_release(str);
-
 done:
     if (STATUS_SUCCESS != retval)
     {
@@ -3474,11 +1675,12 @@ static int end_string(preprocessor_scanner* scanner, const event* ev, int ch)
 {
     int retval, release_retval;
     const cursor* pos;
-    char* str;
+    const char* str;
+    size_t size;
     event_raw_string_token sev;
 
     /* append the character to the raw string. */
-    retval = continue_string(scanner, ev, ch);
+    retval = continue_token(scanner, ev, ch);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -3491,12 +1693,9 @@ static int end_string(preprocessor_scanner* scanner, const event* ev, int ch)
         goto done;
     }
 
-    /* Build a string for the raw string token. */
-    retval = string_builder_build(&str, scanner->builder);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* view the string for the raw string token. */
+    str = string_builder_view(scanner->builder);
+    size = string_builder_size(scanner->builder);
 
     /* is this a system include string? */
     if (
@@ -3504,10 +1703,11 @@ static int end_string(preprocessor_scanner* scanner, const event* ev, int ch)
             == scanner->preprocessor_state)
     {
         /* initialize the raw system string event. */
-        retval = event_raw_string_token_init_for_system_string(&sev, pos, str);
+        retval =
+            event_raw_string_token_init_for_system_view(&sev, pos, str, size);
         if (STATUS_SUCCESS != retval)
         {
-            goto cleanup_str;
+            goto done;
         }
 
         /* fall back to the include state. */
@@ -3517,10 +1717,10 @@ static int end_string(preprocessor_scanner* scanner, const event* ev, int ch)
     else
     {
         /* initialize the raw string event. */
-        retval = event_raw_string_token_init(&sev, pos, str);
+        retval = event_raw_string_token_init_for_view(&sev, pos, str, size);
         if (STATUS_SUCCESS != retval)
         {
-            goto cleanup_str;
+            goto done;
         }
     }
 
@@ -3553,9 +1753,6 @@ cleanup_sev:
         retval = release_retval;
     }
 
-cleanup_str:
-    string_utils_string_release(str);
-
 done:
     return retval;
 }
@@ -3575,11 +1772,11 @@ static int end_char(preprocessor_scanner* scanner, const event* ev, int ch)
 {
     int retval, release_retval;
     const cursor* pos;
-    char* str;
+    const char* str;
     event_raw_character_literal cev;
 
     /* append the character to the raw character literal. */
-    retval = continue_char(scanner, ev, ch);
+    retval = continue_token(scanner, ev, ch);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -3592,18 +1789,14 @@ static int end_char(preprocessor_scanner* scanner, const event* ev, int ch)
         goto done;
     }
 
-    /* Build a string for the raw character literal. */
-    retval = string_builder_build(&str, scanner->builder);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* view the string for the raw character literal. */
+    str = string_builder_view(scanner->builder);
 
     /* initialize the raw character literal event. */
     retval = event_raw_character_literal_init(&cev, pos, str);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_str;
+        goto done;
     }
 
     /* broadcast this event. */
@@ -3635,9 +1828,6 @@ cleanup_cev:
         retval = release_retval;
     }
 
-cleanup_str:
-    string_utils_string_release(str);
-
 done:
     return retval;
 }
@@ -3675,7 +1865,8 @@ static int end_integer(preprocessor_scanner* scanner, const event* ev)
 {
     int retval, release_retval;
     const cursor* pos;
-    char* str;
+    const char* str;
+    size_t size;
     event_raw_integer_token iev;
 
     /* verify that a hex sequence contains at least one hex digit. */
@@ -3692,18 +1883,15 @@ static int end_integer(preprocessor_scanner* scanner, const event* ev)
         goto done;
     }
 
-    /* Build a string for the integer. */
-    retval = string_builder_build(&str, scanner->builder);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* view the string for the integer. */
+    str = string_builder_view(scanner->builder);
+    size = string_builder_size(scanner->builder);
 
     /* initialize the integer event. */
-    retval = event_raw_integer_token_init(&iev, pos, str);
+    retval = event_raw_integer_token_init_for_view(&iev, pos, str, size);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_str;
+        goto done;
     }
 
     /* broadcast this event. */
@@ -3735,9 +1923,6 @@ cleanup_iev:
         retval = release_retval;
     }
 
-cleanup_str:
-    string_utils_string_release(str);
-
 done:
     if (STATUS_SUCCESS != retval)
     {
@@ -3762,7 +1947,8 @@ static int end_float(preprocessor_scanner* scanner, const event* ev)
 {
     int retval, release_retval;
     const cursor* pos;
-    char* str;
+    const char* str;
+    size_t size;
     event_raw_float_token fev;
 
     /* get the cached position. */
@@ -3772,18 +1958,15 @@ static int end_float(preprocessor_scanner* scanner, const event* ev)
         goto done;
     }
 
-    /* Build a string for the float. */
-    retval = string_builder_build(&str, scanner->builder);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* view the string for the float. */
+    str = string_builder_view(scanner->builder);
+    size = string_builder_size(scanner->builder);
 
     /* initialize the float event. */
-    retval = event_raw_float_token_init(&fev, pos, str);
+    retval = event_raw_float_token_init_for_view(&fev, pos, str, size);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_str;
+        goto done;
     }
 
     /* broadcast this event. */
@@ -3815,9 +1998,6 @@ cleanup_fev:
         retval = release_retval;
     }
 
-cleanup_str:
-    string_utils_string_release(str);
-
 done:
     if (STATUS_SUCCESS != retval)
     {
@@ -3972,6 +2152,7 @@ static int broadcast_pp_end(preprocessor_scanner* scanner)
     {
         bpos.end_line = bpos.begin_line;
         bpos.end_col = bpos.begin_col;
+        bpos.end_offset = bpos.begin_offset;
     }
 
     /* initialize the token event. */
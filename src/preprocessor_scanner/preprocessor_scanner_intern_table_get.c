@@ -0,0 +1,23 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_intern_table_get.c
+ *
+ * \brief Get the intern table used by the preprocessor scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "preprocessor_scanner_internal.h"
+
+/**
+ * \brief Get the \ref intern_table used by this scanner for identifiers.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to query.
+ *
+ * \returns the \ref intern_table for this scanner.
+ */
+CPARSE_SYM(intern_table)* CPARSE_SYM(preprocessor_scanner_intern_table_get)(
+    CPARSE_SYM(preprocessor_scanner)* scanner)
+{
+    return scanner->intern;
+}
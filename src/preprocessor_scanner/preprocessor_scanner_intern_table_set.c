@@ -0,0 +1,43 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_intern_table_set.c
+ *
+ * \brief Use a shared intern table in the preprocessor scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_intern_table;
+
+/**
+ * \brief Use a shared \ref intern_table for identifiers.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to update.
+ * \param table             The shared \ref intern_table to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_intern_table_set)(
+    CPARSE_SYM(preprocessor_scanner)* scanner,
+    CPARSE_SYM(intern_table)* table)
+{
+    int retval = STATUS_SUCCESS;
+
+    /* release the table we own. */
+    if (scanner->owns_intern && table != scanner->intern)
+    {
+        retval = intern_table_release(scanner->intern);
+    }
+
+    /* borrow the shared table. */
+    scanner->intern = table;
+    scanner->owns_intern = false;
+
+    return retval;
+}
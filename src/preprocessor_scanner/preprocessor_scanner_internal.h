@@ -10,10 +10,16 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
+#include <libcparse/arena.h>
 #include <libcparse/newline_preserving_whitespace_filter.h>
 #include <libcparse/event_reactor_fwd.h>
 #include <libcparse/file_position_cache.h>
+#include <libcparse/intern_table.h>
 #include <libcparse/string_builder.h>
+#include <libcparse/util/event_ring.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -33,10 +39,16 @@ struct CPARSE_SYM(preprocessor_scanner)
     CPARSE_SYM(file_position_cache)* newline_cache;
     CPARSE_SYM(file_position_cache)* hash_cache;
     CPARSE_SYM(string_builder)* builder;
+    CPARSE_SYM(event_ring)* ring;
+    CPARSE_SYM(intern_table)* intern;
+    bool owns_intern;
     int state;
     int preprocessor_state;
     bool state_reset;
     bool has_hex_digit;
+    CPARSE_SYM(allocator) alloc;
+    CPARSE_SYM(arena)* arena;
+    bool owns_arena;
 };
 
 enum CPARSE_SYM(preprocessor_scanner_state)
@@ -122,6 +134,164 @@ enum CPARSE_SYM(preprocessor_scanner_state)
     CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT =      78,
 };
 
+/**
+ * \brief The number of preprocessor scanner states.
+ */
+#define CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT 79
+
+/**
+ * \brief Character classes used to index the raw character transition table.
+ *
+ * Two characters share a class when every scanner state treats them alike.
+ */
+enum CPARSE_SYM(preprocessor_scanner_char_class)
+{
+    /* any character not listed below. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_OTHER =                           0,
+    /* 0 */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_ZERO =                            1,
+    /* 1-7 */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_OCTAL_DIGIT =                     2,
+    /* 8-9 */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_DECIMAL_DIGIT =                   3,
+    /* a b: hex digits and escape characters. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_ESCAPE =                      4,
+    /* c d A B C D */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_ALPHA =                       5,
+    /* e E: hex digits and float exponents. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_EXPONENT =                        6,
+    /* f: hex digit, escape character, and float suffix. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LITTLE_F =                        7,
+    /* F: hex digit and float suffix. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_BIG_F =                           8,
+    /* l L: long specifiers and float suffixes. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LONG =                            9,
+    /* u */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LITTLE_U =                       10,
+    /* U */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_BIG_U =                          11,
+    /* x X */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_PREFIX =                     12,
+    /* p P */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_EXPONENT =                   13,
+    /* n r t v */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_ESCAPE =                         14,
+    /* any other letter. */
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_ALPHA =                          15,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_UNDERSCORE =                     16,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_PAREN =                     17,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_PAREN =                    18,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_BRACE =                     19,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_BRACE =                    20,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_BRACKET =                   21,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_BRACKET =                  22,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_COMMA =                          23,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_COLON =                          24,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_SEMICOLON =                      25,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_DOT =                            26,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_DASH =                           27,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_PLUS =                           28,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_STAR =                           29,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_SLASH =                          30,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_PERCENT =                        31,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_AMPERSAND =                      32,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_PIPE =                           33,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_CARET =                          34,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_TILDE =                          35,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_QUESTION =                       36,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_EQUAL =                          37,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_NOT =                            38,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_LT =                             39,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_GT =                             40,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_DOUBLE_QUOTE =                   41,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_SINGLE_QUOTE =                   42,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_HASH =                           43,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_BACKSLASH =                      44,
+    CPARSE_PREPROCESSOR_SCANNER_CLASS_COUNT =                          45,
+};
+
+/**
+ * \brief Actions performed by a raw character transition.
+ */
+enum CPARSE_SYM(preprocessor_scanner_action)
+{
+    /* fail with ERROR_LIBCPARSE_PP_SCANNER_UNEXPECTED_CHARACTER. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER =           0,
+    /* fail with ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_CHARACTER. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_CHARACTER =            1,
+    /* fail with ERROR_LIBCPARSE_PP_SCANNER_EXPECTING_DIGIT. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_DIGIT =                2,
+    /* fail with ERROR_LIBCPARSE_PP_SCANNER_HEX_FLOAT_EXPECTING_P. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_FLOAT_EXPECTING_P =          3,
+    /* leave the begin line state and process the character again. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_BEGIN_LINE =                     4,
+    /* start a hash at the beginning of a line. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_HASH =                     5,
+    /* start a hash which cannot begin a preprocessor directive. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_INLINE_HASH =              6,
+    /* start the identifier following a hash. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_HASH_IDENTIFIER =                7,
+    /* broadcast a double hash token. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_DOUBLE_HASH =                    8,
+    /* broadcast a single hash token. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_HASH =                       9,
+    /* start a token in the given state with this character. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN =                   10,
+    /* start an integer with a leading zero. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_ZERO_INTEGER =            11,
+    /* start a less than token, or a system include string. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_LT =                      12,
+    /* start a punctuator in the given state. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_START_STATE =                   13,
+    /* extend a punctuator into the given state. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_TRANSITION_STATE =              14,
+    /* add this character to the token and enter the given state. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN =                15,
+    /* add a hex digit to a hex integer. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_DIGIT =                     16,
+    /* start the exponent of a hex float, if the integer has a digit. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_EXPONENT =                  17,
+    /* turn a dot into the start of a float. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_UPGRADE_DOT =                   18,
+    /* end a string, unless this is a system include string. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_QUOTE =                  19,
+    /* end a system include string, or continue any other string. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_GT =                     20,
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_IDENTIFIER =                21,
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_STRING =                    22,
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_CHAR =                      23,
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_INTEGER =                   24,
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_FLOAT =                     25,
+    /* broadcast the given token at this character. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_SIMPLE_TOKEN =                  26,
+    /* broadcast the given token, ending with this character. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_COMPOUND_TOKEN =                27,
+    /* broadcast the given token, then process this character again. */
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_CACHED_TOKEN =                  28,
+};
+
+/**
+ * \brief Runs of characters that a state can consume from a span in bulk.
+ *
+ * Every character in a run continues the current token without changing the
+ * scanner state, so a run can be appended to the token at once.
+ */
+enum CPARSE_SYM(preprocessor_scanner_run)
+{
+    /* this state processes each character individually. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_NONE =                              0,
+    /* letters, decimal digits, and underscores. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_IDENTIFIER =                        1,
+    /* decimal digits. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_DECIMAL =                           2,
+    /* hexadecimal digits. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_HEX =                               3,
+    /* anything but a double quote, backslash, newline, or greater than. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_STRING =                            4,
+    /* anything but a single quote, backslash, or newline. */
+    CPARSE_PREPROCESSOR_SCANNER_RUN_CHAR =                              5,
+};
+
 enum CPARSE_SYM(preprocessor_directive_state)
 {
     CPARSE_PREPROCESSOR_DIRECTIVE_STATE_INIT =                          0,
@@ -132,6 +302,93 @@ enum CPARSE_SYM(preprocessor_directive_state)
     CPARSE_PREPROCESSOR_DIRECTIVE_STATE_DISABLED =                      5,
 };
 
+/**
+ * \brief Flags describing how a keyword table entry is used.
+ */
+enum CPARSE_SYM(preprocessor_scanner_keyword_flag)
+{
+    /* this preprocessor keyword starts an include directive. */
+    CPARSE_PREPROCESSOR_SCANNER_KEYWORD_INCLUDE =                  0x0001,
+    /* this word can prefix a string literal. */
+    CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX =            0x0002,
+    /* this word can prefix a character literal. */
+    CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX =              0x0004,
+};
+
+/**
+ * \brief Constructor for a keyword or punctuator token event.
+ */
+typedef int (*CPARSE_SYM(preprocessor_scanner_keyword_ctor))(
+    CPARSE_SYM(event)*, const CPARSE_SYM(cursor)*);
+
+typedef struct CPARSE_SYM(preprocessor_scanner_keyword)
+CPARSE_SYM(preprocessor_scanner_keyword);
+
+/**
+ * \brief An entry in the keyword table.
+ *
+ * A word may be both a C keyword and a preprocessor keyword (e.g. "if"), in
+ * which case both constructors are set.
+ */
+struct CPARSE_SYM(preprocessor_scanner_keyword)
+{
+    const char* word;
+    size_t size;
+    CPARSE_SYM(preprocessor_scanner_keyword_ctor) keyword_ctor;
+    CPARSE_SYM(preprocessor_scanner_keyword_ctor) preprocessor_ctor;
+    int flags;
+};
+
+typedef struct CPARSE_SYM(preprocessor_scanner_transition)
+CPARSE_SYM(preprocessor_scanner_transition);
+
+/**
+ * \brief An entry in the raw character transition table.
+ *
+ * The meaning of the state and token fields depends on the action.
+ */
+struct CPARSE_SYM(preprocessor_scanner_transition)
+{
+    uint8_t action;
+    uint8_t state;
+    uint8_t token;
+};
+
+/**
+ * \brief The character class of each raw character.
+ *
+ * This table is generated by tools/lexer_table_gen.
+ */
+extern const uint8_t CPARSE_SYM(preprocessor_scanner_char_class)[256];
+
+/**
+ * \brief The raw character transition table, indexed by scanner state and by
+ * character class.
+ *
+ * This table is generated by tools/lexer_table_gen.
+ */
+extern const CPARSE_SYM(preprocessor_scanner_transition)
+CPARSE_SYM(preprocessor_scanner_transitions)[
+    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT]
+    [CPARSE_PREPROCESSOR_SCANNER_CLASS_COUNT];
+
+/**
+ * \brief The \ref preprocessor_scanner_run that each scanner state can consume
+ * in bulk.
+ *
+ * This table is generated by tools/lexer_table_gen.
+ */
+extern const uint8_t CPARSE_SYM(preprocessor_scanner_runs)[
+    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT];
+
+/**
+ * \brief The token constructors referenced by the transition table.
+ *
+ * This table is generated by tools/lexer_table_gen.
+ */
+extern const CPARSE_SYM(preprocessor_scanner_keyword_ctor)
+CPARSE_SYM(preprocessor_scanner_token_ctors)[];
+
 /******************************************************************************/
 /* Start of private methods.                                                  */
 /******************************************************************************/
@@ -165,12 +422,86 @@ int CPARSE_SYM(preprocessor_scanner_message_callback)(
 int CPARSE_SYM(preprocessor_scanner_event_callback)(
     void* context, const CPARSE_SYM(event)* ev);
 
+/**
+ * \brief Create a preprocessor scanner, optionally in pipelined mode.
+ *
+ * \param scanner           Pointer to the \ref preprocessor_scanner pointer to
+ *                          be populated with the created preprocessor scanner
+ *                          instance on success.
+ * \param pipeline_capacity The capacity of the pipeline ring, or 0 if this
+ *                          scanner should run serially.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_create_internal)(
+    CPARSE_SYM(preprocessor_scanner)** scanner, size_t pipeline_capacity,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Producer-side event handler callback for a pipelined
+ * \ref preprocessor_scanner.
+ *
+ * This copies each event from the newline preserving whitespace filter onto
+ * the pipeline ring, to be scanned on the consumer thread.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref preprocessor_scanner instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_pipeline_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev);
+
+/**
+ * \brief Run a pipelined \ref preprocessor_scanner.
+ *
+ * The run message is forwarded to the rest of the parser stack on a producer
+ * thread, while the calling thread scans the events that it produces.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The run message to forward.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_pipeline_run)(
+    CPARSE_SYM(preprocessor_scanner)* scanner, const CPARSE_SYM(message)* msg);
+
+/**
+ * \brief Classify an identifier as a keyword, a preprocessor keyword, or a
+ * string or char prefix.
+ *
+ * This is a perfect hash lookup, generated by tools/keyword_hash_gen.
+ *
+ * \param str               The identifier to look up.
+ * \param size              The size of the identifier.
+ *
+ * \returns the keyword entry for this identifier, or NULL if it is a plain
+ * identifier.
+ */
+const CPARSE_SYM(preprocessor_scanner_keyword)*
+CPARSE_SYM(preprocessor_scanner_keyword_lookup)(
+    const char* str, size_t size);
+
 /******************************************************************************/
 /* Start of privote exports.                                                  */
 /******************************************************************************/
 
 #define __INTERNAL_CPARSE_IMPORT_preprocessor_scanner_internal_sym(sym) \
     CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(preprocessor_scanner_keyword_ctor) \
+    sym ## preprocessor_scanner_keyword_ctor; \
+    typedef CPARSE_SYM(preprocessor_scanner_keyword) \
+    sym ## preprocessor_scanner_keyword; \
+    typedef CPARSE_SYM(preprocessor_scanner_transition) \
+    sym ## preprocessor_scanner_transition; \
     static inline int \
     sym ## preprocessor_scanner_message_callback( \
         void* x, const CPARSE_SYM(message)* y) { \
@@ -179,6 +510,25 @@ int CPARSE_SYM(preprocessor_scanner_event_callback)(
     sym ## preprocessor_scanner_event_callback( \
         void* x, const CPARSE_SYM(event)* y) { \
             return CPARSE_SYM(preprocessor_scanner_event_callback)(x,y); } \
+    static inline int \
+    sym ## preprocessor_scanner_create_internal( \
+        CPARSE_SYM(preprocessor_scanner)** x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(preprocessor_scanner_create_internal)(x,y,z); } \
+    static inline int \
+    sym ## preprocessor_scanner_pipeline_event_callback( \
+        void* x, const CPARSE_SYM(event)* y) { \
+            return \
+                CPARSE_SYM(preprocessor_scanner_pipeline_event_callback)( \
+                    x,y); } \
+    static inline int \
+    sym ## preprocessor_scanner_pipeline_run( \
+        CPARSE_SYM(preprocessor_scanner)* x, const CPARSE_SYM(message)* y) { \
+            return CPARSE_SYM(preprocessor_scanner_pipeline_run)(x,y); } \
+    static inline const CPARSE_SYM(preprocessor_scanner_keyword)* \
+    sym ## preprocessor_scanner_keyword_lookup( \
+        const char* x, size_t y) { \
+            return CPARSE_SYM(preprocessor_scanner_keyword_lookup)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_preprocessor_scanner_internal_as(sym) \
@@ -0,0 +1,386 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_keyword_lookup.c
+ *
+ * \brief Perfect hash lookup of preprocessor scanner keywords.
+ *
+ * This file is generated by tools/keyword_hash_gen. Do not edit it by hand;
+ * instead, update the generator and run the keyword_hash target.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+#define KEYWORD_SLOTS 64
+#define KEYWORD_MAX_SIZE 14
+
+/**
+ * \brief The hash weight of each character.
+ */
+static const uint8_t weights[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+     0, 25,  9, 36,  0,  0,  0, 62,  0, 16,  0,  0, 18,  0, 63,  0,
+     0,  0,  0, 33, 38, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,
+     0, 51, 41,  0, 44, 50, 12, 34, 37,  0,  0,  3, 59, 35, 54,  6,
+    39,  0, 13, 58, 60, 31, 11, 40, 61, 21,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+/**
+ * \brief The keyword table, indexed by hash slot.
+ */
+static const preprocessor_scanner_keyword keywords[KEYWORD_SLOTS] = {
+    [0] = {
+        "continue", 8,
+        &event_init_for_token_keyword_continue,
+        NULL,
+        0 },
+    [1] = {
+        "void", 4,
+        &event_init_for_token_keyword_void,
+        NULL,
+        0 },
+    [3] = {
+        "restrict", 8,
+        &event_init_for_token_keyword_restrict,
+        NULL,
+        0 },
+    [4] = {
+        "while", 5,
+        &event_init_for_token_keyword_while,
+        NULL,
+        0 },
+    [5] = {
+        "_Alignas", 8,
+        &event_init_for_token_keyword__Alignas,
+        NULL,
+        0 },
+    [7] = {
+        "const", 5,
+        &event_init_for_token_keyword_const,
+        NULL,
+        0 },
+    [8] = {
+        "float", 5,
+        &event_init_for_token_keyword_float,
+        NULL,
+        0 },
+    [9] = {
+        "unsigned", 8,
+        &event_init_for_token_keyword_unsigned,
+        NULL,
+        0 },
+    [10] = {
+        "_Atomic", 7,
+        &event_init_for_token_keyword__Atomic,
+        NULL,
+        0 },
+    [11] = {
+        "volatile", 8,
+        &event_init_for_token_keyword_volatile,
+        NULL,
+        0 },
+    [12] = {
+        "sizeof", 6,
+        &event_init_for_token_keyword_sizeof,
+        NULL,
+        0 },
+    [13] = {
+        "switch", 6,
+        &event_init_for_token_keyword_switch,
+        NULL,
+        0 },
+    [15] = {
+        "enum", 4,
+        &event_init_for_token_keyword_enum,
+        NULL,
+        0 },
+    [16] = {
+        "union", 5,
+        &event_init_for_token_keyword_union,
+        NULL,
+        0 },
+    [17] = {
+        "error", 5,
+        NULL,
+        &event_init_for_token_preprocessor_id_error,
+        0 },
+    [19] = {
+        "_Complex", 8,
+        &event_init_for_token_keyword__Complex,
+        NULL,
+        0 },
+    [20] = {
+        "register", 8,
+        &event_init_for_token_keyword_register,
+        NULL,
+        0 },
+    [21] = {
+        "_Static_assert", 14,
+        &event_init_for_token_keyword__Static_assert,
+        NULL,
+        0 },
+    [22] = {
+        "define", 6,
+        NULL,
+        &event_init_for_token_preprocessor_id_define,
+        0 },
+    [23] = {
+        "_Alignof", 8,
+        &event_init_for_token_keyword__Alignof,
+        NULL,
+        0 },
+    [24] = {
+        "_Thread_local", 13,
+        &event_init_for_token_keyword__Thread_local,
+        NULL,
+        0 },
+    [25] = {
+        "_Imaginary", 10,
+        &event_init_for_token_keyword__Imaginary,
+        NULL,
+        0 },
+    [26] = {
+        "if", 2,
+        &event_init_for_token_keyword_if,
+        &event_init_for_token_preprocessor_id_if,
+        0 },
+    [27] = {
+        "U", 1,
+        NULL,
+        NULL,
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX
+          | CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX },
+    [28] = {
+        "auto", 4,
+        &event_init_for_token_keyword_auto,
+        NULL,
+        0 },
+    [29] = {
+        "ifdef", 5,
+        NULL,
+        &event_init_for_token_preprocessor_id_ifdef,
+        0 },
+    [30] = {
+        "ifndef", 6,
+        NULL,
+        &event_init_for_token_preprocessor_id_ifndef,
+        0 },
+    [31] = {
+        "u8", 2,
+        NULL,
+        NULL,
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX },
+    [32] = {
+        "short", 5,
+        &event_init_for_token_keyword_short,
+        NULL,
+        0 },
+    [33] = {
+        "default", 7,
+        &event_init_for_token_keyword_default,
+        NULL,
+        0 },
+    [34] = {
+        "for", 3,
+        &event_init_for_token_keyword_for,
+        NULL,
+        0 },
+    [35] = {
+        "else", 4,
+        &event_init_for_token_keyword_else,
+        &event_init_for_token_preprocessor_id_else,
+        0 },
+    [36] = {
+        "typedef", 7,
+        &event_init_for_token_keyword_typedef,
+        NULL,
+        0 },
+    [37] = {
+        "L", 1,
+        NULL,
+        NULL,
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX
+          | CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX },
+    [38] = {
+        "undef", 5,
+        NULL,
+        &event_init_for_token_preprocessor_id_undef,
+        0 },
+    [39] = {
+        "long", 4,
+        &event_init_for_token_keyword_long,
+        NULL,
+        0 },
+    [40] = {
+        "_Noreturn", 9,
+        &event_init_for_token_keyword__Noreturn,
+        NULL,
+        0 },
+    [41] = {
+        "case", 4,
+        &event_init_for_token_keyword_case,
+        NULL,
+        0 },
+    [42] = {
+        "double", 6,
+        &event_init_for_token_keyword_double,
+        NULL,
+        0 },
+    [43] = {
+        "extern", 6,
+        &event_init_for_token_keyword_extern,
+        NULL,
+        0 },
+    [44] = {
+        "signed", 6,
+        &event_init_for_token_keyword_signed,
+        NULL,
+        0 },
+    [45] = {
+        "pragma", 6,
+        NULL,
+        &event_init_for_token_preprocessor_id_pragma,
+        0 },
+    [46] = {
+        "inline", 6,
+        &event_init_for_token_keyword_inline,
+        NULL,
+        0 },
+    [47] = {
+        "include", 7,
+        NULL,
+        &event_init_for_token_preprocessor_id_include,
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_INCLUDE },
+    [48] = {
+        "_Generic", 8,
+        &event_init_for_token_keyword__Generic,
+        NULL,
+        0 },
+    [49] = {
+        "line", 4,
+        NULL,
+        &event_init_for_token_preprocessor_id_line,
+        0 },
+    [50] = {
+        "goto", 4,
+        &event_init_for_token_keyword_goto,
+        NULL,
+        0 },
+    [51] = {
+        "_Bool", 5,
+        &event_init_for_token_keyword__Bool,
+        NULL,
+        0 },
+    [53] = {
+        "int", 3,
+        &event_init_for_token_keyword_int,
+        NULL,
+        0 },
+    [54] = {
+        "char", 4,
+        &event_init_for_token_keyword_char,
+        NULL,
+        0 },
+    [56] = {
+        "struct", 6,
+        &event_init_for_token_keyword_struct,
+        NULL,
+        0 },
+    [57] = {
+        "endif", 5,
+        NULL,
+        &event_init_for_token_preprocessor_id_endif,
+        0 },
+    [58] = {
+        "do", 2,
+        &event_init_for_token_keyword_do,
+        NULL,
+        0 },
+    [59] = {
+        "return", 6,
+        &event_init_for_token_keyword_return,
+        NULL,
+        0 },
+    [60] = {
+        "static", 6,
+        &event_init_for_token_keyword_static,
+        NULL,
+        0 },
+    [61] = {
+        "elif", 4,
+        NULL,
+        &event_init_for_token_preprocessor_id_elif,
+        0 },
+    [62] = {
+        "break", 5,
+        &event_init_for_token_keyword_break,
+        NULL,
+        0 },
+    [63] = {
+        "u", 1,
+        NULL,
+        NULL,
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX
+          | CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX },
+};
+
+/**
+ * \brief Classify an identifier as a keyword, a preprocessor keyword, or a
+ * string or char prefix.
+ *
+ * \param str               The identifier to look up.
+ * \param size              The size of the identifier.
+ *
+ * \returns the keyword entry for this identifier, or NULL if it is a plain
+ * identifier.
+ */
+const CPARSE_SYM(preprocessor_scanner_keyword)*
+CPARSE_SYM(preprocessor_scanner_keyword_lookup)(
+    const char* str, size_t size)
+{
+    const preprocessor_scanner_keyword* entry;
+    size_t slot;
+
+    /* no keyword is empty or longer than the longest keyword. */
+    if (0 == size || size > KEYWORD_MAX_SIZE)
+    {
+        return NULL;
+    }
+
+    /* hash the length and the first, second, and last characters. */
+    slot = size;
+    slot += weights[(uint8_t)str[0]];
+    slot += weights[(uint8_t)str[size - 1]];
+    if (size > 1)
+    {
+        slot += weights[(uint8_t)str[1]];
+    }
+
+    /* only the word in this slot can match. */
+    entry = &keywords[slot & (KEYWORD_SLOTS - 1)];
+    if (entry->size != size || 0 != memcmp(entry->word, str, size))
+    {
+        return NULL;
+    }
+
+    return entry;
+}
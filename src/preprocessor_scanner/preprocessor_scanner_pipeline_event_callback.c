@@ -0,0 +1,77 @@
+/**
+ * \file
+ * src/preprocessor_scanner/preprocessor_scanner_pipeline_event_callback.c
+ *
+ * \brief Producer-side event callback for a pipelined
+ * \ref preprocessor_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_copy.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_util_event_ring;
+
+/**
+ * \brief Producer-side event handler callback for a pipelined
+ * \ref preprocessor_scanner.
+ *
+ * This copies each event from the newline preserving whitespace filter onto
+ * the pipeline ring, to be scanned on the consumer thread.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref preprocessor_scanner instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_pipeline_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner = (preprocessor_scanner*)context;
+    event_copy* cpy;
+
+    /* stop producing if the consumer has failed. */
+    if (event_ring_is_closed(scanner->ring))
+    {
+        return ERROR_LIBCPARSE_EVENT_RING_CLOSED;
+    }
+
+    /* copy the event, since the original only lives for this callback. */
+    retval = event_copy_create_with_allocator(&cpy, ev, &scanner->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* hand the copy to the consumer. */
+    retval = event_ring_push(scanner->ring, cpy);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cpy;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_cpy:
+    release_retval = event_copy_release(cpy);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
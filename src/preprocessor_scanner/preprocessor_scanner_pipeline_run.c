@@ -0,0 +1,190 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_pipeline_run.c
+ *
+ * \brief Run a pipelined \ref preprocessor_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/message.h>
+#include <libcparse/message_handler.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "../event_copy/event_copy_internal.h"
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+CPARSE_IMPORT_util_event_ring;
+
+typedef struct producer_context producer_context;
+
+struct producer_context
+{
+    preprocessor_scanner* scanner;
+    const message* msg;
+    int status;
+};
+
+static void* producer_thread(void* context);
+static int file_intern(
+    preprocessor_scanner* scanner, event_copy* cpy, const char** last);
+
+/**
+ * \brief Run a pipelined \ref preprocessor_scanner.
+ *
+ * The run message is forwarded to the rest of the parser stack on a producer
+ * thread, while the calling thread scans the events that it produces.
+ *
+ * Each event copy owns a copy of its file name, which is released along with
+ * it. The position caches keep file names for longer than that, so each event
+ * is pointed at the parser's interned file name before it is scanned.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The run message to forward.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(preprocessor_scanner_pipeline_run)(
+    CPARSE_SYM(preprocessor_scanner)* scanner, const CPARSE_SYM(message)* msg)
+{
+    int retval, release_retval;
+    int consumer_status = STATUS_SUCCESS;
+    pthread_t thread;
+    producer_context producer = { scanner, msg, STATUS_SUCCESS };
+    const char* last = NULL;
+    event_copy* cpy;
+
+    /* prepare the ring for this run. */
+    event_ring_reset(scanner->ring);
+
+    /* start the producer. */
+    if (0 != pthread_create(&thread, NULL, &producer_thread, &producer))
+    {
+        return ERROR_LIBCPARSE_THREAD_CREATE;
+    }
+
+    /* scan events in order until the producer is finished. */
+    while (STATUS_SUCCESS == event_ring_pop(&cpy, scanner->ring))
+    {
+        /* once we have failed, just drain the ring. */
+        if (STATUS_SUCCESS == consumer_status)
+        {
+            consumer_status = file_intern(scanner, cpy, &last);
+            if (STATUS_SUCCESS == consumer_status)
+            {
+                consumer_status =
+                    preprocessor_scanner_event_callback(
+                        scanner, event_copy_get_event(cpy));
+            }
+
+            if (STATUS_SUCCESS != consumer_status)
+            {
+                event_ring_close(scanner->ring);
+            }
+        }
+
+        release_retval = event_copy_release(cpy);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            if (STATUS_SUCCESS == consumer_status)
+            {
+                consumer_status = release_retval;
+                event_ring_close(scanner->ring);
+            }
+        }
+    }
+
+    /* wait for the producer to exit. */
+    pthread_join(thread, NULL);
+
+    /* a consumer failure takes precedence, since it stopped the producer. */
+    if (STATUS_SUCCESS != consumer_status)
+    {
+        retval = consumer_status;
+    }
+    else
+    {
+        retval = producer.status;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Run the rest of the parser stack, then finish the ring.
+ *
+ * \param context           The producer context.
+ *
+ * \returns NULL.
+ */
+static void* producer_thread(void* context)
+{
+    producer_context* producer = (producer_context*)context;
+    preprocessor_scanner* scanner = producer->scanner;
+
+    /* run the front half of the parser stack. */
+    producer->status = message_handler_send(&scanner->parent_mh, producer->msg);
+
+    /* let the consumer know that no more events are coming. */
+    event_ring_finish(scanner->ring);
+
+    return NULL;
+}
+
+/**
+ * \brief Point the cursor of an event copy at the interned copy of its file
+ * name.
+ *
+ * The file table is thread safe, but each lookup takes its lock, so the last
+ * interned name is reused while events come from the same file.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param cpy               The event copy to update.
+ * \param last              The last interned file name, which is updated.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int file_intern(
+    preprocessor_scanner* scanner, event_copy* cpy, const char** last)
+{
+    int retval;
+    cursor* pos = &cpy->detail.event.event_cursor;
+    uint32_t file_id;
+
+    if (NULL == pos->file)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (NULL == *last || 0 != strcmp(*last, pos->file))
+    {
+        retval =
+            abstract_parser_file_intern(
+                last, &file_id, scanner->base, pos->file);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the file ID was assigned by the same table. */
+    pos->file = *last;
+
+    return STATUS_SUCCESS;
+}
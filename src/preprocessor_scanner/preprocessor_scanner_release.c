@@ -7,23 +7,37 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
+#include <libcparse/arena.h>
 #include <libcparse/event_reactor.h>
+#include <libcparse/message/raw_stack_scanner.h>
+#include <libcparse/preprocessor_scanner.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "preprocessor_scanner_internal.h"
 
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_arena;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_file_position_cache;
+CPARSE_IMPORT_intern_table;
 CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_message_raw_stack_scanner;
 CPARSE_IMPORT_newline_preserving_whitespace_filter;
+CPARSE_IMPORT_preprocessor_scanner;
 CPARSE_IMPORT_string_builder;
+CPARSE_IMPORT_util_event_ring;
+
+static int release_in_arena(preprocessor_scanner* scanner);
 
 /**
  * \brief Release a preprocessor scanner instance, releasing any internal
  * resources it may own.
  *
+ * A scanner created in an arena only releases the resources that live outside
+ * of the arena, and then releases the arena if it owns it.
+ *
  * \param scanner           The \ref preprocessor_scanner instance to release.
  *
  * \returns a status code indicating success or failure.
@@ -40,6 +54,18 @@ int CPARSE_SYM(preprocessor_scanner_release)(
     int hash_cache_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
     int builder_release_retval = STATUS_SUCCESS;
+    int ring_release_retval = STATUS_SUCCESS;
+    int intern_release_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* everything else is reclaimed with the arena. */
+    if (NULL != scanner->arena)
+    {
+        return release_in_arena(scanner);
+    }
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &scanner->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != scanner->parent)
@@ -80,6 +106,18 @@ int CPARSE_SYM(preprocessor_scanner_release)(
         builder_release_retval = string_builder_release(scanner->builder);
     }
 
+    /* release the pipeline ring if valid. */
+    if (NULL != scanner->ring)
+    {
+        ring_release_retval = event_ring_release(scanner->ring);
+    }
+
+    /* release the intern table if owned. */
+    if (NULL != scanner->intern && scanner->owns_intern)
+    {
+        intern_release_retval = intern_table_release(scanner->intern);
+    }
+
     /* dispose the parent message handler. */
     mh_dispose_retval = message_handler_dispose(&scanner->parent_mh);
 
@@ -87,7 +125,7 @@ int CPARSE_SYM(preprocessor_scanner_release)(
     memset(scanner, 0, sizeof(*scanner));
 
     /* free scanner memory. */
-    free(scanner);
+    allocator_free(&alloc, scanner);
 
     /* decode return value. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -114,8 +152,89 @@ int CPARSE_SYM(preprocessor_scanner_release)(
     {
         return builder_release_retval;
     }
+    else if (STATUS_SUCCESS != ring_release_retval)
+    {
+        return ring_release_retval;
+    }
+    else if (STATUS_SUCCESS != intern_release_retval)
+    {
+        return intern_release_retval;
+    }
     else
     {
         return mh_dispose_retval;
     }
 }
+
+/**
+ * \brief Release a preprocessor scanner created in an arena.
+ *
+ * Only the input streams on the raw stack and the pipeline ring's aligned
+ * header live outside of the arena, so these are released before the arena is
+ * released, if owned. Every other stage is reclaimed with the arena, or when
+ * the caller resets it.
+ *
+ * \param scanner           The \ref preprocessor_scanner instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int release_in_arena(preprocessor_scanner* scanner)
+{
+    int retval, release_retval;
+    int clear_retval = STATUS_SUCCESS;
+    int ring_release_retval = STATUS_SUCCESS;
+    int arena_release_retval = STATUS_SUCCESS;
+    message_rss_clear msg;
+
+    /* initialize the clear message. */
+    retval = message_rss_clear_init(&msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto release_ring;
+    }
+
+    /* release the input streams on the raw stack. */
+    clear_retval =
+        message_handler_send(
+            &scanner->parent_mh, message_rss_clear_upcast(&msg));
+
+    /* dispose the message. */
+    release_retval = message_rss_clear_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    else
+    {
+        retval = clear_retval;
+    }
+
+release_ring:
+    /* release the pipeline ring if valid. */
+    if (NULL != scanner->ring)
+    {
+        ring_release_retval = event_ring_release(scanner->ring);
+    }
+
+    /* release the arena, reclaiming everything allocated from it at once. */
+    if (scanner->owns_arena)
+    {
+        arena_release_retval = arena_release(scanner->arena);
+    }
+
+    /* decode return value. */
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+    else if (STATUS_SUCCESS != ring_release_retval)
+    {
+        return ring_release_retval;
+    }
+    else
+    {
+        return arena_release_retval;
+    }
+}
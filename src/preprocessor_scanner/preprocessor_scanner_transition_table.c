@@ -0,0 +1,1306 @@
+/**
+ * \file src/preprocessor_scanner/preprocessor_scanner_transition_table.c
+ *
+ * \brief Character class and transition tables for the preprocessor scanner.
+ *
+ * This file is generated by tools/lexer_table_gen. Do not edit it by hand;
+ * instead, update the generator and run the lexer_table target.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <stdint.h>
+
+#include "preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+/**
+ * \brief The character class of each raw character.
+ */
+const uint8_t CPARSE_SYM(preprocessor_scanner_char_class)[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 38, 41, 43,  0, 31, 32, 42, 17, 18, 29, 28, 23, 27, 26, 30,
+     1,  2,  2,  2,  2,  2,  2,  2,  3,  3, 24, 25, 39, 37, 40, 36,
+     0,  5,  5,  5,  5,  6,  8, 15, 15, 15, 15, 15,  9, 15, 15, 15,
+    13, 15, 15, 15, 15, 11, 15, 15, 12, 15, 15, 21, 44, 22, 34, 16,
+     0,  4,  4,  5,  5,  6,  7, 15, 15, 15, 15, 15,  9, 15, 14, 15,
+    13, 15, 14, 15, 14, 10, 14, 15, 12, 15, 15, 19, 33, 20, 35,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+/**
+ * \brief The token constructors referenced by the transition table.
+ */
+const preprocessor_scanner_keyword_ctor
+CPARSE_SYM(preprocessor_scanner_token_ctors)[] = {
+    /*  0 */ &event_init_for_token_left_paren,
+    /*  1 */ &event_init_for_token_right_paren,
+    /*  2 */ &event_init_for_token_left_brace,
+    /*  3 */ &event_init_for_token_right_brace,
+    /*  4 */ &event_init_for_token_left_bracket,
+    /*  5 */ &event_init_for_token_right_bracket,
+    /*  6 */ &event_init_for_token_comma,
+    /*  7 */ &event_init_for_token_colon,
+    /*  8 */ &event_init_for_token_semicolon,
+    /*  9 */ &event_init_for_token_question,
+    /* 10 */ &event_init_for_token_dot,
+    /* 11 */ &event_init_for_token_ellipsis,
+    /* 12 */ &event_init_for_token_arrow,
+    /* 13 */ &event_init_for_token_minus_equal,
+    /* 14 */ &event_init_for_token_decrement,
+    /* 15 */ &event_init_for_token_minus,
+    /* 16 */ &event_init_for_token_plus_equal,
+    /* 17 */ &event_init_for_token_increment,
+    /* 18 */ &event_init_for_token_plus,
+    /* 19 */ &event_init_for_token_times_equal,
+    /* 20 */ &event_init_for_token_star,
+    /* 21 */ &event_init_for_token_div_equal,
+    /* 22 */ &event_init_for_token_forward_slash,
+    /* 23 */ &event_init_for_token_mod_equal,
+    /* 24 */ &event_init_for_token_percent,
+    /* 25 */ &event_init_for_token_preprocessor_hash,
+    /* 26 */ &event_init_for_token_preprocessor_string_concat,
+    /* 27 */ &event_init_for_token_logical_and,
+    /* 28 */ &event_init_for_token_and_equal,
+    /* 29 */ &event_init_for_token_ampersand,
+    /* 30 */ &event_init_for_token_logical_or,
+    /* 31 */ &event_init_for_token_or_equal,
+    /* 32 */ &event_init_for_token_pipe,
+    /* 33 */ &event_init_for_token_xor_equal,
+    /* 34 */ &event_init_for_token_caret,
+    /* 35 */ &event_init_for_token_compl_equal,
+    /* 36 */ &event_init_for_token_tilde,
+    /* 37 */ &event_init_for_token_equal_compare,
+    /* 38 */ &event_init_for_token_equal_assign,
+    /* 39 */ &event_init_for_token_not_equal_compare,
+    /* 40 */ &event_init_for_token_not,
+    /* 41 */ &event_init_for_token_less_than_equal,
+    /* 42 */ &event_init_for_token_less_than,
+    /* 43 */ &event_init_for_token_left_shift_equal,
+    /* 44 */ &event_init_for_token_bitshift_left,
+    /* 45 */ &event_init_for_token_greater_than_equal,
+    /* 46 */ &event_init_for_token_greater_than,
+    /* 47 */ &event_init_for_token_right_shift_equal,
+    /* 48 */ &event_init_for_token_bitshift_right,
+};
+
+/**
+ * \brief The raw character transition table.
+ *
+ * Each entry is { action, state, token }, indexed by scanner state and by
+ * character class.
+ */
+const preprocessor_scanner_transition
+CPARSE_SYM(preprocessor_scanner_transitions)[
+    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT]
+    [CPARSE_PREPROCESSOR_SCANNER_CLASS_COUNT] = {
+    /* state 0 */
+    {
+        {  0,  0,  0 }, { 11,  0,  0 }, { 10, 19,  0 }, { 10, 19,  0 },
+        { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 },
+        { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 },
+        { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 }, { 10,  1,  0 },
+        { 10,  1,  0 }, { 26,  0,  0 }, { 26,  0,  1 }, { 26,  0,  2 },
+        { 26,  0,  3 }, { 26,  0,  4 }, { 26,  0,  5 }, { 26,  0,  6 },
+        { 13, 69,  0 }, { 26,  0,  8 }, { 13, 67,  0 }, { 13,  2,  0 },
+        { 13,  3,  0 }, { 13,  4,  0 }, { 13,  5,  0 }, { 13,  6,  0 },
+        { 13,  9,  0 }, { 13, 10,  0 }, { 13, 11,  0 }, { 13, 12,  0 },
+        { 26,  0,  9 }, { 13, 13,  0 }, { 13, 14,  0 }, { 12,  0,  0 },
+        { 13, 17,  0 }, { 10, 28,  0 }, { 10, 49,  0 }, {  6,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 1 */
+    {
+        { 21,  0,  0 }, { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 },
+        { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 },
+        { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 },
+        { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 }, { 15,  1,  0 },
+        { 15,  1,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 }, { 21,  0,  0 },
+        { 21,  0,  0 },
+    },
+    /* state 2 */
+    {
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 27,  0, 14 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 }, { 27,  0, 13 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 27,  0, 12 }, { 28,  0, 15 }, { 28,  0, 15 }, { 28,  0, 15 },
+        { 28,  0, 15 },
+    },
+    /* state 3 */
+    {
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 27,  0, 17 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 27,  0, 16 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 }, { 28,  0, 18 },
+        { 28,  0, 18 },
+    },
+    /* state 4 */
+    {
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 27,  0, 19 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 }, { 28,  0, 20 },
+        { 28,  0, 20 },
+    },
+    /* state 5 */
+    {
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 27,  0, 21 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 }, { 28,  0, 22 },
+        { 28,  0, 22 },
+    },
+    /* state 6 */
+    {
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 14,  7,  0 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 }, { 27,  0, 23 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 27,  0,  3 }, { 28,  0, 24 }, { 28,  0, 24 }, { 28,  0, 24 },
+        { 28,  0, 24 },
+    },
+    /* state 7 */
+    {
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 14,  8,  0 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 }, { 28,  0, 25 },
+        { 28,  0, 25 },
+    },
+    /* state 8 */
+    {
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        { 27,  0, 26 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 }, {  1,  0,  0 },
+        {  1,  0,  0 },
+    },
+    /* state 9 */
+    {
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 27,  0, 27 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 27,  0, 28 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 }, { 28,  0, 29 },
+        { 28,  0, 29 },
+    },
+    /* state 10 */
+    {
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 27,  0, 30 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 27,  0, 31 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 }, { 28,  0, 32 },
+        { 28,  0, 32 },
+    },
+    /* state 11 */
+    {
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 27,  0, 33 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 }, { 28,  0, 34 },
+        { 28,  0, 34 },
+    },
+    /* state 12 */
+    {
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 27,  0, 35 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 }, { 28,  0, 36 },
+        { 28,  0, 36 },
+    },
+    /* state 13 */
+    {
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 27,  0, 37 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 }, { 28,  0, 38 },
+        { 28,  0, 38 },
+    },
+    /* state 14 */
+    {
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 27,  0, 39 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 }, { 28,  0, 40 },
+        { 28,  0, 40 },
+    },
+    /* state 15 */
+    {
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 27,  0,  4 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 27,  0,  2 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 }, { 27,  0, 41 }, { 28,  0, 42 }, { 14, 16,  0 },
+        { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 }, { 28,  0, 42 },
+        { 28,  0, 42 },
+    },
+    /* state 16 */
+    {
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 27,  0, 43 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 }, { 28,  0, 44 },
+        { 28,  0, 44 },
+    },
+    /* state 17 */
+    {
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 }, { 27,  0, 45 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 14, 18,  0 }, { 28,  0, 46 }, { 28,  0, 46 }, { 28,  0, 46 },
+        { 28,  0, 46 },
+    },
+    /* state 18 */
+    {
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 27,  0, 47 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 }, { 28,  0, 48 },
+        { 28,  0, 48 },
+    },
+    /* state 19 */
+    {
+        { 24,  0,  0 }, { 15, 19,  0 }, { 15, 19,  0 }, { 15, 19,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 25,  0 }, { 15, 23,  0 }, { 15, 23,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 15, 70,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 20 */
+    {
+        { 24,  0,  0 }, { 15, 20,  0 }, { 15, 20,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 25,  0 }, { 15, 23,  0 }, { 15, 23,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 21 */
+    {
+        { 24,  0,  0 }, { 15, 20,  0 }, { 15, 20,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 25,  0 }, { 15, 23,  0 }, { 15, 23,  0 },
+        { 15, 22,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 15, 70,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 22 */
+    {
+        { 24,  0,  0 }, { 16,  0,  0 }, { 16,  0,  0 }, { 16,  0,  0 },
+        { 16,  0,  0 }, { 16,  0,  0 }, { 16,  0,  0 }, { 16,  0,  0 },
+        { 16,  0,  0 }, { 15, 25,  0 }, { 15, 23,  0 }, { 15, 23,  0 },
+        { 24,  0,  0 }, { 17, 76,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 15, 75,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 23 */
+    {
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 24,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 24 */
+    {
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 27,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 25 */
+    {
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 15, 26,  0 }, { 15, 27,  0 }, { 15, 27,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 26 */
+    {
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 15, 27,  0 }, { 15, 27,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 27 */
+    {
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 }, { 24,  0,  0 },
+        { 24,  0,  0 },
+    },
+    /* state 28 */
+    {
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 20,  0,  0 }, { 19,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 29,  0 },
+    },
+    /* state 29 */
+    {
+        {  0,  0,  0 }, { 15, 30,  0 }, { 15, 30,  0 }, {  0,  0,  0 },
+        { 15, 28,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, { 15, 28,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, { 15, 34,  0 }, { 15, 38,  0 },
+        { 15, 32,  0 }, {  0,  0,  0 }, { 15, 28,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        { 15, 28,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, {  0,  0,  0 },
+        { 15, 28,  0 },
+    },
+    /* state 30 */
+    {
+        { 15, 28,  0 }, { 15, 31,  0 }, { 15, 31,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 22,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 29,  0 },
+    },
+    /* state 31 */
+    {
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 22,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 29,  0 },
+    },
+    /* state 32 */
+    {
+        {  0,  0,  0 }, { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 },
+        { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 },
+        { 15, 33,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 33 */
+    {
+        { 15, 28,  0 }, { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 },
+        { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 }, { 15, 33,  0 },
+        { 15, 33,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 22,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 29,  0 },
+    },
+    /* state 34 */
+    {
+        {  0,  0,  0 }, { 15, 35,  0 }, { 15, 35,  0 }, { 15, 35,  0 },
+        { 15, 35,  0 }, { 15, 35,  0 }, { 15, 35,  0 }, { 15, 35,  0 },
+        { 15, 35,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 35 */
+    {
+        {  0,  0,  0 }, { 15, 36,  0 }, { 15, 36,  0 }, { 15, 36,  0 },
+        { 15, 36,  0 }, { 15, 36,  0 }, { 15, 36,  0 }, { 15, 36,  0 },
+        { 15, 36,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 36 */
+    {
+        {  0,  0,  0 }, { 15, 37,  0 }, { 15, 37,  0 }, { 15, 37,  0 },
+        { 15, 37,  0 }, { 15, 37,  0 }, { 15, 37,  0 }, { 15, 37,  0 },
+        { 15, 37,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 37 */
+    {
+        {  0,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 38 */
+    {
+        {  0,  0,  0 }, { 15, 39,  0 }, { 15, 39,  0 }, { 15, 39,  0 },
+        { 15, 39,  0 }, { 15, 39,  0 }, { 15, 39,  0 }, { 15, 39,  0 },
+        { 15, 39,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 39 */
+    {
+        {  0,  0,  0 }, { 15, 40,  0 }, { 15, 40,  0 }, { 15, 40,  0 },
+        { 15, 40,  0 }, { 15, 40,  0 }, { 15, 40,  0 }, { 15, 40,  0 },
+        { 15, 40,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 40 */
+    {
+        {  0,  0,  0 }, { 15, 41,  0 }, { 15, 41,  0 }, { 15, 41,  0 },
+        { 15, 41,  0 }, { 15, 41,  0 }, { 15, 41,  0 }, { 15, 41,  0 },
+        { 15, 41,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 41 */
+    {
+        {  0,  0,  0 }, { 15, 42,  0 }, { 15, 42,  0 }, { 15, 42,  0 },
+        { 15, 42,  0 }, { 15, 42,  0 }, { 15, 42,  0 }, { 15, 42,  0 },
+        { 15, 42,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 42 */
+    {
+        {  0,  0,  0 }, { 15, 43,  0 }, { 15, 43,  0 }, { 15, 43,  0 },
+        { 15, 43,  0 }, { 15, 43,  0 }, { 15, 43,  0 }, { 15, 43,  0 },
+        { 15, 43,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 43 */
+    {
+        {  0,  0,  0 }, { 15, 44,  0 }, { 15, 44,  0 }, { 15, 44,  0 },
+        { 15, 44,  0 }, { 15, 44,  0 }, { 15, 44,  0 }, { 15, 44,  0 },
+        { 15, 44,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 44 */
+    {
+        {  0,  0,  0 }, { 15, 45,  0 }, { 15, 45,  0 }, { 15, 45,  0 },
+        { 15, 45,  0 }, { 15, 45,  0 }, { 15, 45,  0 }, { 15, 45,  0 },
+        { 15, 45,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 45 */
+    {
+        {  0,  0,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 }, { 15, 28,  0 },
+        { 15, 28,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 46 */
+    {
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 },
+        {  4,  0,  0 }, {  4,  0,  0 }, {  4,  0,  0 }, {  5,  0,  0 },
+        {  4,  0,  0 },
+    },
+    /* state 47 */
+    {
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 },
+        {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 },
+        {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 }, {  7,  0,  0 },
+        {  7,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 },
+        {  9,  0,  0 }, {  9,  0,  0 }, {  9,  0,  0 }, {  8,  0,  0 },
+        {  9,  0,  0 },
+    },
+    /* state 48 */
+    {
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 49 */
+    {
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 23,  0,  0 }, { 15, 49,  0 },
+        { 15, 50,  0 },
+    },
+    /* state 50 */
+    {
+        {  0,  0,  0 }, { 15, 51,  0 }, { 15, 51,  0 }, {  0,  0,  0 },
+        { 15, 49,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, { 15, 49,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, { 15, 55,  0 }, { 15, 59,  0 },
+        { 15, 53,  0 }, {  0,  0,  0 }, { 15, 49,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        { 15, 49,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, {  0,  0,  0 },
+        { 15, 49,  0 },
+    },
+    /* state 51 */
+    {
+        { 15, 49,  0 }, { 15, 52,  0 }, { 15, 52,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 23,  0,  0 }, { 15, 49,  0 },
+        { 15, 50,  0 },
+    },
+    /* state 52 */
+    {
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 23,  0,  0 }, { 15, 49,  0 },
+        { 15, 50,  0 },
+    },
+    /* state 53 */
+    {
+        {  0,  0,  0 }, { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 },
+        { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 },
+        { 15, 54,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 54 */
+    {
+        { 15, 49,  0 }, { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 },
+        { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 }, { 15, 54,  0 },
+        { 15, 54,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 23,  0,  0 }, { 15, 49,  0 },
+        { 15, 50,  0 },
+    },
+    /* state 55 */
+    {
+        {  0,  0,  0 }, { 15, 56,  0 }, { 15, 56,  0 }, { 15, 56,  0 },
+        { 15, 56,  0 }, { 15, 56,  0 }, { 15, 56,  0 }, { 15, 56,  0 },
+        { 15, 56,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 56 */
+    {
+        {  0,  0,  0 }, { 15, 57,  0 }, { 15, 57,  0 }, { 15, 57,  0 },
+        { 15, 57,  0 }, { 15, 57,  0 }, { 15, 57,  0 }, { 15, 57,  0 },
+        { 15, 57,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 57 */
+    {
+        {  0,  0,  0 }, { 15, 58,  0 }, { 15, 58,  0 }, { 15, 58,  0 },
+        { 15, 58,  0 }, { 15, 58,  0 }, { 15, 58,  0 }, { 15, 58,  0 },
+        { 15, 58,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 58 */
+    {
+        {  0,  0,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 59 */
+    {
+        {  0,  0,  0 }, { 15, 60,  0 }, { 15, 60,  0 }, { 15, 60,  0 },
+        { 15, 60,  0 }, { 15, 60,  0 }, { 15, 60,  0 }, { 15, 60,  0 },
+        { 15, 60,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 60 */
+    {
+        {  0,  0,  0 }, { 15, 61,  0 }, { 15, 61,  0 }, { 15, 61,  0 },
+        { 15, 61,  0 }, { 15, 61,  0 }, { 15, 61,  0 }, { 15, 61,  0 },
+        { 15, 61,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 61 */
+    {
+        {  0,  0,  0 }, { 15, 62,  0 }, { 15, 62,  0 }, { 15, 62,  0 },
+        { 15, 62,  0 }, { 15, 62,  0 }, { 15, 62,  0 }, { 15, 62,  0 },
+        { 15, 62,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 62 */
+    {
+        {  0,  0,  0 }, { 15, 63,  0 }, { 15, 63,  0 }, { 15, 63,  0 },
+        { 15, 63,  0 }, { 15, 63,  0 }, { 15, 63,  0 }, { 15, 63,  0 },
+        { 15, 63,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 63 */
+    {
+        {  0,  0,  0 }, { 15, 64,  0 }, { 15, 64,  0 }, { 15, 64,  0 },
+        { 15, 64,  0 }, { 15, 64,  0 }, { 15, 64,  0 }, { 15, 64,  0 },
+        { 15, 64,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 64 */
+    {
+        {  0,  0,  0 }, { 15, 65,  0 }, { 15, 65,  0 }, { 15, 65,  0 },
+        { 15, 65,  0 }, { 15, 65,  0 }, { 15, 65,  0 }, { 15, 65,  0 },
+        { 15, 65,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 65 */
+    {
+        {  0,  0,  0 }, { 15, 66,  0 }, { 15, 66,  0 }, { 15, 66,  0 },
+        { 15, 66,  0 }, { 15, 66,  0 }, { 15, 66,  0 }, { 15, 66,  0 },
+        { 15, 66,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 66 */
+    {
+        {  0,  0,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 }, { 15, 49,  0 },
+        { 15, 49,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 67 */
+    {
+        { 28,  0, 10 }, { 18,  0,  0 }, { 18,  0,  0 }, { 18,  0,  0 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 14, 68,  0 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 }, { 28,  0, 10 },
+        { 28,  0, 10 },
+    },
+    /* state 68 */
+    {
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, { 27,  0, 11 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 },
+    },
+    /* state 69 */
+    {
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 27,  0,  5 }, { 28,  0,  7 }, { 28,  0,  7 }, { 28,  0,  7 },
+        { 28,  0,  7 },
+    },
+    /* state 70 */
+    {
+        { 25,  0,  0 }, { 15, 70,  0 }, { 15, 70,  0 }, { 15, 70,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 15, 71,  0 }, { 15, 74,  0 },
+        { 15, 74,  0 }, { 15, 74,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 },
+    },
+    /* state 71 */
+    {
+        {  2,  0,  0 }, { 15, 73,  0 }, { 15, 73,  0 }, { 15, 73,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, { 15, 72,  0 },
+        { 15, 72,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 },
+    },
+    /* state 72 */
+    {
+        {  2,  0,  0 }, { 15, 73,  0 }, { 15, 73,  0 }, { 15, 73,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 },
+    },
+    /* state 73 */
+    {
+        { 25,  0,  0 }, { 15, 73,  0 }, { 15, 73,  0 }, { 15, 73,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 15, 74,  0 },
+        { 15, 74,  0 }, { 15, 74,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 },
+    },
+    /* state 74 */
+    {
+        { 25,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 }, {  0,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 },
+    },
+    /* state 75 */
+    {
+        {  3,  0,  0 }, { 15, 75,  0 }, { 15, 75,  0 }, { 15, 75,  0 },
+        { 15, 75,  0 }, { 15, 75,  0 }, { 15, 75,  0 }, { 15, 75,  0 },
+        { 15, 75,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, { 15, 76,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 }, {  3,  0,  0 },
+        {  3,  0,  0 },
+    },
+    /* state 76 */
+    {
+        {  2,  0,  0 }, { 15, 78,  0 }, { 15, 78,  0 }, { 15, 78,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, { 15, 77,  0 },
+        { 15, 77,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 },
+    },
+    /* state 77 */
+    {
+        {  2,  0,  0 }, { 15, 78,  0 }, { 15, 78,  0 }, { 15, 78,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 }, {  2,  0,  0 },
+        {  2,  0,  0 },
+    },
+    /* state 78 */
+    {
+        { 25,  0,  0 }, { 15, 78,  0 }, { 15, 78,  0 }, { 15, 78,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 15, 74,  0 },
+        { 15, 74,  0 }, { 15, 74,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 }, { 25,  0,  0 },
+        { 25,  0,  0 },
+    },
+};
+
+/**
+ * \brief The run of characters that each state can consume in bulk.
+ */
+const uint8_t CPARSE_SYM(preprocessor_scanner_runs)[
+    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 3, 0, 0, 0,
+};
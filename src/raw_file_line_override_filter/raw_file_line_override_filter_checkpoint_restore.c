@@ -0,0 +1,53 @@
+/**
+ * \file
+ * src/raw_file_line_override_filter/raw_file_line_override_filter_checkpoint_restore.c
+ *
+ * \brief Restore the state of a \ref raw_file_line_override_filter from a
+ * checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/raw_file_line_override_filter.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "raw_file_line_override_filter_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_raw_file_line_override_filter;
+
+/**
+ * \brief Restore the state of a raw file/line override filter from a
+ * checkpoint.
+ *
+ * \param filter            The \ref raw_file_line_override_filter instance to
+ *                          restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(raw_file_line_override_filter_checkpoint_restore)(
+    CPARSE_SYM(raw_file_line_override_filter)* filter,
+    const CPARSE_SYM(raw_file_line_override_filter_checkpoint)* ckpt)
+{
+    int retval;
+    cursor tmp;
+
+    /* an overridden file is interned in this parser. */
+    retval = checkpoint_cursor_restore(&tmp, filter->base, &ckpt->pos);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    filter->use_pos = ckpt->use_pos;
+    memcpy(&filter->pos, &tmp, sizeof(filter->pos));
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * src/raw_file_line_override_filter/raw_file_line_override_filter_checkpoint_save.c
+ *
+ * \brief Save the state of a \ref raw_file_line_override_filter to a
+ * checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/raw_file_line_override_filter.h>
+#include <string.h>
+
+#include "raw_file_line_override_filter_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_raw_file_line_override_filter;
+
+/**
+ * \brief Save the state of a raw file/line override filter to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param filter            The \ref raw_file_line_override_filter instance to
+ *                          save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int CPARSE_SYM(raw_file_line_override_filter_checkpoint_save)(
+    CPARSE_SYM(raw_file_line_override_filter_checkpoint)* ckpt,
+    const CPARSE_SYM(raw_file_line_override_filter)* filter)
+{
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    ckpt->use_pos = filter->use_pos;
+
+    return checkpoint_cursor_save(&ckpt->pos, &filter->pos);
+}
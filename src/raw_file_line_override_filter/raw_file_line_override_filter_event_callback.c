@@ -10,9 +10,12 @@
 
 #include <libcparse/event.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/raw_file_line_override_filter.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
 #include <string.h>
 
 #include "raw_file_line_override_filter_internal.h"
@@ -20,12 +23,17 @@
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_raw_file_line_override_filter;
+CPARSE_IMPORT_raw_file_line_override_filter_internal;
+CPARSE_IMPORT_util_cursor_advance;
+CPARSE_IMPORT_util_raw_span;
 
 static int broadcast_char_event(
     raw_file_line_override_filter* filter, const event* ev);
-static void update_cursor(cursor* pos, int ch);
+static int broadcast_span_event(
+    raw_file_line_override_filter* filter, const event* ev);
 
 /**
  * \brief Event handler callback for \ref raw_file_line_override_filter.
@@ -52,6 +60,9 @@ int CPARSE_SYM(raw_file_line_override_filter_event_callback)(
         case CPARSE_EVENT_TYPE_RAW_CHARACTER:
             return broadcast_char_event(filter, ev);
 
+        case CPARSE_EVENT_TYPE_RAW_SPAN:
+            return broadcast_span_event(filter, ev);
+
         default:
             return STATUS_SUCCESS;
     }
@@ -95,10 +106,15 @@ static int broadcast_char_event(
         if (NULL == pos.file)
         {
             pos.file = ev_pos->file;
+            pos.file_id = ev_pos->file_id;
         }
 
+        /* offsets always refer to the originating input. */
+        pos.begin_offset = ev_pos->begin_offset;
+        pos.end_offset = ev_pos->end_offset;
+
         /* update our position. */
-        update_cursor(&filter->pos, ch);
+        cursor_advance_character(&filter->pos, ch);
     }
     /* use the original position. */
     else
@@ -141,24 +157,71 @@ done:
 }
 
 /**
- * \brief Update a cursor with the given character.
+ * \brief Broadcast a span event, possibly overriding the cursor position.
  *
- * \param pos               The cursor to update.
- * \param ch                The character to use to update this cursor.
+ * If any subscriber needs raw characters, then the span is broken up into
+ * character events, which are handled as above.
+ *
+ * \param filter            The filter for this operation.
+ * \param ev                The event for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
  */
-static void update_cursor(cursor* pos, int ch)
+static int broadcast_span_event(
+    raw_file_line_override_filter* filter, const event* ev)
 {
-    switch (ch)
+    int retval;
+    event_raw_span* rsev;
+    cursor pos;
+
+    /* dynamic cast the message. */
+    retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+    if (STATUS_SUCCESS != retval)
     {
-        case '\n':
-            pos->begin_line += 1;
-            pos->end_line = pos->begin_line;
-            pos->begin_col = pos->end_col = 1;
-            break;
+        return retval;
+    }
 
-        default:
-            pos->begin_col += 1;
-            pos->end_col = pos->begin_col;
-            break;
+    const char* span = event_raw_span_get(rsev);
+    size_t size = event_raw_span_size_get(rsev);
+
+    /* break up the span if a subscriber needs characters. */
+    if (!event_reactor_accepts_raw_spans(filter->reactor))
+    {
+        raw_span_start_position(&pos, ev);
+
+        return
+            raw_span_send_characters(
+                &raw_file_line_override_filter_event_callback, filter, &pos,
+                span, size);
+    }
+
+    /* without an override, the span can be passed on as is. */
+    if (!filter->use_pos)
+    {
+        return event_reactor_broadcast(filter->reactor, ev);
+    }
+
+    /* copy our override position. */
+    memcpy(&pos, &filter->pos, sizeof(pos));
+
+    /* set the file if not overridden. */
+    if (NULL == pos.file)
+    {
+        pos.file = event_get_cursor(ev)->file;
+        pos.file_id = event_get_cursor(ev)->file_id;
     }
+
+    /* offsets always refer to the originating input. */
+    pos.begin_offset = pos.end_offset = event_get_cursor(ev)->begin_offset;
+
+    /* update our position first, so an override set by a subscriber sticks. */
+    cursor_advance(&filter->pos, span, size);
+
+    /* broadcast the span at our override position. */
+    retval = raw_span_broadcast(filter->reactor, &pos, span, size);
+    memset(&pos, 0, sizeof(pos));
+
+    return retval;
 }
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <libcparse/abstract_parser_fwd.h>
+#include <libcparse/allocator.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/raw_stack_scanner.h>
 #include <libcparse/cursor.h>
@@ -33,7 +34,7 @@ struct CPARSE_SYM(raw_file_line_override_filter)
     CPARSE_SYM(message_handler) parent_mh;
     bool use_pos;
     CPARSE_SYM(cursor) pos;
-    char* file;
+    CPARSE_SYM(allocator) alloc;
 };
 
 /******************************************************************************/
@@ -8,35 +8,39 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/abstract_parser.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message.h>
+#include <libcparse/message/checkpoint.h>
 #include <libcparse/message/file_line_override.h>
 #include <libcparse/message/subscription.h>
 #include <libcparse/raw_file_line_override_filter.h>
 #include <libcparse/status_codes.h>
-#include <libcparse/string_utils.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "raw_file_line_override_filter_internal.h"
 
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_checkpoint;
 CPARSE_IMPORT_message_file_line_override;
 CPARSE_IMPORT_message_handler;
 CPARSE_IMPORT_message_subscription;
 CPARSE_IMPORT_raw_file_line_override_filter;
-CPARSE_IMPORT_string_utils;
 
 static int subscribe(raw_file_line_override_filter* filter, const message* msg);
 static int file_line_override(
     raw_file_line_override_filter* filter, const message* msg);
-static int file_set(raw_file_line_override_filter* filter, const char* file);
 
+static int checkpoint(
+    raw_file_line_override_filter* filter, const message* msg);
 /**
  * \brief Message handler callback for \ref raw_file_line_override_filter.
  *
@@ -62,6 +66,10 @@ int CPARSE_SYM(raw_file_line_override_filter_message_callback)(
         case CPARSE_MESSAGE_TYPE_RFLO_FILE_LINE_OVERRIDE:
             return file_line_override(filter, msg);
 
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE:
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE:
+            return checkpoint(filter, msg);
+
         default:
             return message_handler_send(&filter->parent_mh, msg);
     }
@@ -94,7 +102,9 @@ static int subscribe(raw_file_line_override_filter* filter, const message* msg)
     eh = message_subscribe_event_handler_get(m);
 
     /* add this handler to our reactor. */
-    retval = event_reactor_add(filter->reactor, eh);
+    retval =
+        event_reactor_add_filtered(
+            filter->reactor, eh, message_subscribe_filter_get(m));
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -143,17 +153,21 @@ static int file_line_override(
     tmp.begin_line = tmp.end_line = line;
     tmp.begin_col = tmp.end_col = 1;
 
-    /* set the file. */
-    retval = file_set(filter, file);
-    if (STATUS_SUCCESS != retval)
+    /* intern the file if set, or keep the file of each event. */
+    if (NULL != file)
     {
-        goto done;
+        retval =
+            abstract_parser_file_intern(
+                &tmp.file, &tmp.file_id, filter->base, file);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
     }
 
     /* success. */
     filter->use_pos = true;
     memcpy(&filter->pos, &tmp, sizeof(filter->pos));
-    filter->pos.file = filter->file;
     retval = STATUS_SUCCESS;
     goto done;
 
@@ -163,44 +177,54 @@ done:
 }
 
 /**
- * \brief Set the file for the override filter.
+ * \brief Save or restore the part of a checkpoint for this filter.
+ *
+ * The parent stages are saved after this filter, and restored before it.
  *
- * \param filter                The filter for this operation.
- * \param file                  The file to set.
+ * \param filter            The filter for this operation.
+ * \param msg               The message for this operation.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static int file_set(raw_file_line_override_filter* filter, const char* file)
+static int checkpoint(raw_file_line_override_filter* filter, const message* msg)
 {
-    char* tmp;
+    int retval;
+    message_checkpoint* m;
+    abstract_parser_checkpoint* ckpt;
 
-    /* duplicate the file string if set. */
-    if (NULL != file)
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_checkpoint(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
     {
-        tmp = strdup(file);
-        if (NULL == tmp)
-        {
-            return ERROR_LIBCPARSE_OUT_OF_MEMORY;
-        }
+        return retval;
     }
-    /* otherwise, the new file string is NULL. */
-    else
+
+    ckpt = message_checkpoint_get(m);
+
+    /* save our state, then pass the message on to our parent. */
+    if (CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE == message_get_type(msg))
     {
-        tmp = NULL;
+        retval =
+            raw_file_line_override_filter_checkpoint_save(
+                &ckpt->raw_file_line_override_filter, filter);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        return message_handler_send(&filter->parent_mh, msg);
     }
 
-    /* clear and free the filter file if set. */
-    if (NULL != filter->file)
+    /* restore our parent, then our state. */
+    retval = message_handler_send(&filter->parent_mh, msg);
+    if (STATUS_SUCCESS != retval)
     {
-        string_utils_string_release(filter->file);
-        filter->file = NULL;
+        return retval;
     }
 
-    /* set the filter file to our new file. */
-    filter->file = tmp;
-
-    /* success. */
-    return STATUS_SUCCESS;
+    return
+        raw_file_line_override_filter_checkpoint_restore(
+            filter, &ckpt->raw_file_line_override_filter);
 }
@@ -8,20 +8,19 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/raw_stack_scanner.h>
 #include <libcparse/status_codes.h>
-#include <libcparse/string_utils.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "raw_file_line_override_filter_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_message_handler;
 CPARSE_IMPORT_raw_stack_scanner;
-CPARSE_IMPORT_string_utils;
 
 /**
  * \brief Release a raw file/line override filter instance, releasing any
@@ -40,6 +39,10 @@ int CPARSE_SYM(raw_file_line_override_filter_release)(
     int parent_release_retval = STATUS_SUCCESS;
     int reactor_release_retval = STATUS_SUCCESS;
     int mh_dispose_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &filter->alloc, sizeof(alloc));
 
     /* release the parent if valid. */
     if (NULL != filter->parent)
@@ -56,17 +59,11 @@ int CPARSE_SYM(raw_file_line_override_filter_release)(
     /* dispose the parent message handler. */
     mh_dispose_retval = message_handler_dispose(&filter->parent_mh);
 
-    /* free the file if set. */
-    if (NULL != filter->file)
-    {
-        string_utils_string_release(filter->file);
-    }
-
     /* clear the filter. */
     memset(filter, 0, sizeof(*filter));
 
     /* free filter memory. */
-    free(filter);
+    allocator_free(&alloc, filter);
 
     /* decode return value. */
     if (STATUS_SUCCESS != parent_release_retval)
@@ -7,12 +7,15 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "raw_stack_scanner_internal.h"
 
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_raw_stack_scanner_internal;
 
 /**
@@ -20,10 +23,13 @@ CPARSE_IMPORT_raw_stack_scanner_internal;
  * name.
  *
  * \note Ownership of \p stream passes to this instance on success. The stream
- * will be released when this instance is released.
+ * will be released when this instance is released. The name is interned in the
+ * file table of the given parser, so that it outlives this instance. The
+ * instance is allocated with the allocator of the given parser.
  *
  * \param ent               Pointer to the \ref raw_stack_entry pointer to
  *                          receive this instance on success.
+ * \param ap                The parser whose file table holds the name.
  * \param stream            The input stream for this instance.
  * \param name              The name of this stream.
  *
@@ -32,14 +38,15 @@ CPARSE_IMPORT_raw_stack_scanner_internal;
  *      - a non-zero error code on failure.
  */
 int CPARSE_SYM(raw_stack_entry_create)(
-    CPARSE_SYM(raw_stack_entry)** ent, CPARSE_SYM(input_stream)* stream,
-    const char* name)
+    CPARSE_SYM(raw_stack_entry)** ent, CPARSE_SYM(abstract_parser)* ap,
+    CPARSE_SYM(input_stream)* stream, const char* name)
 {
     int retval;
     raw_stack_entry* tmp;
+    const allocator* alloc = abstract_parser_allocator_get(ap);
 
     /* allocate instance memory. */
-    tmp = (raw_stack_entry*)malloc(sizeof(*tmp));
+    tmp = (raw_stack_entry*)allocator_allocate(alloc, sizeof(*tmp));
     if (NULL == tmp)
     {
         retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
@@ -49,18 +56,25 @@ int CPARSE_SYM(raw_stack_entry_create)(
     /* clear instance memory. */
     memset(tmp, 0, sizeof(*tmp));
 
-    /* duplicate name. */
-    tmp->name = strdup(name);
-    if (NULL == tmp->name)
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* intern the name. */
+    retval =
+        abstract_parser_file_intern(
+            &tmp->pos.file, &tmp->pos.file_id, ap, name);
+    if (STATUS_SUCCESS != retval)
     {
-        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
         goto cleanup_tmp;
     }
 
     /* initialize instance. */
     tmp->next = NULL;
     tmp->stream = stream;
-    tmp->pos.file = tmp->name;
     tmp->pos.begin_line = 1;
     tmp->pos.begin_col = 1;
     tmp->pos.end_line = 1;
@@ -72,7 +86,8 @@ int CPARSE_SYM(raw_stack_entry_create)(
     goto done;
 
 cleanup_tmp:
-    free(tmp);
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
 
 done:
     return retval;
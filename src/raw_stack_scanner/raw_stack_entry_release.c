@@ -7,12 +7,13 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "raw_stack_scanner_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_input_stream;
 CPARSE_IMPORT_raw_stack_scanner_internal;
 
@@ -28,12 +29,10 @@ CPARSE_IMPORT_raw_stack_scanner_internal;
 int CPARSE_SYM(raw_stack_entry_release)(CPARSE_SYM(raw_stack_entry)* ent)
 {
     int stream_release_retval = STATUS_SUCCESS;
+    allocator alloc;
 
-    /* free name if set. */
-    if (NULL != ent->name)
-    {
-        free(ent->name);
-    }
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &ent->alloc, sizeof(alloc));
 
     /* release stream if set. */
     if (NULL != ent->stream)
@@ -45,7 +44,7 @@ int CPARSE_SYM(raw_stack_entry_release)(CPARSE_SYM(raw_stack_entry)* ent)
     memset(ent, 0, sizeof(*ent));
 
     /* free instance memory. */
-    free(ent);
+    allocator_free(&alloc, ent);
 
     /* decode return code. */
     return stream_release_retval;
@@ -0,0 +1,72 @@
+/**
+ * \file src/raw_stack_scanner/raw_stack_scanner_checkpoint_restore.c
+ *
+ * \brief Restore the position of a \ref raw_stack_scanner from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/checkpoint.h>
+#include <libcparse/raw_stack_scanner.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "raw_stack_scanner_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_raw_stack_scanner;
+CPARSE_IMPORT_raw_stack_scanner_internal;
+
+/**
+ * \brief Restore the position of a raw stack scanner from a checkpoint.
+ *
+ * The input stream on top of the stack must hold the input that follows the
+ * checkpoint offset. Its position is set to the checkpoint position, so that
+ * the events scanned from it have the same cursors as those scanned after the
+ * checkpoint was saved.
+ *
+ * \param scanner           The \ref raw_stack_scanner instance to restore.
+ * \param ckpt              The checkpoint to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_INVALID if there is no input stream, or if
+ *        characters already read from the top input stream are pending.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(raw_stack_scanner_checkpoint_restore)(
+    CPARSE_SYM(raw_stack_scanner)* scanner,
+    const CPARSE_SYM(raw_stack_scanner_checkpoint)* ckpt)
+{
+    int retval;
+    raw_stack_entry* ent = scanner->head;
+    cursor tmp;
+
+    /* pending characters would be scanned at the wrong position. */
+    if (NULL == ent || 0 != ent->pending_size)
+    {
+        return ERROR_LIBCPARSE_CHECKPOINT_INVALID;
+    }
+
+    /* intern the file in this parser, or keep the name of this stream. */
+    retval = checkpoint_cursor_restore(&tmp, &scanner->hdr, &ckpt->pos);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL == tmp.file)
+    {
+        tmp.file = ent->pos.file;
+        tmp.file_id = ent->pos.file_id;
+    }
+
+    /* offsets now refer to the input at the checkpoint. */
+    memcpy(&ent->pos, &tmp, sizeof(ent->pos));
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file src/raw_stack_scanner/raw_stack_scanner_checkpoint_save.c
+ *
+ * \brief Save the position of a \ref raw_stack_scanner to a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/checkpoint.h>
+#include <libcparse/raw_stack_scanner.h>
+#include <string.h>
+
+#include "raw_stack_scanner_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_raw_stack_scanner;
+
+/**
+ * \brief Save the position of a raw stack scanner to a checkpoint.
+ *
+ * \param ckpt              The checkpoint to populate.
+ * \param scanner           The \ref raw_stack_scanner instance to save.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG if a file name does not
+ *        fit in the checkpoint.
+ */
+int CPARSE_SYM(raw_stack_scanner_checkpoint_save)(
+    CPARSE_SYM(raw_stack_scanner_checkpoint)* ckpt,
+    const CPARSE_SYM(raw_stack_scanner)* scanner)
+{
+    const cursor* pos;
+
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    /* the top entry is positioned at its next character. */
+    if (NULL != scanner->head)
+    {
+        pos = &scanner->head->pos;
+    }
+    /* otherwise, the run is at the end of its input. */
+    else
+    {
+        pos = &scanner->running_pos;
+    }
+
+    ckpt->offset = pos->begin_offset;
+
+    return checkpoint_cursor_save(&ckpt->pos, pos);
+}
@@ -10,9 +10,12 @@
 #pragma once
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
 #include <libcparse/cursor.h>
 #include <libcparse/event_reactor_fwd.h>
 #include <libcparse/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -25,17 +28,31 @@ struct CPARSE_SYM(raw_stack_entry)
 {
     CPARSE_SYM(raw_stack_entry)* next;
     CPARSE_SYM(input_stream)* stream;
-    char* name;
     CPARSE_SYM(cursor) pos;
+    const char* pending;
+    size_t pending_size;
+    CPARSE_SYM(allocator) alloc;
 };
 
+/**
+ * \brief The name of the stream which holds fed input.
+ */
+#define CPARSE_RAW_STACK_SCANNER_FEED_NAME "(feed)"
+
 typedef struct CPARSE_SYM(raw_stack_scanner) CPARSE_SYM(raw_stack_scanner);
 
 struct CPARSE_SYM(raw_stack_scanner)
 {
     CPARSE_SYM(abstract_parser) hdr;
     CPARSE_SYM(event_reactor)* reactor;
+    CPARSE_SYM(event_reactor)* span_reactor;
     CPARSE_SYM(raw_stack_entry)* head;
+    CPARSE_SYM(input_stream)* feed;
+    bool has_subscribers;
+    bool has_span_subscribers;
+    bool running;
+    CPARSE_SYM(cursor) running_pos;
+    CPARSE_SYM(allocator) alloc;
 };
 
 /******************************************************************************/
@@ -47,10 +64,13 @@ struct CPARSE_SYM(raw_stack_scanner)
  * name.
  *
  * \note Ownership of \p stream passes to this instance on success. The stream
- * will be released when this instance is released.
+ * will be released when this instance is released. The name is interned in the
+ * file table of the given parser, so that it outlives this instance. The
+ * instance is allocated with the allocator of the given parser.
  *
  * \param ent               Pointer to the \ref raw_stack_entry pointer to
  *                          receive this instance on success.
+ * \param ap                The parser whose file table holds the name.
  * \param stream            The input stream for this instance.
  * \param name              The name of this stream.
  *
@@ -59,8 +79,8 @@ struct CPARSE_SYM(raw_stack_scanner)
  *      - a non-zero error code on failure.
  */
 int CPARSE_SYM(raw_stack_entry_create)(
-    CPARSE_SYM(raw_stack_entry)** ent, CPARSE_SYM(input_stream)* stream,
-    const char* name);
+    CPARSE_SYM(raw_stack_entry)** ent, CPARSE_SYM(abstract_parser)* ap,
+    CPARSE_SYM(input_stream)* stream, const char* name);
 
 /**
  * \brief Release a \ref raw_stack_entry instance.
@@ -98,9 +118,9 @@ int CPARSE_SYM(raw_stack_scanner_message_callback)(
     CPARSE_BEGIN_EXPORT \
     typedef CPARSE_SYM(raw_stack_entry) sym ## raw_stack_entry; \
     static inline int sym ## raw_stack_entry_create( \
-        CPARSE_SYM(raw_stack_entry)** x, CPARSE_SYM(input_stream)* y, \
-        const char* z) { \
-            return CPARSE_SYM(raw_stack_entry_create)(x,y,z); } \
+        CPARSE_SYM(raw_stack_entry)** x, CPARSE_SYM(abstract_parser)* y, \
+        CPARSE_SYM(input_stream)* z, const char* w) { \
+            return CPARSE_SYM(raw_stack_entry_create)(x,y,z,w); } \
     static inline int sym ## raw_stack_entry_release( \
         CPARSE_SYM(raw_stack_entry)* x) { \
             return CPARSE_SYM(raw_stack_entry_release)(x); } \
@@ -7,37 +7,56 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/abstract_parser.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/input_stream.h>
 #include <libcparse/message.h>
+#include <libcparse/message/checkpoint.h>
 #include <libcparse/message/raw_stack_scanner.h>
 #include <libcparse/message/subscription.h>
 #include <libcparse/raw_stack_scanner.h>
 #include <libcparse/status_codes.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
 #include <string.h>
 
 #include "raw_stack_scanner_internal.h"
 
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_input_stream;
 CPARSE_IMPORT_message;
+CPARSE_IMPORT_message_checkpoint;
 CPARSE_IMPORT_message_raw_stack_scanner;
 CPARSE_IMPORT_message_subscription;
 CPARSE_IMPORT_raw_stack_scanner;
 CPARSE_IMPORT_raw_stack_scanner_internal;
+CPARSE_IMPORT_util_cursor_advance;
+CPARSE_IMPORT_util_raw_span;
 
 static int add_input_stream(raw_stack_scanner* scanner, message* msg);
 static int subscribe(raw_stack_scanner* scanner, const message* msg);
 static int run(raw_stack_scanner* scanner, const message* msg);
-static void update_cursor(cursor* pos, int ch);
+static int step(raw_stack_scanner* scanner, const message* msg);
+static int feed(raw_stack_scanner* scanner, const message* msg);
+static int feed_stream_push(raw_stack_scanner* scanner);
+static int checkpoint(raw_stack_scanner* scanner, const message* msg);
+static int clear(raw_stack_scanner* scanner);
+static int run_until(raw_stack_scanner* scanner, const bool* yield);
+static int read_span(raw_stack_scanner* scanner, raw_stack_entry* ent);
 static int broadcast_raw_character_event(
     raw_stack_scanner* scanner, const cursor* pos, int ch);
+static int broadcast_raw_span_event(
+    raw_stack_scanner* scanner, const raw_stack_entry* ent);
 static int broadcast_eof_event(raw_stack_scanner* scanner, const cursor* pos);
 static int pop_stack(raw_stack_scanner* scanner);
 
@@ -65,9 +84,24 @@ int CPARSE_SYM(raw_stack_scanner_message_callback)(
         case CPARSE_MESSAGE_TYPE_RUN:
             return run(scanner, msg);
 
+        case CPARSE_MESSAGE_TYPE_RSS_STEP:
+            return step(scanner, msg);
+
+        case CPARSE_MESSAGE_TYPE_RSS_FEED:
+        case CPARSE_MESSAGE_TYPE_RSS_FEED_FINISH:
+            return feed(scanner, msg);
+
         case CPARSE_MESSAGE_TYPE_RSS_SUBSCRIBE:
+        case CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE:
             return subscribe(scanner, msg);
 
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE:
+        case CPARSE_MESSAGE_TYPE_CHECKPOINT_RESTORE:
+            return checkpoint(scanner, msg);
+
+        case CPARSE_MESSAGE_TYPE_RSS_CLEAR:
+            return clear(scanner);
+
         default:
             return ERROR_LIBCPARSE_UNHANDLED_MESSAGE;
     }
@@ -109,7 +143,7 @@ static int add_input_stream(raw_stack_scanner* scanner, message* msg)
     }
 
     /* create a raw stack entry. */
-    retval = raw_stack_entry_create(&ent, stream, name);
+    retval = raw_stack_entry_create(&ent, &scanner->hdr, stream, name);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_stream;
@@ -135,6 +169,9 @@ done:
 /**
  * \brief Subscribe to the raw_stack_scanner.
  *
+ * Span subscriptions are added to the span reactor, and all other
+ * subscriptions are added to the raw character reactor.
+ *
  * \param scanner           The scanner for this operation.
  * \param msg               The message for this operation.
  *
@@ -158,11 +195,31 @@ static int subscribe(raw_stack_scanner* scanner, const message* msg)
     /* get the event handler for this message. */
     eh = message_subscribe_event_handler_get(m);
 
-    /* add this handler to our reactor. */
-    retval = event_reactor_add(scanner->reactor, eh);
-    if (STATUS_SUCCESS != retval)
+    /* add this handler to the span reactor if it is a span subscription. */
+    if (CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE == message_get_type(msg))
     {
-        goto done;
+        retval =
+            event_reactor_add_filtered(
+                scanner->span_reactor, eh, message_subscribe_filter_get(m));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        scanner->has_span_subscribers = true;
+    }
+    /* otherwise, add this handler to our reactor. */
+    else
+    {
+        retval =
+            event_reactor_add_filtered(
+                scanner->reactor, eh, message_subscribe_filter_get(m));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        scanner->has_subscribers = true;
     }
 
     /* success. */
@@ -186,37 +243,314 @@ done:
 static int run(raw_stack_scanner* scanner, const message* msg)
 {
     (void)msg;
+
+    return run_until(scanner, NULL);
+}
+
+/**
+ * \brief Run the raw_stack_scanner until the step message's yield flag is set.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The message for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int step(raw_stack_scanner* scanner, const message* msg)
+{
+    int retval;
+    message_rss_step* m;
+
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_rss_step(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return run_until(scanner, message_rss_step_yield_get(m));
+}
+
+/**
+ * \brief Feed bytes to the raw_stack_scanner, or finish fed input.
+ *
+ * Fed bytes are appended to a feed stream, which is pushed onto the stack by
+ * the first feed message of a run. The scanner then runs until this stream has
+ * no more bytes, leaving every downstream state machine where it stopped, so
+ * that a token split across two feeds is completed by the second. A finish
+ * message lets the feed stream reach EOF, so the run ends as it would for a
+ * run message.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The message for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int feed(raw_stack_scanner* scanner, const message* msg)
+{
+    int retval;
+    message_rss_feed* m;
+
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_rss_feed(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* finishing a run closes its feed stream, if any. */
+    if (CPARSE_MESSAGE_TYPE_RSS_FEED_FINISH == message_get_type(msg))
+    {
+        if (NULL != scanner->feed)
+        {
+            retval = input_stream_feed_finish(scanner->feed);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        return run_until(scanner, NULL);
+    }
+
+    /* the first feed of a run pushes the feed stream. */
+    if (NULL == scanner->feed)
+    {
+        retval = feed_stream_push(scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* append these bytes to the feed stream. */
+    retval =
+        input_stream_feed(
+            scanner->feed, message_rss_feed_buffer_get(m),
+            message_rss_feed_size_get(m));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return run_until(scanner, NULL);
+}
+
+/**
+ * \brief Create a feed stream and push it onto the stack.
+ *
+ * \param scanner           The scanner for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int feed_stream_push(raw_stack_scanner* scanner)
+{
+    int retval, release_retval;
+    input_stream* stream;
+    raw_stack_entry* ent;
+
+    /* create the feed stream. */
+    retval = input_stream_create_for_feed(&stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create a raw stack entry for this stream. */
+    retval =
+        raw_stack_entry_create(
+            &ent, &scanner->hdr, stream, CPARSE_RAW_STACK_SCANNER_FEED_NAME);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    /* push this entry onto the stack; the entry owns the stream. */
+    ent->next = scanner->head;
+    scanner->head = ent;
+    scanner->feed = stream;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_stream:
+    release_retval = input_stream_release(stream);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Save or restore the part of a checkpoint for this scanner.
+ *
+ * As the last stage to receive this message, the scanner also records the
+ * offset of the checkpoint.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param msg               The message for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int checkpoint(raw_stack_scanner* scanner, const message* msg)
+{
+    int retval;
+    message_checkpoint* m;
+    abstract_parser_checkpoint* ckpt;
+
+    /* dynamic cast the message. */
+    retval = message_downcast_to_message_checkpoint(&m, (message*)msg);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ckpt = message_checkpoint_get(m);
+
+    if (CPARSE_MESSAGE_TYPE_CHECKPOINT_SAVE == message_get_type(msg))
+    {
+        retval =
+            raw_stack_scanner_checkpoint_save(
+                &ckpt->raw_stack_scanner, scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ckpt->offset = ckpt->raw_stack_scanner.offset;
+
+        return STATUS_SUCCESS;
+    }
+
+    return
+        raw_stack_scanner_checkpoint_restore(
+            scanner, &ckpt->raw_stack_scanner);
+}
+
+/**
+ * \brief Release every input stream on the stack.
+ *
+ * Every entry is released, even if releasing an earlier one fails.
+ *
+ * \param scanner           The scanner for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int clear(raw_stack_scanner* scanner)
+{
+    int retval = STATUS_SUCCESS, release_retval;
+
+    while (NULL != scanner->head)
+    {
+        release_retval = pop_stack(scanner);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Run the raw_stack_scanner until the end of input, or until the given
+ * yield flag is set.
+ *
+ * Input is read from each stream a span at a time. Span subscribers receive
+ * each span as a whole, and raw character subscribers then receive the
+ * characters of this span one at a time. Characters that have not yet been
+ * delivered remain pending on the stack entry, so an input stream pushed by a
+ * subscriber takes effect at the next character.
+ *
+ * When running without a yield flag, and every raw character subscriber has
+ * also subscribed to raw span events, the pending span is broadcast to them as
+ * a single raw span event instead. In this case, an input stream pushed by a
+ * subscriber takes effect after this span.
+ *
+ * The yield flag is checked before each character. If it is set, the running
+ * cursor is kept on the scanner and this method returns, so that the next run
+ * or step resumes from the same place. The same is true when the input stream
+ * on top of the stack has no bytes available yet.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param yield             The yield flag, or NULL to run to the end of input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int run_until(raw_stack_scanner* scanner, const bool* yield)
+{
     int retval;
-    cursor running_pos;
+    cursor* running_pos = &scanner->running_pos;
     raw_stack_entry* ent;
+    const char* span;
+    size_t span_size;
     int ch;
-    char name_cache[257];
 
-    /* initialize the running cursor. */
-    memset(&running_pos, 0, sizeof(running_pos));
-    running_pos.begin_line = running_pos.end_line = 1;
-    running_pos.begin_col = running_pos.end_col = 1;
-    running_pos.file = "(null)";
+    /* initialize the running cursor if this is a new run. */
+    if (!scanner->running)
+    {
+        memset(running_pos, 0, sizeof(*running_pos));
+        running_pos->begin_line = running_pos->end_line = 1;
+        running_pos->begin_col = running_pos->end_col = 1;
+        running_pos->file_id = CPARSE_CURSOR_FILE_ID_NONE;
+        retval =
+            abstract_parser_file_lookup(
+                &running_pos->file, &scanner->hdr, running_pos->file_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        scanner->running = true;
+    }
 
     /* iterate over all input sources. */
     while (NULL != scanner->head)
     {
+        /* stop here if asked to yield. */
+        if (NULL != yield && *yield)
+        {
+            return STATUS_SUCCESS;
+        }
+
         ent = scanner->head;
 
         /* copy the running cursor. */
-        memcpy(&running_pos, &ent->pos, sizeof(running_pos));
+        memcpy(running_pos, &ent->pos, sizeof(*running_pos));
 
-        /* read a character from the input stream. */
-        retval = input_stream_read(ent->stream, &ch);
+        /* read a span from the input stream if none is pending. */
+        if (0 == ent->pending_size)
+        {
+            retval = read_span(scanner, ent);
+        }
+        else
+        {
+            retval = STATUS_SUCCESS;
+        }
 
+        /* if this stream has run dry, wait for more input. */
+        if (ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK == retval)
+        {
+            return STATUS_SUCCESS;
+        }
         /* if we've reached EOF... */
-        if (ERROR_LIBCPARSE_INPUT_STREAM_EOF == retval)
+        else if (ERROR_LIBCPARSE_INPUT_STREAM_EOF == retval)
         {
-            /* cache the current name. */
-            strncpy(name_cache, ent->pos.file, sizeof(name_cache)-1);
-            running_pos.file = name_cache;
-
-            /* pop this entry off of the stack. */
+            /* pop this entry off of the stack. The running cursor keeps its
+             * name, which is interned by the parser. */
             retval = pop_stack(scanner);
             if (STATUS_SUCCESS != retval)
             {
@@ -232,11 +566,42 @@ static int run(raw_stack_scanner* scanner, const message* msg)
             goto done;
         }
 
+        /* skip to the next entry if this span has already been consumed. */
+        if (0 == ent->pending_size)
+        {
+            continue;
+        }
+
+        /* pass the whole span on if every subscriber can take it. */
+        if (NULL == yield && event_reactor_accepts_raw_spans(scanner->reactor))
+        {
+            span = ent->pending;
+            span_size = ent->pending_size;
+            ent->pending = NULL;
+            ent->pending_size = 0;
+
+            /* broadcast this span, moving the stream position past it. */
+            retval =
+                raw_span_broadcast(
+                    scanner->reactor, &ent->pos, span, span_size);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto done;
+            }
+
+            continue;
+        }
+
+        /* take the next pending character. */
+        ch = *ent->pending;
+        ent->pending += 1;
+        ent->pending_size -= 1;
+
         /* update the position in the stream for the next character. */
-        update_cursor(&ent->pos, ch);
+        cursor_advance_character(&ent->pos, ch);
 
         /* broadcast this raw character event. */
-        retval = broadcast_raw_character_event(scanner, &running_pos, ch);
+        retval = broadcast_raw_character_event(scanner, running_pos, ch);
         if (STATUS_SUCCESS != retval)
         {
             goto done;
@@ -244,7 +609,7 @@ static int run(raw_stack_scanner* scanner, const message* msg)
     }
 
     /* broadcast EOF. */
-    retval = broadcast_eof_event(scanner, &running_pos);
+    retval = broadcast_eof_event(scanner, running_pos);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -255,33 +620,68 @@ static int run(raw_stack_scanner* scanner, const message* msg)
     goto done;
 
 done:
-    memset(&running_pos, 0, sizeof(running_pos));
-    memset(name_cache, 0, sizeof(name_cache));
+    scanner->running = false;
+    memset(running_pos, 0, sizeof(*running_pos));
 
     return retval;
 }
 
 /**
- * \brief Update a cursor with the given character.
+ * \brief Read the next span from the given entry's input stream.
+ *
+ * If there are span subscribers, then the span is broadcast to them. If there
+ * are raw character subscribers, then the span is left pending on the entry so
+ * that its characters can be broadcast individually. Otherwise, the span is
+ * consumed here.
+ *
+ * \param scanner           The scanner for this operation.
+ * \param ent               The stack entry from which the span is read.
  *
- * \param pos               The cursor to update.
- * \param ch                The character to use to update this cursor.
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK if no bytes are available.
+ *      - ERROR_LIBCPARSE_INPUT_STREAM_EOF on EOF.
+ *      - a non-zero error code on failure.
  */
-static void update_cursor(cursor* pos, int ch)
+static int read_span(raw_stack_scanner* scanner, raw_stack_entry* ent)
 {
-    switch (ch)
+    int retval;
+
+    /* read a span from the input stream. */
+    retval =
+        input_stream_read_span(
+            ent->stream, &ent->pending, &ent->pending_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        ent->pending = NULL;
+        ent->pending_size = 0;
+        goto done;
+    }
+
+    /* broadcast this span to span subscribers. */
+    if (scanner->has_span_subscribers)
     {
-        case '\n':
-            pos->begin_line += 1;
-            pos->end_line = pos->begin_line;
-            pos->begin_col = pos->end_col = 1;
-            break;
+        retval = broadcast_raw_span_event(scanner, ent);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
 
-        default:
-            pos->begin_col += 1;
-            pos->end_col = pos->begin_col;
-            break;
+    /* if no one is listening for characters, consume the span here. */
+    if (!scanner->has_subscribers)
+    {
+        cursor_advance(&ent->pos, ent->pending, ent->pending_size);
+        ent->pending = NULL;
+        ent->pending_size = 0;
     }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
 }
 
 /**
@@ -333,7 +733,67 @@ done:
 }
 
 /**
- * \brief Broadcast an EOF event to the event reactor.
+ * \brief Broadcast the pending span of a stack entry as a raw span event to the
+ * span event reactor.
+ *
+ * \param scanner           The scanner instance for this operation.
+ * \param ent               The stack entry holding the span to broadcast.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int broadcast_raw_span_event(
+    raw_stack_scanner* scanner, const raw_stack_entry* ent)
+{
+    int retval, release_retval;
+    event_raw_span rsev;
+    cursor pos, last;
+
+    /* the span begins at the current position of this entry. */
+    memcpy(&pos, &ent->pos, sizeof(pos));
+
+    /* the span ends at its last character. */
+    memcpy(&last, &ent->pos, sizeof(last));
+    cursor_advance(&last, ent->pending, ent->pending_size - 1);
+    pos.end_line = last.begin_line;
+    pos.end_col = last.begin_col;
+    pos.end_offset = last.begin_offset;
+
+    /* create an event for this span. */
+    retval =
+        event_raw_span_init(&rsev, &pos, ent->pending, ent->pending_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* broadcast this event. */
+    retval =
+        event_reactor_broadcast(
+            scanner->span_reactor, event_raw_span_upcast(&rsev));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_rsev;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_rsev;
+
+cleanup_rsev:
+    release_retval = event_raw_span_dispose(&rsev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Broadcast an EOF event to the event reactors.
  *
  * \param scanner           The scanner instance for this operation.
  * \param pos               The cursor position for this event.
@@ -354,6 +814,13 @@ static int broadcast_eof_event(raw_stack_scanner* scanner, const cursor* pos)
         goto done;
     }
 
+    /* broadcast the EOF event to span subscribers. */
+    retval = event_reactor_broadcast(scanner->span_reactor, &ev);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_ev;
+    }
+
     /* broadcast the EOF event. */
     retval = event_reactor_broadcast(scanner->reactor, &ev);
     if (STATUS_SUCCESS != retval)
@@ -402,6 +869,12 @@ static int pop_stack(raw_stack_scanner* scanner)
     /* pop this entry off of the stack. */
     scanner->head = ent->next;
 
+    /* the feed stream is released with its entry. */
+    if (ent->stream == scanner->feed)
+    {
+        scanner->feed = NULL;
+    }
+
     /* release this entry. */
     retval = raw_stack_entry_release(ent);
     if (STATUS_SUCCESS != retval)
@@ -7,15 +7,16 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/event_reactor.h>
 #include <libcparse/raw_stack_scanner.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "raw_stack_scanner_internal.h"
 
 CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_raw_stack_scanner;
 CPARSE_IMPORT_raw_stack_scanner_internal;
@@ -34,6 +35,10 @@ int CPARSE_SYM(raw_stack_scanner_release)(
     CPARSE_SYM(raw_stack_scanner)* scanner)
 {
     int retval = STATUS_SUCCESS, release_retval = STATUS_SUCCESS;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &scanner->alloc, sizeof(alloc));
 
     /* release entries. */
     while (NULL != scanner->head)
@@ -59,6 +64,16 @@ int CPARSE_SYM(raw_stack_scanner_release)(
         }
     }
 
+    /* release span event reactor. */
+    if (NULL != scanner->span_reactor)
+    {
+        release_retval = event_reactor_release(scanner->span_reactor);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
     /* dispose abstract parser. */
     release_retval = abstract_parser_dispose(&scanner->hdr);
     if (STATUS_SUCCESS != release_retval)
@@ -70,7 +85,7 @@ int CPARSE_SYM(raw_stack_scanner_release)(
     memset(scanner, 0, sizeof(*scanner));
 
     /* free instance memory. */
-    free(scanner);
+    allocator_free(&alloc, scanner);
 
     /* decode return code. */
     return retval;
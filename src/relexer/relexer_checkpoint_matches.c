@@ -0,0 +1,167 @@
+/**
+ * \file relexer/relexer_checkpoint_matches.c
+ *
+ * \brief Compare a recorded checkpoint with a checkpoint saved after an edit.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_relexer_internal;
+
+static bool cursor_matches(
+    const checkpoint_cursor* before, const checkpoint_cursor* after,
+    const relexer_shift* shift);
+static bool stage_matches(
+    int before_state, const checkpoint_cursor* before_cache, int after_state,
+    const checkpoint_cursor* after_cache, const relexer_shift* shift);
+
+/**
+ * \brief Determine whether a recorded checkpoint, moved by an edit, matches a
+ * checkpoint saved after the edit.
+ *
+ * Every stage must be in the same state, with the same partial token, and with
+ * any cached position moved by the edit. A cached position from before the
+ * edit does not match, because the events that refer to it would not be moved
+ * in the same way as the rest.
+ *
+ * \param before            The recorded checkpoint.
+ * \param after             The checkpoint saved after the edit.
+ * \param shift             How the edit moves positions.
+ *
+ * \returns true if scanning from either checkpoint produces the same events,
+ * moved by the edit.
+ */
+bool CPARSE_SYM(relexer_checkpoint_matches)(
+    const CPARSE_SYM(abstract_parser_checkpoint)* before,
+    const CPARSE_SYM(abstract_parser_checkpoint)* after,
+    const CPARSE_SYM(relexer_shift)* shift)
+{
+    const preprocessor_scanner_checkpoint* bps = &before->preprocessor_scanner;
+    const preprocessor_scanner_checkpoint* aps = &after->preprocessor_scanner;
+
+    /* the input position must be moved by the edit. */
+    if (
+        before->offset + shift->offset != after->offset
+     || !cursor_matches(
+            &before->raw_stack_scanner.pos, &after->raw_stack_scanner.pos,
+            shift))
+    {
+        return false;
+    }
+
+    /* a line override must be the same. */
+    if (
+        before->raw_file_line_override_filter.use_pos
+            != after->raw_file_line_override_filter.use_pos
+     || (before->raw_file_line_override_filter.use_pos
+      && !cursor_matches(
+            &before->raw_file_line_override_filter.pos,
+            &after->raw_file_line_override_filter.pos, shift)))
+    {
+        return false;
+    }
+
+    /* each filter must be in the same state. */
+    if (
+        !stage_matches(
+            before->line_wrap_filter.state, &before->line_wrap_filter.cache,
+            after->line_wrap_filter.state, &after->line_wrap_filter.cache,
+            shift)
+     || !stage_matches(
+            before->comment_scanner.state, &before->comment_scanner.cache,
+            after->comment_scanner.state, &after->comment_scanner.cache,
+            shift)
+     || !stage_matches(
+            before->comment_filter.state, &before->comment_filter.cache,
+            after->comment_filter.state, &after->comment_filter.cache,
+            shift)
+     || !stage_matches(
+            before->newline_preserving_whitespace_filter.state,
+            &before->newline_preserving_whitespace_filter.cache,
+            after->newline_preserving_whitespace_filter.state,
+            &after->newline_preserving_whitespace_filter.cache, shift))
+    {
+        return false;
+    }
+
+    /* the preprocessor scanner must be in the same state. */
+    if (
+        bps->state != aps->state
+     || bps->preprocessor_state != aps->preprocessor_state
+     || bps->state_reset != aps->state_reset
+     || bps->has_hex_digit != aps->has_hex_digit
+     || !cursor_matches(&bps->cache, &aps->cache, shift)
+     || !cursor_matches(&bps->newline_cache, &aps->newline_cache, shift)
+     || !cursor_matches(&bps->hash_cache, &aps->hash_cache, shift))
+    {
+        return false;
+    }
+
+    /* with the same partial token. */
+    return
+        bps->token_size == aps->token_size
+     && 0 == memcmp(bps->token, aps->token, bps->token_size);
+}
+
+/**
+ * \brief Determine whether a recorded cursor, moved by an edit, matches a
+ * cursor saved after the edit.
+ *
+ * \param before            The recorded cursor.
+ * \param after             The cursor saved after the edit.
+ * \param shift             How the edit moves positions.
+ *
+ * \returns true if both cursors are unset, or if both are set to the same
+ * position.
+ */
+static bool cursor_matches(
+    const checkpoint_cursor* before, const checkpoint_cursor* after,
+    const relexer_shift* shift)
+{
+    cursor tmp;
+
+    /* a cursor with no file is unset. */
+    if (!before->has_file || !after->has_file)
+    {
+        return before->has_file == after->has_file;
+    }
+
+    memcpy(&tmp, &before->pos, sizeof(tmp));
+    relexer_cursor_shift(&tmp, shift);
+
+    return
+        tmp.begin_line == after->pos.begin_line
+     && tmp.begin_col == after->pos.begin_col
+     && tmp.end_line == after->pos.end_line
+     && tmp.end_col == after->pos.end_col
+     && tmp.begin_offset == after->pos.begin_offset
+     && tmp.end_offset == after->pos.end_offset;
+}
+
+/**
+ * \brief Determine whether a recorded filter state, moved by an edit, matches
+ * a filter state saved after the edit.
+ *
+ * \param before_state      The recorded state.
+ * \param before_cache      The recorded cached position.
+ * \param after_state       The state saved after the edit.
+ * \param after_cache       The cached position saved after the edit.
+ * \param shift             How the edit moves positions.
+ *
+ * \returns true if these filter states match.
+ */
+static bool stage_matches(
+    int before_state, const checkpoint_cursor* before_cache, int after_state,
+    const checkpoint_cursor* after_cache, const relexer_shift* shift)
+{
+    return
+        before_state == after_state
+     && cursor_matches(before_cache, after_cache, shift);
+}
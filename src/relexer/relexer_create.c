@@ -0,0 +1,43 @@
+/**
+ * \file relexer/relexer_create.c
+ *
+ * \brief Create a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_relexer;
+
+/**
+ * \brief Create a \ref relexer instance with an empty document.
+ *
+ * \param rl                    Pointer to the \ref relexer pointer to set to
+ *                              the created instance on success.
+ * \param name                  The file name of the document, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_create)(CPARSE_SYM(relexer)** rl, const char* name)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return relexer_create_with_allocator(rl, name, &alloc);
+}
@@ -0,0 +1,95 @@
+/**
+ * \file relexer/relexer_create_with_allocator.c
+ *
+ * \brief Create a relexer that uses a given allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_relexer;
+
+/**
+ * \brief Create a \ref relexer instance with an empty document that uses the
+ * given allocator.
+ *
+ * \param rl                    Pointer to the \ref relexer pointer to set to
+ *                              the created instance on success.
+ * \param name                  The file name of the document, which is
+ *                              copied.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_create_with_allocator)(
+    CPARSE_SYM(relexer)** rl, const char* name,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    relexer* tmp;
+    size_t name_size = strlen(name);
+
+    /* allocate memory for this instance. */
+    tmp = (relexer*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(*tmp));
+        allocator_free(alloc, tmp);
+        goto done;
+    }
+
+    /* copy the name. */
+    tmp->name = (char*)allocator_allocate(alloc, name_size + 1);
+    if (NULL == tmp->name)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    memcpy(tmp->name, name, name_size + 1);
+
+    /* every scan shares this table, so identifiers keep their symbols. */
+    retval = intern_table_create_with_allocator(&tmp->intern, false, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *rl = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    release_retval = relexer_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
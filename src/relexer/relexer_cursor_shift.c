@@ -0,0 +1,28 @@
+/**
+ * \file relexer/relexer_cursor_shift.c
+ *
+ * \brief Move a cursor by an edit.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "relexer_internal.h"
+
+/**
+ * \brief Move a cursor by an edit.
+ *
+ * Columns are not moved. A relexer only keeps events after a checkpoint whose
+ * columns were unchanged by the edit.
+ *
+ * \param pos               The cursor to move.
+ * \param shift             How the edit moves positions.
+ */
+void CPARSE_SYM(relexer_cursor_shift)(
+    CPARSE_SYM(cursor)* pos, const CPARSE_SYM(relexer_shift)* shift)
+{
+    pos->begin_line += shift->line;
+    pos->end_line += shift->line;
+    pos->begin_offset += shift->offset;
+    pos->end_offset += shift->offset;
+}
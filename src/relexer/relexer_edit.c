@@ -0,0 +1,432 @@
+/**
+ * \file relexer/relexer_edit.c
+ *
+ * \brief Apply an edit to the document of a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/status_codes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../event_copy/event_copy_internal.h"
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_relexer;
+CPARSE_IMPORT_relexer_internal;
+
+static unsigned int count_lines(const char* text, size_t size);
+static size_t checkpoint_first(const relexer* rl, size_t offset);
+static int report(
+    relexer* rl, size_t removed_begin, size_t removed_end, size_t added_begin,
+    size_t added_end, event_handler* removed, event_handler* added);
+static void checkpoint_shift(
+    relexer_checkpoint* ckpt, const relexer_shift* shift, size_t events);
+
+/**
+ * \brief Replace a range of the document of a \ref relexer, and re-scan the
+ * region that this edit affects.
+ *
+ * Scanning restarts from the last checkpoint at or before the edit, and stops
+ * at the first checkpoint after the edit that the scanner reaches in the same
+ * state, or at EOF. The events scanned in between replace the recorded events
+ * in between. Scanned events that match the recorded events at either end of
+ * this range are the same events, so they are not reported.
+ *
+ * \param rl                    The \ref relexer for this operation.
+ * \param offset                The byte offset of the edit.
+ * \param removed_size          The number of bytes removed at \p offset.
+ * \param inserted              The bytes inserted at \p offset, which are
+ *                              copied.
+ * \param inserted_size         The number of bytes inserted at \p offset.
+ * \param removed               The handler for removed events, or NULL.
+ * \param added                 The handler for added events, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_RELEXER_BAD_EDIT if the removed range is not within
+ *        the document.
+ *      - a non-zero error code from scanning or from a handler.
+ */
+int CPARSE_SYM(relexer_edit)(
+    CPARSE_SYM(relexer)* rl, size_t offset, size_t removed_size,
+    const void* inserted, size_t inserted_size,
+    CPARSE_SYM(event_handler)* removed, CPARSE_SYM(event_handler)* added)
+{
+    int retval, release_retval;
+    relexer_shift shift;
+    const relexer_checkpoint* start;
+    char* text;
+    size_t size, first, resync, begin, end, count, prefix, suffix, tail;
+
+    /* the removed range must be within the document. */
+    if (offset > rl->text_size || removed_size > rl->text_size - offset)
+    {
+        return ERROR_LIBCPARSE_RELEXER_BAD_EDIT;
+    }
+
+    size = rl->text_size - removed_size;
+    if (inserted_size > SIZE_MAX - size - 1)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    size += inserted_size;
+
+    /* build the edited document. */
+    text = (char*)allocator_allocate(&rl->alloc, size + 1);
+    if (NULL == text)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    if (offset > 0)
+    {
+        memcpy(text, rl->text, offset);
+    }
+
+    if (inserted_size > 0)
+    {
+        memcpy(text + offset, inserted, inserted_size);
+    }
+
+    if (size > offset + inserted_size)
+    {
+        memcpy(
+            text + offset + inserted_size, rl->text + offset + removed_size,
+            size - offset - inserted_size);
+    }
+
+    /* describe how this edit moves the positions that follow it. */
+    shift.edit_end = offset + inserted_size;
+    shift.offset = inserted_size - removed_size;
+    shift.line =
+        count_lines((const char*)inserted, inserted_size)
+            - count_lines(rl->text + offset, removed_size);
+
+    /* restart from the last checkpoint at or before the edit. */
+    first = checkpoint_first(rl, offset);
+    start = (first > 0) ? &rl->checkpoints[first - 1] : NULL;
+    begin = (NULL != start) ? start->event_index : 0;
+    shift.first = first;
+
+    /* scan until back in step with the recorded events. */
+    retval = relexer_run(&resync, rl, start, &shift, text, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanned;
+    }
+
+    /* the scanned events replace the recorded events up to the resync. */
+    end =
+        (resync < rl->checkpoint_count)
+            ? rl->checkpoints[resync].event_index : rl->event_count;
+    count = rl->event_count - (end - begin) + rl->scanned_count;
+
+    /* skip the events that are the same at the start of this range. */
+    prefix = 0;
+    while (
+        prefix < rl->scanned_count
+     && begin + prefix < end
+     && relexer_event_equal(
+            event_copy_get_event(rl->events[begin + prefix]), rl->text,
+            rl->text_size, event_copy_get_event(rl->scanned[prefix]), text,
+            size, NULL))
+    {
+        ++prefix;
+    }
+
+    /* skip the events that are the same at the end of this range. */
+    suffix = 0;
+    while (
+        prefix + suffix < rl->scanned_count
+     && begin + prefix + suffix < end
+     && relexer_event_equal(
+            event_copy_get_event(rl->events[end - 1 - suffix]), rl->text,
+            rl->text_size,
+            event_copy_get_event(rl->scanned[rl->scanned_count - 1 - suffix]),
+            text, size, &shift))
+    {
+        ++suffix;
+    }
+
+    /* make room for the spliced events and checkpoints. */
+    retval =
+        relexer_reserve(
+            (void**)&rl->events, &rl->event_capacity, count,
+            sizeof(*rl->events), &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanned;
+    }
+
+    tail = rl->checkpoint_count - resync;
+    retval =
+        relexer_reserve(
+            (void**)&rl->checkpoints, &rl->checkpoint_capacity,
+            first + rl->saved_count + tail, sizeof(*rl->checkpoints),
+            &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanned;
+    }
+
+    /* report the events that changed. */
+    retval =
+        report(
+            rl, begin + prefix, end - suffix, prefix,
+            rl->scanned_count - suffix, removed, added);
+
+    /* release the removed events, and the scanned copies of kept events. */
+    for (size_t i = begin + prefix; i < end - suffix; ++i)
+    {
+        release_retval = event_copy_release(rl->events[i]);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = relexer_scanned_release(rl, 0, prefix);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval =
+        relexer_scanned_release(
+            rl, rl->scanned_count - suffix, rl->scanned_count);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* move the kept events that follow the edit. */
+    if (0 != shift.offset || 0 != shift.line)
+    {
+        for (size_t i = end - suffix; i < rl->event_count; ++i)
+        {
+            relexer_cursor_shift(
+                &rl->events[i]->detail.event.event_cursor, &shift);
+        }
+    }
+
+    /* splice the scanned events in place of the removed events. */
+    if (rl->event_count > end - suffix)
+    {
+        memmove(
+            rl->events + begin + rl->scanned_count - suffix,
+            rl->events + end - suffix,
+            (rl->event_count - end + suffix) * sizeof(*rl->events));
+    }
+
+    if (rl->scanned_count > prefix + suffix)
+    {
+        memcpy(
+            rl->events + begin + prefix, rl->scanned + prefix,
+            (rl->scanned_count - prefix - suffix) * sizeof(*rl->events));
+    }
+    rl->event_count = count;
+
+    /* splice the saved checkpoints in place of the replaced checkpoints. */
+    for (size_t i = resync; i < rl->checkpoint_count; ++i)
+    {
+        checkpoint_shift(
+            &rl->checkpoints[i], &shift,
+            rl->scanned_count - (end - begin));
+    }
+
+    if (tail > 0)
+    {
+        memmove(
+            rl->checkpoints + first + rl->saved_count,
+            rl->checkpoints + resync, tail * sizeof(*rl->checkpoints));
+    }
+
+    if (rl->saved_count > 0)
+    {
+        memcpy(
+            rl->checkpoints + first, rl->saved,
+            rl->saved_count * sizeof(*rl->checkpoints));
+    }
+    rl->checkpoint_count = first + rl->saved_count + tail;
+    rl->scanned_count = 0;
+    rl->saved_count = 0;
+
+    /* the edited document replaces the document. */
+    if (NULL != rl->text)
+    {
+        allocator_free(&rl->alloc, rl->text);
+    }
+
+    rl->text = text;
+    rl->text_size = size;
+
+    return retval;
+
+cleanup_scanned:
+    release_retval = relexer_scanned_release(rl, 0, rl->scanned_count);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    rl->scanned_count = 0;
+    rl->saved_count = 0;
+    allocator_free(&rl->alloc, text);
+
+    return retval;
+}
+
+/**
+ * \brief Count the line breaks in a span of text.
+ *
+ * \param text              The text to search.
+ * \param size              The size of the text.
+ *
+ * \returns the number of line breaks.
+ */
+static unsigned int count_lines(const char* text, size_t size)
+{
+    unsigned int lines = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if ('\n' == text[i])
+        {
+            ++lines;
+        }
+    }
+
+    return lines;
+}
+
+/**
+ * \brief Count the recorded checkpoints at or before an offset.
+ *
+ * \param rl                The relexer to search.
+ * \param offset            The offset of the edit.
+ *
+ * \returns the number of checkpoints that the edit does not affect.
+ */
+static size_t checkpoint_first(const relexer* rl, size_t offset)
+{
+    size_t lo = 0, hi = rl->checkpoint_count;
+
+    /* checkpoints are ordered by offset. */
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (rl->checkpoints[mid].ckpt.offset <= offset)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * \brief Report the removed events, and then the added events.
+ *
+ * \param rl                The relexer for this operation.
+ * \param removed_begin     The index of the first removed event.
+ * \param removed_end       The index past the last removed event.
+ * \param added_begin       The index of the first added scanned event.
+ * \param added_end         The index past the last added scanned event.
+ * \param removed           The handler for removed events, or NULL.
+ * \param added             The handler for added events, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from a handler.
+ */
+static int report(
+    relexer* rl, size_t removed_begin, size_t removed_end, size_t added_begin,
+    size_t added_end, event_handler* removed, event_handler* added)
+{
+    int retval;
+
+    if (NULL != removed)
+    {
+        for (size_t i = removed_begin; i < removed_end; ++i)
+        {
+            retval =
+                event_handler_send(
+                    removed, event_copy_get_event(rl->events[i]));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    if (NULL != added)
+    {
+        for (size_t i = added_begin; i < added_end; ++i)
+        {
+            retval =
+                event_handler_send(
+                    added, event_copy_get_event(rl->scanned[i]));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Move a recorded checkpoint that follows an edit.
+ *
+ * \param ckpt              The checkpoint to move.
+ * \param shift             How the edit moves positions.
+ * \param events            The change in the number of events before this
+ *                          checkpoint, with unsigned wraparound.
+ */
+static void checkpoint_shift(
+    relexer_checkpoint* ckpt, const relexer_shift* shift, size_t events)
+{
+    abstract_parser_checkpoint* c = &ckpt->ckpt;
+    checkpoint_cursor* cursors[] = {
+        &c->raw_stack_scanner.pos,
+        &c->raw_file_line_override_filter.pos,
+        &c->line_wrap_filter.cache,
+        &c->comment_scanner.cache,
+        &c->comment_filter.cache,
+        &c->newline_preserving_whitespace_filter.cache,
+        &c->preprocessor_scanner.cache,
+        &c->preprocessor_scanner.newline_cache,
+        &c->preprocessor_scanner.hash_cache,
+    };
+
+    ckpt->event_index += events;
+    c->offset += shift->offset;
+    c->raw_stack_scanner.offset += shift->offset;
+
+    /* only set cursors are moved, so that unset cursors stay unset. */
+    for (size_t i = 0; i < sizeof(cursors) / sizeof(cursors[0]); ++i)
+    {
+        if (cursors[i]->has_file)
+        {
+            relexer_cursor_shift(&cursors[i]->pos, shift);
+        }
+    }
+}
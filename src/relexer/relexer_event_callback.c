@@ -0,0 +1,73 @@
+/**
+ * \file relexer/relexer_event_callback.c
+ *
+ * \brief Record each event scanned by a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/event_type.h>
+#include <libcparse/status_codes.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_relexer;
+CPARSE_IMPORT_relexer_internal;
+
+/**
+ * \brief Event handler callback that records each event scanned by a relexer,
+ * and asks the raw stack scanner to yield.
+ *
+ * Yielding after each event lets the relexer save checkpoints between events,
+ * and stop scanning as soon as it is back in step with the recorded events.
+ *
+ * \param context           The context for this handler (the relexer).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    int retval;
+    relexer* rl = (relexer*)context;
+
+    /* make room for this event. */
+    retval =
+        relexer_reserve(
+            (void**)&rl->scanned, &rl->scanned_capacity,
+            rl->scanned_count + 1, sizeof(*rl->scanned), &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* copy this event. */
+    retval =
+        event_copy_create_with_allocator(
+            &rl->scanned[rl->scanned_count], ev, &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ++rl->scanned_count;
+
+    /* the EOF event is the last event of this scan. */
+    if (CPARSE_EVENT_TYPE_EOF == event_get_type(ev))
+    {
+        rl->eof = true;
+    }
+
+    /* ask the raw stack scanner to yield. */
+    rl->yield = true;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file relexer/relexer_event_count_get.c
+ *
+ * \brief Get the number of events recorded by a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "relexer_internal.h"
+
+/**
+ * \brief Get the number of events recorded for the document of a
+ * \ref relexer.
+ *
+ * \param rl                    The \ref relexer to query.
+ *
+ * \returns the number of events, including the EOF event once the document
+ * has been scanned.
+ */
+size_t CPARSE_SYM(relexer_event_count_get)(const CPARSE_SYM(relexer)* rl)
+{
+    return rl->event_count;
+}
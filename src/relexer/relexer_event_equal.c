@@ -0,0 +1,118 @@
+/**
+ * \file relexer/relexer_event_equal.c
+ *
+ * \brief Compare a recorded event with an event scanned after an edit.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <string.h>
+
+#include "../event/event_internal.h"
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_relexer_internal;
+
+static size_t span_size(const cursor* pos, size_t size);
+
+/**
+ * \brief Determine whether an event recorded before an edit is the same as an
+ * event scanned after the edit.
+ *
+ * The scanner derives every value of an event from the bytes that it covers,
+ * so events of the same type and category that cover the same bytes at the
+ * same position are the same.
+ *
+ * \param before            The recorded event.
+ * \param before_text       The document before the edit.
+ * \param before_size       The size of the document before the edit.
+ * \param after             The scanned event.
+ * \param after_text        The document after the edit.
+ * \param after_size        The size of the document after the edit.
+ * \param shift             How the edit moves the recorded event, or NULL if
+ *                          it is not moved.
+ *
+ * \returns true if these events are the same.
+ */
+bool CPARSE_SYM(relexer_event_equal)(
+    const CPARSE_SYM(event)* before, const char* before_text,
+    size_t before_size, const CPARSE_SYM(event)* after,
+    const char* after_text, size_t after_size,
+    const CPARSE_SYM(relexer_shift)* shift)
+{
+    const cursor* after_pos = event_get_cursor(after);
+    cursor before_pos;
+    size_t size;
+
+    if (
+        event_get_type(before) != event_get_type(after)
+     || event_get_category(before) != event_get_category(after))
+    {
+        return false;
+    }
+
+    /* compare the positions, moving the recorded event if needed. */
+    memcpy(&before_pos, event_get_cursor(before), sizeof(before_pos));
+    if (NULL != shift)
+    {
+        relexer_cursor_shift(&before_pos, shift);
+    }
+
+    if (
+        before_pos.begin_line != after_pos->begin_line
+     || before_pos.begin_col != after_pos->begin_col
+     || before_pos.end_line != after_pos->end_line
+     || before_pos.end_col != after_pos->end_col
+     || before_pos.begin_offset != after_pos->begin_offset
+     || before_pos.end_offset != after_pos->end_offset)
+    {
+        return false;
+    }
+
+    /* compare the bytes covered by each event. */
+    memcpy(&before_pos, event_get_cursor(before), sizeof(before_pos));
+    size = span_size(&before_pos, before_size);
+    if (size != span_size(after_pos, after_size))
+    {
+        return false;
+    }
+
+    return
+        0 == size
+     || 0
+            == memcmp(
+                before_text + before_pos.begin_offset,
+                after_text + after_pos->begin_offset, size);
+}
+
+/**
+ * \brief Get the number of bytes of a document covered by a cursor.
+ *
+ * An event at the end of the document, such as EOF, covers no bytes.
+ *
+ * \param pos               The cursor.
+ * \param size              The size of the document.
+ *
+ * \returns the number of bytes covered.
+ */
+static size_t span_size(const cursor* pos, size_t size)
+{
+    size_t end = pos->end_offset + 1;
+
+    if (pos->begin_offset >= size || pos->end_offset < pos->begin_offset)
+    {
+        return 0;
+    }
+
+    if (end > size)
+    {
+        end = size;
+    }
+
+    return end - pos->begin_offset;
+}
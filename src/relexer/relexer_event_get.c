@@ -0,0 +1,29 @@
+/**
+ * \file relexer/relexer_event_get.c
+ *
+ * \brief Get an event recorded by a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_copy.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_event_copy;
+
+/**
+ * \brief Get an event recorded for the document of a \ref relexer.
+ *
+ * \param rl                    The \ref relexer to query.
+ * \param index                 The index of the event, which must be less than
+ *                              the event count.
+ *
+ * \returns the event at this index.
+ */
+const CPARSE_SYM(event)* CPARSE_SYM(relexer_event_get)(
+    const CPARSE_SYM(relexer)* rl, size_t index)
+{
+    return event_copy_get_event(rl->events[index]);
+}
@@ -0,0 +1,273 @@
+/**
+ * \file relexer/relexer_internal.h
+ *
+ * \brief Internal declarations and definitions for the relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator/detail.h>
+#include <libcparse/checkpoint.h>
+#include <libcparse/cursor.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/relexer.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The number of events between two checkpoints.
+ *
+ * An edit re-scans at least the events between the checkpoints on either side
+ * of it, so this trades the memory used by checkpoints against the work done
+ * for each edit.
+ */
+#define CPARSE_RELEXER_CHECKPOINT_INTERVAL 64
+
+/**
+ * \brief The number of bytes of the document fed to the scanner at a time.
+ *
+ * The document is fed lazily, so that a re-scan that stops early does not copy
+ * the rest of the document into its input stream.
+ */
+#define CPARSE_RELEXER_FEED_SIZE 4096
+
+typedef struct CPARSE_SYM(relexer_checkpoint) CPARSE_SYM(relexer_checkpoint);
+
+/**
+ * \brief A checkpoint, along with the number of events recorded before it.
+ */
+struct CPARSE_SYM(relexer_checkpoint)
+{
+    size_t event_index;
+    CPARSE_SYM(abstract_parser_checkpoint) ckpt;
+};
+
+typedef struct CPARSE_SYM(relexer_shift) CPARSE_SYM(relexer_shift);
+
+/**
+ * \brief How an edit moves the events and checkpoints that follow it.
+ *
+ * The shifts are added with unsigned wraparound, so they also move positions
+ * backward when the edit removes more than it inserts.
+ */
+struct CPARSE_SYM(relexer_shift)
+{
+    /* the offset in the new document just past the inserted bytes. */
+    size_t edit_end;
+
+    /* the shift added to each offset. */
+    size_t offset;
+
+    /* the shift added to each line number. */
+    unsigned int line;
+
+    /* the first recorded checkpoint at which a re-scan may stop. */
+    size_t first;
+};
+
+struct CPARSE_SYM(relexer)
+{
+    char* name;
+    char* text;
+    size_t text_size;
+    CPARSE_SYM(event_copy)** events;
+    size_t event_count;
+    size_t event_capacity;
+    CPARSE_SYM(relexer_checkpoint)* checkpoints;
+    size_t checkpoint_count;
+    size_t checkpoint_capacity;
+    CPARSE_SYM(event_copy)** scanned;
+    size_t scanned_count;
+    size_t scanned_capacity;
+    CPARSE_SYM(relexer_checkpoint)* saved;
+    size_t saved_count;
+    size_t saved_capacity;
+    bool yield;
+    bool eof;
+    CPARSE_SYM(intern_table)* intern;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Make room for at least the given number of elements in an array.
+ *
+ * \param array             Pointer to the array, which is updated if it is
+ *                          reallocated.
+ * \param capacity          Pointer to the capacity of the array, in elements.
+ * \param count             The number of elements needed.
+ * \param elem_size         The size of each element.
+ * \param alloc             The allocator for the array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_OUT_OF_MEMORY if the array could not be grown.
+ */
+int CPARSE_SYM(relexer_reserve)(
+    void** array, size_t* capacity, size_t count, size_t elem_size,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Scan a document, starting from a checkpoint, into the scanned events
+ * and saved checkpoints of a relexer.
+ *
+ * When \p shift is not NULL, scanning stops at the first recorded checkpoint
+ * at or after \p shift->first that the scanner reaches in the same state, as
+ * moved by \p shift. Otherwise, the whole document is scanned.
+ *
+ * \param resync            Pointer to receive the index of the recorded
+ *                          checkpoint at which scanning stopped, or the
+ *                          checkpoint count if scanning reached EOF.
+ * \param rl                The relexer for this operation.
+ * \param start             The checkpoint from which to scan, or NULL to scan
+ *                          from the start of the document.
+ * \param shift             How the edit moved the recorded checkpoints, or
+ *                          NULL.
+ * \param text              The document.
+ * \param size              The size of the document.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_run)(
+    size_t* resync, CPARSE_SYM(relexer)* rl,
+    const CPARSE_SYM(relexer_checkpoint)* start,
+    const CPARSE_SYM(relexer_shift)* shift, const char* text, size_t size);
+
+/**
+ * \brief Move a cursor by an edit.
+ *
+ * \param pos               The cursor to move.
+ * \param shift             How the edit moves positions.
+ */
+void CPARSE_SYM(relexer_cursor_shift)(
+    CPARSE_SYM(cursor)* pos, const CPARSE_SYM(relexer_shift)* shift);
+
+/**
+ * \brief Determine whether a recorded checkpoint, moved by an edit, matches a
+ * checkpoint saved after the edit.
+ *
+ * \param before            The recorded checkpoint.
+ * \param after             The checkpoint saved after the edit.
+ * \param shift             How the edit moves positions.
+ *
+ * \returns true if scanning from either checkpoint produces the same events,
+ * moved by the edit.
+ */
+bool CPARSE_SYM(relexer_checkpoint_matches)(
+    const CPARSE_SYM(abstract_parser_checkpoint)* before,
+    const CPARSE_SYM(abstract_parser_checkpoint)* after,
+    const CPARSE_SYM(relexer_shift)* shift);
+
+/**
+ * \brief Determine whether an event recorded before an edit is the same as an
+ * event scanned after the edit.
+ *
+ * Events are the same if they have the same type and category, their cursors
+ * match, and they cover the same bytes.
+ *
+ * \param before            The recorded event.
+ * \param before_text       The document before the edit.
+ * \param before_size       The size of the document before the edit.
+ * \param after             The scanned event.
+ * \param after_text        The document after the edit.
+ * \param after_size        The size of the document after the edit.
+ * \param shift             How the edit moves the recorded event, or NULL if
+ *                          it is not moved.
+ *
+ * \returns true if these events are the same.
+ */
+bool CPARSE_SYM(relexer_event_equal)(
+    const CPARSE_SYM(event)* before, const char* before_text,
+    size_t before_size, const CPARSE_SYM(event)* after,
+    const char* after_text, size_t after_size,
+    const CPARSE_SYM(relexer_shift)* shift);
+
+/**
+ * \brief Release the scanned events of a relexer that have not been kept.
+ *
+ * \param rl                The relexer for this operation.
+ * \param begin             The index of the first scanned event to release.
+ * \param end               The index past the last scanned event to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_scanned_release)(
+    CPARSE_SYM(relexer)* rl, size_t begin, size_t end);
+
+/**
+ * \brief Event handler callback that records each event scanned by a relexer,
+ * and asks the raw stack scanner to yield.
+ *
+ * \param context           The context for this handler (the relexer).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_relexer_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(relexer_checkpoint) sym ## relexer_checkpoint; \
+    typedef CPARSE_SYM(relexer_shift) sym ## relexer_shift; \
+    static inline int sym ## relexer_reserve( \
+        void** v, size_t* w, size_t x, size_t y, \
+        const CPARSE_SYM(allocator)* z) { \
+            return CPARSE_SYM(relexer_reserve)(v,w,x,y,z); } \
+    static inline int sym ## relexer_run( \
+        size_t* u, CPARSE_SYM(relexer)* v, \
+        const CPARSE_SYM(relexer_checkpoint)* w, \
+        const CPARSE_SYM(relexer_shift)* x, const char* y, size_t z) { \
+            return CPARSE_SYM(relexer_run)(u,v,w,x,y,z); } \
+    static inline void sym ## relexer_cursor_shift( \
+        CPARSE_SYM(cursor)* x, const CPARSE_SYM(relexer_shift)* y) { \
+            CPARSE_SYM(relexer_cursor_shift)(x,y); } \
+    static inline bool sym ## relexer_checkpoint_matches( \
+        const CPARSE_SYM(abstract_parser_checkpoint)* x, \
+        const CPARSE_SYM(abstract_parser_checkpoint)* y, \
+        const CPARSE_SYM(relexer_shift)* z) { \
+            return CPARSE_SYM(relexer_checkpoint_matches)(x,y,z); } \
+    static inline bool sym ## relexer_event_equal( \
+        const CPARSE_SYM(event)* t, const char* u, size_t v, \
+        const CPARSE_SYM(event)* w, const char* x, size_t y, \
+        const CPARSE_SYM(relexer_shift)* z) { \
+            return CPARSE_SYM(relexer_event_equal)(t,u,v,w,x,y,z); } \
+    static inline int sym ## relexer_scanned_release( \
+        CPARSE_SYM(relexer)* x, size_t y, size_t z) { \
+            return CPARSE_SYM(relexer_scanned_release)(x,y,z); } \
+    static inline int sym ## relexer_event_callback( \
+        void* x, const CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(relexer_event_callback)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_relexer_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_relexer_internal_sym(sym ## _)
+#define CPARSE_IMPORT_relexer_internal \
+    __INTERNAL_CPARSE_IMPORT_relexer_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,105 @@
+/**
+ * \file relexer/relexer_release.c
+ *
+ * \brief Release a relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_relexer;
+CPARSE_IMPORT_relexer_internal;
+
+/**
+ * \brief Release a \ref relexer instance, along with its document and events.
+ *
+ * \param rl                    The \ref relexer instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_release)(CPARSE_SYM(relexer)* rl)
+{
+    int retval = STATUS_SUCCESS, release_retval;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &rl->alloc, sizeof(alloc));
+
+    /* release the recorded events. */
+    for (size_t i = 0; i < rl->event_count; ++i)
+    {
+        release_retval = event_copy_release(rl->events[i]);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* release any scanned events. */
+    release_retval = relexer_scanned_release(rl, 0, rl->scanned_count);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* release the arrays. */
+    if (NULL != rl->events)
+    {
+        allocator_free(&alloc, rl->events);
+    }
+
+    if (NULL != rl->scanned)
+    {
+        allocator_free(&alloc, rl->scanned);
+    }
+
+    if (NULL != rl->checkpoints)
+    {
+        allocator_free(&alloc, rl->checkpoints);
+    }
+
+    if (NULL != rl->saved)
+    {
+        allocator_free(&alloc, rl->saved);
+    }
+
+    /* release the document and its name. */
+    if (NULL != rl->text)
+    {
+        allocator_free(&alloc, rl->text);
+    }
+
+    if (NULL != rl->name)
+    {
+        allocator_free(&alloc, rl->name);
+    }
+
+    /* release the intern table. */
+    if (NULL != rl->intern)
+    {
+        release_retval = intern_table_release(rl->intern);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* clear and free this instance. */
+    memset(rl, 0, sizeof(*rl));
+    allocator_free(&alloc, rl);
+
+    return retval;
+}
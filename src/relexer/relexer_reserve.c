@@ -0,0 +1,80 @@
+/**
+ * \file relexer/relexer_reserve.c
+ *
+ * \brief Make room for elements in a relexer array.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdint.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_relexer_internal;
+
+/**
+ * \brief The capacity of a new array, in elements.
+ */
+#define INITIAL_CAPACITY 64
+
+/**
+ * \brief Make room for at least the given number of elements in an array.
+ *
+ * The capacity is doubled until it is large enough, so that appending one
+ * element at a time takes amortized constant time.
+ *
+ * \param array             Pointer to the array, which is updated if it is
+ *                          reallocated.
+ * \param capacity          Pointer to the capacity of the array, in elements.
+ * \param count             The number of elements needed.
+ * \param elem_size         The size of each element.
+ * \param alloc             The allocator for the array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_OUT_OF_MEMORY if the array could not be grown.
+ */
+int CPARSE_SYM(relexer_reserve)(
+    void** array, size_t* capacity, size_t count, size_t elem_size,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    size_t new_capacity = *capacity;
+    void* tmp;
+
+    /* there is nothing to do if the array is already large enough. */
+    if (count <= new_capacity)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (0 == new_capacity)
+    {
+        new_capacity = INITIAL_CAPACITY;
+    }
+
+    while (new_capacity < count)
+    {
+        new_capacity *= 2;
+    }
+
+    /* guard against overflow of the allocation size. */
+    if (new_capacity > SIZE_MAX / elem_size)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    tmp = allocator_reallocate(alloc, *array, new_capacity * elem_size);
+    if (NULL == tmp)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    *array = tmp;
+    *capacity = new_capacity;
+
+    return STATUS_SUCCESS;
+}
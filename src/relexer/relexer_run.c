@@ -0,0 +1,420 @@
+/**
+ * \file relexer/relexer_run.c
+ *
+ * \brief Scan a document for a relexer, starting from a checkpoint.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/message/raw_stack_scanner.h>
+#include <libcparse/message_handler.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_message_raw_stack_scanner;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_relexer;
+CPARSE_IMPORT_relexer_internal;
+
+static int step(abstract_parser* ap, relexer* rl);
+static int feed(
+    input_stream* stream, size_t* fed, const char* text, size_t size);
+static int checkpoint(
+    bool* done, size_t* resync, relexer* rl, abstract_parser* ap,
+    size_t event_index, bool due, const relexer_shift* shift);
+static size_t checkpoint_find(
+    const relexer* rl, size_t offset, size_t first);
+
+/**
+ * \brief Scan a document, starting from a checkpoint, into the scanned events
+ * and saved checkpoints of a relexer.
+ *
+ * The document is scanned by a private \ref preprocessor_scanner that shares
+ * the relexer's intern table, so identifiers keep their symbols from one scan
+ * to the next. The scanner yields after each event, and a checkpoint is saved
+ * every \ref CPARSE_RELEXER_CHECKPOINT_INTERVAL events.
+ *
+ * \param resync            Pointer to receive the index of the recorded
+ *                          checkpoint at which scanning stopped, or the
+ *                          checkpoint count if scanning reached EOF.
+ * \param rl                The relexer for this operation.
+ * \param start             The checkpoint from which to scan, or NULL to scan
+ *                          from the start of the document.
+ * \param shift             How the edit moved the recorded checkpoints, or
+ *                          NULL.
+ * \param text              The document.
+ * \param size              The size of the document.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_run)(
+    size_t* resync, CPARSE_SYM(relexer)* rl,
+    const CPARSE_SYM(relexer_checkpoint)* start,
+    const CPARSE_SYM(relexer_shift)* shift, const char* text, size_t size)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner;
+    abstract_parser* ap;
+    input_stream* stream;
+    event_handler eh;
+    size_t fed = 0, base = 0, last;
+    bool done = false;
+
+    *resync = rl->checkpoint_count;
+    rl->saved_count = 0;
+    rl->yield = false;
+    rl->eof = false;
+
+    /* create the private scanner. */
+    retval = preprocessor_scanner_create_with_allocator(&scanner, &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    ap = preprocessor_scanner_upcast(scanner);
+
+    retval = preprocessor_scanner_intern_table_set(scanner, rl->intern);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    /* record its events. */
+    retval = event_handler_init(&eh, &relexer_event_callback, rl);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+    else if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+        goto cleanup_scanner;
+    }
+
+    /* the document is fed to this stream as it is scanned. */
+    retval = input_stream_create_for_feed(&stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    retval = abstract_parser_push_input_stream(ap, rl->name, stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval = input_stream_release(stream);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        goto cleanup_scanner;
+    }
+
+    /* resume from the checkpoint, if any. */
+    if (NULL != start)
+    {
+        retval = abstract_parser_checkpoint_restore(ap, &start->ckpt);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scanner;
+        }
+
+        fed = start->ckpt.offset;
+        base = start->event_index;
+    }
+
+    last = base;
+
+    /* scan until EOF, or until back in step with the recorded events. */
+    while (!done && !rl->eof)
+    {
+        retval = step(ap, rl);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scanner;
+        }
+
+        /* if the stream has run dry, feed it more of the document. */
+        if (!rl->yield)
+        {
+            retval = feed(stream, &fed, text, size);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_scanner;
+            }
+
+            continue;
+        }
+
+        /* there is nothing left to scan after EOF. */
+        if (rl->eof)
+        {
+            break;
+        }
+
+        /* the scanner is between two characters. */
+        retval =
+            checkpoint(
+                &done, resync, rl, ap, base + rl->scanned_count,
+                base + rl->scanned_count - last
+                    >= CPARSE_RELEXER_CHECKPOINT_INTERVAL,
+                shift);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scanner;
+        }
+
+        if (rl->saved_count > 0)
+        {
+            last = rl->saved[rl->saved_count - 1].event_index;
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_scanner;
+
+cleanup_scanner:
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Step the raw stack scanner until an event is scanned, or until the
+ * input stream runs dry.
+ *
+ * \param ap                The parser for this operation.
+ * \param rl                The relexer for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int step(abstract_parser* ap, relexer* rl)
+{
+    int retval, release_retval;
+    message_rss_step msg;
+
+    /* clear the yield flag; the event callback sets it again. */
+    rl->yield = false;
+
+    /* initialize the message. */
+    retval = message_rss_step_init(&msg, &rl->yield);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the message down the parser stack. */
+    retval =
+        message_handler_send(
+            abstract_parser_message_handler_get(ap),
+            message_rss_step_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_rss_step_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Feed the next part of the document to the input stream, or finish
+ * the stream once the whole document has been fed.
+ *
+ * \param stream            The input stream to feed.
+ * \param fed               Pointer to the offset of the next byte to feed,
+ *                          which is updated.
+ * \param text              The document.
+ * \param size              The size of the document.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int feed(
+    input_stream* stream, size_t* fed, const char* text, size_t size)
+{
+    size_t chunk = size - *fed;
+
+    /* the stream reaches EOF once the whole document has been read. */
+    if (0 == chunk)
+    {
+        return input_stream_feed_finish(stream);
+    }
+
+    if (chunk > CPARSE_RELEXER_FEED_SIZE)
+    {
+        chunk = CPARSE_RELEXER_FEED_SIZE;
+    }
+
+    *fed += chunk;
+
+    return input_stream_feed(stream, text + *fed - chunk, chunk);
+}
+
+/**
+ * \brief Save a checkpoint if one is due, and determine whether the scan is
+ * back in step with the recorded events.
+ *
+ * \param done              Pointer to set to true if the scan is back in
+ *                          step.
+ * \param resync            Pointer to receive the index of the matching
+ *                          recorded checkpoint.
+ * \param rl                The relexer for this operation.
+ * \param ap                The parser for this operation.
+ * \param event_index       The number of events before this point.
+ * \param due               True if a checkpoint should be kept here.
+ * \param shift             How the edit moved the recorded checkpoints, or
+ *                          NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int checkpoint(
+    bool* done, size_t* resync, relexer* rl, abstract_parser* ap,
+    size_t event_index, bool due, const relexer_shift* shift)
+{
+    int retval;
+    relexer_checkpoint next;
+    size_t index;
+
+    /* a full scan only needs the checkpoints that are due. */
+    if (!due && NULL == shift)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval = abstract_parser_checkpoint_save(&next.ckpt, ap);
+    if (
+        ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG == retval
+     || ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG == retval)
+    {
+        /* try again after the next event; without checkpoints, edits rescan
+         * the whole document. */
+        return STATUS_SUCCESS;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    next.event_index = event_index;
+
+    /* past the edit, look for a recorded checkpoint in the same state. */
+    if (NULL != shift && next.ckpt.offset >= shift->edit_end)
+    {
+        index =
+            checkpoint_find(
+                rl, next.ckpt.offset - shift->offset, shift->first);
+        if (
+            index < rl->checkpoint_count
+         && relexer_checkpoint_matches(
+                &rl->checkpoints[index].ckpt, &next.ckpt, shift))
+        {
+            *resync = index;
+            *done = true;
+
+            return STATUS_SUCCESS;
+        }
+    }
+
+    if (!due)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* keep this checkpoint. */
+    retval =
+        relexer_reserve(
+            (void**)&rl->saved, &rl->saved_capacity, rl->saved_count + 1,
+            sizeof(*rl->saved), &rl->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(&rl->saved[rl->saved_count], &next, sizeof(next));
+    ++rl->saved_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Find the recorded checkpoint at the given offset.
+ *
+ * \param rl                The relexer to search.
+ * \param offset            The offset of the checkpoint.
+ * \param first             The index of the first checkpoint to search.
+ *
+ * \returns the index of the checkpoint, or the checkpoint count if there is
+ * no checkpoint at this offset.
+ */
+static size_t checkpoint_find(
+    const relexer* rl, size_t offset, size_t first)
+{
+    size_t lo = first, hi = rl->checkpoint_count;
+
+    /* checkpoints are ordered by offset. */
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (rl->checkpoints[mid].ckpt.offset < offset)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (lo < rl->checkpoint_count && rl->checkpoints[lo].ckpt.offset == offset)
+    {
+        return lo;
+    }
+
+    return rl->checkpoint_count;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file relexer/relexer_scan.c
+ *
+ * \brief Replace the document of a relexer and scan all of it.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/status_codes.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_relexer;
+
+/**
+ * \brief Replace the document of a \ref relexer and scan all of it.
+ *
+ * Once the recorded events are discarded, the new document is an edit that
+ * inserts every byte into an empty document, and every scanned event is
+ * added.
+ *
+ * \param rl                    The \ref relexer for this operation.
+ * \param data                  The new document, which is copied.
+ * \param size                  The size of the new document.
+ * \param added                 The handler for the events of the new document,
+ *                              or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from scanning or from a handler.
+ */
+int CPARSE_SYM(relexer_scan)(
+    CPARSE_SYM(relexer)* rl, const void* data, size_t size,
+    CPARSE_SYM(event_handler)* added)
+{
+    int retval = STATUS_SUCCESS, release_retval;
+
+    /* discard the recorded events and checkpoints. */
+    for (size_t i = 0; i < rl->event_count; ++i)
+    {
+        release_retval = event_copy_release(rl->events[i]);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    rl->event_count = 0;
+    rl->checkpoint_count = 0;
+
+    /* discard the document. */
+    if (NULL != rl->text)
+    {
+        allocator_free(&rl->alloc, rl->text);
+    }
+
+    rl->text = NULL;
+    rl->text_size = 0;
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return relexer_edit(rl, 0, 0, data, size, NULL, added);
+}
@@ -0,0 +1,51 @@
+/**
+ * \file relexer/relexer_scanned_release.c
+ *
+ * \brief Release scanned events that a relexer has not kept.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_copy.h>
+#include <libcparse/status_codes.h>
+
+#include "relexer_internal.h"
+
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_relexer_internal;
+
+/**
+ * \brief Release the scanned events of a relexer that have not been kept.
+ *
+ * Each released slot is cleared, so that it is not released twice.
+ *
+ * \param rl                The relexer for this operation.
+ * \param begin             The index of the first scanned event to release.
+ * \param end               The index past the last scanned event to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(relexer_scanned_release)(
+    CPARSE_SYM(relexer)* rl, size_t begin, size_t end)
+{
+    int retval = STATUS_SUCCESS, release_retval;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (NULL != rl->scanned[i])
+        {
+            release_retval = event_copy_release(rl->scanned[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+
+            rl->scanned[i] = NULL;
+        }
+    }
+
+    return retval;
+}
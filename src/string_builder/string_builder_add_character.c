@@ -8,8 +8,6 @@
  */
 
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
-#include <string.h>
 
 #include "string_builder_internal.h"
 
@@ -28,57 +26,22 @@ CPARSE_IMPORT_string_builder_internal;
 int CPARSE_SYM(string_builder_add_character)(
     CPARSE_SYM(string_builder)* builder, int ch)
 {
-    string_builder_chunk* tmp;
-    size_t chunk_offset =
-        builder->offset % CPARSE_STRING_BUILDER_CHUNK_ARRAY_SIZE;
+    int retval;
 
-    /* There are three possible states:
-     * 1. There are no chunks, so allocate one.
-     * 2. The current chunks are full, so allocate one.
-     * 3. There is room for this character in an existing chunk, so add it.
-     *
-     * This function progressively shifts toward state 3.
-     */
-
-    /* 3. There is room for the character in an existing chunk, so set tmp to
-     * this chunk. */
-    if (builder->offset > 0 && 0 != chunk_offset)
-    {
-        tmp = builder->tail;
-    }
-
-    /* (1, 2). We need to allocate memory for the chunk, so save it to tmp. */
-    if (0 == chunk_offset)
+    /* make room for this character. */
+    if (builder->offset + 1 >= builder->buffer_size)
     {
-        /* allocate memory for this chunk. */
-        tmp = (string_builder_chunk*)malloc(sizeof(*tmp));
-        if (NULL == tmp)
-        {
-            return ERROR_LIBCPARSE_OUT_OF_MEMORY;
-        }
-
-        /* clear the new chunk. */
-        memset(tmp, 0, sizeof(*tmp));
-
-        /* Fix up tail next to point to tmp. */
-        if (NULL != builder->tail)
+        retval = string_builder_reserve(builder, 1);
+        if (STATUS_SUCCESS != retval)
         {
-            builder->tail->next = tmp;
+            return retval;
         }
-
-        /* tmp is our new tail. */
-        builder->tail = tmp;
-    }
-
-    /* 1. Is this the first chunk? If so, set head to tmp. */
-    if (0 == builder->offset)
-    {
-        builder->head = tmp;
     }
 
-    /* 3. Add the character to the builder. */
-    tmp->arr[chunk_offset] = ch;
+    /* add the character to the builder, keeping the buffer terminated. */
+    builder->buffer[builder->offset] = ch;
     builder->offset += 1;
+    builder->buffer[builder->offset] = 0;
 
     /* success. */
     return STATUS_SUCCESS;
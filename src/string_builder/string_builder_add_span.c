@@ -0,0 +1,53 @@
+/**
+ * \file src/string_builder/string_builder_add_span.c
+ *
+ * \brief Add a span of characters to the \ref string_builder.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "string_builder_internal.h"
+
+CPARSE_IMPORT_string_builder_internal;
+
+/**
+ * \brief Add a span of characters to the string builder.
+ *
+ * \param builder           The string builder instance for this operation.
+ * \param span              The start of the span to add.
+ * \param size              The number of characters in this span.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(string_builder_add_span)(
+    CPARSE_SYM(string_builder)* builder, const char* span, size_t size)
+{
+    int retval;
+
+    /* an empty span adds nothing. */
+    if (0 == size)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* make room for this span. */
+    retval = string_builder_reserve(builder, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* copy the span, keeping the buffer terminated. */
+    memcpy(builder->buffer + builder->offset, span, size);
+    builder->offset += size;
+    builder->buffer[builder->offset] = 0;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
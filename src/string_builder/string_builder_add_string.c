@@ -9,6 +9,7 @@
 
 #include <libcparse/status_codes.h>
 #include <libcparse/string_builder.h>
+#include <string.h>
 
 CPARSE_IMPORT_string_builder;
 
@@ -25,19 +26,5 @@ CPARSE_IMPORT_string_builder;
 int CPARSE_SYM(string_builder_add_string)(
     CPARSE_SYM(string_builder)* builder, const char* ch)
 {
-    int retval;
-
-    /* interate through the string. */
-    for (const char* tmp = ch; 0 != *tmp; ++tmp)
-    {
-        /* attempt to add this character to the builder. */
-        retval = string_builder_add_character(builder, *tmp);
-        if (STATUS_SUCCESS != retval)
-        {
-            return retval;
-        }
-    }
-
-    /* success. */
-    return STATUS_SUCCESS;
+    return string_builder_add_span(builder, ch, strlen(ch));
 }
@@ -31,10 +31,7 @@ int CPARSE_SYM(string_builder_build)(
     char** str, CPARSE_SYM(string_builder)* builder)
 {
     size_t string_size = builder->offset + 1;
-    size_t count;
     char* tmp;
-    char* out;
-    string_builder_chunk* curr = builder->head;
 
     /* allocate memory for the string. */
     tmp = (char*)malloc(string_size);
@@ -43,35 +40,15 @@ int CPARSE_SYM(string_builder_build)(
         return ERROR_LIBCPARSE_OUT_OF_MEMORY;
     }
 
-    /* clear the string. */
-    memset(tmp, 0, string_size);
-
-    /* set the output pointer. */
-    out = tmp;
-
-    /* iterate over all of the builder chunks. */
-    while (NULL != curr)
+    /* copy the string data. */
+    if (builder->offset > 0)
     {
-        /* decode the copy count. */
-        if (curr == builder->tail)
-        {
-            count = builder->offset % CPARSE_STRING_BUILDER_CHUNK_ARRAY_SIZE;
-        }
-        else
-        {
-            count = CPARSE_STRING_BUILDER_CHUNK_ARRAY_SIZE;
-        }
-
-        /* copy string data. */
-        memcpy(out, curr->arr, count);
-
-        /* update the output pointer. */
-        out += count;
-
-        /* skip to the next chunk. */
-        curr = curr->next;
+        memcpy(tmp, builder->buffer, builder->offset);
     }
 
+    /* terminate the string. */
+    tmp[builder->offset] = 0;
+
     /* success. */
     *str = tmp;
     return STATUS_SUCCESS;
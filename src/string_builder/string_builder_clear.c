@@ -7,14 +7,10 @@
  * distribution for the license terms under which this software is distributed.
  */
 
-#include <libcparse/status_codes.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "string_builder_internal.h"
 
-CPARSE_IMPORT_string_builder_internal;
-
 /**
  * \brief Clear the current string builder instance, returning its internal
  * state to empty.
@@ -23,17 +19,11 @@ CPARSE_IMPORT_string_builder_internal;
  */
 void CPARSE_SYM(string_builder_clear)(CPARSE_SYM(string_builder)* builder)
 {
-    /* clear all chunks. */
-    string_builder_chunk* tmp = builder->head;
-    while (NULL != tmp)
+    /* clear the string, but keep the buffer for the next string. */
+    if (NULL != builder->buffer)
     {
-        string_builder_chunk* next = tmp->next;
-
-        memset(tmp, 0, sizeof(*tmp));
-        free(tmp);
-        tmp = next;
+        memset(builder->buffer, 0, builder->offset);
     }
 
-    /* clear structure. */
-    memset(builder, 0, sizeof(*builder));
+    builder->offset = 0;
 }
@@ -7,12 +7,12 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <stdlib.h>
-#include <string.h>
 
 #include "string_builder_internal.h"
 
+CPARSE_IMPORT_allocator;
 CPARSE_IMPORT_string_builder;
 
 /**
@@ -28,24 +28,14 @@ CPARSE_IMPORT_string_builder;
 int CPARSE_SYM(string_builder_create)(CPARSE_SYM(string_builder)** builder)
 {
     int retval;
-    string_builder* tmp;
+    allocator alloc;
 
-    /* allocate memory for this instance. */
-    tmp = (string_builder*)malloc(sizeof(*tmp));
-    if (NULL == tmp)
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
     {
-        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
-        goto done;
+        return retval;
     }
 
-    /* clear instance memory. */
-    memset(tmp, 0, sizeof(*tmp));
-
-    /* success. */
-    *builder = tmp;
-    retval = STATUS_SUCCESS;
-    goto done;
-
-done:
-    return retval;
+    return string_builder_create_with_allocator(builder, &alloc);
 }
@@ -0,0 +1,66 @@
+/**
+ * \file src/string_builder/string_builder_create_with_allocator.c
+ *
+ * \brief Create a \ref string_builder that uses a given \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "string_builder_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_string_builder;
+
+/**
+ * \brief Create a string builder instance that uses the given allocator for
+ * its memory.
+ *
+ * \param builder           Pointer to the string builder pointer to receive
+ *                          this instance on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(string_builder_create_with_allocator)(
+    CPARSE_SYM(string_builder)** builder, const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    string_builder* tmp;
+
+    /* allocate memory for this instance. */
+    tmp = (string_builder*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *builder = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
+
+done:
+    return retval;
+}
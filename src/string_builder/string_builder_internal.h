@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <libcparse/allocator.h>
 #include <libcparse/string_builder.h>
 #include <stdint.h>
 #include <stddef.h>
@@ -18,31 +19,48 @@
 extern "C" {
 # endif /*__cplusplus*/
 
-#define CPARSE_STRING_BUILDER_CHUNK_ARRAY_SIZE 100
-
-typedef struct CPARSE_SYM(string_builder_chunk)
-CPARSE_SYM(string_builder_chunk);
-
-struct CPARSE_SYM(string_builder_chunk)
-{
-    CPARSE_SYM(string_builder_chunk)* next;
-    char arr[CPARSE_STRING_BUILDER_CHUNK_ARRAY_SIZE];
-};
+/**
+ * \brief The initial size of the string builder buffer.
+ */
+#define CPARSE_STRING_BUILDER_INITIAL_SIZE 64
 
 struct CPARSE_SYM(string_builder)
 {
-    CPARSE_SYM(string_builder_chunk)* head;
-    CPARSE_SYM(string_builder_chunk)* tail;
+    char* buffer;
+    size_t buffer_size;
     size_t offset;
+    CPARSE_SYM(allocator) alloc;
 };
 
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Ensure that the string builder buffer has room for the given number of
+ * additional characters, plus a NUL terminator.
+ *
+ * The buffer grows geometrically, so a run of small appends is amortized.
+ *
+ * \param builder           The string builder instance for this operation.
+ * \param size              The number of characters to reserve.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(string_builder_reserve)(
+    CPARSE_SYM(string_builder)* builder, size_t size);
+
 /******************************************************************************/
 /* Start of private exports.                                                  */
 /******************************************************************************/
 
 #define __INTERNAL_CPARSE_IMPORT_string_builder_internal_sym(sym) \
     CPARSE_BEGIN_EXPORT \
-    typedef CPARSE_SYM(string_builder_chunk) sym ## string_builder_chunk; \
+    static inline int sym ## string_builder_reserve( \
+        CPARSE_SYM(string_builder)* x, size_t y) { \
+            return CPARSE_SYM(string_builder_reserve)(x,y); } \
     CPARSE_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define CPARSE_IMPORT_string_builder_internal_as(sym) \
@@ -7,11 +7,13 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
 #include <libcparse/status_codes.h>
-#include <libcparse/string_builder.h>
-#include <stdlib.h>
+#include <string.h>
 
-CPARSE_IMPORT_string_builder;
+#include "string_builder_internal.h"
+
+CPARSE_IMPORT_allocator;
 
 /**
  * \brief Release a string builder instance, releasing any internal resources it
@@ -25,11 +27,23 @@ CPARSE_IMPORT_string_builder;
  */
 int CPARSE_SYM(string_builder_release)(CPARSE_SYM(string_builder)* builder)
 {
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &builder->alloc, sizeof(alloc));
+
+    /* clear and free the buffer. */
+    if (NULL != builder->buffer)
+    {
+        memset(builder->buffer, 0, builder->buffer_size);
+        allocator_free(&alloc, builder->buffer);
+    }
+
     /* clear the structure. */
-    string_builder_clear(builder);
+    memset(builder, 0, sizeof(*builder));
 
     /* free structure. */
-    free(builder);
+    allocator_free(&alloc, builder);
 
     return STATUS_SUCCESS;
 }
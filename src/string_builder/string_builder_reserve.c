@@ -0,0 +1,72 @@
+/**
+ * \file src/string_builder/string_builder_reserve.c
+ *
+ * \brief Reserve space in the \ref string_builder buffer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdint.h>
+
+#include "string_builder_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_string_builder;
+
+/**
+ * \brief Ensure that the string builder buffer has room for the given number of
+ * additional characters, plus a NUL terminator.
+ *
+ * \param builder           The string builder instance for this operation.
+ * \param size              The number of characters to reserve.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(string_builder_reserve)(
+    CPARSE_SYM(string_builder)* builder, size_t size)
+{
+    size_t required, buffer_size;
+    char* tmp;
+
+    /* guard against overflow. */
+    if (size > SIZE_MAX - builder->offset - 1)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    /* is there already enough room? */
+    required = builder->offset + size + 1;
+    if (required <= builder->buffer_size)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* grow the buffer geometrically. */
+    buffer_size =
+        (builder->buffer_size < CPARSE_STRING_BUILDER_INITIAL_SIZE)
+            ? CPARSE_STRING_BUILDER_INITIAL_SIZE : builder->buffer_size;
+    while (buffer_size < required)
+    {
+        buffer_size =
+            (buffer_size > SIZE_MAX / 2) ? required : buffer_size * 2;
+    }
+
+    /* reallocate the buffer. */
+    tmp =
+        (char*)allocator_reallocate(
+            &builder->alloc, builder->buffer, buffer_size);
+    if (NULL == tmp)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    builder->buffer = tmp;
+    builder->buffer_size = buffer_size;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file src/string_builder/string_builder_size.c
+ *
+ * \brief Get the size of the string in the \ref string_builder.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "string_builder_internal.h"
+
+/**
+ * \brief Get the size of the string in the current string builder.
+ *
+ * \param builder           The string builder for this operation.
+ *
+ * \returns the number of characters added since the builder was created or
+ * last cleared.
+ */
+size_t CPARSE_SYM(string_builder_size)(
+    const CPARSE_SYM(string_builder)* builder)
+{
+    return builder->offset;
+}
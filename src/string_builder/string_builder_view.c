@@ -0,0 +1,29 @@
+/**
+ * \file src/string_builder/string_builder_view.c
+ *
+ * \brief View the string in the \ref string_builder.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "string_builder_internal.h"
+
+/**
+ * \brief Get a borrowed view of the string in the current string builder.
+ *
+ * \param builder           The string builder for this operation.
+ *
+ * \returns a NUL-terminated string owned by the builder.
+ */
+const char* CPARSE_SYM(string_builder_view)(
+    const CPARSE_SYM(string_builder)* builder)
+{
+    /* nothing has been added yet. */
+    if (NULL == builder->buffer)
+    {
+        return "";
+    }
+
+    return builder->buffer;
+}
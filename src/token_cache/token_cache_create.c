@@ -0,0 +1,47 @@
+/**
+ * \file token_cache/token_cache_create.c
+ *
+ * \brief Create a token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache;
+
+/**
+ * \brief Create a \ref token_cache instance.
+ *
+ * \param cache                 Pointer to the \ref token_cache pointer to set
+ *                              to the created instance on success.
+ * \param dir                   The cache directory.
+ * \param max_size              The maximum total size of the entries, in
+ *                              bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_create)(
+    CPARSE_SYM(token_cache)** cache, const char* dir, size_t max_size)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return token_cache_create_with_allocator(cache, dir, max_size, &alloc);
+}
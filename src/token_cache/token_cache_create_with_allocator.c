@@ -0,0 +1,125 @@
+/**
+ * \file token_cache/token_cache_create_with_allocator.c
+ *
+ * \brief Create a token cache that uses a given allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache;
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Create a \ref token_cache instance that uses the given allocator.
+ *
+ * \param cache                 Pointer to the \ref token_cache pointer to set
+ *                              to the created instance on success.
+ * \param dir                   The cache directory.
+ * \param max_size              The maximum total size of the entries, in
+ *                              bytes.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_create_with_allocator)(
+    CPARSE_SYM(token_cache)** cache, const char* dir, size_t max_size,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    token_cache* tmp;
+    size_t dir_size = strlen(dir);
+    size_t buckets_size =
+        CPARSE_TOKEN_CACHE_INITIAL_BUCKETS * sizeof(token_cache_entry*);
+
+    /* allocate memory for this instance. */
+    tmp = (token_cache*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->dir_size = dir_size;
+    tmp->max_size = max_size;
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(*tmp));
+        allocator_free(alloc, tmp);
+        goto done;
+    }
+
+    /* the entry path is the directory, a separator, and the entry name. */
+    tmp->path =
+        (char*)allocator_allocate(
+            alloc, dir_size + 1 + CPARSE_TOKEN_CACHE_NAME_SIZE + 1);
+    if (NULL == tmp->path)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    memcpy(tmp->path, dir, dir_size);
+    tmp->path[dir_size] = '/';
+    tmp->path[dir_size + 1] = 0;
+
+    /* the temporary path is formatted in place by mkstemp. */
+    tmp->temp_path =
+        (char*)allocator_allocate(
+            alloc, dir_size + 1 + sizeof(CPARSE_TOKEN_CACHE_TEMP_NAME));
+    if (NULL == tmp->temp_path)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    /* allocate the empty hash buckets. */
+    tmp->buckets = (token_cache_entry**)allocator_allocate(alloc, buckets_size);
+    if (NULL == tmp->buckets)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    memset(tmp->buckets, 0, buckets_size);
+    tmp->bucket_count = CPARSE_TOKEN_CACHE_INITIAL_BUCKETS;
+
+    /* index the entries already in the directory. */
+    retval = token_cache_load(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *cache = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    release_retval = token_cache_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
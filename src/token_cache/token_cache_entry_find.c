@@ -0,0 +1,39 @@
+/**
+ * \file token_cache/token_cache_entry_find.c
+ *
+ * \brief Find an entry in the token cache index.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Find the index entry for a key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key to find.
+ *
+ * \returns the entry, or NULL if this key is not indexed.
+ */
+CPARSE_SYM(token_cache_entry)* CPARSE_SYM(token_cache_entry_find)(
+    const CPARSE_SYM(token_cache)* cache, const uint64_t key[2])
+{
+    token_cache_entry* entry =
+        cache->buckets[key[0] & (cache->bucket_count - 1)];
+
+    while (NULL != entry)
+    {
+        if (entry->key[0] == key[0] && entry->key[1] == key[1])
+        {
+            return entry;
+        }
+
+        entry = entry->next;
+    }
+
+    return NULL;
+}
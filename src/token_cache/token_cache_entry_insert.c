@@ -0,0 +1,141 @@
+/**
+ * \file token_cache/token_cache_entry_insert.c
+ *
+ * \brief Add an entry to the token cache index.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache;
+CPARSE_IMPORT_token_cache_internal;
+
+static int grow_buckets(token_cache* cache);
+
+/**
+ * \brief Index an entry as the most recently used entry, replacing any entry
+ * with the same key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ * \param size              The size of the entry file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_entry_insert)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2], uint64_t size)
+{
+    int retval;
+    token_cache_entry* entry;
+    size_t bucket;
+
+    /* an entry that is already indexed was rewritten. */
+    entry = token_cache_entry_find(cache, key);
+    if (NULL != entry)
+    {
+        cache->stats.size -= entry->size;
+        cache->stats.size += size;
+        entry->size = size;
+        token_cache_entry_touch(cache, entry);
+
+        return STATUS_SUCCESS;
+    }
+
+    /* keep the chains short. */
+    if (cache->stats.entries >= cache->bucket_count)
+    {
+        retval = grow_buckets(cache);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* allocate the entry. */
+    entry =
+        (token_cache_entry*)allocator_allocate(&cache->alloc, sizeof(*entry));
+    if (NULL == entry)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    memset(entry, 0, sizeof(*entry));
+    entry->key[0] = key[0];
+    entry->key[1] = key[1];
+    entry->size = size;
+
+    /* chain the entry in its bucket. */
+    bucket = key[0] & (cache->bucket_count - 1);
+    entry->next = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+
+    /* link the entry as the most recently used. */
+    entry->older = cache->newest;
+    if (NULL != cache->newest)
+    {
+        cache->newest->newer = entry;
+    }
+    else
+    {
+        cache->oldest = entry;
+    }
+
+    cache->newest = entry;
+
+    cache->stats.entries += 1;
+    cache->stats.size += size;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the number of hash buckets, rechaining every entry.
+ *
+ * \param cache             The cache for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int grow_buckets(token_cache* cache)
+{
+    size_t bucket_count = 2 * cache->bucket_count;
+    size_t buckets_size = bucket_count * sizeof(token_cache_entry*);
+    token_cache_entry** buckets;
+
+    buckets =
+        (token_cache_entry**)allocator_allocate(&cache->alloc, buckets_size);
+    if (NULL == buckets)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    memset(buckets, 0, buckets_size);
+
+    /* every entry is on the recency list, so rechain from there. */
+    for (token_cache_entry* i = cache->oldest; NULL != i; i = i->newer)
+    {
+        size_t bucket = i->key[0] & (bucket_count - 1);
+
+        i->next = buckets[bucket];
+        buckets[bucket] = i;
+    }
+
+    memset(
+        cache->buckets, 0, cache->bucket_count * sizeof(*cache->buckets));
+    allocator_free(&cache->alloc, cache->buckets);
+
+    cache->buckets = buckets;
+    cache->bucket_count = bucket_count;
+
+    return STATUS_SUCCESS;
+}
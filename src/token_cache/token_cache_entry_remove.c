@@ -0,0 +1,62 @@
+/**
+ * \file token_cache/token_cache_entry_remove.c
+ *
+ * \brief Remove an entry from the token cache index.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Remove an entry from the index and free it.
+ *
+ * \param cache             The cache for this operation.
+ * \param entry             The entry to remove.
+ */
+void CPARSE_SYM(token_cache_entry_remove)(
+    CPARSE_SYM(token_cache)* cache, CPARSE_SYM(token_cache_entry)* entry)
+{
+    token_cache_entry** link =
+        &cache->buckets[entry->key[0] & (cache->bucket_count - 1)];
+
+    /* unchain the entry from its bucket. */
+    while (*link != entry)
+    {
+        link = &(*link)->next;
+    }
+
+    *link = entry->next;
+
+    /* unlink the entry from the recency list. */
+    if (NULL != entry->older)
+    {
+        entry->older->newer = entry->newer;
+    }
+    else
+    {
+        cache->oldest = entry->newer;
+    }
+
+    if (NULL != entry->newer)
+    {
+        entry->newer->older = entry->older;
+    }
+    else
+    {
+        cache->newest = entry->older;
+    }
+
+    cache->stats.entries -= 1;
+    cache->stats.size -= entry->size;
+
+    memset(entry, 0, sizeof(*entry));
+    allocator_free(&cache->alloc, entry);
+}
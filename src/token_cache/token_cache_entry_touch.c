@@ -0,0 +1,44 @@
+/**
+ * \file token_cache/token_cache_entry_touch.c
+ *
+ * \brief Mark a token cache entry as the most recently used.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Mark an entry as the most recently used entry.
+ *
+ * \param cache             The cache for this operation.
+ * \param entry             The entry to mark.
+ */
+void CPARSE_SYM(token_cache_entry_touch)(
+    CPARSE_SYM(token_cache)* cache, CPARSE_SYM(token_cache_entry)* entry)
+{
+    if (cache->newest == entry)
+    {
+        return;
+    }
+
+    /* unlink the entry; it has a newer neighbor. */
+    entry->newer->older = entry->older;
+    if (NULL != entry->older)
+    {
+        entry->older->newer = entry->newer;
+    }
+    else
+    {
+        cache->oldest = entry->newer;
+    }
+
+    /* relink the entry as the newest. */
+    entry->older = cache->newest;
+    entry->newer = NULL;
+    cache->newest->newer = entry;
+    cache->newest = entry;
+}
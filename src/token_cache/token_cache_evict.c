@@ -0,0 +1,35 @@
+/**
+ * \file token_cache/token_cache_evict.c
+ *
+ * \brief Evict the least recently used token cache entries.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <unistd.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Delete the least recently used entries until the cache fits within
+ * its size bound.
+ *
+ * An entry file that has already been deleted, for instance by another
+ * process sharing this directory, is simply dropped from the index.
+ *
+ * \param cache             The cache for this operation.
+ */
+void CPARSE_SYM(token_cache_evict)(CPARSE_SYM(token_cache)* cache)
+{
+    while (NULL != cache->oldest && cache->stats.size > cache->max_size)
+    {
+        token_cache_entry* entry = cache->oldest;
+
+        (void)unlink(token_cache_path_format(cache, entry->key));
+        token_cache_entry_remove(cache, entry);
+        cache->stats.evictions += 1;
+    }
+}
@@ -0,0 +1,34 @@
+/**
+ * \file token_cache/token_cache_forward_callback.c
+ *
+ * \brief Forward an event to the subscribers of a scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_reactor.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_event_reactor;
+
+/**
+ * \brief Event handler callback that forwards each event to a scanner's
+ * subscribers.
+ *
+ * \param context           The context for this handler (the scanner's event
+ *                          reactor).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_forward_callback)(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    event_reactor* reactor = (event_reactor*)context;
+
+    return event_reactor_broadcast(reactor, ev);
+}
@@ -0,0 +1,321 @@
+/**
+ * \file token_cache/token_cache_internal.h
+ *
+ * \brief Internal declarations and definitions for the token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator/detail.h>
+#include <libcparse/event_fwd.h>
+#include <libcparse/token_cache.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The suffix of every cache entry file.
+ */
+#define CPARSE_TOKEN_CACHE_ENTRY_SUFFIX ".cpts"
+
+/**
+ * \brief The number of hex digits in a cache entry file name.
+ */
+#define CPARSE_TOKEN_CACHE_KEY_DIGITS 32
+
+/**
+ * \brief The length of a cache entry file name.
+ */
+#define CPARSE_TOKEN_CACHE_NAME_SIZE \
+    (CPARSE_TOKEN_CACHE_KEY_DIGITS \
+        + sizeof(CPARSE_TOKEN_CACHE_ENTRY_SUFFIX) - 1)
+
+/**
+ * \brief The prefix of temporary file names.
+ */
+#define CPARSE_TOKEN_CACHE_TEMP_PREFIX ".tmp-"
+
+/**
+ * \brief The template for temporary files, which never matches an entry.
+ */
+#define CPARSE_TOKEN_CACHE_TEMP_NAME CPARSE_TOKEN_CACHE_TEMP_PREFIX "XXXXXX"
+
+/**
+ * \brief The initial number of hash buckets in the cache index.
+ */
+#define CPARSE_TOKEN_CACHE_INITIAL_BUCKETS 64
+
+/**
+ * \brief The configuration hashed into the key of a preprocessor scanner
+ * entry.
+ *
+ * This must change whenever the events produced by the preprocessor scanner
+ * change. The token stream version is hashed separately.
+ */
+#define CPARSE_TOKEN_CACHE_CONFIG_PREPROCESSOR_SCANNER 1
+
+typedef struct CPARSE_SYM(token_cache_entry) CPARSE_SYM(token_cache_entry);
+
+/**
+ * \brief An entry in the cache index.
+ *
+ * Entries are chained in their hash bucket, and linked from the least to the
+ * most recently used.
+ */
+struct CPARSE_SYM(token_cache_entry)
+{
+    uint64_t key[2];
+    uint64_t size;
+    CPARSE_SYM(token_cache_entry)* next;
+    CPARSE_SYM(token_cache_entry)* older;
+    CPARSE_SYM(token_cache_entry)* newer;
+};
+
+struct CPARSE_SYM(token_cache)
+{
+    char* path;
+    size_t dir_size;
+    char* temp_path;
+    size_t max_size;
+    CPARSE_SYM(token_cache_entry)** buckets;
+    size_t bucket_count;
+    CPARSE_SYM(token_cache_entry)* oldest;
+    CPARSE_SYM(token_cache_entry)* newest;
+    CPARSE_SYM(token_cache_stats) stats;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Compute the 128-bit key for an input.
+ *
+ * \param key               The key to compute.
+ * \param config            The scanner configuration.
+ * \param name              The name of the input.
+ * \param data              The input.
+ * \param size              The size of the input.
+ */
+void CPARSE_SYM(token_cache_key_compute)(
+    uint64_t key[2], uint64_t config, const char* name, const void* data,
+    size_t size);
+
+/**
+ * \brief Format the path of the entry file for a key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ *
+ * \returns the path, which is valid until the next call.
+ */
+const char* CPARSE_SYM(token_cache_path_format)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2]);
+
+/**
+ * \brief Find the index entry for a key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key to find.
+ *
+ * \returns the entry, or NULL if this key is not indexed.
+ */
+CPARSE_SYM(token_cache_entry)* CPARSE_SYM(token_cache_entry_find)(
+    const CPARSE_SYM(token_cache)* cache, const uint64_t key[2]);
+
+/**
+ * \brief Index an entry as the most recently used entry, replacing any entry
+ * with the same key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ * \param size              The size of the entry file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_entry_insert)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2], uint64_t size);
+
+/**
+ * \brief Remove an entry from the index and free it.
+ *
+ * \param cache             The cache for this operation.
+ * \param entry             The entry to remove.
+ */
+void CPARSE_SYM(token_cache_entry_remove)(
+    CPARSE_SYM(token_cache)* cache, CPARSE_SYM(token_cache_entry)* entry);
+
+/**
+ * \brief Mark an entry as the most recently used entry.
+ *
+ * \param cache             The cache for this operation.
+ * \param entry             The entry to mark.
+ */
+void CPARSE_SYM(token_cache_entry_touch)(
+    CPARSE_SYM(token_cache)* cache, CPARSE_SYM(token_cache_entry)* entry);
+
+/**
+ * \brief Delete the least recently used entries until the cache fits within
+ * its size bound.
+ *
+ * \param cache             The cache for this operation.
+ */
+void CPARSE_SYM(token_cache_evict)(CPARSE_SYM(token_cache)* cache);
+
+/**
+ * \brief Index the entries already in the cache directory, creating the
+ * directory if it does not exist.
+ *
+ * \param cache             The cache for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_load)(CPARSE_SYM(token_cache)* cache);
+
+/**
+ * \brief Replay the entry for a key to the subscribers of a scanner, if this
+ * entry exists and is valid.
+ *
+ * An entry that exists but can't be read is deleted.
+ *
+ * \param hit               Pointer to receive whether the entry was replayed.
+ * \param cache             The cache for this operation.
+ * \param scanner           The scanner whose subscribers receive the events.
+ * \param key               The key of the entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, whether or not the entry was replayed.
+ *      - a non-zero error code from a subscriber.
+ */
+int CPARSE_SYM(token_cache_replay)(
+    bool* hit, CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const uint64_t key[2]);
+
+/**
+ * \brief Scan an input, forwarding its events to the subscribers of a scanner
+ * and recording them.
+ *
+ * \param recording         Pointer to receive the encoded recording on
+ *                          success, which must be freed by the caller.
+ * \param recording_size    Pointer to receive the size of the recording.
+ * \param cache             The cache for this operation.
+ * \param scanner           The scanner whose subscribers receive the events.
+ * \param name              The name of the input.
+ * \param data              The input.
+ * \param size              The size of the input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_scan)(
+    void** recording, size_t* recording_size, CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const char* name,
+    const void* data, size_t size);
+
+/**
+ * \brief Write an entry file, replacing any existing entry atomically.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ * \param data              The encoded token stream.
+ * \param size              The size of the encoded token stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the entry could not be
+ *        written.
+ */
+int CPARSE_SYM(token_cache_store)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2], const void* data,
+    size_t size);
+
+/**
+ * \brief Event handler callback that forwards each event to a scanner's
+ * subscribers.
+ *
+ * \param context           The context for this handler (the scanner's event
+ *                          reactor).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_forward_callback)(
+    void* context, const CPARSE_SYM(event)* ev);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_cache_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(token_cache_entry) sym ## token_cache_entry; \
+    static inline void sym ## token_cache_key_compute( \
+        uint64_t v[2], uint64_t w, const char* x, const void* y, size_t z) { \
+            CPARSE_SYM(token_cache_key_compute)(v,w,x,y,z); } \
+    static inline const char* sym ## token_cache_path_format( \
+        CPARSE_SYM(token_cache)* x, const uint64_t y[2]) { \
+            return CPARSE_SYM(token_cache_path_format)(x,y); } \
+    static inline CPARSE_SYM(token_cache_entry)* \
+    sym ## token_cache_entry_find( \
+        const CPARSE_SYM(token_cache)* x, const uint64_t y[2]) { \
+            return CPARSE_SYM(token_cache_entry_find)(x,y); } \
+    static inline int sym ## token_cache_entry_insert( \
+        CPARSE_SYM(token_cache)* x, const uint64_t y[2], uint64_t z) { \
+            return CPARSE_SYM(token_cache_entry_insert)(x,y,z); } \
+    static inline void sym ## token_cache_entry_remove( \
+        CPARSE_SYM(token_cache)* x, CPARSE_SYM(token_cache_entry)* y) { \
+            CPARSE_SYM(token_cache_entry_remove)(x,y); } \
+    static inline void sym ## token_cache_entry_touch( \
+        CPARSE_SYM(token_cache)* x, CPARSE_SYM(token_cache_entry)* y) { \
+            CPARSE_SYM(token_cache_entry_touch)(x,y); } \
+    static inline void sym ## token_cache_evict( \
+        CPARSE_SYM(token_cache)* x) { \
+            CPARSE_SYM(token_cache_evict)(x); } \
+    static inline int sym ## token_cache_load( \
+        CPARSE_SYM(token_cache)* x) { \
+            return CPARSE_SYM(token_cache_load)(x); } \
+    static inline int sym ## token_cache_replay( \
+        bool* w, CPARSE_SYM(token_cache)* x, \
+        CPARSE_SYM(preprocessor_scanner)* y, const uint64_t z[2]) { \
+            return CPARSE_SYM(token_cache_replay)(w,x,y,z); } \
+    static inline int sym ## token_cache_scan( \
+        void** t, size_t* u, CPARSE_SYM(token_cache)* v, \
+        CPARSE_SYM(preprocessor_scanner)* w, const char* x, \
+        const void* y, size_t z) { \
+            return CPARSE_SYM(token_cache_scan)(t,u,v,w,x,y,z); } \
+    static inline int sym ## token_cache_store( \
+        CPARSE_SYM(token_cache)* w, const uint64_t x[2], const void* y, \
+        size_t z) { \
+            return CPARSE_SYM(token_cache_store)(w,x,y,z); } \
+    static inline int sym ## token_cache_forward_callback( \
+        void* x, const CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(token_cache_forward_callback)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_cache_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_cache_internal_sym(sym ## _)
+#define CPARSE_IMPORT_token_cache_internal \
+    __INTERNAL_CPARSE_IMPORT_token_cache_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
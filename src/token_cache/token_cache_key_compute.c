@@ -0,0 +1,125 @@
+/**
+ * \file token_cache/token_cache_key_compute.c
+ *
+ * \brief Compute the key for a token cache entry.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/token_stream.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+#define PRIME_1 0x9E3779B185EBCA87ULL
+#define PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME_3 0x165667B19E3779F9ULL
+#define PRIME_4 0x85EBCA77C2B2AE63ULL
+
+static void absorb(uint64_t lanes[2], const void* data, size_t size);
+static void absorb_word(uint64_t lanes[2], uint64_t word);
+static uint64_t rotate(uint64_t x, int bits);
+static uint64_t finalize(uint64_t x);
+
+/**
+ * \brief Compute the 128-bit key for an input.
+ *
+ * The input is hashed eight bytes at a time in two independent lanes, which
+ * is much faster than scanning it. The name is part of the key, because it is
+ * recorded in the cursor of every event.
+ *
+ * \param key               The key to compute.
+ * \param config            The scanner configuration.
+ * \param name              The name of the input.
+ * \param data              The input.
+ * \param size              The size of the input.
+ */
+void CPARSE_SYM(token_cache_key_compute)(
+    uint64_t key[2], uint64_t config, const char* name, const void* data,
+    size_t size)
+{
+    uint64_t lanes[2] = { PRIME_1, PRIME_2 };
+
+    absorb_word(lanes, config);
+    absorb_word(lanes, CPARSE_TOKEN_STREAM_VERSION);
+    absorb(lanes, name, strlen(name));
+    absorb(lanes, data, size);
+
+    key[0] = finalize(lanes[0] ^ rotate(lanes[1], 32));
+    key[1] = finalize(lanes[1] ^ key[0]);
+}
+
+/**
+ * \brief Absorb a block of bytes, followed by its size so that consecutive
+ * blocks can't be confused.
+ *
+ * \param lanes             The hash lanes.
+ * \param data              The bytes to absorb.
+ * \param size              The number of bytes to absorb.
+ */
+static void absorb(uint64_t lanes[2], const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint64_t word;
+    size_t i;
+
+    for (i = 0; i + sizeof(word) <= size; i += sizeof(word))
+    {
+        memcpy(&word, bytes + i, sizeof(word));
+        absorb_word(lanes, word);
+    }
+
+    /* the tail is zero-padded to a full word. */
+    if (i < size)
+    {
+        word = 0;
+        memcpy(&word, bytes + i, size - i);
+        absorb_word(lanes, word);
+    }
+
+    absorb_word(lanes, (uint64_t)size);
+}
+
+/**
+ * \brief Absorb a single word into both lanes.
+ *
+ * \param lanes             The hash lanes.
+ * \param word              The word to absorb.
+ */
+static void absorb_word(uint64_t lanes[2], uint64_t word)
+{
+    lanes[0] = rotate(lanes[0] ^ (word * PRIME_2), 31) * PRIME_1;
+    lanes[1] = rotate(lanes[1] ^ (word * PRIME_4), 27) * PRIME_3;
+}
+
+/**
+ * \brief Rotate a word left.
+ *
+ * \param x                 The word to rotate.
+ * \param bits              The number of bits to rotate by.
+ *
+ * \returns the rotated word.
+ */
+static uint64_t rotate(uint64_t x, int bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+/**
+ * \brief Mix every bit of a lane into every bit of the result.
+ *
+ * \param x                 The lane to mix.
+ *
+ * \returns the mixed lane.
+ */
+static uint64_t finalize(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+
+    return x;
+}
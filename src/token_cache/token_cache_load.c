@@ -0,0 +1,245 @@
+/**
+ * \file token_cache/token_cache_load.c
+ *
+ * \brief Index the entries in a token cache directory.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <dirent.h>
+#include <errno.h>
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache_internal;
+
+typedef struct found_entry found_entry;
+
+struct found_entry
+{
+    uint64_t key[2];
+    uint64_t size;
+    uint64_t stamp;
+};
+
+static bool parse_name(uint64_t key[2], const char* name);
+static bool is_temp_name(const char* name);
+static int compare_stamps(const void* lhs, const void* rhs);
+
+/**
+ * \brief Index the entries already in the cache directory, creating the
+ * directory if it does not exist.
+ *
+ * Entries are indexed from the least to the most recently modified, since a
+ * hit updates the modification time of its entry. Temporary files left behind
+ * by an interrupted write are removed. If another writer is still using one,
+ * its rename fails, which only costs that writer a failed write.
+ *
+ * \param cache             The cache for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the cache directory
+ *        could not be created or read.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_load)(CPARSE_SYM(token_cache)* cache)
+{
+    int retval;
+    DIR* dir;
+    struct dirent* dirent;
+    struct stat st;
+    found_entry* found = NULL;
+    size_t count = 0, capacity = 0;
+
+    /* the path is the directory, with a trailing separator. */
+    cache->path[cache->dir_size + 1] = 0;
+
+    /* open the directory, creating it if needed. */
+    dir = opendir(cache->path);
+    if (NULL == dir && ENOENT == errno)
+    {
+        if (0 != mkdir(cache->path, 0777) && EEXIST != errno)
+        {
+            return ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR;
+        }
+
+        dir = opendir(cache->path);
+    }
+
+    if (NULL == dir)
+    {
+        return ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR;
+    }
+
+    /* gather every entry. */
+    while (NULL != (dirent = readdir(dir)))
+    {
+        uint64_t key[2];
+
+        /* remove temporary files that were never moved into place. */
+        if (is_temp_name(dirent->d_name))
+        {
+            (void)unlinkat(dirfd(dir), dirent->d_name, 0);
+            continue;
+        }
+
+        if (
+            !parse_name(key, dirent->d_name)
+         || 0 != fstatat(dirfd(dir), dirent->d_name, &st, 0)
+         || !S_ISREG(st.st_mode))
+        {
+            continue;
+        }
+
+        if (count == capacity)
+        {
+            size_t new_capacity = (0 == capacity) ? 64 : 2 * capacity;
+            found_entry* tmp =
+                (found_entry*)allocator_reallocate(
+                    &cache->alloc, found, new_capacity * sizeof(*found));
+            if (NULL == tmp)
+            {
+                retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+                goto cleanup_found;
+            }
+
+            found = tmp;
+            capacity = new_capacity;
+        }
+
+        found[count].key[0] = key[0];
+        found[count].key[1] = key[1];
+        found[count].size = (uint64_t)st.st_size;
+        found[count].stamp =
+            (uint64_t)st.st_mtim.tv_sec * 1000000000ULL
+                + (uint64_t)st.st_mtim.tv_nsec;
+        count += 1;
+    }
+
+    /* index the entries from oldest to newest. */
+    if (0 != count)
+    {
+        qsort(found, count, sizeof(*found), &compare_stamps);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval =
+            token_cache_entry_insert(cache, found[i].key, found[i].size);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_found;
+        }
+    }
+
+    /* the size bound may be smaller than it was. */
+    token_cache_evict(cache);
+    retval = STATUS_SUCCESS;
+    goto cleanup_found;
+
+cleanup_found:
+    if (NULL != found)
+    {
+        memset(found, 0, capacity * sizeof(*found));
+        allocator_free(&cache->alloc, found);
+    }
+
+    closedir(dir);
+
+    return retval;
+}
+
+/**
+ * \brief Parse the key from the name of an entry file.
+ *
+ * \param key               The key to parse.
+ * \param name              The file name.
+ *
+ * \returns true if this is the name of an entry file, and false otherwise.
+ */
+static bool parse_name(uint64_t key[2], const char* name)
+{
+    if (
+        strlen(name) != CPARSE_TOKEN_CACHE_NAME_SIZE
+     || 0 != strcmp(
+                name + CPARSE_TOKEN_CACHE_KEY_DIGITS,
+                CPARSE_TOKEN_CACHE_ENTRY_SUFFIX))
+    {
+        return false;
+    }
+
+    key[0] = key[1] = 0;
+    for (int i = 0; i < CPARSE_TOKEN_CACHE_KEY_DIGITS; ++i)
+    {
+        uint64_t digit;
+
+        if (name[i] >= '0' && name[i] <= '9')
+        {
+            digit = (uint64_t)(name[i] - '0');
+        }
+        else if (name[i] >= 'a' && name[i] <= 'f')
+        {
+            digit = (uint64_t)(name[i] - 'a' + 10);
+        }
+        else
+        {
+            return false;
+        }
+
+        key[i / 16] = (key[i / 16] << 4) | digit;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Check whether a file name matches the temporary file template.
+ *
+ * \param name              The file name.
+ *
+ * \returns true if this is the name of a temporary file, and false otherwise.
+ */
+static bool is_temp_name(const char* name)
+{
+    return
+        strlen(name) == sizeof(CPARSE_TOKEN_CACHE_TEMP_NAME) - 1
+     && 0 == strncmp(
+                name, CPARSE_TOKEN_CACHE_TEMP_PREFIX,
+                sizeof(CPARSE_TOKEN_CACHE_TEMP_PREFIX) - 1);
+}
+
+/**
+ * \brief Order found entries by their modification times.
+ *
+ * \param lhs               The left-hand entry.
+ * \param rhs               The right-hand entry.
+ *
+ * \returns an integer value representing the comparison result.
+ */
+static int compare_stamps(const void* lhs, const void* rhs)
+{
+    const found_entry* l = (const found_entry*)lhs;
+    const found_entry* r = (const found_entry*)rhs;
+
+    if (l->stamp < r->stamp)
+    {
+        return -1;
+    }
+    else if (l->stamp > r->stamp)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ * \file token_cache/token_cache_path_format.c
+ *
+ * \brief Format the path of a token cache entry.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+/**
+ * \brief Format the path of the entry file for a key.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ *
+ * \returns the path, which is valid until the next call.
+ */
+const char* CPARSE_SYM(token_cache_path_format)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2])
+{
+    static const char digits[] = "0123456789abcdef";
+    char* name = cache->path + cache->dir_size + 1;
+
+    for (int i = 0; i < CPARSE_TOKEN_CACHE_KEY_DIGITS; ++i)
+    {
+        uint64_t word = key[i / 16];
+        int shift = 60 - 4 * (i % 16);
+
+        name[i] = digits[(word >> shift) & 0x0F];
+    }
+
+    memcpy(
+        name + CPARSE_TOKEN_CACHE_KEY_DIGITS, CPARSE_TOKEN_CACHE_ENTRY_SUFFIX,
+        sizeof(CPARSE_TOKEN_CACHE_ENTRY_SUFFIX));
+
+    return cache->path;
+}
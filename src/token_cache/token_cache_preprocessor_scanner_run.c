@@ -0,0 +1,96 @@
+/**
+ * \file token_cache/token_cache_preprocessor_scanner_run.c
+ *
+ * \brief Scan an input through the token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Broadcast the events of a \ref preprocessor_scanner for an input,
+ * replaying them from the cache if possible.
+ *
+ * \param cache                 The \ref token_cache for this operation.
+ * \param scanner               The \ref preprocessor_scanner whose subscribers
+ *                              receive the events. This scanner is not run.
+ * \param name                  The name of this input.
+ * \param data                  The input.
+ * \param size                  The size of the input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from scanning or from a subscriber.
+ */
+int CPARSE_SYM(token_cache_preprocessor_scanner_run)(
+    CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const char* name,
+    const void* data, size_t size)
+{
+    int retval;
+    uint64_t key[2];
+    bool hit;
+    void* recording;
+    size_t recording_size;
+
+    token_cache_key_compute(
+        key, CPARSE_TOKEN_CACHE_CONFIG_PREPROCESSOR_SCANNER, name, data,
+        size);
+
+    /* replay the entry on a hit. */
+    retval = token_cache_replay(&hit, cache, scanner, key);
+    if (hit)
+    {
+        cache->stats.hits += 1;
+        cache->stats.bytes_saved += size;
+        return retval;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* otherwise, scan the input. */
+    cache->stats.misses += 1;
+    retval =
+        token_cache_scan(
+            &recording, &recording_size, cache, scanner, name, data, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* write through, unless this entry could never fit. */
+    if (recording_size > cache->max_size)
+    {
+        goto cleanup_recording;
+    }
+
+    /* a failed write only costs a later miss. */
+    if (
+        STATUS_SUCCESS
+            != token_cache_store(cache, key, recording, recording_size))
+    {
+        cache->stats.failed_writes += 1;
+        goto cleanup_recording;
+    }
+
+    retval = token_cache_entry_insert(cache, key, recording_size);
+    token_cache_evict(cache);
+    goto cleanup_recording;
+
+cleanup_recording:
+
+    memset(recording, 0, recording_size);
+    free(recording);
+
+    return retval;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file token_cache/token_cache_release.c
+ *
+ * \brief Release a token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_cache;
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Release a \ref token_cache instance.
+ *
+ * \param cache                 The \ref token_cache instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_release)(CPARSE_SYM(token_cache)* cache)
+{
+    token_cache_entry* entry = cache->oldest;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &cache->alloc, sizeof(alloc));
+
+    /* release the index entries. */
+    while (NULL != entry)
+    {
+        token_cache_entry* newer = entry->newer;
+
+        memset(entry, 0, sizeof(*entry));
+        allocator_free(&alloc, entry);
+        entry = newer;
+    }
+
+    /* release the hash buckets. */
+    if (NULL != cache->buckets)
+    {
+        memset(
+            cache->buckets, 0, cache->bucket_count * sizeof(*cache->buckets));
+        allocator_free(&alloc, cache->buckets);
+    }
+
+    /* release the paths. */
+    if (NULL != cache->temp_path)
+    {
+        allocator_free(&alloc, cache->temp_path);
+    }
+
+    if (NULL != cache->path)
+    {
+        allocator_free(&alloc, cache->path);
+    }
+
+    /* clear and free this instance. */
+    memset(cache, 0, sizeof(*cache));
+    allocator_free(&alloc, cache);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file token_cache/token_cache_replay.c
+ *
+ * \brief Replay a token cache entry.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <fcntl.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_stream.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../preprocessor_scanner/preprocessor_scanner_internal.h"
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Replay the entry for a key to the subscribers of a scanner, if this
+ * entry exists and is valid.
+ *
+ * The entry is mapped into memory, and every event in it is decoded and
+ * checked before any event is broadcast, so a truncated, stale, or corrupt
+ * entry is never partially replayed. An entry that can't be decoded is a miss,
+ * and is deleted so that the scan that follows replaces it.
+ *
+ * \param hit               Pointer to receive whether the entry was replayed.
+ * \param cache             The cache for this operation.
+ * \param scanner           The scanner whose subscribers receive the events.
+ * \param key               The key of the entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, whether or not the entry was replayed.
+ *      - a non-zero error code from a subscriber.
+ */
+int CPARSE_SYM(token_cache_replay)(
+    bool* hit, CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const uint64_t key[2])
+{
+    int retval, release_retval;
+    const char* path = token_cache_path_format(cache, key);
+    token_cache_entry* entry = token_cache_entry_find(cache, key);
+    token_stream* stream;
+    struct stat st;
+    void* data;
+    int desc;
+
+    *hit = false;
+
+    /* a missing entry is a miss. */
+    desc = open(path, O_RDONLY);
+    if (desc < 0)
+    {
+        retval = STATUS_SUCCESS;
+        goto forget_entry;
+    }
+
+    /* map the entry. */
+    if (0 != fstat(desc, &st) || 0 == st.st_size)
+    {
+        retval = STATUS_SUCCESS;
+        goto delete_entry;
+    }
+
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, desc, 0);
+    if (MAP_FAILED == data)
+    {
+        retval = STATUS_SUCCESS;
+        goto delete_entry;
+    }
+
+    /* an entry that can't be read is a miss. */
+    retval =
+        token_stream_create_with_allocator(
+            &stream, data, (size_t)st.st_size, &cache->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        munmap(data, (size_t)st.st_size);
+        retval = STATUS_SUCCESS;
+        goto delete_entry;
+    }
+
+    /* replay the entry, interning identifiers as the scanner would. */
+    *hit = true;
+    retval = token_stream_replay(stream, scanner->reactor, scanner->intern);
+
+    /* record this use, both in the index and on disk. */
+    (void)futimens(desc, NULL);
+    if (NULL != entry)
+    {
+        token_cache_entry_touch(cache, entry);
+    }
+    else
+    {
+        release_retval =
+            token_cache_entry_insert(cache, key, (uint64_t)st.st_size);
+        if (STATUS_SUCCESS != release_retval && STATUS_SUCCESS == retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = token_stream_release(stream);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    munmap(data, (size_t)st.st_size);
+    close(desc);
+    goto done;
+
+delete_entry:
+    (void)unlink(path);
+    close(desc);
+
+forget_entry:
+    if (NULL != entry)
+    {
+        token_cache_entry_remove(cache, entry);
+    }
+
+done:
+    return retval;
+}
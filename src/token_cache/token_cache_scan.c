@@ -0,0 +1,178 @@
+/**
+ * \file token_cache/token_cache_scan.c
+ *
+ * \brief Scan and record an input that missed the token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_stream.h>
+
+#include "../preprocessor_scanner/preprocessor_scanner_internal.h"
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_cache_internal;
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Scan an input, forwarding its events to the subscribers of a scanner
+ * and recording them.
+ *
+ * The input is scanned by a private scanner, so that the recorder is not left
+ * subscribed to the caller's scanner. The private scanner shares the caller's
+ * intern table, so identifiers carry the same symbols either way.
+ *
+ * \param recording         Pointer to receive the encoded recording on
+ *                          success, which must be freed by the caller.
+ * \param recording_size    Pointer to receive the size of the recording.
+ * \param cache             The cache for this operation.
+ * \param scanner           The scanner whose subscribers receive the events.
+ * \param name              The name of the input.
+ * \param data              The input.
+ * \param size              The size of the input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_cache_scan)(
+    void** recording, size_t* recording_size, CPARSE_SYM(token_cache)* cache,
+    CPARSE_SYM(preprocessor_scanner)* scanner, const char* name,
+    const void* data, size_t size)
+{
+    int retval, release_retval;
+    preprocessor_scanner* tmp;
+    token_stream_writer* writer;
+    input_stream* stream;
+    event_handler eh;
+
+    /* create the private scanner. */
+    retval = preprocessor_scanner_create_with_allocator(&tmp, &cache->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    abstract_parser* ap = preprocessor_scanner_upcast(tmp);
+
+    retval = preprocessor_scanner_intern_table_set(tmp, scanner->intern);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* forward its events to the caller's subscribers. */
+    retval =
+        event_handler_init(
+            &eh, &token_cache_forward_callback, scanner->reactor);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+    else if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+        goto cleanup_tmp;
+    }
+
+    /* record its events. */
+    retval = token_stream_writer_create_with_allocator(&writer, &cache->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    retval = token_stream_writer_event_handler_init(&eh, writer);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_writer;
+    }
+
+    retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_writer;
+    }
+    else if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+        goto cleanup_writer;
+    }
+
+    /* add the input. */
+    retval = input_stream_create_for_feed(&stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_writer;
+    }
+
+    retval = input_stream_feed(stream, data, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    retval = input_stream_feed_finish(stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    retval = abstract_parser_push_input_stream(ap, name, stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    /* scan the input. */
+    retval = abstract_parser_run(ap);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_writer;
+    }
+
+    /* encode the recording. */
+    retval = token_stream_writer_build(recording, recording_size, writer);
+    goto cleanup_writer;
+
+cleanup_stream:
+    release_retval = input_stream_release(stream);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_writer:
+    release_retval = token_stream_writer_release(writer);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_tmp:
+    release_retval = preprocessor_scanner_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,25 @@
+/**
+ * \file token_cache/token_cache_stats_get.c
+ *
+ * \brief Get the statistics for a token cache.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "token_cache_internal.h"
+
+/**
+ * \brief Get the statistics for a \ref token_cache.
+ *
+ * \param stats                 The statistics to populate.
+ * \param cache                 The \ref token_cache to query.
+ */
+void CPARSE_SYM(token_cache_stats_get)(
+    CPARSE_SYM(token_cache_stats)* stats,
+    const CPARSE_SYM(token_cache)* cache)
+{
+    memcpy(stats, &cache->stats, sizeof(*stats));
+}
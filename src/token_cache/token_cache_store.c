@@ -0,0 +1,99 @@
+/**
+ * \file token_cache/token_cache_store.c
+ *
+ * \brief Write a token cache entry.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <errno.h>
+#include <libcparse/status_codes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "token_cache_internal.h"
+
+CPARSE_IMPORT_token_cache_internal;
+
+/**
+ * \brief Write an entry file, replacing any existing entry atomically.
+ *
+ * The entry is written to a uniquely named temporary file in the cache
+ * directory, which is then renamed over the entry. A concurrent reader sees
+ * either the old entry or the new one, and never a partial write.
+ *
+ * \param cache             The cache for this operation.
+ * \param key               The key of the entry.
+ * \param data              The encoded token stream.
+ * \param size              The size of the encoded token stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR if the entry could not be
+ *        written.
+ */
+int CPARSE_SYM(token_cache_store)(
+    CPARSE_SYM(token_cache)* cache, const uint64_t key[2], const void* data,
+    size_t size)
+{
+    const uint8_t* curr = (const uint8_t*)data;
+    size_t remaining = size;
+    int desc;
+
+    /* create the temporary file. */
+    memcpy(cache->temp_path, cache->path, cache->dir_size + 1);
+    memcpy(
+        cache->temp_path + cache->dir_size + 1, CPARSE_TOKEN_CACHE_TEMP_NAME,
+        sizeof(CPARSE_TOKEN_CACHE_TEMP_NAME));
+
+    desc = mkstemp(cache->temp_path);
+    if (desc < 0)
+    {
+        return ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR;
+    }
+
+    /* write the entry. */
+    while (remaining > 0)
+    {
+        ssize_t written = write(desc, curr, remaining);
+        if (written < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        else if (written <= 0)
+        {
+            goto cleanup_temp;
+        }
+
+        curr += written;
+        remaining -= (size_t)written;
+    }
+
+    if (0 != close(desc))
+    {
+        desc = -1;
+        goto cleanup_temp;
+    }
+
+    /* move the entry into place. */
+    if (0 != rename(cache->temp_path, token_cache_path_format(cache, key)))
+    {
+        desc = -1;
+        goto cleanup_temp;
+    }
+
+    return STATUS_SUCCESS;
+
+cleanup_temp:
+    if (desc >= 0)
+    {
+        close(desc);
+    }
+
+    (void)unlink(cache->temp_path);
+
+    return ERROR_LIBCPARSE_TOKEN_CACHE_DIRECTORY_ERROR;
+}
@@ -0,0 +1,40 @@
+/**
+ * \file src/token_iterator/token_iterator_create.c
+ *
+ * \brief Create a \ref token_iterator instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_iterator;
+
+/**
+ * \brief Create a token iterator.
+ *
+ * \param it                Pointer to the \ref token_iterator pointer to be
+ *                          populated with the created iterator on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_create)(CPARSE_SYM(token_iterator)** it)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return token_iterator_create_with_allocator(it, &alloc);
+}
@@ -0,0 +1,117 @@
+/**
+ * \file src/token_iterator/token_iterator_create_with_allocator.c
+ *
+ * \brief Create a \ref token_iterator that uses a given \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/allocator.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+#include <string.h>
+
+#include "token_iterator_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_iterator;
+CPARSE_IMPORT_token_iterator_internal;
+
+/**
+ * \brief Create a token iterator that uses the given allocator for its memory.
+ *
+ * \param it                Pointer to the \ref token_iterator pointer to be
+ *                          populated with the created iterator on success.
+ * \param alloc             The allocator for this instance, which is copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_create_with_allocator)(
+    CPARSE_SYM(token_iterator)** it, const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    token_iterator* tmp;
+    event_handler eh;
+
+    /* allocate memory for this instance. */
+    tmp = (token_iterator*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_alloc;
+    }
+
+    /* create the parser stack. */
+    retval =
+        preprocessor_scanner_create_with_allocator(&tmp->scanner, &tmp->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the buffering event handler. */
+    retval = event_handler_init(&eh, &token_iterator_event_callback, tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* subscribe to the preprocessor scanner. */
+    retval =
+        abstract_parser_preprocessor_scanner_subscribe(
+            preprocessor_scanner_upcast(tmp->scanner), &eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    *it = tmp;
+    tmp = NULL;
+    goto cleanup_eh;
+
+cleanup_eh:
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_tmp:
+    if (NULL != tmp)
+    {
+        release_retval = token_iterator_release(tmp);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+    goto done;
+
+cleanup_alloc:
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
+
+done:
+    return retval;
+}
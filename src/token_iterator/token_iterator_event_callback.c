@@ -0,0 +1,69 @@
+/**
+ * \file src/token_iterator/token_iterator_event_callback.c
+ *
+ * \brief Buffer events for a \ref token_iterator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/event_type.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+
+#include "token_iterator_internal.h"
+
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_token_iterator;
+
+/**
+ * \brief Event handler callback for \ref token_iterator.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref token_iterator instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_ITERATOR_OVERFLOW if the buffer is full.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    int retval;
+    token_iterator* it = (token_iterator*)context;
+    size_t tail;
+
+    /* verify that there is room for this event. */
+    if (CPARSE_TOKEN_ITERATOR_BUFFER_SIZE == it->count)
+    {
+        return ERROR_LIBCPARSE_TOKEN_ITERATOR_OVERFLOW;
+    }
+
+    /* copy this event onto the tail of the buffer. */
+    tail = (it->head + it->count) % CPARSE_TOKEN_ITERATOR_BUFFER_SIZE;
+    retval =
+        event_copy_create_with_allocator(&it->buffer[tail], ev, &it->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ++it->count;
+
+    /* the EOF event is the last event of this run. */
+    if (CPARSE_EVENT_TYPE_EOF == event_get_type(ev))
+    {
+        it->eof = true;
+    }
+
+    /* ask the raw stack scanner to yield so this event can be pulled. */
+    it->yield = true;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file token_iterator/token_iterator_internal.h
+ *
+ * \brief Internal declarations and definitions for the token iterator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator.h>
+#include <libcparse/event_fwd.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/token_iterator.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The number of events that the iterator can buffer.
+ *
+ * The raw stack scanner yields after each character that produces an event,
+ * and a single character produces at most a few events, so this bound is never
+ * approached in practice.
+ */
+#define CPARSE_TOKEN_ITERATOR_BUFFER_SIZE 16
+
+struct CPARSE_SYM(token_iterator)
+{
+    CPARSE_SYM(preprocessor_scanner)* scanner;
+    CPARSE_SYM(event_copy)* buffer[CPARSE_TOKEN_ITERATOR_BUFFER_SIZE];
+    size_t head;
+    size_t count;
+    bool yield;
+    bool eof;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Event handler callback for \ref token_iterator.
+ *
+ * This copies each preprocessor scanner event into the iterator's buffer, and
+ * asks the raw stack scanner to yield.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref token_iterator instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_ITERATOR_OVERFLOW if the buffer is full.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_iterator_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline int \
+    sym ## token_iterator_event_callback( \
+        void* x, const CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(token_iterator_event_callback)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_iterator_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_iterator_internal_sym(sym ## _)
+#define CPARSE_IMPORT_token_iterator_internal \
+    __INTERNAL_CPARSE_IMPORT_token_iterator_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
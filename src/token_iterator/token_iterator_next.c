@@ -0,0 +1,117 @@
+/**
+ * \file src/token_iterator/token_iterator_next.c
+ *
+ * \brief Pull the next event from a \ref token_iterator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/message/raw_stack_scanner.h>
+#include <libcparse/message_handler.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+
+#include "token_iterator_internal.h"
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_message_handler;
+CPARSE_IMPORT_message_raw_stack_scanner;
+CPARSE_IMPORT_token_iterator;
+
+static int step(token_iterator* it);
+
+/**
+ * \brief Pull the next event from the preprocessor scanner.
+ *
+ * \param it                The \ref token_iterator instance for this
+ *                          operation.
+ * \param cpy               Pointer to the \ref event_copy pointer to receive
+ *                          the next event on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_ITERATOR_END if every event has been pulled.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_next)(
+    CPARSE_SYM(token_iterator)* it, CPARSE_SYM(event_copy)** cpy)
+{
+    int retval;
+
+    /* scan until an event is buffered. */
+    while (0 == it->count)
+    {
+        /* there is nothing left to scan after EOF. */
+        if (it->eof)
+        {
+            return ERROR_LIBCPARSE_TOKEN_ITERATOR_END;
+        }
+
+        retval = step(it);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* hand the head of the buffer to the caller. */
+    *cpy = it->buffer[it->head];
+    it->buffer[it->head] = NULL;
+    it->head = (it->head + 1) % CPARSE_TOKEN_ITERATOR_BUFFER_SIZE;
+    --it->count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Step the raw stack scanner until the preprocessor scanner produces an
+ * event.
+ *
+ * \param it                The \ref token_iterator instance for this
+ *                          operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int step(token_iterator* it)
+{
+    int retval, release_retval;
+    message_rss_step msg;
+
+    /* clear the yield flag; the event callback sets it again. */
+    it->yield = false;
+
+    /* initialize the message. */
+    retval = message_rss_step_init(&msg, &it->yield);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the message down the parser stack. */
+    retval =
+        message_handler_send(
+            abstract_parser_message_handler_get(token_iterator_upcast(it)),
+            message_rss_step_upcast(&msg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_msg;
+
+cleanup_msg:
+    release_retval = message_rss_step_dispose(&msg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
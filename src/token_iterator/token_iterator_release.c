@@ -0,0 +1,77 @@
+/**
+ * \file src/token_iterator/token_iterator_release.c
+ *
+ * \brief Release a \ref token_iterator instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+#include <string.h>
+
+#include "token_iterator_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_iterator;
+
+/**
+ * \brief Release a token iterator, along with its parser stack and any events
+ * that have not been pulled.
+ *
+ * \param it                The \ref token_iterator instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_iterator_release)(CPARSE_SYM(token_iterator)* it)
+{
+    int scanner_release_retval = STATUS_SUCCESS;
+    int copy_release_retval = STATUS_SUCCESS;
+    int retval;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &it->alloc, sizeof(alloc));
+
+    /* release the parser stack if valid. */
+    if (NULL != it->scanner)
+    {
+        scanner_release_retval = preprocessor_scanner_release(it->scanner);
+    }
+
+    /* release any events that were not pulled. */
+    for (size_t i = 0; i < it->count; ++i)
+    {
+        size_t index = (it->head + i) % CPARSE_TOKEN_ITERATOR_BUFFER_SIZE;
+
+        retval = event_copy_release(it->buffer[index]);
+        if (STATUS_SUCCESS != retval)
+        {
+            copy_release_retval = retval;
+        }
+    }
+
+    /* clear instance memory. */
+    memset(it, 0, sizeof(*it));
+
+    /* reclaim instance memory. */
+    allocator_free(&alloc, it);
+
+    /* decode return value. */
+    if (STATUS_SUCCESS != scanner_release_retval)
+    {
+        return scanner_release_retval;
+    }
+    else
+    {
+        return copy_release_retval;
+    }
+}
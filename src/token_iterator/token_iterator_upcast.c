@@ -0,0 +1,29 @@
+/**
+ * \file src/token_iterator/token_iterator_upcast.c
+ *
+ * \brief Get the \ref abstract_parser interface for a \ref token_iterator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/token_iterator.h>
+
+#include "token_iterator_internal.h"
+
+CPARSE_IMPORT_preprocessor_scanner;
+
+/**
+ * \brief Get the \ref abstract_parser interface for this iterator's parser
+ * stack.
+ *
+ * \param it                The \ref token_iterator instance to query.
+ *
+ * \returns the \ref abstract_parser interface for this iterator.
+ */
+CPARSE_SYM(abstract_parser)* CPARSE_SYM(token_iterator_upcast)(
+    CPARSE_SYM(token_iterator)* it)
+{
+    return preprocessor_scanner_upcast(it->scanner);
+}
@@ -0,0 +1,70 @@
+/**
+ * \file token_stream/token_stream_buffer_append.c
+ *
+ * \brief Append bytes to a token stream buffer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+
+/**
+ * \brief The initial capacity of a token stream buffer.
+ */
+#define INITIAL_CAPACITY 4096
+
+/**
+ * \brief Append bytes to a \ref token_stream_buffer, growing it as needed.
+ *
+ * \param buffer            The buffer for this operation.
+ * \param alloc             The allocator used to grow this buffer.
+ * \param data              The bytes to append.
+ * \param size              The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_buffer_append)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc, const void* data, size_t size)
+{
+    /* grow the buffer geometrically if this append does not fit. */
+    if (size > buffer->capacity - buffer->size)
+    {
+        size_t capacity =
+            (0 == buffer->capacity) ? INITIAL_CAPACITY : buffer->capacity;
+
+        while (size > capacity - buffer->size)
+        {
+            if (capacity > SIZE_MAX / 2)
+            {
+                return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+            }
+
+            capacity *= 2;
+        }
+
+        uint8_t* tmp =
+            (uint8_t*)allocator_reallocate(alloc, buffer->data, capacity);
+        if (NULL == tmp)
+        {
+            return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        }
+
+        buffer->data = tmp;
+        buffer->capacity = capacity;
+    }
+
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+
+    return STATUS_SUCCESS;
+}
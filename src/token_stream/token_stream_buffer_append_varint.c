@@ -0,0 +1,44 @@
+/**
+ * \file token_stream/token_stream_buffer_append_varint.c
+ *
+ * \brief Append a varint to a token stream buffer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_token_stream_internal;
+
+/**
+ * \brief Append a LEB128 varint to a \ref token_stream_buffer.
+ *
+ * \param buffer            The buffer for this operation.
+ * \param alloc             The allocator used to grow this buffer.
+ * \param val               The value to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_buffer_append_varint)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc, uint64_t val)
+{
+    uint8_t bytes[10];
+    size_t size = 0;
+
+    /* emit seven bits at a time, low bits first. */
+    while (val >= 0x80)
+    {
+        bytes[size++] = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+
+    bytes[size++] = (uint8_t)val;
+
+    return token_stream_buffer_append(buffer, alloc, bytes, size);
+}
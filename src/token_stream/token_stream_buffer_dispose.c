@@ -0,0 +1,34 @@
+/**
+ * \file token_stream/token_stream_buffer_dispose.c
+ *
+ * \brief Dispose of a token stream buffer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+
+/**
+ * \brief Dispose of a \ref token_stream_buffer, freeing its memory.
+ *
+ * \param buffer            The buffer to dispose.
+ * \param alloc             The allocator that grew this buffer.
+ */
+void CPARSE_SYM(token_stream_buffer_dispose)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    if (NULL != buffer->data)
+    {
+        memset(buffer->data, 0, buffer->capacity);
+        allocator_free(alloc, buffer->data);
+    }
+
+    memset(buffer, 0, sizeof(*buffer));
+}
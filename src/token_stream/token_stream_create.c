@@ -0,0 +1,48 @@
+/**
+ * \file token_stream/token_stream_create.c
+ *
+ * \brief Create a token stream view of an encoded buffer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Create a \ref token_stream view of an encoded buffer.
+ *
+ * \param stream                Pointer to the \ref token_stream pointer to set
+ *                              to the created instance on success.
+ * \param data                  The encoded buffer.
+ * \param size                  The size of the encoded buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if this buffer is not a valid
+ *        token stream.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION if this buffer was written
+ *        with a different version of the format.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_create)(
+    CPARSE_SYM(token_stream)** stream, const void* data, size_t size)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return token_stream_create_with_allocator(stream, data, size, &alloc);
+}
@@ -0,0 +1,197 @@
+/**
+ * \file token_stream/token_stream_create_with_allocator.c
+ *
+ * \brief Create a token stream view that uses a given allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_stream;
+CPARSE_IMPORT_token_stream_internal;
+
+static int validate_strings(
+    const uint8_t* index, uint32_t count, const char* data, size_t size);
+
+/**
+ * \brief Create a \ref token_stream view of an encoded buffer that uses the
+ * given allocator.
+ *
+ * Every event is decoded and checked here, without being broadcast, so that a
+ * truncated or corrupt file is rejected before any of its events are seen.
+ *
+ * \param stream                Pointer to the \ref token_stream pointer to set
+ *                              to the created instance on success.
+ * \param data                  The encoded buffer.
+ * \param size                  The size of the encoded buffer.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if this buffer is not a valid
+ *        token stream.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION if this buffer was written
+ *        with a different version of the format.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_create_with_allocator)(
+    CPARSE_SYM(token_stream)** stream, const void* data, size_t size,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval, release_retval;
+    const uint8_t* bytes = (const uint8_t*)data;
+    const uint8_t* sections[CPARSE_TOKEN_STREAM_SECTION_COUNT];
+    uint64_t sizes[CPARSE_TOKEN_STREAM_SECTION_COUNT];
+    uint32_t count, string_count;
+    token_stream* tmp;
+
+    /* check the magic number. */
+    if (
+        size < CPARSE_TOKEN_STREAM_HEADER_SIZE
+     || 0 != memcmp(bytes, CPARSE_TOKEN_STREAM_MAGIC, 4))
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* check the version. */
+    if (CPARSE_TOKEN_STREAM_VERSION != token_stream_le_read(bytes + 4, 4))
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION;
+    }
+
+    count = (uint32_t)token_stream_le_read(bytes + 8, 4);
+    string_count = (uint32_t)token_stream_le_read(bytes + 12, 4);
+
+    /* every section must lie within the buffer. */
+    for (int i = 0; i < CPARSE_TOKEN_STREAM_SECTION_COUNT; ++i)
+    {
+        uint64_t offset = token_stream_le_read(bytes + 16 + 16 * i, 8);
+        sizes[i] = token_stream_le_read(bytes + 24 + 16 * i, 8);
+
+        if (offset > size || sizes[i] > size - offset)
+        {
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+        }
+
+        sections[i] = bytes + offset;
+    }
+
+    /* the fixed width sections must match the counts. */
+    if (
+        sizes[CPARSE_TOKEN_STREAM_SECTION_TYPES] != 2 * (uint64_t)count
+     || sizes[CPARSE_TOKEN_STREAM_SECTION_CATEGORIES] != count
+     || sizes[CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX]
+            != 8 * (uint64_t)string_count)
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* every string must lie within the string data, and be terminated. */
+    retval =
+        validate_strings(
+            sections[CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX], string_count,
+            (const char*)sections[CPARSE_TOKEN_STREAM_SECTION_STRING_DATA],
+            sizes[CPARSE_TOKEN_STREAM_SECTION_STRING_DATA]);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* allocate memory for this instance. */
+    tmp = (token_stream*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(*tmp));
+        allocator_free(alloc, tmp);
+        return retval;
+    }
+
+    /* point each column into the buffer. */
+    tmp->types = sections[CPARSE_TOKEN_STREAM_SECTION_TYPES];
+    tmp->categories = sections[CPARSE_TOKEN_STREAM_SECTION_CATEGORIES];
+    tmp->cursors = sections[CPARSE_TOKEN_STREAM_SECTION_CURSORS];
+    tmp->cursors_end =
+        tmp->cursors + sizes[CPARSE_TOKEN_STREAM_SECTION_CURSORS];
+    tmp->payloads = sections[CPARSE_TOKEN_STREAM_SECTION_PAYLOADS];
+    tmp->payloads_end =
+        tmp->payloads + sizes[CPARSE_TOKEN_STREAM_SECTION_PAYLOADS];
+    tmp->string_index = sections[CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX];
+    tmp->string_data =
+        (const char*)sections[CPARSE_TOKEN_STREAM_SECTION_STRING_DATA];
+    tmp->count = count;
+    tmp->string_count = string_count;
+
+    /* every event must decode. */
+    retval = token_stream_decode(tmp, NULL, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *stream = tmp;
+
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = token_stream_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Verify that every string in the string index is in bounds and
+ * NUL-terminated.
+ *
+ * \param index             The string index.
+ * \param count             The number of strings.
+ * \param data              The string data.
+ * \param size              The size of the string data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if a string is invalid.
+ */
+static int validate_strings(
+    const uint8_t* index, uint32_t count, const char* data, size_t size)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint64_t offset = token_stream_le_read(index + 8 * i, 4);
+        uint64_t length = token_stream_le_read(index + 8 * i + 4, 4);
+
+        if (offset >= size || length >= size - offset)
+        {
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+        }
+
+        if (0 != data[offset + length])
+        {
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,1010 @@
+/**
+ * \file token_stream/token_stream_decode.c
+ *
+ * \brief Decode the events in a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event.h>
+#include <libcparse/event/identifier.h>
+#include <libcparse/event/include.h>
+#include <libcparse/event/integer.h>
+#include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_character_literal.h>
+#include <libcparse/event/raw_float.h>
+#include <libcparse/event/raw_integer.h>
+#include <libcparse/event/raw_span.h>
+#include <libcparse/event/raw_string.h>
+#include <libcparse/event/string.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/event_type.h>
+#include <libcparse/integer_type.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "../event/event_internal.h"
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_identifier;
+CPARSE_IMPORT_event_include;
+CPARSE_IMPORT_event_integer;
+CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_character_literal;
+CPARSE_IMPORT_event_raw_float;
+CPARSE_IMPORT_event_raw_integer;
+CPARSE_IMPORT_event_raw_span;
+CPARSE_IMPORT_event_raw_string;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_event_string;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_token_stream;
+CPARSE_IMPORT_token_stream_internal;
+
+typedef struct replay_symbol replay_symbol;
+typedef struct replay_context replay_context;
+
+/**
+ * \brief An identifier string re-interned in the caller's intern table.
+ */
+struct replay_symbol
+{
+    const char* str;
+    uint32_t symbol;
+};
+
+/**
+ * \brief The state of a single replay.
+ */
+struct replay_context
+{
+    const token_stream* stream;
+    event_reactor* reactor;
+    intern_table* symbols;
+    replay_symbol* map;
+    const uint8_t* cursor;
+    const uint8_t* payload;
+    uint64_t prev[CPARSE_TOKEN_STREAM_CURSOR_FIELDS];
+};
+
+static int read_cursor(replay_context* ctx, cursor* pos);
+static int string_lookup(
+    replay_context* ctx, const char** str, size_t* size, uint64_t id);
+static int read_varint(replay_context* ctx, uint64_t* val);
+static int read_string(
+    replay_context* ctx, const char** str, size_t* size, uint64_t* id);
+static int broadcast(replay_context* ctx, int event_type, const event* ev);
+static int replay_base(replay_context* ctx, int event_type, const cursor* pos);
+static int replay_identifier(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_include(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_integer(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_character(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_character_literal(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_float(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_integer(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_span(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_raw_string(
+    replay_context* ctx, int event_type, const cursor* pos);
+static int replay_string(
+    replay_context* ctx, int event_type, const cursor* pos);
+
+/**
+ * \brief Decode every event in a \ref token_stream, in the order in which the
+ * events were recorded, and broadcast each to an event reactor.
+ *
+ * With no reactor, each event is decoded and checked, but not broadcast, so
+ * that a stream can be validated before any of its events are seen.
+ *
+ * \param stream                The \ref token_stream to decode.
+ * \param reactor               The event reactor that receives the events, or
+ *                              NULL to only check them.
+ * \param symbols               The intern table for identifiers, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if an event can't be decoded.
+ *      - a non-zero error code from a subscriber, which stops the decoding.
+ */
+int CPARSE_SYM(token_stream_decode)(
+    const CPARSE_SYM(token_stream)* stream,
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(intern_table)* symbols)
+{
+    int retval = STATUS_SUCCESS;
+    replay_context ctx;
+    size_t map_size = stream->string_count * sizeof(replay_symbol);
+    cursor pos;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.stream = stream;
+    ctx.reactor = reactor;
+    ctx.symbols = symbols;
+    ctx.cursor = stream->cursors;
+    ctx.payload = stream->payloads;
+
+    /* each distinct identifier is re-interned at most once. */
+    if (NULL != symbols && 0 != map_size)
+    {
+        ctx.map = (replay_symbol*)allocator_allocate(&stream->alloc, map_size);
+        if (NULL == ctx.map)
+        {
+            retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+            goto done;
+        }
+
+        memset(ctx.map, 0, map_size);
+    }
+
+    for (uint32_t i = 0; i < stream->count; ++i)
+    {
+        int event_type = (int)token_stream_le_read(stream->types + 2 * i, 2);
+
+        /* no scanner broadcasts an unknown event. */
+        if (CPARSE_EVENT_TYPE_UNKNOWN == event_type)
+        {
+            retval = ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+            goto cleanup_map;
+        }
+
+        retval = read_cursor(&ctx, &pos);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_map;
+        }
+
+        switch (stream->categories[i])
+        {
+            case CPARSE_EVENT_CATEGORY_BASE:
+                retval = replay_base(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_IDENTIFIER:
+                retval = replay_identifier(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_INCLUDE:
+                retval = replay_include(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_INTEGER_TOKEN:
+                retval = replay_integer(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_CHARACTER:
+                retval = replay_raw_character(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_CHARACTER_LITERAL:
+                retval = replay_raw_character_literal(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_FLOAT_TOKEN:
+                retval = replay_raw_float(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_INTEGER_TOKEN:
+                retval = replay_raw_integer(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_SPAN:
+                retval = replay_raw_span(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_RAW_STRING_TOKEN:
+                retval = replay_raw_string(&ctx, event_type, &pos);
+                break;
+
+            case CPARSE_EVENT_CATEGORY_STRING:
+                retval = replay_string(&ctx, event_type, &pos);
+                break;
+
+            default:
+                retval = ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_map;
+        }
+    }
+
+    /* every cursor and payload must belong to an event. */
+    if (
+        ctx.cursor != stream->cursors_end
+     || ctx.payload != stream->payloads_end)
+    {
+        retval = ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+        goto cleanup_map;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_map;
+
+cleanup_map:
+    if (NULL != ctx.map)
+    {
+        memset(ctx.map, 0, map_size);
+        allocator_free(&stream->alloc, ctx.map);
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Decode the next cursor from its deltas.
+ *
+ * \param ctx               The replay context.
+ * \param pos               The cursor to decode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT on a decoding error.
+ */
+static int read_cursor(replay_context* ctx, cursor* pos)
+{
+    int retval;
+    uint64_t delta;
+    size_t size;
+
+    for (int i = 0; i < CPARSE_TOKEN_STREAM_CURSOR_FIELDS; ++i)
+    {
+        retval =
+            token_stream_varint_read(
+                &delta, &ctx->cursor, ctx->stream->cursors_end);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ctx->prev[i] += CPARSE_TOKEN_STREAM_UNZIGZAG(delta);
+    }
+
+    /* the file is a string ID. */
+    retval = string_lookup(ctx, &pos->file, &size, ctx->prev[0]);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    pos->file_id = (uint32_t)ctx->prev[1];
+    pos->begin_line = (unsigned int)ctx->prev[2];
+    pos->begin_col = (unsigned int)ctx->prev[3];
+    pos->end_line = (unsigned int)ctx->prev[4];
+    pos->end_col = (unsigned int)ctx->prev[5];
+    pos->begin_offset = (size_t)ctx->prev[6];
+    pos->end_offset = (size_t)ctx->prev[7];
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Look up a string by its ID.
+ *
+ * \param ctx               The replay context.
+ * \param str               Pointer to receive the string, or NULL for ID 0.
+ * \param size              Pointer to receive the size of the string.
+ * \param id                The string ID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if the ID is out of range.
+ */
+static int string_lookup(
+    replay_context* ctx, const char** str, size_t* size, uint64_t id)
+{
+    const uint8_t* entry;
+
+    if (0 == id)
+    {
+        *str = NULL;
+        *size = 0;
+        return STATUS_SUCCESS;
+    }
+
+    if (id > ctx->stream->string_count)
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* the bounds of every string were checked when the stream was created. */
+    entry = ctx->stream->string_index + 8 * (id - 1);
+    *str = ctx->stream->string_data + token_stream_le_read(entry, 4);
+    *size = (size_t)token_stream_le_read(entry + 4, 4);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the next payload value.
+ *
+ * \param ctx               The replay context.
+ * \param val               Pointer to receive the value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT on a decoding error.
+ */
+static int read_varint(replay_context* ctx, uint64_t* val)
+{
+    return
+        token_stream_varint_read(
+            val, &ctx->payload, ctx->stream->payloads_end);
+}
+
+/**
+ * \brief Read the next payload value as a string.
+ *
+ * \param ctx               The replay context.
+ * \param str               Pointer to receive the string, or NULL.
+ * \param size              Pointer to receive the size of the string.
+ * \param id                Pointer to receive the string ID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT on a decoding error.
+ */
+static int read_string(
+    replay_context* ctx, const char** str, size_t* size, uint64_t* id)
+{
+    int retval;
+
+    retval = read_varint(ctx, id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return string_lookup(ctx, str, size, *id);
+}
+
+/**
+ * \brief Broadcast a decoded event, unless the stream is only being checked.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type, which must match the type
+ *                          of the decoded event.
+ * \param ev                The decoded event.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if the types don't match.
+ *      - a non-zero error code from a subscriber.
+ */
+static int broadcast(replay_context* ctx, int event_type, const event* ev)
+{
+    if (event_type != event_get_type(ev))
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* when only checking the stream, the event is not broadcast. */
+    if (NULL == ctx->reactor)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    return event_reactor_broadcast(ctx->reactor, ev);
+}
+
+/**
+ * \brief Replay a base event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_base(replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    event ev;
+
+    retval = event_init(&ev, event_type, CPARSE_EVENT_CATEGORY_BASE, pos);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, &ev);
+
+    release_retval = event_dispose(&ev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay an identifier event, re-interning it if requested.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_identifier(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id, symbol;
+    event_identifier iev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = read_varint(ctx, &symbol);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL == str || symbol > UINT32_MAX)
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* re-intern this identifier the first time that it is seen. */
+    if (NULL != ctx->map)
+    {
+        replay_symbol* entry = &ctx->map[id - 1];
+
+        if (NULL == entry->str)
+        {
+            retval =
+                intern_table_intern(
+                    &entry->str, &entry->symbol, ctx->symbols, str, size);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        str = entry->str;
+        symbol = entry->symbol;
+    }
+
+    retval = event_identifier_init_for_symbol(&iev, pos, str, symbol);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_identifier_upcast(&iev));
+
+    release_retval = event_identifier_dispose(&iev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay an include event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_include(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id;
+    event_include iev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    switch (event_type)
+    {
+        case CPARSE_EVENT_TYPE_PREPROCESSOR_SYSTEM_INCLUDE:
+            retval = event_include_init_for_system_include(&iev, pos, str);
+            break;
+
+        case CPARSE_EVENT_TYPE_PREPROCESSOR_LOCAL_INCLUDE:
+            retval = event_include_init_for_local_include(&iev, pos, str);
+            break;
+
+        default:
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_include_upcast(&iev));
+
+    release_retval = event_include_dispose(&iev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay an integer token event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_integer(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    uint64_t integer_type, val;
+    event_integer_token iev;
+
+    retval = read_varint(ctx, &integer_type);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = read_varint(ctx, &val);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the value was recorded as the bits of the unsigned member. */
+    switch (integer_type)
+    {
+        case CPARSE_INTEGER_TYPE_SIGNED_INT:
+            retval = event_integer_token_init_for_signed_int(&iev, pos, val);
+            break;
+
+        case CPARSE_INTEGER_TYPE_UNSIGNED_INT:
+            retval = event_integer_token_init_for_unsigned_int(&iev, pos, val);
+            break;
+
+        case CPARSE_INTEGER_TYPE_SIGNED_LONG:
+            retval = event_integer_token_init_for_signed_long(&iev, pos, val);
+            break;
+
+        case CPARSE_INTEGER_TYPE_UNSIGNED_LONG:
+            retval =
+                event_integer_token_init_for_unsigned_long(&iev, pos, val);
+            break;
+
+        case CPARSE_INTEGER_TYPE_SIGNED_LONG_LONG:
+            retval =
+                event_integer_token_init_for_signed_long_long(
+                    &iev, pos, (long long)val);
+            break;
+
+        case CPARSE_INTEGER_TYPE_UNSIGNED_LONG_LONG:
+            retval =
+                event_integer_token_init_for_unsigned_long_long(
+                    &iev, pos, val);
+            break;
+
+        default:
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_integer_token_upcast(&iev));
+
+    release_retval = event_integer_token_dispose(&iev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw character event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_character(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    uint64_t ch;
+    event_raw_character cev;
+
+    retval = read_varint(ctx, &ch);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        event_raw_character_init(
+            &cev, pos, (int)(int64_t)CPARSE_TOKEN_STREAM_UNZIGZAG(ch));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_raw_character_upcast(&cev));
+
+    release_retval = event_raw_character_dispose(&cev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw character literal event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_character_literal(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id;
+    event_raw_character_literal cev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = event_raw_character_literal_init(&cev, pos, str);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        broadcast(ctx, event_type, event_raw_character_literal_upcast(&cev));
+
+    release_retval = event_raw_character_literal_dispose(&cev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw float token event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_float(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id, has_sign;
+    event_raw_float_token fev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = read_varint(ctx, &has_sign);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* strings in the stream are NUL-terminated, as the view requires. */
+    retval = event_raw_float_token_init_for_view(&fev, pos, str, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (0 != has_sign)
+    {
+        retval = event_raw_float_token_sign_set(&fev, true);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_fev;
+        }
+    }
+
+    retval = broadcast(ctx, event_type, event_raw_float_token_upcast(&fev));
+    goto cleanup_fev;
+
+cleanup_fev:
+    release_retval = event_raw_float_token_dispose(&fev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw integer token event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_integer(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id, has_sign;
+    event_raw_integer_token iev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = read_varint(ctx, &has_sign);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* strings in the stream are NUL-terminated, as the view requires. */
+    retval = event_raw_integer_token_init_for_view(&iev, pos, str, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (0 != has_sign)
+    {
+        retval = event_raw_integer_token_sign_set(&iev, true);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_iev;
+        }
+    }
+
+    retval = broadcast(ctx, event_type, event_raw_integer_token_upcast(&iev));
+    goto cleanup_iev;
+
+cleanup_iev:
+    release_retval = event_raw_integer_token_dispose(&iev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw span event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_span(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id;
+    event_raw_span sev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL == str)
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    retval = event_raw_span_init(&sev, pos, str, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_raw_span_upcast(&sev));
+
+    release_retval = event_raw_span_dispose(&sev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a raw string token event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_raw_string(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id;
+    event_raw_string_token sev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* strings in the stream are NUL-terminated, as the view requires. */
+    if (CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_SYSTEM_STRING == event_type)
+    {
+        retval =
+            event_raw_string_token_init_for_system_view(&sev, pos, str, size);
+    }
+    else
+    {
+        retval =
+            event_raw_string_token_init_for_view(&sev, pos, str, size);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_raw_string_token_upcast(&sev));
+
+    release_retval = event_raw_string_token_dispose(&sev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Replay a string event.
+ *
+ * \param ctx               The replay context.
+ * \param event_type        The recorded event type.
+ * \param pos               The decoded cursor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_string(
+    replay_context* ctx, int event_type, const cursor* pos)
+{
+    int retval, release_retval;
+    const char* str;
+    size_t size;
+    uint64_t id;
+    event_string sev;
+
+    retval = read_string(ctx, &str, &size, &id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (CPARSE_EVENT_TYPE_TOKEN_VALUE_SYSTEM_STRING == event_type)
+    {
+        retval = event_string_init_for_system_string(&sev, pos, str);
+    }
+    else
+    {
+        retval = event_string_init(&sev, pos, str);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = broadcast(ctx, event_type, event_string_upcast(&sev));
+
+    release_retval = event_string_dispose(&sev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file token_stream/token_stream_event_count_get.c
+ *
+ * \brief Get the number of events in a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_stream_internal.h"
+
+/**
+ * \brief Get the number of events in a \ref token_stream.
+ *
+ * \param stream                The \ref token_stream to query.
+ *
+ * \returns the number of events in this stream.
+ */
+size_t CPARSE_SYM(token_stream_event_count_get)(
+    const CPARSE_SYM(token_stream)* stream)
+{
+    return stream->count;
+}
@@ -0,0 +1,289 @@
+/**
+ * \file token_stream/token_stream_internal.h
+ *
+ * \brief Internal declarations and definitions for the token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator/detail.h>
+#include <libcparse/cursor.h>
+#include <libcparse/event_reactor_fwd.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/token_stream.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The magic number at the start of every token stream.
+ */
+#define CPARSE_TOKEN_STREAM_MAGIC "CPTS"
+
+/**
+ * \brief Every section in a token stream starts on a multiple of this size.
+ */
+#define CPARSE_TOKEN_STREAM_SECTION_ALIGNMENT 8
+
+/**
+ * \brief The number of cursor fields, each of which is delta encoded.
+ */
+#define CPARSE_TOKEN_STREAM_CURSOR_FIELDS 8
+
+/**
+ * \brief Map a signed delta onto an unsigned value, so that deltas close to
+ * zero encode as short varints in either direction.
+ */
+#define CPARSE_TOKEN_STREAM_ZIGZAG(x) \
+    (((uint64_t)(x) << 1) ^ (uint64_t)((int64_t)(x) >> 63))
+
+/**
+ * \brief Reverse \ref CPARSE_TOKEN_STREAM_ZIGZAG.
+ */
+#define CPARSE_TOKEN_STREAM_UNZIGZAG(x) \
+    (((uint64_t)(x) >> 1) ^ (0 - ((uint64_t)(x) & 1)))
+
+/**
+ * \brief The sections of a token stream, in the order in which they are
+ * written.
+ */
+enum CPARSE_SYM(token_stream_section)
+{
+    /* one little-endian 16-bit event type per event. */
+    CPARSE_TOKEN_STREAM_SECTION_TYPES =                                 0,
+
+    /* one 8-bit event category per event. */
+    CPARSE_TOKEN_STREAM_SECTION_CATEGORIES =                            1,
+
+    /* varint cursor deltas, CPARSE_TOKEN_STREAM_CURSOR_FIELDS per event. */
+    CPARSE_TOKEN_STREAM_SECTION_CURSORS =                               2,
+
+    /* varint category-specific values, such as string IDs. */
+    CPARSE_TOKEN_STREAM_SECTION_PAYLOADS =                              3,
+
+    /* a little-endian 32-bit offset and 32-bit size per string. */
+    CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX =                          4,
+
+    /* the bytes of each string, each followed by a NUL. */
+    CPARSE_TOKEN_STREAM_SECTION_STRING_DATA =                           5,
+
+    CPARSE_TOKEN_STREAM_SECTION_COUNT =                                 6,
+};
+
+/**
+ * \brief The size of the token stream header.
+ *
+ * The header is the magic number, followed by the little-endian 32-bit
+ * version, event count, and string count, followed by a little-endian 64-bit
+ * offset and size for each section.
+ */
+#define CPARSE_TOKEN_STREAM_HEADER_SIZE \
+    (16 + 16 * CPARSE_TOKEN_STREAM_SECTION_COUNT)
+
+typedef struct CPARSE_SYM(token_stream_buffer)
+CPARSE_SYM(token_stream_buffer);
+
+/**
+ * \brief A growable byte buffer for a single section.
+ */
+struct CPARSE_SYM(token_stream_buffer)
+{
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+};
+
+struct CPARSE_SYM(token_stream_writer)
+{
+    CPARSE_SYM(intern_table)* strings;
+    CPARSE_SYM(token_stream_buffer) types;
+    CPARSE_SYM(token_stream_buffer) categories;
+    CPARSE_SYM(token_stream_buffer) cursors;
+    CPARSE_SYM(token_stream_buffer) payloads;
+    uint32_t count;
+    uint64_t prev[CPARSE_TOKEN_STREAM_CURSOR_FIELDS];
+    CPARSE_SYM(allocator) alloc;
+};
+
+struct CPARSE_SYM(token_stream)
+{
+    const uint8_t* types;
+    const uint8_t* categories;
+    const uint8_t* cursors;
+    const uint8_t* cursors_end;
+    const uint8_t* payloads;
+    const uint8_t* payloads_end;
+    const uint8_t* string_index;
+    const char* string_data;
+    uint32_t count;
+    uint32_t string_count;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Append bytes to a \ref token_stream_buffer, growing it as needed.
+ *
+ * \param buffer            The buffer for this operation.
+ * \param alloc             The allocator used to grow this buffer.
+ * \param data              The bytes to append.
+ * \param size              The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_buffer_append)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc, const void* data, size_t size);
+
+/**
+ * \brief Append a LEB128 varint to a \ref token_stream_buffer.
+ *
+ * \param buffer            The buffer for this operation.
+ * \param alloc             The allocator used to grow this buffer.
+ * \param val               The value to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_buffer_append_varint)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc, uint64_t val);
+
+/**
+ * \brief Dispose of a \ref token_stream_buffer, freeing its memory.
+ *
+ * \param buffer            The buffer to dispose.
+ * \param alloc             The allocator that grew this buffer.
+ */
+void CPARSE_SYM(token_stream_buffer_dispose)(
+    CPARSE_SYM(token_stream_buffer)* buffer,
+    const CPARSE_SYM(allocator)* alloc);
+
+/**
+ * \brief Read a LEB128 varint, advancing past it.
+ *
+ * \param val               Pointer to receive the value on success.
+ * \param curr              Pointer to the read position, which is advanced
+ *                          past the varint on success.
+ * \param end               The end of the readable bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if the varint is truncated
+ *        or too long.
+ */
+int CPARSE_SYM(token_stream_varint_read)(
+    uint64_t* val, const uint8_t** curr, const uint8_t* end);
+
+/**
+ * \brief Read a little-endian unsigned integer.
+ *
+ * \param data              The bytes to read.
+ * \param width             The width of the integer, in bytes.
+ *
+ * \returns the integer.
+ */
+uint64_t CPARSE_SYM(token_stream_le_read)(const uint8_t* data, size_t width);
+
+/**
+ * \brief Write a little-endian unsigned integer.
+ *
+ * \param data              The bytes to write.
+ * \param val               The integer to write.
+ * \param width             The width of the integer, in bytes.
+ */
+void CPARSE_SYM(token_stream_le_write)(
+    uint8_t* data, uint64_t val, size_t width);
+
+/**
+ * \brief Decode every event in a \ref token_stream, and broadcast each to an
+ * event reactor.
+ *
+ * \param stream            The \ref token_stream to decode.
+ * \param reactor           The event reactor that receives the events, or NULL
+ *                          to only check them.
+ * \param symbols           The intern table for identifiers, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if an event can't be decoded.
+ *      - a non-zero error code from a subscriber, which stops the decoding.
+ */
+int CPARSE_SYM(token_stream_decode)(
+    const CPARSE_SYM(token_stream)* stream,
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(intern_table)* symbols);
+
+/**
+ * \brief Event handler callback for \ref token_stream_writer.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref token_stream_writer instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_token_stream_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    typedef CPARSE_SYM(token_stream_buffer) sym ## token_stream_buffer; \
+    static inline int sym ## token_stream_buffer_append( \
+        CPARSE_SYM(token_stream_buffer)* w, \
+        const CPARSE_SYM(allocator)* x, const void* y, size_t z) { \
+            return CPARSE_SYM(token_stream_buffer_append)(w,x,y,z); } \
+    static inline int sym ## token_stream_buffer_append_varint( \
+        CPARSE_SYM(token_stream_buffer)* x, \
+        const CPARSE_SYM(allocator)* y, uint64_t z) { \
+            return CPARSE_SYM(token_stream_buffer_append_varint)(x,y,z); } \
+    static inline void sym ## token_stream_buffer_dispose( \
+        CPARSE_SYM(token_stream_buffer)* x, \
+        const CPARSE_SYM(allocator)* y) { \
+            CPARSE_SYM(token_stream_buffer_dispose)(x,y); } \
+    static inline int sym ## token_stream_varint_read( \
+        uint64_t* x, const uint8_t** y, const uint8_t* z) { \
+            return CPARSE_SYM(token_stream_varint_read)(x,y,z); } \
+    static inline uint64_t sym ## token_stream_le_read( \
+        const uint8_t* x, size_t y) { \
+            return CPARSE_SYM(token_stream_le_read)(x,y); } \
+    static inline void sym ## token_stream_le_write( \
+        uint8_t* x, uint64_t y, size_t z) { \
+            CPARSE_SYM(token_stream_le_write)(x,y,z); } \
+    static inline int sym ## token_stream_decode( \
+        const CPARSE_SYM(token_stream)* x, \
+        CPARSE_SYM(event_reactor)* y, CPARSE_SYM(intern_table)* z) { \
+            return CPARSE_SYM(token_stream_decode)(x,y,z); } \
+    static inline int sym ## token_stream_writer_event_callback( \
+        void* x, const CPARSE_SYM(event)* y) { \
+            return CPARSE_SYM(token_stream_writer_event_callback)(x,y); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_token_stream_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_token_stream_internal_sym(sym ## _)
+#define CPARSE_IMPORT_token_stream_internal \
+    __INTERNAL_CPARSE_IMPORT_token_stream_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
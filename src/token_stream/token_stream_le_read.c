@@ -0,0 +1,30 @@
+/**
+ * \file token_stream/token_stream_le_read.c
+ *
+ * \brief Read a little-endian integer from a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_stream_internal.h"
+
+/**
+ * \brief Read a little-endian unsigned integer.
+ *
+ * \param data              The bytes to read.
+ * \param width             The width of the integer, in bytes.
+ *
+ * \returns the integer.
+ */
+uint64_t CPARSE_SYM(token_stream_le_read)(const uint8_t* data, size_t width)
+{
+    uint64_t val = 0;
+
+    for (size_t i = width; i > 0; --i)
+    {
+        val = (val << 8) | data[i - 1];
+    }
+
+    return val;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file token_stream/token_stream_le_write.c
+ *
+ * \brief Write a little-endian integer to a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_stream_internal.h"
+
+/**
+ * \brief Write a little-endian unsigned integer.
+ *
+ * \param data              The bytes to write.
+ * \param val               The integer to write.
+ * \param width             The width of the integer, in bytes.
+ */
+void CPARSE_SYM(token_stream_le_write)(
+    uint8_t* data, uint64_t val, size_t width)
+{
+    for (size_t i = 0; i < width; ++i)
+    {
+        data[i] = (uint8_t)val;
+        val >>= 8;
+    }
+}
@@ -0,0 +1,39 @@
+/**
+ * \file token_stream/token_stream_release.c
+ *
+ * \brief Release a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+
+/**
+ * \brief Release a \ref token_stream instance.
+ *
+ * \param stream                The \ref token_stream instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_release)(CPARSE_SYM(token_stream)* stream)
+{
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &stream->alloc, sizeof(alloc));
+
+    /* clear and free this instance; the buffer belongs to the caller. */
+    memset(stream, 0, sizeof(*stream));
+    allocator_free(&alloc, stream);
+
+    return STATUS_SUCCESS;
+}
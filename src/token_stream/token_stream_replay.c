@@ -0,0 +1,34 @@
+/**
+ * \file token_stream/token_stream_replay.c
+ *
+ * \brief Broadcast the events in a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_token_stream_internal;
+
+/**
+ * \brief Broadcast every event in a \ref token_stream to an event reactor, in
+ * the order in which the events were recorded.
+ *
+ * Every event was decoded and checked when the stream was created, so a
+ * replay can only be stopped by a subscriber.
+ *
+ * \param stream                The \ref token_stream to replay.
+ * \param reactor               The event reactor that receives the events.
+ * \param symbols               The intern table for identifiers, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from a subscriber, which stops the replay.
+ */
+int CPARSE_SYM(token_stream_replay)(
+    const CPARSE_SYM(token_stream)* stream,
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(intern_table)* symbols)
+{
+    return token_stream_decode(stream, reactor, symbols);
+}
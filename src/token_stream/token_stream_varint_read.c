@@ -0,0 +1,60 @@
+/**
+ * \file token_stream/token_stream_varint_read.c
+ *
+ * \brief Read a varint from a token stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "token_stream_internal.h"
+
+/**
+ * \brief Read a LEB128 varint, advancing past it.
+ *
+ * \param val               Pointer to receive the value on success.
+ * \param curr              Pointer to the read position, which is advanced
+ *                          past the varint on success.
+ * \param end               The end of the readable bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT if the varint is truncated
+ *        or too long.
+ */
+int CPARSE_SYM(token_stream_varint_read)(
+    uint64_t* val, const uint8_t** curr, const uint8_t* end)
+{
+    const uint8_t* p = *curr;
+    uint64_t tmp = 0;
+
+    /* most values fit in a single byte. */
+    if (p < end && *p < 0x80)
+    {
+        *val = *p;
+        *curr = p + 1;
+        return STATUS_SUCCESS;
+    }
+
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (p >= end)
+        {
+            return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+        }
+
+        uint8_t byte = *p++;
+        tmp |= (uint64_t)(byte & 0x7F) << shift;
+
+        if (0 == (byte & 0x80))
+        {
+            *val = tmp;
+            *curr = p;
+            return STATUS_SUCCESS;
+        }
+    }
+
+    return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+}
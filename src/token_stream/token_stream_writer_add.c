@@ -0,0 +1,385 @@
+/**
+ * \file token_stream/token_stream_writer_add.c
+ *
+ * \brief Record an event in a token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event/detail.h>
+#include <libcparse/event/identifier.h>
+#include <libcparse/event/include.h>
+#include <libcparse/event/integer.h>
+#include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_character_literal.h>
+#include <libcparse/event/raw_float.h>
+#include <libcparse/event/raw_integer.h>
+#include <libcparse/event/raw_span.h>
+#include <libcparse/event/raw_string.h>
+#include <libcparse/event/string.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "../event/event_internal.h"
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_identifier;
+CPARSE_IMPORT_event_include;
+CPARSE_IMPORT_event_integer;
+CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_character_literal;
+CPARSE_IMPORT_event_raw_float;
+CPARSE_IMPORT_event_raw_integer;
+CPARSE_IMPORT_event_raw_span;
+CPARSE_IMPORT_event_raw_string;
+CPARSE_IMPORT_event_string;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_token_stream;
+CPARSE_IMPORT_token_stream_internal;
+
+/**
+ * \brief The most varints that any event category adds to the payloads.
+ */
+#define MAX_PAYLOAD 2
+
+static int add_cursor(token_stream_writer* writer, const cursor* pos);
+static int string_id(
+    uint64_t* id, token_stream_writer* writer, const char* str, size_t size);
+
+/**
+ * \brief Record an event in a \ref token_stream_writer.
+ *
+ * \param writer                The \ref token_stream_writer for this
+ *                              operation.
+ * \param ev                    The event to record.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_TOKEN_STREAM_UNSUPPORTED_EVENT_CATEGORY if this event
+ *        can't be encoded.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_add)(
+    CPARSE_SYM(token_stream_writer)* writer, const CPARSE_SYM(event)* ev)
+{
+    int retval;
+    int event_type = event_get_type(ev);
+    int category = event_get_category(ev);
+    const char* str = NULL;
+    size_t size = 0;
+    bool has_string = false;
+    bool view = false;
+    uint64_t payload[MAX_PAYLOAD];
+    size_t payload_count = 0;
+    uint8_t type_bytes[2];
+    uint8_t category_byte;
+    event_identifier* identifier_ev;
+    event_include* include_ev;
+    event_integer_token* integer_ev;
+    event_raw_character* character_ev;
+    event_raw_character_literal* literal_ev;
+    event_raw_float_token* float_ev;
+    event_raw_integer_token* raw_integer_ev;
+    event_raw_span* span_ev;
+    event_raw_string_token* raw_string_ev;
+    event_string* string_ev;
+
+    /* the type must fit in its column, and the count in the header. */
+    if (
+        event_type < 0 || event_type > UINT16_MAX
+     || UINT32_MAX == writer->count)
+    {
+        return ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT;
+    }
+
+    /* gather the category-specific values of this event. */
+    switch (category)
+    {
+        case CPARSE_EVENT_CATEGORY_BASE:
+            retval = STATUS_SUCCESS;
+            break;
+
+        case CPARSE_EVENT_CATEGORY_IDENTIFIER:
+            retval =
+                event_downcast_to_event_identifier(&identifier_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_identifier_get(identifier_ev);
+                payload[1] = event_identifier_symbol_get(identifier_ev);
+                payload_count = 1;
+                has_string = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_INCLUDE:
+            retval = event_downcast_to_event_include(&include_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_include_file_get(include_ev);
+                has_string = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_INTEGER_TOKEN:
+            retval =
+                event_downcast_to_event_integer_token(&integer_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                payload[0] = (uint64_t)integer_ev->integer_type;
+                payload[1] = integer_ev->val.unsigned_val;
+                payload_count = 2;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_CHARACTER:
+            retval =
+                event_downcast_to_event_raw_character(
+                    &character_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                payload[0] =
+                    CPARSE_TOKEN_STREAM_ZIGZAG(
+                        (int64_t)event_raw_character_get(character_ev));
+                payload_count = 1;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_CHARACTER_LITERAL:
+            retval =
+                event_downcast_to_event_raw_character_literal(
+                    &literal_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_raw_character_literal_get(literal_ev);
+                has_string = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_FLOAT_TOKEN:
+            retval =
+                event_downcast_to_event_raw_float_token(&float_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_raw_float_token_string_get(float_ev);
+                size = event_raw_float_token_size_get(float_ev);
+                payload[1] = float_ev->has_sign;
+                payload_count = 1;
+                has_string = true;
+                view = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_INTEGER_TOKEN:
+            retval =
+                event_downcast_to_event_raw_integer_token(
+                    &raw_integer_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_raw_integer_token_string_get(raw_integer_ev);
+                size = event_raw_integer_token_size_get(raw_integer_ev);
+                payload[1] = raw_integer_ev->has_sign;
+                payload_count = 1;
+                has_string = true;
+                view = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_SPAN:
+            retval = event_downcast_to_event_raw_span(&span_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_raw_span_get(span_ev);
+                size = event_raw_span_size_get(span_ev);
+                has_string = true;
+                view = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_RAW_STRING_TOKEN:
+            retval =
+                event_downcast_to_event_raw_string_token(
+                    &raw_string_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_raw_string_token_get(raw_string_ev);
+                size = event_raw_string_token_size_get(raw_string_ev);
+                has_string = true;
+                view = true;
+            }
+            break;
+
+        case CPARSE_EVENT_CATEGORY_STRING:
+            retval = event_downcast_to_event_string(&string_ev, (event*)ev);
+            if (STATUS_SUCCESS == retval)
+            {
+                str = event_string_get(string_ev);
+                has_string = true;
+            }
+            break;
+
+        default:
+            return ERROR_LIBCPARSE_TOKEN_STREAM_UNSUPPORTED_EVENT_CATEGORY;
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the string, if any, is always the first payload value. */
+    if (has_string)
+    {
+        if (NULL != str && !view)
+        {
+            size = strlen(str);
+        }
+
+        retval = string_id(&payload[0], writer, str, size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        payload_count += 1;
+    }
+
+    /* append the type and category columns. */
+    token_stream_le_write(type_bytes, (uint64_t)event_type, 2);
+    retval =
+        token_stream_buffer_append(
+            &writer->types, &writer->alloc, type_bytes, 2);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    category_byte = (uint8_t)category;
+    retval =
+        token_stream_buffer_append(
+            &writer->categories, &writer->alloc, &category_byte, 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* append the cursor. */
+    retval = add_cursor(writer, event_get_cursor(ev));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* append the payload. */
+    for (size_t i = 0; i < payload_count; ++i)
+    {
+        retval =
+            token_stream_buffer_append_varint(
+                &writer->payloads, &writer->alloc, payload[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    writer->count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Append the delta of a cursor from the previous cursor.
+ *
+ * Consecutive events have nearby cursors, so most of these deltas encode as a
+ * single byte.
+ *
+ * \param writer            The writer for this operation.
+ * \param pos               The cursor to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int add_cursor(token_stream_writer* writer, const cursor* pos)
+{
+    int retval;
+    uint64_t fields[CPARSE_TOKEN_STREAM_CURSOR_FIELDS];
+
+    /* the file name is interned like any other string. */
+    retval =
+        string_id(
+            &fields[0], writer, pos->file,
+            (NULL != pos->file) ? strlen(pos->file) : 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    fields[1] = pos->file_id;
+    fields[2] = pos->begin_line;
+    fields[3] = pos->begin_col;
+    fields[4] = pos->end_line;
+    fields[5] = pos->end_col;
+    fields[6] = pos->begin_offset;
+    fields[7] = pos->end_offset;
+
+    for (int i = 0; i < CPARSE_TOKEN_STREAM_CURSOR_FIELDS; ++i)
+    {
+        retval =
+            token_stream_buffer_append_varint(
+                &writer->cursors, &writer->alloc,
+                CPARSE_TOKEN_STREAM_ZIGZAG(fields[i] - writer->prev[i]));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        writer->prev[i] = fields[i];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the string ID for a string, adding it to the string table if
+ * needed.
+ *
+ * \param id                Pointer to receive the string ID on success. This
+ *                          is zero for a NULL string, and otherwise one more
+ *                          than the string's index in the string table.
+ * \param writer            The writer for this operation.
+ * \param str               The string, or NULL.
+ * \param size              The size of the string.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int string_id(
+    uint64_t* id, token_stream_writer* writer, const char* str, size_t size)
+{
+    int retval;
+    const char* interned;
+    uint32_t symbol;
+
+    if (NULL == str)
+    {
+        *id = 0;
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        intern_table_intern(&interned, &symbol, writer->strings, str, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *id = (uint64_t)symbol + 1;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,149 @@
+/**
+ * \file token_stream/token_stream_writer_build.c
+ *
+ * \brief Encode the events recorded by a token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../intern_table/intern_table_internal.h"
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_intern_table_internal;
+CPARSE_IMPORT_token_stream_internal;
+
+static size_t align_section(size_t offset);
+
+/**
+ * \brief Encode the events recorded by a \ref token_stream_writer.
+ *
+ * \param data                  Pointer to receive the encoded buffer on
+ *                              success. On success, this buffer is owned by
+ *                              the caller and must be freed when no longer
+ *                              needed.
+ * \param size                  Pointer to receive the size of the encoded
+ *                              buffer on success.
+ * \param writer                The \ref token_stream_writer for this
+ *                              operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_build)(
+    void** data, size_t* size, CPARSE_SYM(token_stream_writer)* writer)
+{
+    const intern_table* strings = writer->strings;
+    size_t offsets[CPARSE_TOKEN_STREAM_SECTION_COUNT];
+    size_t sizes[CPARSE_TOKEN_STREAM_SECTION_COUNT];
+    size_t string_data_size = 0;
+    size_t offset;
+    uint8_t* tmp;
+
+    /* the string data is indexed with 32-bit offsets. */
+    for (uint32_t i = 0; i < strings->count; ++i)
+    {
+        string_data_size += strings->entries[i].size + 1;
+        if (string_data_size > UINT32_MAX)
+        {
+            return ERROR_LIBCPARSE_OUT_OF_BOUNDS;
+        }
+    }
+
+    /* compute the size of each section. */
+    sizes[CPARSE_TOKEN_STREAM_SECTION_TYPES] = writer->types.size;
+    sizes[CPARSE_TOKEN_STREAM_SECTION_CATEGORIES] = writer->categories.size;
+    sizes[CPARSE_TOKEN_STREAM_SECTION_CURSORS] = writer->cursors.size;
+    sizes[CPARSE_TOKEN_STREAM_SECTION_PAYLOADS] = writer->payloads.size;
+    sizes[CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX] = 8 * strings->count;
+    sizes[CPARSE_TOKEN_STREAM_SECTION_STRING_DATA] = string_data_size;
+
+    /* lay out the sections after the header. */
+    offset = CPARSE_TOKEN_STREAM_HEADER_SIZE;
+    for (int i = 0; i < CPARSE_TOKEN_STREAM_SECTION_COUNT; ++i)
+    {
+        offset = align_section(offset);
+        offsets[i] = offset;
+        offset += sizes[i];
+    }
+
+    /* allocate the buffer, clearing any padding. */
+    tmp = (uint8_t*)calloc(1, offset);
+    if (NULL == tmp)
+    {
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    /* write the header. */
+    memcpy(tmp, CPARSE_TOKEN_STREAM_MAGIC, 4);
+    token_stream_le_write(tmp + 4, CPARSE_TOKEN_STREAM_VERSION, 4);
+    token_stream_le_write(tmp + 8, writer->count, 4);
+    token_stream_le_write(tmp + 12, strings->count, 4);
+    for (int i = 0; i < CPARSE_TOKEN_STREAM_SECTION_COUNT; ++i)
+    {
+        token_stream_le_write(tmp + 16 + 16 * i, offsets[i], 8);
+        token_stream_le_write(tmp + 24 + 16 * i, sizes[i], 8);
+    }
+
+    /* copy the event columns. */
+    if (0 != writer->count)
+    {
+        memcpy(
+            tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_TYPES],
+            writer->types.data, writer->types.size);
+        memcpy(
+            tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_CATEGORIES],
+            writer->categories.data, writer->categories.size);
+        memcpy(
+            tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_CURSORS],
+            writer->cursors.data, writer->cursors.size);
+    }
+
+    if (0 != writer->payloads.size)
+    {
+        memcpy(
+            tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_PAYLOADS],
+            writer->payloads.data, writer->payloads.size);
+    }
+
+    /* write the string table, in symbol ID order. */
+    uint8_t* index = tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_STRING_INDEX];
+    uint8_t* string_data =
+        tmp + offsets[CPARSE_TOKEN_STREAM_SECTION_STRING_DATA];
+    size_t string_offset = 0;
+    for (uint32_t i = 0; i < strings->count; ++i)
+    {
+        const intern_table_entry* entry = &strings->entries[i];
+
+        token_stream_le_write(index + 8 * i, string_offset, 4);
+        token_stream_le_write(index + 8 * i + 4, entry->size, 4);
+        memcpy(string_data + string_offset, entry->str, entry->size);
+        string_offset += entry->size + 1;
+    }
+
+    /* success. */
+    *data = tmp;
+    *size = offset;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Round an offset up to the start of the next section.
+ *
+ * \param offset            The offset to round.
+ *
+ * \returns the rounded offset.
+ */
+static size_t align_section(size_t offset)
+{
+    return
+        (offset + CPARSE_TOKEN_STREAM_SECTION_ALIGNMENT - 1)
+            & ~(size_t)(CPARSE_TOKEN_STREAM_SECTION_ALIGNMENT - 1);
+}
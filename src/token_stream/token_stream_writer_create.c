@@ -0,0 +1,42 @@
+/**
+ * \file token_stream/token_stream_writer_create.c
+ *
+ * \brief Create a token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Create a \ref token_stream_writer instance.
+ *
+ * \param writer                Pointer to the \ref token_stream_writer pointer
+ *                              to set to the created instance on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_create)(
+    CPARSE_SYM(token_stream_writer)** writer)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return token_stream_writer_create_with_allocator(writer, &alloc);
+}
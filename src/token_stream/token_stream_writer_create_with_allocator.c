@@ -0,0 +1,77 @@
+/**
+ * \file token_stream/token_stream_writer_create_with_allocator.c
+ *
+ * \brief Create a token stream writer that uses a given allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Create a \ref token_stream_writer instance that uses the given
+ * allocator.
+ *
+ * \param writer                Pointer to the \ref token_stream_writer pointer
+ *                              to set to the created instance on success.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_create_with_allocator)(
+    CPARSE_SYM(token_stream_writer)** writer,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    token_stream_writer* tmp;
+
+    /* allocate memory for this instance. */
+    tmp =
+        (token_stream_writer*)allocator_allocate(alloc, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* create the string table. */
+    retval = intern_table_create_with_allocator(&tmp->strings, false, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *writer = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    allocator_free(alloc, tmp);
+
+done:
+    return retval;
+}
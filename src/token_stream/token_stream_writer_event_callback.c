@@ -0,0 +1,29 @@
+/**
+ * \file token_stream/token_stream_writer_event_callback.c
+ *
+ * \brief Event handler callback for the token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_token_stream;
+
+/**
+ * \brief Event handler callback for \ref token_stream_writer.
+ *
+ * \param context           The context for this handler (the
+ *                          \ref token_stream_writer instance).
+ * \param ev                The event for this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_event_callback)(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    return token_stream_writer_add((token_stream_writer*)context, ev);
+}
@@ -0,0 +1,34 @@
+/**
+ * \file token_stream/token_stream_writer_event_handler_init.c
+ *
+ * \brief Initialize an event handler for a token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event_handler.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_token_stream_internal;
+
+/**
+ * \brief Initialize an event handler that records each event it receives in a
+ * \ref token_stream_writer.
+ *
+ * \param eh                    The event handler to initialize.
+ * \param writer                The \ref token_stream_writer that receives the
+ *                              events, which must outlive this handler.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_event_handler_init)(
+    CPARSE_SYM(event_handler)* eh, CPARSE_SYM(token_stream_writer)* writer)
+{
+    return
+        event_handler_init(eh, &token_stream_writer_event_callback, writer);
+}
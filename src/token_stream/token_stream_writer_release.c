@@ -0,0 +1,53 @@
+/**
+ * \file token_stream/token_stream_writer_release.c
+ *
+ * \brief Release a token stream writer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <string.h>
+
+#include "token_stream_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_token_stream_internal;
+
+/**
+ * \brief Release a \ref token_stream_writer instance.
+ *
+ * \param writer                The \ref token_stream_writer instance to
+ *                              release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(token_stream_writer_release)(
+    CPARSE_SYM(token_stream_writer)* writer)
+{
+    int retval;
+    allocator alloc;
+
+    /* keep a copy of the allocator to free this instance. */
+    memcpy(&alloc, &writer->alloc, sizeof(alloc));
+
+    /* release the string table. */
+    retval = intern_table_release(writer->strings);
+
+    /* release the section buffers. */
+    token_stream_buffer_dispose(&writer->types, &alloc);
+    token_stream_buffer_dispose(&writer->categories, &alloc);
+    token_stream_buffer_dispose(&writer->cursors, &alloc);
+    token_stream_buffer_dispose(&writer->payloads, &alloc);
+
+    /* clear and free this instance. */
+    memset(writer, 0, sizeof(*writer));
+    allocator_free(&alloc, writer);
+
+    return retval;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file src/util/char_scan_any.c
+ *
+ * \brief Find the first character in a block that is in a set.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "char_scan_internal.h"
+
+CPARSE_IMPORT_util_char_scan_internal;
+
+/**
+ * \brief Find the first character in a block that is in the given set.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set, from 1 to
+ *                      \ref CPARSE_CHAR_SCAN_MAX_SET.
+ *
+ * \returns the offset of the first character in this block that is in the set,
+ * or \p size if there is no such character.
+ */
+size_t CPARSE_SYM(char_scan_any)(
+    const char* block, size_t size, const char* set, size_t set_size)
+{
+    /* the C library already has a well tuned search for one character. */
+    if (1 == set_size)
+    {
+        const char* found = (const char*)memchr(block, set[0], size);
+
+        return (NULL == found) ? size : (size_t)(found - block);
+    }
+
+    /* small blocks aren't worth vectorizing. */
+    if (size < CPARSE_CHAR_SCAN_MIN_VECTOR_SIZE)
+    {
+        return char_scan_any_scalar(block, size, set, set_size);
+    }
+
+#if CPARSE_CHAR_SCAN_X86
+    /* use the widest scan that this CPU supports. */
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return char_scan_any_avx2(block, size, set, set_size);
+    }
+
+    return char_scan_any_sse2(block, size, set, set_size);
+#else
+    return char_scan_any_scalar(block, size, set, set_size);
+#endif
+}
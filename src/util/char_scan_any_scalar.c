@@ -0,0 +1,38 @@
+/**
+ * \file src/util/char_scan_any_scalar.c
+ *
+ * \brief Scalar character set scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "char_scan_internal.h"
+
+/**
+ * \brief Find the first character in a block that is in the given set one
+ * character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set.
+ *
+ * \returns the offset of the first match, or \p size if there is none.
+ */
+size_t CPARSE_SYM(char_scan_any_scalar)(
+    const char* block, size_t size, const char* set, size_t set_size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        for (size_t j = 0; j < set_size; ++j)
+        {
+            if (set[j] == block[i])
+            {
+                return i;
+            }
+        }
+    }
+
+    return size;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file src/util/char_scan_any_sse2.c
+ *
+ * \brief SSE2 character set scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "char_scan_internal.h"
+
+#if CPARSE_CHAR_SCAN_X86
+
+#include <emmintrin.h>
+
+CPARSE_IMPORT_util_char_scan_internal;
+
+/**
+ * \brief Find the first character in a block that is in the given set 16
+ * characters at a time using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set.
+ *
+ * \returns the offset of the first match, or \p size if there is none.
+ */
+__attribute__((target("sse2")))
+size_t CPARSE_SYM(char_scan_any_sse2)(
+    const char* block, size_t size, const char* set, size_t set_size)
+{
+    __m128i needles[CPARSE_CHAR_SCAN_MAX_SET];
+    size_t i;
+
+    /* broadcast each character in the set across a lane. */
+    for (size_t j = 0; j < set_size; ++j)
+    {
+        needles[j] = _mm_set1_epi8(set[j]);
+    }
+
+    /* scan full 16 byte lanes. */
+    for (i = 0; i + 16 <= size; i += 16)
+    {
+        __m128i lane = _mm_loadu_si128((const __m128i*)(block + i));
+        __m128i match = _mm_cmpeq_epi8(lane, needles[0]);
+        unsigned int mask;
+
+        for (size_t j = 1; j < set_size; ++j)
+        {
+            match = _mm_or_si128(match, _mm_cmpeq_epi8(lane, needles[j]));
+        }
+
+        mask = (unsigned int)_mm_movemask_epi8(match);
+        if (0 != mask)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+
+    /* scan the remaining tail. */
+    return i + char_scan_any_scalar(block + i, size - i, set, set_size);
+}
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ * \file src/util/char_scan_internal.h
+ *
+ * \brief Private details for the character scan implementations.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/util/char_scan.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The vectorized character scans are only built for x86 targets.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define CPARSE_CHAR_SCAN_X86 1
+#else
+# define CPARSE_CHAR_SCAN_X86 0
+#endif
+
+/**
+ * \brief Blocks smaller than this are always scanned with the scalar scan.
+ */
+#define CPARSE_CHAR_SCAN_MIN_VECTOR_SIZE 16
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * one character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+size_t CPARSE_SYM(char_scan_run_scalar)(
+    const char* block, size_t size, int char_class);
+
+/**
+ * \brief Find the first character in a block that is in the given set one
+ * character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set.
+ *
+ * \returns the offset of the first match, or \p size if there is none.
+ */
+size_t CPARSE_SYM(char_scan_any_scalar)(
+    const char* block, size_t size, const char* set, size_t set_size);
+
+#if CPARSE_CHAR_SCAN_X86
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * 16 characters at a time using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+size_t CPARSE_SYM(char_scan_run_sse2)(
+    const char* block, size_t size, int char_class);
+
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * 32 characters at a time using AVX2.
+ *
+ * \note The caller must verify that the CPU supports AVX2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+size_t CPARSE_SYM(char_scan_run_avx2)(
+    const char* block, size_t size, int char_class);
+
+/**
+ * \brief Find the first character in a block that is in the given set 16
+ * characters at a time using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set.
+ *
+ * \returns the offset of the first match, or \p size if there is none.
+ */
+size_t CPARSE_SYM(char_scan_any_sse2)(
+    const char* block, size_t size, const char* set, size_t set_size);
+
+/**
+ * \brief Find the first character in a block that is in the given set 32
+ * characters at a time using AVX2.
+ *
+ * \note The caller must verify that the CPU supports AVX2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param set           The characters to search for.
+ * \param set_size      The number of characters in this set.
+ *
+ * \returns the offset of the first match, or \p size if there is none.
+ */
+size_t CPARSE_SYM(char_scan_any_avx2)(
+    const char* block, size_t size, const char* set, size_t set_size);
+#endif
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#if CPARSE_CHAR_SCAN_X86
+# define __INTERNAL_CPARSE_IMPORT_util_char_scan_x86_sym(sym) \
+    static inline size_t sym ## char_scan_run_sse2( \
+        const char* x, size_t y, int z) { \
+            return CPARSE_SYM(char_scan_run_sse2)(x,y,z); } \
+    static inline size_t sym ## char_scan_run_avx2( \
+        const char* x, size_t y, int z) { \
+            return CPARSE_SYM(char_scan_run_avx2)(x,y,z); } \
+    static inline size_t sym ## char_scan_any_sse2( \
+        const char* x, size_t y, const char* z, size_t w) { \
+            return CPARSE_SYM(char_scan_any_sse2)(x,y,z,w); } \
+    static inline size_t sym ## char_scan_any_avx2( \
+        const char* x, size_t y, const char* z, size_t w) { \
+            return CPARSE_SYM(char_scan_any_avx2)(x,y,z,w); }
+#else
+# define __INTERNAL_CPARSE_IMPORT_util_char_scan_x86_sym(sym)
+#endif
+
+#define __INTERNAL_CPARSE_IMPORT_util_char_scan_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline size_t sym ## char_scan_run_scalar( \
+        const char* x, size_t y, int z) { \
+            return CPARSE_SYM(char_scan_run_scalar)(x,y,z); } \
+    static inline size_t sym ## char_scan_any_scalar( \
+        const char* x, size_t y, const char* z, size_t w) { \
+            return CPARSE_SYM(char_scan_any_scalar)(x,y,z,w); } \
+    __INTERNAL_CPARSE_IMPORT_util_char_scan_x86_sym(sym) \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_char_scan_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_char_scan_internal_sym(sym ## _)
+#define CPARSE_IMPORT_util_char_scan_internal \
+    __INTERNAL_CPARSE_IMPORT_util_char_scan_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
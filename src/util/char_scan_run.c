@@ -0,0 +1,45 @@
+/**
+ * \file src/util/char_scan_run.c
+ *
+ * \brief Find the leading run of a character class in a block.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "char_scan_internal.h"
+
+CPARSE_IMPORT_util_char_scan_internal;
+
+/**
+ * \brief Find the length of the run of characters at the start of a block that
+ * all belong to the given character class.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the number of characters at the start of this block that belong to
+ * this class, which is \p size if they all do.
+ */
+size_t CPARSE_SYM(char_scan_run)(
+    const char* block, size_t size, int char_class)
+{
+    /* small blocks aren't worth vectorizing. */
+    if (size < CPARSE_CHAR_SCAN_MIN_VECTOR_SIZE)
+    {
+        return char_scan_run_scalar(block, size, char_class);
+    }
+
+#if CPARSE_CHAR_SCAN_X86
+    /* use the widest scan that this CPU supports. */
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return char_scan_run_avx2(block, size, char_class);
+    }
+
+    return char_scan_run_sse2(block, size, char_class);
+#else
+    return char_scan_run_scalar(block, size, char_class);
+#endif
+}
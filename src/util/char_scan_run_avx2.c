@@ -0,0 +1,125 @@
+/**
+ * \file src/util/char_scan_run_avx2.c
+ *
+ * \brief AVX2 character class run scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "char_scan_internal.h"
+
+#if CPARSE_CHAR_SCAN_X86
+
+#include <immintrin.h>
+
+CPARSE_IMPORT_util_char_scan_internal;
+
+/**
+ * \brief Match each byte of a lane against an inclusive range of characters.
+ *
+ * AVX2 only has a signed byte compare, so the range is shifted to start at
+ * -128, where a single signed compare checks both ends.
+ *
+ * \param lane          The lane to check.
+ * \param lo            The first character in the range.
+ * \param hi            The last character in the range.
+ *
+ * \returns a lane with each byte set to all ones if the matching byte is in
+ * the range, and to zero otherwise.
+ */
+__attribute__((target("avx2")))
+static inline __m256i in_range(__m256i lane, char lo, char hi)
+{
+    __m256i shifted =
+        _mm256_add_epi8(lane, _mm256_set1_epi8((char)(0x80 - lo)));
+
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(hi - lo - 127)), shifted);
+}
+
+/**
+ * \brief Match each byte of a lane against a character class.
+ *
+ * \param lane          The lane to check.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns a lane with each byte set to all ones if the matching byte is in
+ * the class, and to zero otherwise.
+ */
+__attribute__((target("avx2")))
+static inline __m256i class_match(__m256i lane, int char_class)
+{
+    __m256i lower = _mm256_or_si256(lane, _mm256_set1_epi8(0x20));
+
+    switch (char_class)
+    {
+        case CPARSE_CHAR_SCAN_CLASS_IDENTIFIER:
+            return
+                _mm256_or_si256(
+                    _mm256_or_si256(
+                        in_range(lower, 'a', 'z'), in_range(lane, '0', '9')),
+                    _mm256_cmpeq_epi8(lane, _mm256_set1_epi8('_')));
+
+        case CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT:
+            return in_range(lane, '0', '9');
+
+        case CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT:
+            return
+                _mm256_or_si256(
+                    in_range(lower, 'a', 'f'), in_range(lane, '0', '9'));
+
+        case CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE:
+            return
+                _mm256_or_si256(
+                    _mm256_andnot_si256(
+                        _mm256_cmpeq_epi8(lane, _mm256_set1_epi8('\n')),
+                        in_range(lane, '\t', '\r')),
+                    _mm256_cmpeq_epi8(lane, _mm256_set1_epi8(' ')));
+
+        case CPARSE_CHAR_SCAN_CLASS_SPACE:
+            return
+                _mm256_or_si256(
+                    in_range(lane, '\t', '\r'),
+                    _mm256_cmpeq_epi8(lane, _mm256_set1_epi8(' ')));
+
+        default:
+            return _mm256_setzero_si256();
+    }
+}
+
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * 32 characters at a time using AVX2.
+ *
+ * \note The caller must verify that the CPU supports AVX2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+__attribute__((target("avx2")))
+size_t CPARSE_SYM(char_scan_run_avx2)(
+    const char* block, size_t size, int char_class)
+{
+    size_t i;
+
+    /* scan full 32 byte lanes. */
+    for (i = 0; i + 32 <= size; i += 32)
+    {
+        __m256i lane = _mm256_loadu_si256((const __m256i*)(block + i));
+        unsigned int misses =
+            ~(unsigned int)_mm256_movemask_epi8(class_match(lane, char_class));
+
+        if (0 != misses)
+        {
+            return i + (size_t)__builtin_ctz(misses);
+        }
+    }
+
+    /* scan the remaining tail. */
+    return i + char_scan_run_scalar(block + i, size - i, char_class);
+}
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * \file src/util/char_scan_run_scalar.c
+ *
+ * \brief Scalar character class run scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdbool.h>
+
+#include "char_scan_internal.h"
+
+/**
+ * \brief Check whether a character belongs to a character class.
+ *
+ * \param ch            The character to check.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns true if this character is in this class, and false otherwise.
+ */
+static bool char_in_class(unsigned char ch, int char_class)
+{
+    switch (char_class)
+    {
+        case CPARSE_CHAR_SCAN_CLASS_IDENTIFIER:
+            return
+                   ('a' <= ch && ch <= 'z')
+                || ('A' <= ch && ch <= 'Z')
+                || ('0' <= ch && ch <= '9')
+                || '_' == ch;
+
+        case CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT:
+            return '0' <= ch && ch <= '9';
+
+        case CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT:
+            return
+                   ('0' <= ch && ch <= '9')
+                || ('a' <= ch && ch <= 'f')
+                || ('A' <= ch && ch <= 'F');
+
+        case CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE:
+            return
+                   ' ' == ch || '\t' == ch || '\v' == ch || '\f' == ch
+                || '\r' == ch;
+
+        case CPARSE_CHAR_SCAN_CLASS_SPACE:
+            return
+                   ' ' == ch || '\t' == ch || '\v' == ch || '\f' == ch
+                || '\r' == ch || '\n' == ch;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * one character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+size_t CPARSE_SYM(char_scan_run_scalar)(
+    const char* block, size_t size, int char_class)
+{
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+    {
+        if (!char_in_class((unsigned char)block[i], char_class))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
@@ -0,0 +1,123 @@
+/**
+ * \file src/util/char_scan_run_sse2.c
+ *
+ * \brief SSE2 character class run scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "char_scan_internal.h"
+
+#if CPARSE_CHAR_SCAN_X86
+
+#include <emmintrin.h>
+
+CPARSE_IMPORT_util_char_scan_internal;
+
+/**
+ * \brief Match each byte of a lane against an inclusive range of characters.
+ *
+ * SSE2 only has a signed byte compare, so the range is shifted to start at
+ * -128, where a single signed compare checks both ends.
+ *
+ * \param lane          The lane to check.
+ * \param lo            The first character in the range.
+ * \param hi            The last character in the range.
+ *
+ * \returns a lane with each byte set to all ones if the matching byte is in
+ * the range, and to zero otherwise.
+ */
+__attribute__((target("sse2")))
+static inline __m128i in_range(__m128i lane, char lo, char hi)
+{
+    __m128i shifted = _mm_add_epi8(lane, _mm_set1_epi8((char)(0x80 - lo)));
+
+    return _mm_cmpgt_epi8(_mm_set1_epi8((char)(hi - lo - 127)), shifted);
+}
+
+/**
+ * \brief Match each byte of a lane against a character class.
+ *
+ * \param lane          The lane to check.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns a lane with each byte set to all ones if the matching byte is in
+ * the class, and to zero otherwise.
+ */
+__attribute__((target("sse2")))
+static inline __m128i class_match(__m128i lane, int char_class)
+{
+    __m128i lower = _mm_or_si128(lane, _mm_set1_epi8(0x20));
+
+    switch (char_class)
+    {
+        case CPARSE_CHAR_SCAN_CLASS_IDENTIFIER:
+            return
+                _mm_or_si128(
+                    _mm_or_si128(
+                        in_range(lower, 'a', 'z'), in_range(lane, '0', '9')),
+                    _mm_cmpeq_epi8(lane, _mm_set1_epi8('_')));
+
+        case CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT:
+            return in_range(lane, '0', '9');
+
+        case CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT:
+            return
+                _mm_or_si128(
+                    in_range(lower, 'a', 'f'), in_range(lane, '0', '9'));
+
+        case CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE:
+            return
+                _mm_or_si128(
+                    _mm_andnot_si128(
+                        _mm_cmpeq_epi8(lane, _mm_set1_epi8('\n')),
+                        in_range(lane, '\t', '\r')),
+                    _mm_cmpeq_epi8(lane, _mm_set1_epi8(' ')));
+
+        case CPARSE_CHAR_SCAN_CLASS_SPACE:
+            return
+                _mm_or_si128(
+                    in_range(lane, '\t', '\r'),
+                    _mm_cmpeq_epi8(lane, _mm_set1_epi8(' ')));
+
+        default:
+            return _mm_setzero_si128();
+    }
+}
+
+/**
+ * \brief Find the length of the leading run of a character class in a block
+ * 16 characters at a time using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param char_class    The \ref char_scan_class to match.
+ *
+ * \returns the length of the run.
+ */
+__attribute__((target("sse2")))
+size_t CPARSE_SYM(char_scan_run_sse2)(
+    const char* block, size_t size, int char_class)
+{
+    size_t i;
+
+    /* scan full 16 byte lanes. */
+    for (i = 0; i + 16 <= size; i += 16)
+    {
+        __m128i lane = _mm_loadu_si128((const __m128i*)(block + i));
+        unsigned int misses =
+            ~(unsigned int)_mm_movemask_epi8(class_match(lane, char_class))
+                & 0xFFFFU;
+
+        if (0 != misses)
+        {
+            return i + (size_t)__builtin_ctz(misses);
+        }
+    }
+
+    /* scan the remaining tail. */
+    return i + char_scan_run_scalar(block + i, size - i, char_class);
+}
+
+#endif
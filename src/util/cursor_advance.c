@@ -0,0 +1,52 @@
+/**
+ * \file src/util/cursor_advance.c
+ *
+ * \brief Advance a cursor over a block of characters.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/util/cursor_advance.h>
+
+CPARSE_IMPORT_util_cursor_advance;
+
+/**
+ * \brief Advance a cursor over a block of characters.
+ *
+ * \param pos           The cursor to advance.
+ * \param block         The block of characters to advance over.
+ * \param size          The size of this block.
+ */
+void CPARSE_SYM(cursor_advance)(
+    CPARSE_SYM(cursor)* pos, const char* block, size_t size)
+{
+    size_t last, lines;
+
+    /* an empty block leaves the cursor where it is. */
+    if (0 == size)
+    {
+        return;
+    }
+
+    /* count the newlines in this block. */
+    lines = newline_scan(block, size, &last);
+
+    /* without a newline, only the column moves. */
+    if (0 == lines)
+    {
+        pos->begin_col += size;
+    }
+    /* otherwise, the column restarts after the last newline. */
+    else
+    {
+        pos->begin_line += lines;
+        pos->begin_col = 1 + (size - last - 1);
+    }
+
+    pos->begin_offset += size;
+
+    pos->end_line = pos->begin_line;
+    pos->end_col = pos->begin_col;
+    pos->end_offset = pos->begin_offset;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file src/util/cursor_advance_character.c
+ *
+ * \brief Advance a cursor over a single character.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/util/cursor_advance.h>
+
+/**
+ * \brief Advance a cursor over a single character.
+ *
+ * \param pos           The cursor to advance.
+ * \param ch            The character to advance over.
+ */
+void CPARSE_SYM(cursor_advance_character)(CPARSE_SYM(cursor)* pos, int ch)
+{
+    switch (ch)
+    {
+        case '\n':
+            pos->begin_line += 1;
+            pos->end_line = pos->begin_line;
+            pos->begin_col = pos->end_col = 1;
+            break;
+
+        default:
+            pos->begin_col += 1;
+            pos->end_col = pos->begin_col;
+            break;
+    }
+
+    pos->begin_offset += 1;
+    pos->end_offset = pos->begin_offset;
+}
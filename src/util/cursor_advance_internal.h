@@ -0,0 +1,114 @@
+/**
+ * \file src/util/cursor_advance_internal.h
+ *
+ * \brief Private details for the newline scan implementations.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/util/cursor_advance.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The vectorized newline scans are only built for x86 targets.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define CPARSE_NEWLINE_SCAN_X86 1
+#else
+# define CPARSE_NEWLINE_SCAN_X86 0
+#endif
+
+/**
+ * \brief Blocks smaller than this are always scanned with the scalar scan.
+ */
+#define CPARSE_NEWLINE_SCAN_MIN_VECTOR_SIZE 16
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Count the newlines in a block of characters one character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan_scalar)(
+    const char* block, size_t size, size_t* last);
+
+#if CPARSE_NEWLINE_SCAN_X86
+/**
+ * \brief Count the newlines in a block of characters 16 characters at a time
+ * using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan_sse2)(
+    const char* block, size_t size, size_t* last);
+
+/**
+ * \brief Count the newlines in a block of characters 32 characters at a time
+ * using AVX2.
+ *
+ * \note The caller must verify that the CPU supports AVX2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan_avx2)(
+    const char* block, size_t size, size_t* last);
+#endif
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#if CPARSE_NEWLINE_SCAN_X86
+# define __INTERNAL_CPARSE_IMPORT_util_cursor_advance_x86_sym(sym) \
+    static inline size_t sym ## newline_scan_sse2( \
+        const char* x, size_t y, size_t* z) { \
+            return CPARSE_SYM(newline_scan_sse2)(x,y,z); } \
+    static inline size_t sym ## newline_scan_avx2( \
+        const char* x, size_t y, size_t* z) { \
+            return CPARSE_SYM(newline_scan_avx2)(x,y,z); }
+#else
+# define __INTERNAL_CPARSE_IMPORT_util_cursor_advance_x86_sym(sym)
+#endif
+
+#define __INTERNAL_CPARSE_IMPORT_util_cursor_advance_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline size_t sym ## newline_scan_scalar( \
+        const char* x, size_t y, size_t* z) { \
+            return CPARSE_SYM(newline_scan_scalar)(x,y,z); } \
+    __INTERNAL_CPARSE_IMPORT_util_cursor_advance_x86_sym(sym) \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_cursor_advance_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_cursor_advance_internal_sym(sym ## _)
+#define CPARSE_IMPORT_util_cursor_advance_internal \
+    __INTERNAL_CPARSE_IMPORT_util_cursor_advance_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,35 @@
+/**
+ * \file src/util/event_ring_backoff.c
+ *
+ * \brief Wait for the other side of an \ref event_ring to make progress.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <sched.h>
+
+#include "event_ring_internal.h"
+
+/**
+ * \brief Wait for the other side of the ring to make progress.
+ *
+ * The first few calls spin; after that, the processor is yielded.
+ *
+ * \param spins         Pointer to the number of times this wait has been
+ *                      called for the current operation.
+ */
+void CPARSE_SYM(event_ring_backoff)(unsigned int* spins)
+{
+    if (*spins < CPARSE_EVENT_RING_SPIN_COUNT)
+    {
+        *spins += 1;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#endif
+    }
+    else
+    {
+        sched_yield();
+    }
+}
@@ -0,0 +1,21 @@
+/**
+ * \file src/util/event_ring_close.c
+ *
+ * \brief Close an \ref event_ring.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "event_ring_internal.h"
+
+/**
+ * \brief Close the ring, asking the producer to stop pushing. The consumer
+ * calls this when it can no longer accept events.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ */
+void CPARSE_SYM(event_ring_close)(CPARSE_SYM(event_ring)* ring)
+{
+    atomic_store_explicit(&ring->closed, true, memory_order_relaxed);
+}
@@ -0,0 +1,44 @@
+/**
+ * \file src/util/event_ring_create.c
+ *
+ * \brief Create an \ref event_ring instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+
+#include "event_ring_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_util_event_ring;
+
+/**
+ * \brief Create an \ref event_ring instance.
+ *
+ * \param ring                  Pointer to the \ref event_ring pointer to set to
+ *                              the created instance on success.
+ * \param capacity              The minimum number of copies this ring can hold.
+ *                              This is rounded up to a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_ring_create)(
+    CPARSE_SYM(event_ring)** ring, size_t capacity)
+{
+    int retval;
+    allocator alloc;
+
+    /* use the default allocator. */
+    retval = allocator_init_default(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return event_ring_create_with_allocator(ring, capacity, &alloc);
+}
@@ -0,0 +1,96 @@
+/**
+ * \file src/util/event_ring_create_with_allocator.c
+ *
+ * \brief Create an \ref event_ring that uses a given \ref allocator.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "event_ring_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_util_event_ring;
+
+/**
+ * \brief Create an \ref event_ring instance that uses the given allocator for
+ * its slots.
+ *
+ * \param ring                  Pointer to the \ref event_ring pointer to set to
+ *                              the created instance on success.
+ * \param capacity              The minimum number of copies this ring can hold.
+ *                              This is rounded up to a power of two.
+ * \param alloc                 The allocator for this instance, which is
+ *                              copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_ring_create_with_allocator)(
+    CPARSE_SYM(event_ring)** ring, size_t capacity,
+    const CPARSE_SYM(allocator)* alloc)
+{
+    int retval;
+    event_ring* tmp;
+    size_t size = 2;
+
+    /* round the capacity up to a power of two. */
+    while (size < capacity)
+    {
+        size *= 2;
+    }
+
+    /* allocate cache-aligned memory for this instance. */
+    tmp =
+        (event_ring*)aligned_alloc(CPARSE_EVENT_RING_CACHE_LINE, sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear instance memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* copy the allocator. */
+    retval = allocator_init_copy(&tmp->alloc, alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* allocate the slots. */
+    tmp->slots =
+        (event_copy**)allocator_allocate(alloc, size * sizeof(*tmp->slots));
+    if (NULL == tmp->slots)
+    {
+        retval = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+        goto cleanup_tmp;
+    }
+
+    /* initialize the indices and flags. */
+    tmp->mask = size - 1;
+    atomic_init(&tmp->head, 0);
+    atomic_init(&tmp->tail, 0);
+    atomic_init(&tmp->finished, false);
+    atomic_init(&tmp->closed, false);
+
+    /* success. */
+    *ring = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+done:
+    return retval;
+}
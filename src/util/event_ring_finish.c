@@ -0,0 +1,21 @@
+/**
+ * \file src/util/event_ring_finish.c
+ *
+ * \brief Mark an \ref event_ring as finished.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "event_ring_internal.h"
+
+/**
+ * \brief Mark the ring as finished. The producer calls this after its last
+ * push.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ */
+void CPARSE_SYM(event_ring_finish)(CPARSE_SYM(event_ring)* ring)
+{
+    atomic_store_explicit(&ring->finished, true, memory_order_release);
+}
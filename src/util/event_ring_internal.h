@@ -0,0 +1,85 @@
+/**
+ * \file src/util/event_ring_internal.h
+ *
+ * \brief Private details for the single-producer / single-consumer event ring.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/allocator.h>
+#include <libcparse/util/event_ring.h>
+#include <stdatomic.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The producer and consumer indices are kept on separate cache lines so
+ * that the two threads don't contend for the same line on every event.
+ */
+#define CPARSE_EVENT_RING_CACHE_LINE 64
+
+/**
+ * \brief The number of times to spin on a full or empty ring before yielding
+ * the processor.
+ */
+#define CPARSE_EVENT_RING_SPIN_COUNT 128
+
+struct CPARSE_SYM(event_ring)
+{
+    /* written by the consumer. */
+    _Alignas(CPARSE_EVENT_RING_CACHE_LINE) atomic_size_t head;
+    size_t cached_tail;
+
+    /* written by the producer. */
+    _Alignas(CPARSE_EVENT_RING_CACHE_LINE) atomic_size_t tail;
+    size_t cached_head;
+
+    /* shared flags. */
+    _Alignas(CPARSE_EVENT_RING_CACHE_LINE) atomic_bool finished;
+    atomic_bool closed;
+
+    /* read-only after creation. */
+    _Alignas(CPARSE_EVENT_RING_CACHE_LINE) size_t mask;
+    CPARSE_SYM(event_copy)** slots;
+    CPARSE_SYM(allocator) alloc;
+};
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Wait for the other side of the ring to make progress.
+ *
+ * The first few calls spin; after that, the processor is yielded.
+ *
+ * \param spins         Pointer to the number of times this wait has been
+ *                      called for the current operation.
+ */
+void CPARSE_SYM(event_ring_backoff)(unsigned int* spins);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+
+#define __INTERNAL_CPARSE_IMPORT_util_event_ring_internal_sym(sym) \
+    CPARSE_BEGIN_EXPORT \
+    static inline void sym ## event_ring_backoff(unsigned int* x) { \
+        CPARSE_SYM(event_ring_backoff)(x); } \
+    CPARSE_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define CPARSE_IMPORT_util_event_ring_internal_as(sym) \
+    __INTERNAL_CPARSE_IMPORT_util_event_ring_internal_sym(sym ## _)
+#define CPARSE_IMPORT_util_event_ring_internal \
+    __INTERNAL_CPARSE_IMPORT_util_event_ring_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,24 @@
+/**
+ * \file src/util/event_ring_is_closed.c
+ *
+ * \brief Query whether an \ref event_ring has been closed.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "event_ring_internal.h"
+
+/**
+ * \brief Return whether the consumer has closed the ring.
+ *
+ * \param ring                  The \ref event_ring instance to query.
+ *
+ * \returns true if the ring has been closed, or false otherwise.
+ */
+bool CPARSE_SYM(event_ring_is_closed)(const CPARSE_SYM(event_ring)* ring)
+{
+    return
+        atomic_load_explicit(
+            (atomic_bool*)&ring->closed, memory_order_relaxed);
+}
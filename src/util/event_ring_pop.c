@@ -0,0 +1,73 @@
+/**
+ * \file src/util/event_ring_pop.c
+ *
+ * \brief Pop a copy from an \ref event_ring.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "event_ring_internal.h"
+
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_util_event_ring;
+CPARSE_IMPORT_util_event_ring_internal;
+
+/**
+ * \brief Pop a copy from the ring, waiting for the producer if the ring is
+ * empty.
+ *
+ * This may only be called by the consumer. On success, ownership of the copy
+ * passes to the caller.
+ *
+ * \param cpy                   Pointer to the \ref event_copy pointer to
+ *                              receive the copy on success.
+ * \param ring                  The \ref event_ring instance for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_EVENT_RING_FINISHED if the producer has finished and
+ *        every copy has been popped.
+ */
+int CPARSE_SYM(event_ring_pop)(
+    CPARSE_SYM(event_copy)** cpy, CPARSE_SYM(event_ring)* ring)
+{
+    unsigned int spins = 0;
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    /* wait for a copy, only re-reading the producer index when we look
+     * empty. */
+    while (head == ring->cached_tail)
+    {
+        ring->cached_tail =
+            atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head != ring->cached_tail)
+        {
+            break;
+        }
+
+        /* the producer publishes its last copy before finishing, so check the
+         * tail once more after seeing the finished flag. */
+        if (atomic_load_explicit(&ring->finished, memory_order_acquire))
+        {
+            ring->cached_tail =
+                atomic_load_explicit(&ring->tail, memory_order_acquire);
+            if (head == ring->cached_tail)
+            {
+                return ERROR_LIBCPARSE_EVENT_RING_FINISHED;
+            }
+
+            break;
+        }
+
+        event_ring_backoff(&spins);
+    }
+
+    /* take the copy. */
+    *cpy = ring->slots[head & ring->mask];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    return STATUS_SUCCESS;
+}
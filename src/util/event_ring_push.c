@@ -0,0 +1,62 @@
+/**
+ * \file src/util/event_ring_push.c
+ *
+ * \brief Push a copy onto an \ref event_ring.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/status_codes.h>
+
+#include "event_ring_internal.h"
+
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_util_event_ring;
+CPARSE_IMPORT_util_event_ring_internal;
+
+/**
+ * \brief Push a copy onto the ring, waiting for space if the ring is full.
+ *
+ * This may only be called by the producer. On success, ownership of the copy
+ * passes to the ring.
+ *
+ * \param ring                  The \ref event_ring instance for this operation.
+ * \param cpy                   The copy to push.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBCPARSE_EVENT_RING_CLOSED if the consumer closed this ring.
+ *        The caller retains ownership of the copy.
+ */
+int CPARSE_SYM(event_ring_push)(
+    CPARSE_SYM(event_ring)* ring, CPARSE_SYM(event_copy)* cpy)
+{
+    unsigned int spins = 0;
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    /* wait for space, only re-reading the consumer index when we look full. */
+    while (tail - ring->cached_head > ring->mask)
+    {
+        ring->cached_head =
+            atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail - ring->cached_head <= ring->mask)
+        {
+            break;
+        }
+
+        /* stop if the consumer has given up. */
+        if (atomic_load_explicit(&ring->closed, memory_order_relaxed))
+        {
+            return ERROR_LIBCPARSE_EVENT_RING_CLOSED;
+        }
+
+        event_ring_backoff(&spins);
+    }
+
+    /* publish the copy. */
+    ring->slots[tail & ring->mask] = cpy;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/**
+ * \file src/util/event_ring_release.c
+ *
+ * \brief Release an \ref event_ring instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "event_ring_internal.h"
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_util_event_ring;
+
+/**
+ * \brief Release an \ref event_ring instance, releasing any copies it still
+ * holds.
+ *
+ * \param ring                  The \ref event_ring instance to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(event_ring_release)(CPARSE_SYM(event_ring)* ring)
+{
+    int retval = STATUS_SUCCESS;
+    int release_retval;
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    /* release any copies left in the ring. */
+    for (; head != tail; ++head)
+    {
+        release_retval = event_copy_release(ring->slots[head & ring->mask]);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* reclaim the slots. */
+    memset(ring->slots, 0, (ring->mask + 1) * sizeof(*ring->slots));
+    allocator_free(&ring->alloc, ring->slots);
+
+    /* clear instance memory. */
+    memset(ring, 0, sizeof(*ring));
+
+    /* reclaim instance memory. */
+    free(ring);
+
+    return retval;
+}
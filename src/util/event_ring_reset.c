@@ -0,0 +1,24 @@
+/**
+ * \file src/util/event_ring_reset.c
+ *
+ * \brief Reset an \ref event_ring instance.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "event_ring_internal.h"
+
+/**
+ * \brief Reset an empty \ref event_ring so it can be used for another run.
+ *
+ * This clears the closed and finished flags. It must only be called while no
+ * producer or consumer is using the ring.
+ *
+ * \param ring                  The \ref event_ring instance to reset.
+ */
+void CPARSE_SYM(event_ring_reset)(CPARSE_SYM(event_ring)* ring)
+{
+    atomic_store_explicit(&ring->finished, false, memory_order_relaxed);
+    atomic_store_explicit(&ring->closed, false, memory_order_relaxed);
+}
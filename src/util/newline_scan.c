@@ -0,0 +1,44 @@
+/**
+ * \file src/util/newline_scan.c
+ *
+ * \brief Count the newlines in a block of characters.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cursor_advance_internal.h"
+
+CPARSE_IMPORT_util_cursor_advance_internal;
+
+/**
+ * \brief Count the newlines in a block of characters, and find the last one.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan)(
+    const char* block, size_t size, size_t* last)
+{
+    /* small blocks aren't worth vectorizing. */
+    if (size < CPARSE_NEWLINE_SCAN_MIN_VECTOR_SIZE)
+    {
+        return newline_scan_scalar(block, size, last);
+    }
+
+#if CPARSE_NEWLINE_SCAN_X86
+    /* use the widest scan that this CPU supports. */
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return newline_scan_avx2(block, size, last);
+    }
+
+    return newline_scan_sse2(block, size, last);
+#else
+    return newline_scan_scalar(block, size, last);
+#endif
+}
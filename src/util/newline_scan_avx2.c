@@ -0,0 +1,71 @@
+/**
+ * \file src/util/newline_scan_avx2.c
+ *
+ * \brief AVX2 newline scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cursor_advance_internal.h"
+
+#if CPARSE_NEWLINE_SCAN_X86
+
+#include <immintrin.h>
+
+CPARSE_IMPORT_util_cursor_advance_internal;
+
+/**
+ * \brief Count the newlines in a block of characters 32 characters at a time
+ * using AVX2.
+ *
+ * \note The caller must verify that the CPU supports AVX2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+__attribute__((target("avx2")))
+size_t CPARSE_SYM(newline_scan_avx2)(
+    const char* block, size_t size, size_t* last)
+{
+    const __m256i nl = _mm256_set1_epi8('\n');
+    size_t count = 0;
+    size_t found = size;
+    size_t tail_last;
+    size_t i;
+
+    /* scan full 32 byte lanes. */
+    for (i = 0; i + 32 <= size; i += 32)
+    {
+        __m256i lane = _mm256_loadu_si256((const __m256i*)(block + i));
+        unsigned int mask =
+            (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lane, nl));
+
+        if (0 != mask)
+        {
+            count += (size_t)__builtin_popcount(mask);
+            found = i + 31 - (size_t)__builtin_clz(mask);
+        }
+    }
+
+    /* scan the remaining tail. */
+    if (i < size)
+    {
+        size_t tail_count =
+            newline_scan_scalar(block + i, size - i, &tail_last);
+        if (0 != tail_count)
+        {
+            count += tail_count;
+            found = i + tail_last;
+        }
+    }
+
+    *last = found;
+    return count;
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * \file src/util/newline_scan_scalar.c
+ *
+ * \brief Scalar newline scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cursor_advance_internal.h"
+
+/**
+ * \brief Count the newlines in a block of characters one character at a time.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+size_t CPARSE_SYM(newline_scan_scalar)(
+    const char* block, size_t size, size_t* last)
+{
+    size_t count = 0;
+
+    *last = size;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if ('\n' == block[i])
+        {
+            count += 1;
+            *last = i;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file src/util/newline_scan_sse2.c
+ *
+ * \brief SSE2 newline scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cursor_advance_internal.h"
+
+#if CPARSE_NEWLINE_SCAN_X86
+
+#include <emmintrin.h>
+
+CPARSE_IMPORT_util_cursor_advance_internal;
+
+/**
+ * \brief Count the newlines in a block of characters 16 characters at a time
+ * using SSE2.
+ *
+ * \param block         The block of characters to scan.
+ * \param size          The size of this block.
+ * \param last          Pointer to be set to the offset of the last newline in
+ *                      the block, or to \p size if there are no newlines.
+ *
+ * \returns the number of newlines in this block.
+ */
+__attribute__((target("sse2")))
+size_t CPARSE_SYM(newline_scan_sse2)(
+    const char* block, size_t size, size_t* last)
+{
+    const __m128i nl = _mm_set1_epi8('\n');
+    size_t count = 0;
+    size_t found = size;
+    size_t tail_last;
+    size_t i;
+
+    /* scan full 16 byte lanes. */
+    for (i = 0; i + 16 <= size; i += 16)
+    {
+        __m128i lane = _mm_loadu_si128((const __m128i*)(block + i));
+        unsigned int mask =
+            (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(lane, nl));
+
+        if (0 != mask)
+        {
+            count += (size_t)__builtin_popcount(mask);
+            found = i + 31 - (size_t)__builtin_clz(mask);
+        }
+    }
+
+    /* scan the remaining tail. */
+    if (i < size)
+    {
+        size_t tail_count =
+            newline_scan_scalar(block + i, size - i, &tail_last);
+        if (0 != tail_count)
+        {
+            count += tail_count;
+            found = i + tail_last;
+        }
+    }
+
+    *last = found;
+    return count;
+}
+
+#endif
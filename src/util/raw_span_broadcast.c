@@ -0,0 +1,88 @@
+/**
+ * \file src/util/raw_span_broadcast.c
+ *
+ * \brief Broadcast a piece of a span as a raw span event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_span.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
+#include <string.h>
+
+CPARSE_IMPORT_event_raw_span;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_util_cursor_advance;
+
+/**
+ * \brief Broadcast a piece of a span as a raw span event, and advance the
+ * given cursor past it.
+ *
+ * \param reactor       The reactor to which the event is broadcast.
+ * \param pos           The position of the first character of this piece. On
+ *                      return, this is the position of the character after
+ *                      it.
+ * \param span          The characters to broadcast.
+ * \param size          The number of characters to broadcast.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(raw_span_broadcast)(
+    CPARSE_SYM(event_reactor)* reactor, CPARSE_SYM(cursor)* pos,
+    const char* span, size_t size)
+{
+    int retval, release_retval;
+    CPARSE_SYM(event_raw_span) rsev;
+    CPARSE_SYM(cursor) span_pos;
+
+    /* there is nothing to broadcast for an empty piece. */
+    if (0 == size)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* the span begins at the current position. */
+    memcpy(&span_pos, pos, sizeof(span_pos));
+
+    /* the span ends at its last character. */
+    cursor_advance(pos, span, size - 1);
+    span_pos.end_line = pos->begin_line;
+    span_pos.end_col = pos->begin_col;
+    span_pos.end_offset = pos->begin_offset;
+
+    /* the next piece starts after the last character. */
+    cursor_advance_character(pos, span[size - 1]);
+
+    /* create an event for this span. */
+    retval = event_raw_span_init(&rsev, &span_pos, span, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* broadcast this event. */
+    retval = event_reactor_broadcast(reactor, event_raw_span_upcast(&rsev));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_rsev;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_rsev;
+
+cleanup_rsev:
+    release_retval = event_raw_span_dispose(&rsev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file src/util/raw_span_send_characters.c
+ *
+ * \brief Send a piece of a span one raw character event at a time.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event/raw_character.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/util/cursor_advance.h>
+#include <libcparse/util/raw_span.h>
+
+CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_util_cursor_advance;
+
+/**
+ * \brief Send a piece of a span to an event callback one raw character event
+ * at a time, advancing the given cursor past it.
+ *
+ * \param fn            The callback to which each event is sent.
+ * \param context       The context for this callback.
+ * \param pos           The position of the first character of this piece. On
+ *                      return, this is the position of the character after
+ *                      it.
+ * \param span          The characters to send.
+ * \param size          The number of characters to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int CPARSE_SYM(raw_span_send_characters)(
+    CPARSE_SYM(event_callback_fn) fn, void* context, CPARSE_SYM(cursor)* pos,
+    const char* span, size_t size)
+{
+    int retval, release_retval;
+    CPARSE_SYM(event_raw_character) rev;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        /* create an event for this character. */
+        retval = event_raw_character_init(&rev, pos, span[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* send this event. */
+        retval = fn(context, event_raw_character_upcast(&rev));
+
+        /* dispose the event. */
+        release_retval = event_raw_character_dispose(&rev);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* move to the next character. */
+        cursor_advance_character(pos, span[i]);
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file src/util/raw_span_start_position.c
+ *
+ * \brief Set a cursor to the first character of an event.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/util/raw_span.h>
+#include <string.h>
+
+CPARSE_IMPORT_event;
+
+/**
+ * \brief Set a cursor to the position of the first character of an event.
+ *
+ * \param pos           The cursor to set.
+ * \param ev            The event whose position is copied.
+ */
+void CPARSE_SYM(raw_span_start_position)(
+    CPARSE_SYM(cursor)* pos, const CPARSE_SYM(event)* ev)
+{
+    memcpy(pos, event_get_cursor(ev), sizeof(*pos));
+    pos->end_line = pos->begin_line;
+    pos->end_col = pos->begin_col;
+    pos->end_offset = pos->begin_offset;
+}
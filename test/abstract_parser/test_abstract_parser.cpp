@@ -8,11 +8,13 @@
  */
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/cursor.h>
 #include <libcparse/input_stream.h>
 #include <libcparse/message/raw_stack_scanner.h>
 #include <libcparse/message_handler.h>
 #include <libcparse/status_codes.h>
 #include <minunit/minunit.h>
+#include <string.h>
 
 CPARSE_IMPORT_abstract_parser;
 CPARSE_IMPORT_event_handler;
@@ -144,6 +146,70 @@ TEST(init_dispose)
     TEST_ASSERT(STATUS_SUCCESS == message_handler_dispose(&mh));
 }
 
+/**
+ * Test that each file name is interned once in the parser's file table.
+ */
+TEST(file_intern)
+{
+    abstract_parser ap;
+    message_handler mh;
+    const char* foo;
+    const char* foo2;
+    const char* bar;
+    const char* file;
+    uint32_t foo_id, foo2_id, bar_id;
+    char name[] = "foo.c";
+
+    /* initialize the message handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == message_handler_init(&mh, &dummy_callback, nullptr));
+
+    /* initialize the abstract parser. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_init(&ap, &mh));
+
+    /* the unnamed file is always interned. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_lookup(
+                    &file, &ap, CPARSE_CURSOR_FILE_ID_NONE));
+    TEST_EXPECT(!strcmp("(null)", file));
+
+    /* intern two files. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_intern(&foo, &foo_id, &ap, name));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_intern(&bar, &bar_id, &ap, "bar.c"));
+
+    /* the interned name is a copy. */
+    TEST_EXPECT(name != foo);
+    TEST_EXPECT(!strcmp(name, foo));
+    TEST_EXPECT(foo_id != bar_id);
+    TEST_EXPECT(CPARSE_CURSOR_FILE_ID_NONE != foo_id);
+
+    /* interning the same name again returns the same string and ID. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_intern(&foo2, &foo2_id, &ap, "foo.c"));
+    TEST_EXPECT(foo == foo2);
+    TEST_EXPECT(foo_id == foo2_id);
+
+    /* names can be looked up by ID. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == abstract_parser_file_lookup(&file, &ap, bar_id));
+    TEST_EXPECT(bar == file);
+
+    /* an unassigned ID is an error. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL
+            == abstract_parser_file_lookup(&file, &ap, 1000));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_dispose(&ap));
+    TEST_ASSERT(STATUS_SUCCESS == message_handler_dispose(&mh));
+}
+
 /**
  * Test that run sends a run message to the message handler.
  */
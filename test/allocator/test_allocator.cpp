@@ -0,0 +1,151 @@
+/**
+ * \file test/allocator/test_allocator.cpp
+ *
+ * \brief Tests for the \ref allocator type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+
+CPARSE_IMPORT_allocator;
+
+TEST_SUITE(allocator);
+
+namespace
+{
+    struct counting_context
+    {
+        size_t allocations;
+        size_t reallocations;
+        size_t frees;
+    };
+
+    void* counting_allocate(void* context, size_t size)
+    {
+        auto ctx = (counting_context*)context;
+
+        ++ctx->allocations;
+
+        return malloc(size);
+    }
+
+    void* counting_reallocate(void* context, void* block, size_t size)
+    {
+        auto ctx = (counting_context*)context;
+
+        ++ctx->reallocations;
+
+        return realloc(block, size);
+    }
+
+    void counting_free(void* context, void* block)
+    {
+        auto ctx = (counting_context*)context;
+
+        ++ctx->frees;
+
+        free(block);
+    }
+}
+
+/**
+ * Test that the default allocator can allocate, resize, and free memory.
+ */
+TEST(default_allocator)
+{
+    allocator alloc;
+
+    /* we can initialize the default allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_init_default(&alloc));
+
+    /* we can allocate a block. */
+    char* block = (char*)allocator_allocate(&alloc, 4);
+    TEST_ASSERT(nullptr != block);
+    memcpy(block, "abc", 4);
+
+    /* we can grow this block, preserving its contents. */
+    block = (char*)allocator_reallocate(&alloc, block, 64);
+    TEST_ASSERT(nullptr != block);
+    TEST_EXPECT(!strcmp(block, "abc"));
+
+    /* we can free this block. */
+    allocator_free(&alloc, block);
+
+    /* freeing NULL is a no-op. */
+    allocator_free(&alloc, nullptr);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+}
+
+/**
+ * Test that a custom allocator calls its functions with its context.
+ */
+TEST(custom_allocator)
+{
+    allocator alloc;
+    counting_context ctx = { 0, 0, 0 };
+
+    /* we can initialize a custom allocator. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == allocator_init(
+                    &alloc, &counting_allocate, &counting_reallocate,
+                    &counting_free, &ctx));
+
+    /* allocate, resize, and free a block. */
+    void* block = allocator_allocate(&alloc, 16);
+    TEST_ASSERT(nullptr != block);
+    block = allocator_reallocate(&alloc, block, 32);
+    TEST_ASSERT(nullptr != block);
+    allocator_free(&alloc, block);
+
+    /* freeing NULL does not call the free function. */
+    allocator_free(&alloc, nullptr);
+
+    /* each function was called once. */
+    TEST_EXPECT(1 == ctx.allocations);
+    TEST_EXPECT(1 == ctx.reallocations);
+    TEST_EXPECT(1 == ctx.frees);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+}
+
+/**
+ * Test that a copied allocator uses the same functions and context.
+ */
+TEST(copy_allocator)
+{
+    allocator alloc, copy;
+    counting_context ctx = { 0, 0, 0 };
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == allocator_init(
+                    &alloc, &counting_allocate, &counting_reallocate,
+                    &counting_free, &ctx));
+
+    /* we can copy this allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_init_copy(&copy, &alloc));
+
+    /* the original can be disposed without affecting the copy. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+
+    /* a block allocated from the copy is counted in the shared context. */
+    void* block = allocator_allocate(&copy, 8);
+    TEST_ASSERT(nullptr != block);
+    allocator_free(&copy, block);
+
+    TEST_EXPECT(1 == ctx.allocations);
+    TEST_EXPECT(1 == ctx.frees);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&copy));
+}
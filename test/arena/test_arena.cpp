@@ -0,0 +1,204 @@
+/**
+ * \file test/arena/test_arena.cpp
+ *
+ * \brief Tests for the \ref arena type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/arena.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_arena;
+
+TEST_SUITE(arena);
+
+/**
+ * Test that we can create and release an arena.
+ */
+TEST(create_release)
+{
+    arena* a;
+
+    /* we can create the arena. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 0, false));
+
+    /* nothing has been allocated. */
+    TEST_EXPECT(0 == arena_used_get(a));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that allocations are distinct and aligned for any type.
+ */
+TEST(allocate)
+{
+    arena* a;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 256, false));
+
+    char* x = (char*)arena_allocate(a, 3);
+    char* y = (char*)arena_allocate(a, 5);
+    TEST_ASSERT(nullptr != x);
+    TEST_ASSERT(nullptr != y);
+
+    /* the allocations do not overlap. */
+    TEST_EXPECT(x + 3 <= y || y + 5 <= x);
+
+    /* both are aligned for any type. */
+    TEST_EXPECT(0 == (uintptr_t)x % alignof(max_align_t));
+    TEST_EXPECT(0 == (uintptr_t)y % alignof(max_align_t));
+
+    /* both are counted. */
+    TEST_EXPECT(arena_used_get(a) >= 8);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that an allocation larger than the block size gets its own block.
+ */
+TEST(large_allocation)
+{
+    arena* a;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 64, false));
+
+    char* big = (char*)arena_allocate(a, 4096);
+    TEST_ASSERT(nullptr != big);
+    memset(big, 'x', 4096);
+
+    /* smaller allocations still succeed afterward. */
+    char* small = (char*)arena_allocate(a, 16);
+    TEST_ASSERT(nullptr != small);
+    memset(small, 'y', 16);
+
+    /* the large block is intact. */
+    TEST_EXPECT('x' == big[0]);
+    TEST_EXPECT('x' == big[4095]);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that resetting an arena reclaims all of its memory.
+ */
+TEST(reset)
+{
+    arena* a;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 128, false));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        TEST_ASSERT(nullptr != arena_allocate(a, 32));
+    }
+
+    TEST_ASSERT(arena_used_get(a) > 0);
+
+    /* reset the arena. */
+    arena_reset(a);
+    TEST_EXPECT(0 == arena_used_get(a));
+
+    /* the arena can be reused. */
+    TEST_EXPECT(nullptr != arena_allocate(a, 32));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that an arena allocator grows the most recent allocation in place, and
+ * copies any other allocation when it grows.
+ */
+TEST(allocator_reallocate)
+{
+    arena* a;
+    allocator alloc;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 1024, false));
+    TEST_ASSERT(STATUS_SUCCESS == arena_allocator_init(&alloc, a));
+
+    char* x = (char*)allocator_allocate(&alloc, 8);
+    TEST_ASSERT(nullptr != x);
+    memcpy(x, "abcdefg", 8);
+
+    /* the most recent allocation grows in place. */
+    char* grown = (char*)allocator_reallocate(&alloc, x, 64);
+    TEST_ASSERT(x == grown);
+    TEST_EXPECT(!strcmp(grown, "abcdefg"));
+
+    /* once another allocation follows it, it is copied instead. */
+    char* y = (char*)allocator_allocate(&alloc, 8);
+    TEST_ASSERT(nullptr != y);
+    char* moved = (char*)allocator_reallocate(&alloc, grown, 128);
+    TEST_ASSERT(nullptr != moved);
+    TEST_EXPECT(grown != moved);
+    TEST_EXPECT(!strcmp(moved, "abcdefg"));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that freeing the most recent allocation reclaims it.
+ */
+TEST(allocator_free)
+{
+    arena* a;
+    allocator alloc;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 1024, false));
+    TEST_ASSERT(STATUS_SUCCESS == arena_allocator_init(&alloc, a));
+
+    void* x = allocator_allocate(&alloc, 16);
+    TEST_ASSERT(nullptr != x);
+    size_t used = arena_used_get(a);
+
+    void* y = allocator_allocate(&alloc, 16);
+    TEST_ASSERT(nullptr != y);
+    TEST_EXPECT(arena_used_get(a) > used);
+
+    /* freeing the most recent allocation rolls the arena back. */
+    allocator_free(&alloc, y);
+    TEST_EXPECT(used == arena_used_get(a));
+
+    /* freeing an earlier allocation is a no-op. */
+    void* z = allocator_allocate(&alloc, 16);
+    TEST_ASSERT(nullptr != z);
+    used = arena_used_get(a);
+    allocator_free(&alloc, x);
+    TEST_EXPECT(used == arena_used_get(a));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
+/**
+ * Test that a thread safe arena can allocate.
+ */
+TEST(thread_safe)
+{
+    arena* a;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 0, true));
+    TEST_EXPECT(nullptr != arena_allocate(a, 32));
+    arena_reset(a);
+    TEST_EXPECT(0 == arena_used_get(a));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
@@ -98,3 +98,34 @@ TEST(event_downcast_to_event_identifier)
     /* clean up. */
     TEST_ASSERT(STATUS_SUCCESS == event_identifier_dispose(&ev));
 }
+
+/**
+ * Test that a plain identifier event has no symbol, and that an interned
+ * identifier event carries its symbol ID.
+ */
+TEST(event_identifier_symbol_get)
+{
+    event_identifier ev;
+    cursor c;
+    const char* TEST_ID = "test";
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* a plain identifier has no symbol. */
+    TEST_ASSERT(STATUS_SUCCESS == event_identifier_init(&ev, &c, TEST_ID));
+    TEST_EXPECT(
+        CPARSE_INTERN_TABLE_NO_SYMBOL == event_identifier_symbol_get(&ev));
+    TEST_ASSERT(STATUS_SUCCESS == event_identifier_dispose(&ev));
+
+    /* an interned identifier carries its symbol. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_identifier_init_for_symbol(&ev, &c, TEST_ID, 17));
+    TEST_EXPECT(
+        CPARSE_EVENT_TYPE_TOKEN_IDENTIFIER
+            == event_get_type(event_identifier_upcast(&ev)));
+    TEST_EXPECT(!strcmp(TEST_ID, event_identifier_get(&ev)));
+    TEST_EXPECT(17U == event_identifier_symbol_get(&ev));
+    TEST_ASSERT(STATUS_SUCCESS == event_identifier_dispose(&ev));
+}
@@ -0,0 +1,142 @@
+/**
+ * \file test/event/test_event_raw_span.cpp
+ *
+ * \brief Tests for the \ref event_raw_span type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event/raw_span.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+#include "../../src/event/event_internal.h"
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_internal;
+CPARSE_IMPORT_event_raw_span;
+
+TEST_SUITE(event_raw_span);
+
+/**
+ * Test that we can create a raw span event.
+ */
+TEST(event_raw_span_init)
+{
+    event_raw_span ev;
+    cursor c;
+    const char* span = "ab\ncd\n";
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* Initialize an event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_span_init(&ev, &c, span, strlen(span)));
+
+    /* get the base event type. */
+    auto bev = event_raw_span_upcast(&ev);
+
+    /* The event type is correct. */
+    TEST_EXPECT(
+        CPARSE_EVENT_TYPE_RAW_SPAN == event_get_type(bev));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_span_dispose(&ev));
+}
+
+/**
+ * Test that we can get the right category for this event.
+ */
+TEST(event_raw_span_category_get)
+{
+    event_raw_span ev;
+    cursor c;
+    const char* span = "ab\ncd\n";
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* Initialize an event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_span_init(&ev, &c, span, strlen(span)));
+
+    /* get the base event type. */
+    auto bev = event_raw_span_upcast(&ev);
+
+    /* The event category is correct. */
+    TEST_EXPECT(
+        CPARSE_EVENT_CATEGORY_RAW_SPAN == event_get_category(bev));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_span_dispose(&ev));
+}
+
+/**
+ * Test that we can get the span, size, and newline count of this event.
+ */
+TEST(event_raw_span_get)
+{
+    event_raw_span ev;
+    cursor c;
+    const char* span = "ab\ncd\n";
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* Initialize an event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_span_init(&ev, &c, span, strlen(span)));
+
+    /* the span is borrowed, not copied. */
+    TEST_EXPECT(span == event_raw_span_get(&ev));
+
+    /* the size matches our span. */
+    TEST_EXPECT(strlen(span) == event_raw_span_size_get(&ev));
+
+    /* the newlines in this span have been counted. */
+    TEST_EXPECT(2 == event_raw_span_newline_count_get(&ev));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_span_dispose(&ev));
+}
+
+/**
+ * Test that we can downcast a raw span event.
+ */
+TEST(event_downcast_to_event_raw_span)
+{
+    event_raw_span ev;
+    event_raw_span* ev2;
+    cursor c;
+    const char* span = "ab\ncd\n";
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* Initialize an event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_span_init(&ev, &c, span, strlen(span)));
+
+    /* get the base event type. */
+    auto bev = event_raw_span_upcast(&ev);
+
+    /* attempt to downcast this event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_downcast_to_event_raw_span(&ev2, bev));
+
+    /* these events should match. */
+    TEST_EXPECT(ev2 == &ev);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_span_dispose(&ev));
+}
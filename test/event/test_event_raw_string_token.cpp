@@ -166,3 +166,59 @@ TEST(event_downcast_to_event_raw_system_string_token)
     /* clean up. */
     TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&ev));
 }
+
+/**
+ * Test that we can initialize an event_raw_string_token from a view of its
+ * value.
+ */
+TEST(init_for_view)
+{
+    cursor pos;
+    event_raw_string_token ev;
+    const char* TEST_VAL = "\"abc\"";
+
+    /* set up the position. */
+    memset(&pos, 0, sizeof(pos));
+    pos.file = "stdin";
+    pos.begin_line = pos.end_line = 1;
+    pos.begin_col = 1;
+    pos.end_col = 5;
+
+    /* we can initialize the event from a view of the value. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_string_token_init_for_view(&ev, &pos, TEST_VAL, 5));
+
+    /* the value is the view, with its size. */
+    TEST_EXPECT(TEST_VAL == event_raw_string_token_get(&ev));
+    TEST_EXPECT(5 == event_raw_string_token_size_get(&ev));
+
+    /* we can dispose the event. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&ev));
+}
+
+/**
+ * Test that the size of a value passed as a string is its length.
+ */
+TEST(init_size)
+{
+    cursor pos;
+    event_raw_string_token ev;
+    const char* TEST_VAL = "\"abc\"";
+
+    /* set up the position. */
+    memset(&pos, 0, sizeof(pos));
+    pos.file = "stdin";
+    pos.begin_line = pos.end_line = 1;
+    pos.begin_col = pos.end_col = 1;
+
+    /* we can initialize the event. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_raw_string_token_init(&ev, &pos, TEST_VAL));
+
+    /* its size is the string length. */
+    TEST_EXPECT(5 == event_raw_string_token_size_get(&ev));
+
+    /* we can dispose the event. */
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&ev));
+}
@@ -320,6 +320,34 @@ TEST(event_identifier_init)
     TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
 }
 
+TEST(event_identifier_init_for_symbol)
+{
+    event_identifier iev;
+    event_identifier* clone_iev;
+    cursor c;
+    event_copy* cpy;
+    const char* ID = "foo";
+
+    memset(&c, 0, sizeof(c));
+    c.file = TESTFILE;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_identifier_init_for_symbol(&iev, &c, ID, 5));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_copy_create(&cpy, event_identifier_upcast(&iev)));
+    TEST_ASSERT(STATUS_SUCCESS == event_identifier_dispose(&iev));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_downcast_to_event_identifier(
+                    &clone_iev, (event*)event_copy_get_event(cpy)));
+    TEST_EXPECT(!strcmp(ID, event_identifier_get(clone_iev)));
+    TEST_EXPECT(5U == event_identifier_symbol_get(clone_iev));
+
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+}
+
 #define EVENT_INCLUDE_COPY_TEST(ctor, type) \
     TEST(ctor) \
     { \
@@ -727,6 +755,94 @@ TEST(event_raw_string_token_init)
     TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
 }
 
+/**
+ * Copying a token initialized from a view makes an owned copy of its value.
+ */
+TEST(event_raw_string_token_init_for_view)
+{
+    event_raw_string_token sev;
+    event_raw_string_token* sev_clone;
+    event* ev;
+    cursor c;
+    event_copy* cpy;
+    const event* clone;
+    char input[] = "\"foo bar\"";
+    const char* VAL = "\"foo bar\"";
+
+    memset(&c, 0, sizeof(c));
+    c.begin_line = c.end_line = 1;
+    c.begin_col = 1;
+    c.end_col = 9;
+    c.file = TESTFILE;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_string_token_init_for_view(
+                    &sev, &c, input, strlen(VAL)));
+    ev = event_raw_string_token_upcast(&sev);
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_create(&cpy, ev));
+
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&sev));
+
+    /* the viewed value can go away once the copy is made. */
+    memset(input, 0, sizeof(input));
+
+    clone = event_copy_get_event(cpy);
+    TEST_ASSERT(NULL != clone);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_string_token(
+                    &sev_clone, (event*)clone));
+    TEST_EXPECT(input != event_raw_string_token_get(sev_clone));
+    TEST_EXPECT(strlen(VAL) == event_raw_string_token_size_get(sev_clone));
+    TEST_ASSERT(!strcmp(VAL, event_raw_string_token_get(sev_clone)));
+
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+}
+
+TEST(event_raw_string_token_init_for_system_string)
+{
+    event_raw_string_token sev;
+    event_raw_string_token* sev_clone;
+    event* ev;
+    cursor c;
+    event_copy* cpy;
+    const event* clone;
+    const char* VAL = "<stdio.h>";
+
+    memset(&c, 0, sizeof(c));
+    c.begin_line = 23;
+    c.end_line = 23;
+    c.begin_col = 10;
+    c.end_col = 18;
+    c.file = TESTFILE;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_string_token_init_for_system_string(&sev, &c, VAL));
+    ev = event_raw_string_token_upcast(&sev);
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_create(&cpy, ev));
+
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&sev));
+
+    clone = event_copy_get_event(cpy);
+    TEST_ASSERT(NULL != clone);
+
+    /* the copy is still a system string. */
+    TEST_EXPECT(
+        CPARSE_EVENT_TYPE_TOKEN_VALUE_RAW_SYSTEM_STRING
+            == event_get_type(clone));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_string_token(
+                    &sev_clone, (event*)clone));
+    TEST_ASSERT(!strcmp(VAL, event_raw_string_token_get(sev_clone)));
+
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+}
+
 TEST(event_string_init)
 {
     event_string sev;
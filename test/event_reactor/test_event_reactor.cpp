@@ -12,6 +12,7 @@
 #include <libcparse/status_codes.h>
 #include <minunit/minunit.h>
 #include <string.h>
+#include <vector>
 
 CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
@@ -27,6 +28,12 @@ namespace
         size_t count;
         const CPARSE_SYM(event)* ev;
     };
+
+    struct order_context
+    {
+        int id;
+        std::vector<int>* order;
+    };
 }
 
 static int dummy_callback(void* context, const CPARSE_SYM(event)* ev)
@@ -38,6 +45,16 @@ static int dummy_callback(void* context, const CPARSE_SYM(event)* ev)
     return STATUS_SUCCESS;
 }
 
+static int order_callback(void* context, const CPARSE_SYM(event)* ev)
+{
+    order_context* ctx = (order_context*)context;
+    (void)ev;
+
+    ctx->order->push_back(ctx->id);
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * Test the basics of the event_reactor type.
  */
@@ -180,3 +197,355 @@ TEST(broadcast_multiple)
     TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh3));
     TEST_ASSERT(STATUS_SUCCESS == event_dispose(&ev));
 }
+
+/**
+ * Test the basics of the event_reactor_filter type.
+ */
+TEST(filter_basics)
+{
+    event_reactor_filter filter;
+
+    /* a cleared filter selects nothing. */
+    event_reactor_filter_clear(&filter);
+    TEST_EXPECT(!event_reactor_filter_has_type(&filter, CPARSE_EVENT_TYPE_EOF));
+    TEST_EXPECT(
+        !event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE));
+
+    /* we can select a single type. */
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE);
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE));
+    TEST_EXPECT(
+        !event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_TOKEN_NEWLINE));
+
+    /* we can select a range of types. */
+    event_reactor_filter_add_type_range(
+        &filter, CPARSE_EVENT_TYPE_COMMENT_BLOCK_BEGIN,
+        CPARSE_EVENT_TYPE_COMMENT_LINE_END);
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_COMMENT_BLOCK_BEGIN));
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_COMMENT_BLOCK_END));
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_COMMENT_LINE_BEGIN));
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_COMMENT_LINE_END));
+    TEST_EXPECT(
+        !event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_COMMENT_LINE_END + 1));
+
+    /* the highest event type can be selected. */
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_EXP_COMMA_END);
+    TEST_EXPECT(
+        event_reactor_filter_has_type(
+            &filter, CPARSE_EVENT_TYPE_EXP_COMMA_END));
+
+    /* unknown event types are ignored. */
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_UNKNOWN);
+    TEST_EXPECT(
+        !event_reactor_filter_has_type(&filter, CPARSE_EVENT_TYPE_UNKNOWN));
+    TEST_EXPECT(!event_reactor_filter_has_type(&filter, -1));
+}
+
+/**
+ * Test that a filtered handler only receives the events it selected.
+ */
+TEST(broadcast_filtered)
+{
+    event_reactor* er;
+    event_handler eh1, eh2;
+    event_reactor_filter filter;
+    event ws, nl, eof;
+    test_context t1, t2;
+    cursor c;
+
+    /* we can create an event_reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+
+    /* initialize the event_handlers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh1, &dummy_callback, &t1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh2, &dummy_callback, &t2));
+
+    /* the first handler only wants whitespace tokens. */
+    event_reactor_filter_clear(&filter);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE);
+
+    /* add these handlers to the reactor. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_reactor_add_filtered(er, &eh1, &filter));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_add(er, &eh2));
+
+    /* changing the filter after adding it has no effect. */
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_EOF);
+
+    /* clear the test contexts. */
+    memset(&t1, 0, sizeof(t1));
+    memset(&t2, 0, sizeof(t2));
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* initialize the events. */
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_whitespace_token(&ws, &c));
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_newline_token(&nl, &c));
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_eof(&eof, &c));
+
+    /* broadcast these events. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &ws));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &nl));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &eof));
+
+    /* the filtered handler only saw the whitespace token. */
+    TEST_EXPECT(1 == t1.count);
+    TEST_EXPECT(&ws == t1.ev);
+
+    /* the unfiltered handler saw every event. */
+    TEST_EXPECT(3 == t2.count);
+    TEST_EXPECT(&eof == t2.ev);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh1));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh2));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&ws));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&nl));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&eof));
+}
+
+/**
+ * Test that mixing filtered and unfiltered handlers preserves broadcast order.
+ */
+TEST(broadcast_filtered_order)
+{
+    event_reactor* er;
+    event_handler eh1, eh2, eh3;
+    event_reactor_filter filter;
+    std::vector<int> order;
+    order_context t1{1, &order}, t2{2, &order}, t3{3, &order};
+    event ws, nl;
+    cursor c;
+
+    /* we can create an event_reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+
+    /* initialize the event_handlers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh1, &order_callback, &t1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh2, &order_callback, &t2));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh3, &order_callback, &t3));
+
+    /* the second handler only wants whitespace tokens. */
+    event_reactor_filter_clear(&filter);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_TOKEN_WHITESPACE);
+
+    /* add these handlers to the reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_add(er, &eh1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_reactor_add_filtered(er, &eh2, &filter));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_add(er, &eh3));
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* initialize the events. */
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_whitespace_token(&ws, &c));
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_newline_token(&nl, &c));
+
+    /* broadcast a whitespace token. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &ws));
+
+    /* all handlers saw this event, in subscription order. */
+    TEST_ASSERT(3 == order.size());
+    TEST_EXPECT(1 == order[0]);
+    TEST_EXPECT(2 == order[1]);
+    TEST_EXPECT(3 == order[2]);
+
+    /* broadcast a newline token. */
+    order.clear();
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &nl));
+
+    /* the filtered handler was skipped. */
+    TEST_ASSERT(2 == order.size());
+    TEST_EXPECT(1 == order[0]);
+    TEST_EXPECT(3 == order[1]);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh1));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh2));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh3));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&ws));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&nl));
+}
+
+/**
+ * Test that handlers are sent events in subscription order, and that the
+ * reactor grows to hold many handlers.
+ */
+TEST(broadcast_subscription_order)
+{
+    const int HANDLER_COUNT = 17;
+    event_reactor* er;
+    event_handler eh[HANDLER_COUNT];
+    std::vector<int> order;
+    order_context t[HANDLER_COUNT];
+    event ev;
+    cursor c;
+
+    /* we can create an event_reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+
+    /* initialize and add the event_handlers. */
+    for (int i = 0; i < HANDLER_COUNT; ++i)
+    {
+        t[i].id = i;
+        t[i].order = &order;
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == event_handler_init(&eh[i], &order_callback, &t[i]));
+        TEST_ASSERT(STATUS_SUCCESS == event_reactor_add(er, &eh[i]));
+    }
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* initialize a dummy event. */
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_whitespace_token(&ev, &c));
+
+    /* broadcast this event. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &ev));
+
+    /* every handler saw this event, in subscription order. */
+    TEST_ASSERT((size_t)HANDLER_COUNT == order.size());
+    for (int i = 0; i < HANDLER_COUNT; ++i)
+    {
+        TEST_EXPECT(i == order[i]);
+    }
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+    for (int i = 0; i < HANDLER_COUNT; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh[i]));
+    }
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&ev));
+}
+
+/**
+ * Test that a single filtered handler is not sent events it didn't select.
+ */
+TEST(broadcast_single_filtered)
+{
+    event_reactor* er;
+    event_handler eh;
+    event_reactor_filter filter;
+    event ws, nl;
+    test_context t;
+    cursor c;
+
+    /* we can create an event_reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+
+    /* initialize an event_handler. */
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_init(&eh, &dummy_callback, &t));
+
+    /* this handler only wants newline tokens. */
+    event_reactor_filter_clear(&filter);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_TOKEN_NEWLINE);
+
+    /* add this handler to the reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_add_filtered(er, &eh, &filter));
+
+    /* clear the test context. */
+    memset(&t, 0, sizeof(t));
+
+    /* clear the cursor. */
+    memset(&c, 0, sizeof(c));
+
+    /* initialize the events. */
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_whitespace_token(&ws, &c));
+    TEST_ASSERT(STATUS_SUCCESS == event_init_for_newline_token(&nl, &c));
+
+    /* broadcast these events. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &ws));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_broadcast(er, &nl));
+
+    /* only the newline token was received. */
+    TEST_EXPECT(1 == t.count);
+    TEST_EXPECT(&nl == t.ev);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&ws));
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&nl));
+}
+
+/**
+ * Test that a reactor only accepts raw spans if every handler does.
+ */
+TEST(accepts_raw_spans)
+{
+    event_reactor* er;
+    event_handler eh1, eh2, eh3;
+    event_reactor_filter span_filter, char_filter;
+    test_context t;
+
+    /* we can create an event_reactor. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+
+    /* initialize the event handlers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh1, &dummy_callback, &t));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh2, &dummy_callback, &t));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh3, &dummy_callback, &t));
+
+    /* one filter accepts raw spans, and one only wants raw characters. */
+    event_reactor_filter_clear(&span_filter);
+    event_reactor_filter_add_type(
+        &span_filter, CPARSE_EVENT_TYPE_RAW_CHARACTER);
+    event_reactor_filter_add_type(&span_filter, CPARSE_EVENT_TYPE_RAW_SPAN);
+    event_reactor_filter_clear(&char_filter);
+    event_reactor_filter_add_type(
+        &char_filter, CPARSE_EVENT_TYPE_RAW_CHARACTER);
+
+    /* an empty reactor accepts raw spans. */
+    TEST_EXPECT(event_reactor_accepts_raw_spans(er));
+
+    /* a handler that accepts spans keeps this true. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_reactor_add_filtered(er, &eh1, &span_filter));
+    TEST_EXPECT(event_reactor_accepts_raw_spans(er));
+
+    /* a handler that only wants raw characters makes this false. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_reactor_add_filtered(er, &eh2, &char_filter));
+    TEST_EXPECT(!event_reactor_accepts_raw_spans(er));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+
+    /* an unfiltered handler also makes this false. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_create(&er));
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_add(er, &eh3));
+    TEST_EXPECT(!event_reactor_accepts_raw_spans(er));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_reactor_release(er));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh1));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh2));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh3));
+}
@@ -98,6 +98,9 @@ TEST(cache_set)
     /* the file matches our expected file. */
     TEST_EXPECT(!strcmp(file, EXPECTED_FILE));
 
+    /* the file is not copied. */
+    TEST_EXPECT(EXPECTED_FILE == file);
+
     /* getting the position succeeds. */
     TEST_ASSERT(
         STATUS_SUCCESS == file_position_cache_position_get(cache, &pos));
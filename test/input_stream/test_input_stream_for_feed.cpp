@@ -0,0 +1,133 @@
+/**
+ * \file test/input_stream/test_input_stream_for_feed.cpp
+ *
+ * \brief Tests for the feed \ref input_stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/input_stream.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+CPARSE_IMPORT_input_stream;
+
+TEST_SUITE(input_stream_for_feed);
+
+/**
+ * Reading from a feed stream with no input would block.
+ */
+TEST(empty_would_block)
+{
+    input_stream* stream = nullptr;
+    const char* span;
+    size_t size;
+    int ch;
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_for_feed(&stream));
+
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK
+            == input_stream_read(stream, &ch));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * Fed characters can be read, and the stream reports EOF once finished.
+ */
+TEST(read_character)
+{
+    input_stream* stream = nullptr;
+    int ch;
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_for_feed(&stream));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed(stream, "ab", 2));
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+    TEST_EXPECT('a' == ch);
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+    TEST_EXPECT('b' == ch);
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_WOULD_BLOCK
+            == input_stream_read(stream, &ch));
+
+    /* bytes fed before finishing are still read. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed(stream, "c", 1));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed_finish(stream));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+    TEST_EXPECT('c' == ch);
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* no more bytes can be fed. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_feed(stream, "d", 1));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * A span holds every byte fed since the last read, and it remains valid while
+ * more bytes are fed.
+ */
+TEST(read_span)
+{
+    input_stream* stream = nullptr;
+    const char* span;
+    const char* next_span;
+    size_t size, next_size;
+    char big[10000];
+
+    memset(big, 'x', sizeof(big));
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_for_feed(&stream));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed(stream, "abc", 3));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed(stream, "def", 3));
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT(6U == size);
+
+    /* feeding enough to grow the buffer does not disturb the span. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed(stream, big, sizeof(big)));
+    TEST_EXPECT(0 == memcmp(span, "abcdef", 6));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_read_span(stream, &next_span, &next_size));
+    TEST_ASSERT(sizeof(big) == next_size);
+    TEST_EXPECT(0 == memcmp(next_span, big, sizeof(big)));
+
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_feed_finish(stream));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * Only feed streams can be fed.
+ */
+TEST(feed_bad_cast)
+{
+    input_stream* stream = nullptr;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == input_stream_create_from_string(&stream, "a"));
+
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_BAD_CAST == input_stream_feed(stream, "b", 1));
+    TEST_EXPECT(ERROR_LIBCPARSE_BAD_CAST == input_stream_feed_finish(stream));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
@@ -0,0 +1,183 @@
+/**
+ * \file test/input_stream/test_input_stream_from_buffered_descriptor.cpp
+ *
+ * \brief Tests for the buffered descriptor \ref input_stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/input_stream.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+CPARSE_IMPORT_input_stream;
+
+TEST_SUITE(input_stream_from_buffered_descriptor);
+
+/**
+ * Reading from an empty buffered descriptor input_stream returns EOF.
+ */
+TEST(empty_EOF)
+{
+    input_stream* stream = nullptr;
+    int ch;
+    int sd[2];
+
+    /* create the socket pair for this stream. */
+    TEST_ASSERT(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, sd));
+
+    /* close the output side so the input side gets EOF. */
+    close(sd[1]);
+
+    /* Creating a buffered descriptor input stream should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_buffered_descriptor(
+                    &stream, sd[0], 0));
+
+    /* Reading from this stream returns an EOF error. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * We can read multiple characters from the buffered descriptor input_stream.
+ */
+TEST(read_multiple_characters)
+{
+    const char* test_msg = "abcdef";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    int ch;
+    int sd[2];
+
+    /* create the socket pair for this stream. */
+    TEST_ASSERT(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, sd));
+
+    /* write the test message to the string. */
+    TEST_ASSERT(test_msg_size == write(sd[1], test_msg, test_msg_size));
+
+    /* close the output side so the input side gets EOF. */
+    close(sd[1]);
+
+    /* Creating a buffered descriptor input stream should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_buffered_descriptor(
+                    &stream, sd[0], 0));
+
+    /* We can read characters. */
+    for (const char* i = test_msg; 0 != *i; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+        TEST_EXPECT(*i == ch);
+    }
+
+    /* Trying to read any more characters results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * When the input is larger than the buffer, the buffer is refilled as it is
+ * exhausted.
+ */
+TEST(read_across_buffer_boundaries)
+{
+    const char* test_msg = "abcdefghijklmnopqrstuvwxyz";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    int ch;
+    int sd[2];
+
+    /* create the socket pair for this stream. */
+    TEST_ASSERT(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, sd));
+
+    /* write the test message to the string. */
+    TEST_ASSERT(test_msg_size == write(sd[1], test_msg, test_msg_size));
+
+    /* close the output side so the input side gets EOF. */
+    close(sd[1]);
+
+    /* Create a buffered descriptor input stream with a tiny buffer. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_buffered_descriptor(
+                    &stream, sd[0], 3));
+
+    /* We can read every character. */
+    for (const char* i = test_msg; 0 != *i; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+        TEST_EXPECT(*i == ch);
+    }
+
+    /* Trying to read any more characters results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * Spans read from the buffered descriptor input_stream are whole blocks.
+ */
+TEST(read_span)
+{
+    const char* test_msg = "abcdefgh";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    const char* span;
+    size_t size;
+    int ch;
+    int sd[2];
+
+    /* create the socket pair for this stream. */
+    TEST_ASSERT(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, sd));
+
+    /* write the test message to the string. */
+    TEST_ASSERT(test_msg_size == write(sd[1], test_msg, test_msg_size));
+
+    /* close the output side so the input side gets EOF. */
+    close(sd[1]);
+
+    /* Create a buffered descriptor input stream with a tiny buffer. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_buffered_descriptor(
+                    &stream, sd[0], 3));
+
+    /* Reading a character leaves the rest of the block for the span. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+    TEST_EXPECT('a' == ch);
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT(2 == size);
+    TEST_EXPECT(0 == memcmp(span, "bc", size));
+
+    /* The next spans are refilled blocks. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT(3 == size);
+    TEST_EXPECT(0 == memcmp(span, "def", size));
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT(2 == size);
+    TEST_EXPECT(0 == memcmp(span, "gh", size));
+
+    /* Trying to read any more spans results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
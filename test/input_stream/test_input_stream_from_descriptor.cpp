@@ -126,3 +126,46 @@ TEST(read_multiple_characters)
     /* clean up. */
     TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
 }
+
+/**
+ * The descriptor input_stream reads spans one character at a time.
+ */
+TEST(read_span)
+{
+    const char* test_msg = "abc";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    const char* span;
+    size_t size;
+    int sd[2];
+
+    /* create the socket pair for this stream. */
+    TEST_ASSERT(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, sd));
+
+    /* write the test message to the string. */
+    TEST_ASSERT(test_msg_size == write(sd[1], test_msg, test_msg_size));
+
+    /* close the output side so the input side gets EOF. */
+    close(sd[1]);
+
+    /* Creating a socket descriptor input stream should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == input_stream_create_from_descriptor(&stream, sd[0]));
+
+    /* Each span holds a single character. */
+    for (const char* i = test_msg; 0 != *i; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+        TEST_ASSERT(1 == size);
+        TEST_EXPECT(*i == *span);
+    }
+
+    /* Trying to read any more spans results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
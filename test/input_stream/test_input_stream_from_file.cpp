@@ -0,0 +1,151 @@
+/**
+ * \file test/input_stream/test_input_stream_from_file.cpp
+ *
+ * \brief Tests for the file \ref input_stream.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/input_stream.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+CPARSE_IMPORT_input_stream;
+
+TEST_SUITE(input_stream_from_file);
+
+/**
+ * Creating a file input_stream for a missing file fails.
+ */
+TEST(missing_file)
+{
+    input_stream* stream = nullptr;
+
+    /* Creating a file input stream for a missing file fails. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_FILE_OPEN_ERROR
+            == input_stream_create_from_file(
+                    &stream, "/this/file/does/not/exist.c"));
+}
+
+/**
+ * Reading from an empty file input_stream returns EOF.
+ */
+TEST(empty_EOF)
+{
+    input_stream* stream = nullptr;
+    char path[] = "/tmp/test_input_stream_from_file.XXXXXX";
+    int ch;
+
+    /* create an empty temporary file. */
+    int desc = mkstemp(path);
+    TEST_ASSERT(desc >= 0);
+    close(desc);
+
+    /* Creating a file input stream should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_from_file(&stream, path));
+
+    /* Reading from this stream returns an EOF error. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+    unlink(path);
+}
+
+/**
+ * Special files fall back to a buffered stream.
+ */
+TEST(special_file_EOF)
+{
+    input_stream* stream = nullptr;
+    int ch;
+
+    /* Creating a file input stream for /dev/null should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == input_stream_create_from_file(&stream, "/dev/null"));
+
+    /* Reading from this stream returns an EOF error. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
+
+/**
+ * We can read multiple characters from the file input_stream.
+ */
+TEST(read_multiple_characters)
+{
+    const char* test_msg = "abcdef";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    char path[] = "/tmp/test_input_stream_from_file.XXXXXX";
+    int ch;
+
+    /* create a temporary file holding the test message. */
+    int desc = mkstemp(path);
+    TEST_ASSERT(desc >= 0);
+    TEST_ASSERT(test_msg_size == write(desc, test_msg, test_msg_size));
+    close(desc);
+
+    /* Creating a file input stream should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_from_file(&stream, path));
+
+    /* We can read characters. */
+    for (const char* i = test_msg; 0 != *i; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+        TEST_EXPECT(*i == ch);
+    }
+
+    /* Reading from this stream returns an EOF error. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF == input_stream_read(stream, &ch));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+    unlink(path);
+}
+
+/**
+ * Reading a span from a mapped file returns the rest of the file.
+ */
+TEST(read_span)
+{
+    const char* test_msg = "abcdef";
+    ssize_t test_msg_size = strlen(test_msg);
+    input_stream* stream = nullptr;
+    char path[] = "/tmp/test_input_stream_from_file.XXXXXX";
+    const char* span;
+    size_t size;
+
+    /* create a temporary file holding the test message. */
+    int desc = mkstemp(path);
+    TEST_ASSERT(desc >= 0);
+    TEST_ASSERT(test_msg_size == write(desc, test_msg, test_msg_size));
+    close(desc);
+
+    /* Creating a file input stream should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_create_from_file(&stream, path));
+
+    /* The span holds the whole file. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT((size_t)test_msg_size == size);
+    TEST_EXPECT(0 == memcmp(span, test_msg, size));
+
+    /* Trying to read any more spans results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+    unlink(path);
+}
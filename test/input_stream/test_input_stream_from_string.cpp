@@ -10,6 +10,7 @@
 #include <libcparse/input_stream.h>
 #include <libcparse/status_codes.h>
 #include <minunit/minunit.h>
+#include <string.h>
 
 CPARSE_IMPORT_input_stream;
 
@@ -92,3 +93,36 @@ TEST(read_multiple_characters)
     /* clean up. */
     TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
 }
+
+/**
+ * Reading a span from the string input_stream returns the rest of the string.
+ */
+TEST(read_span)
+{
+    input_stream* stream = nullptr;
+    const char* span;
+    size_t size;
+    int ch;
+
+    /* Creating a string input stream should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, "abcdef"));
+
+    /* We can read a character. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read(stream, &ch));
+    TEST_EXPECT('a' == ch);
+
+    /* The span holds the remaining characters. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_read_span(stream, &span, &size));
+    TEST_ASSERT(5 == size);
+    TEST_EXPECT(0 == memcmp(span, "bcdef", size));
+
+    /* Trying to read any more spans results in an EOF. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INPUT_STREAM_EOF
+            == input_stream_read_span(stream, &span, &size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == input_stream_release(stream));
+}
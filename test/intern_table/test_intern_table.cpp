@@ -0,0 +1,232 @@
+/**
+ * \file test/intern_table/test_intern_table.cpp
+ *
+ * \brief Tests for the \ref intern_table type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/intern_table.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+CPARSE_IMPORT_intern_table;
+
+TEST_SUITE(intern_table);
+
+/**
+ * Test that we can create and release an intern table.
+ */
+TEST(create)
+{
+    intern_table* table = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+    TEST_ASSERT(nullptr != table);
+    TEST_EXPECT(0U == intern_table_count(table));
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
+
+/**
+ * Test that equal spans are interned once, and that distinct spans get dense
+ * symbol IDs in the order in which they are first seen.
+ */
+TEST(intern)
+{
+    intern_table* table = nullptr;
+    const char* foo;
+    const char* bar;
+    const char* foo2;
+    uint32_t foo_sym, bar_sym, foo2_sym;
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+
+    /* spans need not be NUL-terminated. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == intern_table_intern(&foo, &foo_sym, table, "foobar", 3));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == intern_table_intern(&bar, &bar_sym, table, "barfoo", 3));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == intern_table_intern(&foo2, &foo2_sym, table, "foo", 3));
+
+    TEST_EXPECT(0U == foo_sym);
+    TEST_EXPECT(1U == bar_sym);
+    TEST_EXPECT(foo_sym == foo2_sym);
+    TEST_EXPECT(foo == foo2);
+    TEST_EXPECT(!strcmp("foo", foo));
+    TEST_EXPECT(!strcmp("bar", bar));
+    TEST_EXPECT(2U == intern_table_count(table));
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
+
+/**
+ * Test that a prefix of an interned string is a distinct string.
+ */
+TEST(intern_prefix)
+{
+    intern_table* table = nullptr;
+    const char* str;
+    uint32_t sym1, sym2, sym3;
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == intern_table_intern(&str, &sym1, table, "abc", 3));
+    TEST_ASSERT(
+        STATUS_SUCCESS == intern_table_intern(&str, &sym2, table, "abc", 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS == intern_table_intern(&str, &sym3, table, "", 0));
+    TEST_EXPECT(sym1 != sym2);
+    TEST_EXPECT(sym2 != sym3);
+    TEST_EXPECT(!strcmp("", str));
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
+
+/**
+ * Test that we can look up the string for a symbol ID.
+ */
+TEST(lookup)
+{
+    intern_table* table = nullptr;
+    const char* str;
+    const char* found;
+    uint32_t sym;
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+    TEST_ASSERT(
+        STATUS_SUCCESS == intern_table_intern(&str, &sym, table, "xyz", 3));
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_lookup(&found, table, sym));
+    TEST_EXPECT(str == found);
+
+    /* unassigned symbols are rejected. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL
+            == intern_table_lookup(&found, table, sym + 1));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_INTERN_TABLE_BAD_SYMBOL
+            == intern_table_lookup(
+                    &found, table, CPARSE_INTERN_TABLE_NO_SYMBOL));
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
+
+/**
+ * Test that interned strings stay valid and unique as the table grows.
+ */
+TEST(growth)
+{
+    intern_table* table = nullptr;
+    const size_t COUNT = 20000;
+    vector<const char*> strs;
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        string name = "id_" + to_string(i);
+        const char* str;
+        uint32_t sym;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == intern_table_intern(
+                        &str, &sym, table, name.data(), name.size()));
+        TEST_ASSERT(i == sym);
+        strs.push_back(str);
+    }
+
+    /* a long string gets a block of its own. */
+    string big(100000, 'x');
+    const char* big_str;
+    uint32_t big_sym;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == intern_table_intern(
+                    &big_str, &big_sym, table, big.data(), big.size()));
+    TEST_EXPECT(big == big_str);
+
+    TEST_EXPECT(COUNT + 1 == intern_table_count(table));
+
+    /* every string is found again, at the same address. */
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        string name = "id_" + to_string(i);
+        const char* str;
+        uint32_t sym;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == intern_table_intern(
+                        &str, &sym, table, name.data(), name.size()));
+        TEST_EXPECT(i == sym);
+        TEST_EXPECT(strs[i] == str);
+        TEST_EXPECT(name == str);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
+
+/**
+ * Test that a thread safe table can be shared by several threads.
+ */
+TEST(thread_safe)
+{
+    intern_table* table = nullptr;
+    const size_t THREADS = 4;
+    const size_t COUNT = 2000;
+    vector<thread> threads;
+    vector<vector<uint32_t>> syms(THREADS);
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, true));
+
+    /* every thread interns the same strings. */
+    for (size_t t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < COUNT; ++i)
+            {
+                string name = "id_" + to_string(i);
+                const char* str;
+                uint32_t sym = CPARSE_INTERN_TABLE_NO_SYMBOL;
+
+                if (
+                    STATUS_SUCCESS
+                        != intern_table_intern(
+                            &str, &sym, table, name.data(), name.size()))
+                {
+                    sym = CPARSE_INTERN_TABLE_NO_SYMBOL;
+                }
+
+                syms[t].push_back(sym);
+            }
+        });
+    }
+
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    /* every thread saw the same symbol for each string. */
+    TEST_EXPECT(COUNT == intern_table_count(table));
+    for (size_t t = 1; t < THREADS; ++t)
+    {
+        TEST_EXPECT(syms[0] == syms[t]);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+}
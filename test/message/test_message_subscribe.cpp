@@ -15,6 +15,7 @@
 
 CPARSE_IMPORT_input_stream;
 CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_message;
 CPARSE_IMPORT_message_subscription;
 
@@ -75,6 +76,37 @@ TEST(event_handler_get)
     TEST_ASSERT(STATUS_SUCCESS == message_subscribe_dispose(&msg));
 }
 
+/**
+ * Get and set the event reactor filter.
+ */
+TEST(filter_get_set)
+{
+    message_subscribe msg;
+    event_handler handler;
+    event_reactor_filter filter;
+
+    /* we can init the event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_handler_init(&handler, &dummy_event_callback_fn, nullptr));
+
+    /* we can initialize the message. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == message_subscribe_init_for_raw_stack_scanner(&msg, &handler));
+
+    /* by default, there is no filter. */
+    TEST_EXPECT(nullptr == message_subscribe_filter_get(&msg));
+
+    /* we can set the filter. */
+    event_reactor_filter_clear(&filter);
+    message_subscribe_filter_set(&msg, &filter);
+    TEST_EXPECT(&filter == message_subscribe_filter_get(&msg));
+
+    /* dispose the message. */
+    TEST_ASSERT(STATUS_SUCCESS == message_subscribe_dispose(&msg));
+}
+
 /**
  *  Test that we can upcast and downcast a CPARSE_MESSAGE_TYPE_RSS_SUBSCRIBE
  *  message.
@@ -312,3 +344,40 @@ TEST(upcast_downcast_CPARSE_MESSAGE_TYPE_PREPROCESSOR_SCANNER_SUBSCRIBE)
     /* dispose the message. */
     TEST_ASSERT(STATUS_SUCCESS == message_subscribe_dispose(&msg));
 }
+
+/**
+ *  Test that we can upcast and downcast a
+ *  CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE message.
+ */
+TEST(upcast_downcast_CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE)
+{
+    message_subscribe msg;
+    message* upcast_msg;
+    message_subscribe* downcast_msg;
+    event_handler handler;
+
+    /* we can init the event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_handler_init(&handler, &dummy_event_callback_fn, nullptr));
+
+    /* we can initialize the message. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == message_subscribe_init_for_raw_stack_scanner_spans(
+                    &msg, &handler));
+
+    /* the message type is correct. */
+    upcast_msg = message_subscribe_upcast(&msg);
+    TEST_ASSERT(NULL != upcast_msg);
+    TEST_EXPECT(
+        CPARSE_MESSAGE_TYPE_RSS_SPAN_SUBSCRIBE == message_get_type(upcast_msg));
+
+    /* we can downcast the message. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            message_downcast_to_message_subscribe(&downcast_msg, upcast_msg));
+
+    /* dispose the message. */
+    TEST_ASSERT(STATUS_SUCCESS == message_subscribe_dispose(&msg));
+}
@@ -0,0 +1,359 @@
+/**
+ * \file test/parse_pool/test_parse_pool.cpp
+ *
+ * \brief Tests for the \ref parse_pool type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_type.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/parse_pool.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_parse_pool;
+
+TEST_SUITE(parse_pool);
+
+#define RESULT_CALLBACK_ERROR 0x7777
+
+namespace
+{
+    struct pool_context
+    {
+        vector<size_t> identifiers;
+        vector<size_t> delivered;
+        vector<int> status;
+        size_t fail_after;
+
+        pool_context(size_t count)
+            : identifiers(count, 0), status(count, -1), fail_after(count)
+        {
+        }
+    };
+
+    struct temp_files
+    {
+        vector<string> paths;
+        vector<const char*> c_paths;
+
+        /* file i contains i + 1 identifiers. */
+        temp_files(size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                char path[] = "/tmp/test_parse_pool.XXXXXX";
+                int desc = mkstemp(path);
+                string contents;
+
+                for (size_t j = 0; j <= i; ++j)
+                {
+                    contents += "x" + to_string(j) + " = 1;\n";
+                }
+
+                if (desc >= 0)
+                {
+                    if (
+                        write(desc, contents.data(), contents.size())
+                            != (ssize_t)contents.size())
+                    {
+                        path[0] = 0;
+                    }
+
+                    close(desc);
+                }
+
+                paths.push_back(path);
+            }
+
+            for (auto& p : paths)
+            {
+                c_paths.push_back(p.c_str());
+            }
+        }
+
+        ~temp_files()
+        {
+            for (auto& p : paths)
+            {
+                unlink(p.c_str());
+            }
+        }
+    };
+}
+
+/**
+ * \brief Count identifier tokens.
+ */
+static int count_callback(void* context, const event* ev)
+{
+    if (CPARSE_EVENT_TYPE_TOKEN_IDENTIFIER == event_get_type(ev))
+    {
+        *(size_t*)context += 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Subscribe an identifier counter for this file.
+ */
+static int setup_callback(
+    void* context, abstract_parser* ap, size_t index, const char*)
+{
+    int retval, release_retval;
+    auto ctx = (pool_context*)context;
+    event_handler eh;
+
+    retval =
+        event_handler_init(&eh, &count_callback, &ctx->identifiers[index]);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Record a result.
+ */
+static int result_callback(
+    void* context, size_t index, const char*, int status)
+{
+    auto ctx = (pool_context*)context;
+
+    if (ctx->delivered.size() == ctx->fail_after)
+    {
+        return RESULT_CALLBACK_ERROR;
+    }
+
+    ctx->delivered.push_back(index);
+    ctx->status[index] = status;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Test that we can create and release a parse pool.
+ */
+TEST(create_release)
+{
+    parse_pool* pool;
+
+    /* by default, there is at least one worker. */
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 0));
+    TEST_EXPECT(parse_pool_thread_count(pool) >= 1);
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+
+    /* the worker count can be given explicitly. */
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 3));
+    TEST_EXPECT(3 == parse_pool_thread_count(pool));
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that an invalid order is rejected, and that an empty list succeeds.
+ */
+TEST(bad_order_empty_list)
+{
+    parse_pool* pool;
+    pool_context ctx(0);
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 2));
+
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_PARSE_POOL_BAD_ORDER
+            == parse_pool_run(
+                    pool, nullptr, 0, 0x1234, &setup_callback,
+                    &result_callback, &ctx));
+
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == parse_pool_run(
+                    pool, nullptr, 0, CPARSE_PARSE_POOL_ORDER_INPUT,
+                    &setup_callback, &result_callback, &ctx));
+    TEST_EXPECT(ctx.delivered.empty());
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that results can be delivered in input order.
+ */
+TEST(input_order)
+{
+    parse_pool* pool;
+    const size_t COUNT = 37;
+    temp_files files(COUNT);
+    pool_context ctx(COUNT);
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 4));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == parse_pool_run(
+                    pool, files.c_paths.data(), COUNT,
+                    CPARSE_PARSE_POOL_ORDER_INPUT, &setup_callback,
+                    &result_callback, &ctx));
+
+    /* every file was parsed, and results arrived in order. */
+    TEST_ASSERT(COUNT == ctx.delivered.size());
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        TEST_EXPECT(i == ctx.delivered[i]);
+        TEST_EXPECT(STATUS_SUCCESS == ctx.status[i]);
+        TEST_EXPECT(i + 1 == ctx.identifiers[i]);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that every file shares the pool's intern table, so that each distinct
+ * identifier is interned once.
+ */
+TEST(shared_symbols)
+{
+    parse_pool* pool;
+    const size_t COUNT = 20;
+    temp_files files(COUNT);
+    pool_context ctx(COUNT);
+    intern_table* table;
+    const char* str;
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 4));
+    table = parse_pool_intern_table_get(pool);
+    TEST_ASSERT(nullptr != table);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == parse_pool_run(
+                    pool, files.c_paths.data(), COUNT,
+                    CPARSE_PARSE_POOL_ORDER_INPUT, &setup_callback,
+                    &result_callback, &ctx));
+
+    /* the files use the identifiers x0 through x19. */
+    TEST_EXPECT(COUNT == intern_table_count(table));
+    for (uint32_t i = 0; i < COUNT; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == intern_table_lookup(&str, table, i));
+        TEST_EXPECT('x' == str[0]);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that results can be delivered in completion order, and that a pool can
+ * be run more than once.
+ */
+TEST(completion_order)
+{
+    parse_pool* pool;
+    const size_t COUNT = 50;
+    temp_files files(COUNT);
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 3));
+
+    for (int run = 0; run < 2; ++run)
+    {
+        pool_context ctx(COUNT);
+        vector<bool> seen(COUNT, false);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == parse_pool_run(
+                        pool, files.c_paths.data(), COUNT,
+                        CPARSE_PARSE_POOL_ORDER_COMPLETION, &setup_callback,
+                        &result_callback, &ctx));
+
+        /* every file was reported exactly once. */
+        TEST_ASSERT(COUNT == ctx.delivered.size());
+        for (auto index : ctx.delivered)
+        {
+            TEST_ASSERT(index < COUNT);
+            TEST_EXPECT(!seen[index]);
+            seen[index] = true;
+            TEST_EXPECT(STATUS_SUCCESS == ctx.status[index]);
+            TEST_EXPECT(index + 1 == ctx.identifiers[index]);
+        }
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that a file failure is reported for that file only.
+ */
+TEST(missing_file)
+{
+    parse_pool* pool;
+    temp_files files(2);
+    const char* paths[] = {
+        files.c_paths[0], "/this/file/does/not/exist.c", files.c_paths[1] };
+    pool_context ctx(3);
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 2));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == parse_pool_run(
+                    pool, paths, 3, CPARSE_PARSE_POOL_ORDER_INPUT,
+                    &setup_callback, &result_callback, &ctx));
+
+    TEST_ASSERT(3 == ctx.delivered.size());
+    TEST_EXPECT(STATUS_SUCCESS == ctx.status[0]);
+    TEST_EXPECT(ERROR_LIBCPARSE_FILE_OPEN_ERROR == ctx.status[1]);
+    TEST_EXPECT(STATUS_SUCCESS == ctx.status[2]);
+    TEST_EXPECT(2 == ctx.identifiers[2]);
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
+
+/**
+ * Test that a result callback failure stops the run.
+ */
+TEST(result_failure)
+{
+    parse_pool* pool;
+    const size_t COUNT = 20;
+    temp_files files(COUNT);
+    pool_context ctx(COUNT);
+
+    ctx.fail_after = 5;
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_create(&pool, 4));
+
+    TEST_EXPECT(
+        RESULT_CALLBACK_ERROR
+            == parse_pool_run(
+                    pool, files.c_paths.data(), COUNT,
+                    CPARSE_PARSE_POOL_ORDER_INPUT, &setup_callback,
+                    &result_callback, &ctx));
+    TEST_EXPECT(5 == ctx.delivered.size());
+
+    TEST_ASSERT(STATUS_SUCCESS == parse_pool_release(pool));
+}
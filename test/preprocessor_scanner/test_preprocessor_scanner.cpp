@@ -7,6 +7,8 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/allocator.h>
+#include <libcparse/arena.h>
 #include <libcparse/event.h>
 #include <libcparse/event/identifier.h>
 #include <libcparse/event/raw_character_literal.h>
@@ -18,8 +20,11 @@
 #include <libcparse/preprocessor_scanner.h>
 #include <libcparse/status_codes.h>
 #include <list>
+#include <map>
 #include <minunit/minunit.h>
+#include <stdlib.h>
 #include <string>
+#include <vector>
 
 #include "test_preprocessor_scanner_helper.h"
 
@@ -27,6 +32,9 @@ using namespace std;
 using namespace test_preprocessor_scanner_helper;
 
 CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_arena;
+CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_identifier;
@@ -38,6 +46,172 @@ CPARSE_IMPORT_preprocessor_scanner;
 
 TEST_SUITE(preprocessor_scanner);
 
+namespace
+{
+    struct push_context
+    {
+        abstract_parser* ap;
+        vector<string> ids;
+        vector<unsigned int> lines;
+        vector<string> files;
+        int status;
+
+        push_context(abstract_parser* p)
+            : ap(p), status(STATUS_SUCCESS)
+        {
+        }
+    };
+
+    /* tracks every live block, so that the bytes in use are known exactly. */
+    struct counting_context
+    {
+        map<void*, size_t> live;
+        size_t allocations;
+        size_t bytes;
+
+        counting_context()
+            : allocations(0), bytes(0)
+        {
+        }
+    };
+
+    /* record identifiers, and act on the "push" and "override" keywords. */
+    int push_callback(void* context, const event* ev)
+    {
+        auto ctx = (push_context*)context;
+        const cursor* pos = event_get_cursor(ev);
+        event_identifier* iev;
+        input_stream* stream;
+
+        if (
+            STATUS_SUCCESS
+                != event_downcast_to_event_identifier(&iev, (event*)ev))
+        {
+            return STATUS_SUCCESS;
+        }
+
+        string id = event_identifier_get(iev);
+        ctx->ids.push_back(id);
+        ctx->lines.push_back(pos->begin_line);
+        ctx->files.push_back((nullptr != pos->file) ? pos->file : "");
+
+        if ("push" == id)
+        {
+            ctx->status = input_stream_create_from_string(&stream, "pushed\n");
+            if (STATUS_SUCCESS == ctx->status)
+            {
+                ctx->status =
+                    abstract_parser_push_input_stream(
+                        ctx->ap, "pushed.h", stream);
+            }
+        }
+        else if ("override" == id)
+        {
+            ctx->status =
+                abstract_parser_file_line_override(ctx->ap, 100, "other.c");
+        }
+
+        return ctx->status;
+    }
+
+    /* feed each block of input to a scanner with the push callback. */
+    int push_scan(push_context** ctx, const vector<string>& blocks)
+    {
+        preprocessor_scanner* scanner;
+        event_handler eh;
+        int retval, release_retval;
+
+        retval = preprocessor_scanner_create(&scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        auto ap = preprocessor_scanner_upcast(scanner);
+        *ctx = new push_context(ap);
+
+        if (
+            STATUS_SUCCESS
+                != (retval = event_handler_init(&eh, &push_callback, *ctx))
+         || STATUS_SUCCESS
+                != (retval =
+                        abstract_parser_preprocessor_scanner_subscribe(
+                            ap, &eh))
+         || STATUS_SUCCESS != (retval = event_handler_dispose(&eh)))
+        {
+            goto cleanup_scanner;
+        }
+
+        for (const auto& block : blocks)
+        {
+            retval = abstract_parser_feed(ap, block.data(), block.size());
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_scanner;
+            }
+        }
+
+        retval = abstract_parser_finish(ap);
+
+    cleanup_scanner:
+        release_retval = preprocessor_scanner_release(scanner);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = release_retval;
+        }
+
+        return retval;
+    }
+
+    void* counting_allocate(void* context, size_t size)
+    {
+        auto ctx = (counting_context*)context;
+        void* block = malloc(size);
+
+        if (nullptr != block)
+        {
+            ctx->live[block] = size;
+            ++ctx->allocations;
+            ctx->bytes += size;
+        }
+
+        return block;
+    }
+
+    void* counting_reallocate(void* context, void* block, size_t size)
+    {
+        auto ctx = (counting_context*)context;
+        void* resized = realloc(block, size);
+
+        if (nullptr != resized)
+        {
+            if (nullptr != block)
+            {
+                ctx->bytes -= ctx->live[block];
+                ctx->live.erase(block);
+            }
+            else
+            {
+                ++ctx->allocations;
+            }
+
+            ctx->live[resized] = size;
+            ctx->bytes += size;
+        }
+
+        return resized;
+    }
+
+    void counting_free(void* context, void* block)
+    {
+        auto ctx = (counting_context*)context;
+
+        ctx->bytes -= ctx->live[block];
+        ctx->live.erase(block);
+        free(block);
+    }
+}
+
 /**
  * Test that we can create and release a preprocessor scanner.
  */
@@ -54,6 +228,268 @@ TEST(create_release)
         STATUS_SUCCESS == preprocessor_scanner_release(scanner));
 }
 
+/**
+ * Test that every allocation made by a scanner stack created with an allocator
+ * goes through that allocator, and is returned to it on release.
+ */
+TEST(custom_allocator)
+{
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    ::allocator alloc;
+    counting_context ctx;
+    test_context t1;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == allocator_init(
+                    &alloc, &counting_allocate, &counting_reallocate,
+                    &counting_free, &ctx));
+
+    /* create the scanner with this allocator. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_create_with_allocator(&scanner, &alloc));
+
+    /* the scanner and every stage under it were allocated. */
+    TEST_EXPECT(ctx.allocations > 0);
+    TEST_EXPECT(ctx.bytes > 0);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &dummy_callback, &t1));
+
+    auto ap = preprocessor_scanner_upcast(scanner);
+
+    /* the parser uses this allocator. */
+    TEST_EXPECT(
+        &counting_allocate == abstract_parser_allocator_get(ap)->allocate);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_preprocessor_scanner_subscribe(ap, &eh));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(
+                    &stream, "int x = 17; /* comment */\n\"abc\" foo\n"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+    TEST_EXPECT(t1.eof);
+    TEST_EXPECT(!t1.vals.empty());
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+
+    /* every block was returned to the allocator. */
+    TEST_EXPECT(ctx.live.empty());
+    TEST_EXPECT(0 == ctx.bytes);
+
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+}
+
+/**
+ * Test that a pipelined scanner allocates its event ring's slots through its
+ * allocator, and returns them on release.
+ */
+TEST(custom_allocator_pipelined)
+{
+    preprocessor_scanner* scanner;
+    ::allocator alloc;
+    counting_context ctx;
+    const size_t capacity = 64;
+    bool found_slots = false;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == allocator_init(
+                    &alloc, &counting_allocate, &counting_reallocate,
+                    &counting_free, &ctx));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_create_pipelined_with_allocator(
+                    &scanner, capacity, &alloc));
+
+    /* the ring's slots came from this allocator. */
+    for (const auto& block : ctx.live)
+    {
+        if (capacity * sizeof(void*) == block.second)
+        {
+            found_slots = true;
+        }
+    }
+
+    TEST_EXPECT(found_slots);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+
+    /* every block was returned to the allocator. */
+    TEST_EXPECT(ctx.live.empty());
+    TEST_EXPECT(0 == ctx.bytes);
+
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+}
+
+/**
+ * Test that a scanner stack built in an arena scans the same tokens as one
+ * built on the heap.
+ */
+TEST(arena)
+{
+    const char* input = "int x = 17; /* comment */\n\"abc\" foo(1.5e3)\n";
+    test_context heap_ctx;
+    test_context arena_ctx;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        preprocessor_scanner* scanner;
+        input_stream* stream;
+        event_handler eh;
+        test_context* ctx = (0 == i) ? &heap_ctx : &arena_ctx;
+
+        /* create the scanner on the heap, then in an arena. */
+        if (0 == i)
+        {
+            TEST_ASSERT(
+                STATUS_SUCCESS == preprocessor_scanner_create(&scanner));
+        }
+        else
+        {
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == preprocessor_scanner_create_with_arena(&scanner, 512));
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == event_handler_init(&eh, &dummy_callback, ctx));
+
+        auto ap = preprocessor_scanner_upcast(scanner);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_preprocessor_scanner_subscribe(ap, &eh));
+        TEST_ASSERT(
+            STATUS_SUCCESS == input_stream_create_from_string(&stream, input));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_push_input_stream(ap, "stdin", stream));
+        TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+        /* releasing the scanner releases its arena. */
+        TEST_ASSERT(
+            STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+        TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+    }
+
+    /* both scanners saw the same tokens. */
+    TEST_EXPECT(heap_ctx.eof);
+    TEST_EXPECT(arena_ctx.eof);
+    TEST_EXPECT(!heap_ctx.vals.empty());
+    TEST_EXPECT(heap_ctx.vals == arena_ctx.vals);
+}
+
+/**
+ * Test that releasing a scanner in an arena releases input streams that were
+ * never read.
+ */
+TEST(arena_release_unread_input)
+{
+    preprocessor_scanner* scanner;
+    input_stream* stream1;
+    input_stream* stream2;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_create_with_arena(&scanner, 512));
+
+    auto ap = preprocessor_scanner_upcast(scanner);
+
+    /* push two input streams, but never run the scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == input_stream_create_from_string(&stream1, "int x;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "first", stream1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == input_stream_create_from_string(&stream2, "int y;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "second", stream2));
+
+    /* both streams are released with the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+}
+
+/**
+ * Test that a caller's arena can be reset and reused for each parse.
+ */
+TEST(arena_reuse)
+{
+    const char* input = "int x = 17; /* comment */\n\"abc\" foo(1.5e3)\n";
+    test_context first_ctx;
+    arena* a;
+    size_t used = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_create(&a, 512, false));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        preprocessor_scanner* scanner;
+        input_stream* stream;
+        event_handler eh;
+        test_context ctx;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == preprocessor_scanner_create_in_arena(&scanner, a));
+        TEST_ASSERT(
+            STATUS_SUCCESS == event_handler_init(&eh, &dummy_callback, &ctx));
+
+        auto ap = preprocessor_scanner_upcast(scanner);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_preprocessor_scanner_subscribe(ap, &eh));
+        TEST_ASSERT(
+            STATUS_SUCCESS == input_stream_create_from_string(&stream, input));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_push_input_stream(ap, "stdin", stream));
+        TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+        /* every parse allocates the same amount from the arena. */
+        if (0 == i)
+        {
+            used = arena_used_get(a);
+            first_ctx.vals = ctx.vals;
+        }
+        else
+        {
+            TEST_EXPECT(used == arena_used_get(a));
+        }
+
+        /* every parse sees the same tokens. */
+        TEST_EXPECT(ctx.eof);
+        TEST_EXPECT(!ctx.vals.empty());
+        TEST_EXPECT(first_ctx.vals == ctx.vals);
+
+        /* release the scanner, then reset the arena for the next parse. */
+        TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+        TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+        arena_reset(a);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == arena_release(a));
+}
+
 /**
  * Test that we can subscribe to a preprocessor scanner.
  */
@@ -93,3 +529,49 @@ TEST(subscribe)
         STATUS_SUCCESS == preprocessor_scanner_release(scanner));
     TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
 }
+
+/**
+ * Test that, when scanning spans, an input stream pushed by a subscriber takes
+ * effect after the rest of the current block of input.
+ */
+TEST(span_push_input_stream_after_block)
+{
+    push_context* ctx;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == push_scan(&ctx, { "push a\nb\n", "c\n" }));
+    TEST_ASSERT(STATUS_SUCCESS == ctx->status);
+
+    /* the pushed stream is scanned after the rest of this block. */
+    vector<string> ids = { "push", "a", "b", "pushed", "c" };
+    TEST_EXPECT(ids == ctx->ids);
+
+    delete ctx;
+}
+
+/**
+ * Test that, when scanning spans, a file / line override by a subscriber takes
+ * effect after the rest of the current block of input.
+ */
+TEST(span_file_line_override_after_block)
+{
+    push_context* ctx;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == push_scan(&ctx, { "override a\nb\n", "c\n" }));
+    TEST_ASSERT(STATUS_SUCCESS == ctx->status);
+
+    vector<string> ids = { "override", "a", "b", "c" };
+    TEST_ASSERT(ids == ctx->ids);
+
+    /* the rest of this block keeps its position. */
+    TEST_EXPECT(1U == ctx->lines[1]);
+    TEST_EXPECT(2U == ctx->lines[2]);
+    TEST_EXPECT("other.c" != ctx->files[2]);
+
+    /* the override takes effect at the next block. */
+    TEST_EXPECT(100U == ctx->lines[3]);
+    TEST_EXPECT("other.c" == ctx->files[3]);
+
+    delete ctx;
+}
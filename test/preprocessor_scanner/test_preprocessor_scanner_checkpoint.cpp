@@ -0,0 +1,373 @@
+/**
+ * \file test/preprocessor_scanner/test_preprocessor_scanner_checkpoint.cpp
+ *
+ * \brief Tests for saving and restoring \ref preprocessor_scanner checkpoints.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/checkpoint.h>
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+#include "test_preprocessor_scanner_helper.h"
+
+using namespace std;
+using namespace test_preprocessor_scanner_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_checkpoint;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+
+TEST_SUITE(preprocessor_scanner_checkpoint);
+
+static const char* INPUT_STRING =
+    "#include <stdio.h>\n"
+    "/* comment */ int main(int argc, char* argv[])\n"
+    "{\n"
+    "    printf(\"%d\\n\", 0x1fu + 'a' + 1.5e3); // done\n"
+    "    return \\\n"
+    "        argc >= 2 ? 0 : -1;\n"
+    "}\n";
+
+namespace
+{
+    struct checkpoint_context
+    {
+        test_context tokens;
+        vector<pair<int, int>> positions;
+        vector<size_t> offsets;
+        vector<string> files;
+    };
+}
+
+/**
+ * \brief Record the tokens, starting positions, offsets, and files of events.
+ */
+static int checkpoint_callback(void* context, const event* ev)
+{
+    auto ctx = (checkpoint_context*)context;
+    const cursor* pos = event_get_cursor(ev);
+
+    ctx->positions.push_back(make_pair(pos->begin_line, pos->begin_col));
+    ctx->offsets.push_back(pos->begin_offset);
+    ctx->files.push_back(nullptr != pos->file ? pos->file : "");
+
+    return dummy_callback(&ctx->tokens, ev);
+}
+
+namespace
+{
+    /**
+     * \brief A preprocessor scanner subscribed to a checkpoint context.
+     */
+    struct checkpoint_scanner
+    {
+        preprocessor_scanner* scanner;
+        event_handler eh;
+
+        checkpoint_scanner(checkpoint_context* ctx)
+            : scanner(nullptr)
+        {
+            int release_retval;
+
+            if (STATUS_SUCCESS != preprocessor_scanner_create(&scanner))
+            {
+                scanner = nullptr;
+                return;
+            }
+
+            if (
+                STATUS_SUCCESS
+                    != event_handler_init(&eh, &checkpoint_callback, ctx))
+            {
+                release_retval = preprocessor_scanner_release(scanner);
+                (void)release_retval;
+                scanner = nullptr;
+                return;
+            }
+
+            if (
+                STATUS_SUCCESS
+                    != abstract_parser_preprocessor_scanner_subscribe(
+                            ap(), &eh))
+            {
+                release_retval = event_handler_dispose(&eh);
+                (void)release_retval;
+                release_retval = preprocessor_scanner_release(scanner);
+                (void)release_retval;
+                scanner = nullptr;
+            }
+        }
+
+        ~checkpoint_scanner()
+        {
+            int release_retval;
+
+            if (nullptr != scanner)
+            {
+                release_retval = event_handler_dispose(&eh);
+                (void)release_retval;
+                release_retval = preprocessor_scanner_release(scanner);
+                (void)release_retval;
+            }
+        }
+
+        abstract_parser* ap()
+        {
+            return preprocessor_scanner_upcast(scanner);
+        }
+
+        /**
+         * \brief Push the given input and run the scanner over it, optionally
+         * restoring a checkpoint first.
+         */
+        int run(const string& input, const abstract_parser_checkpoint* ckpt)
+        {
+            int retval, release_retval;
+            input_stream* stream;
+
+            retval = input_stream_create_from_string(&stream, input.c_str());
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval = abstract_parser_push_input_stream(ap(), "resume", stream);
+            if (STATUS_SUCCESS != retval)
+            {
+                release_retval = input_stream_release(stream);
+                (void)release_retval;
+                return retval;
+            }
+
+            if (nullptr != ckpt)
+            {
+                retval = abstract_parser_checkpoint_restore(ap(), ckpt);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+
+            return abstract_parser_run(ap());
+        }
+    };
+}
+
+/**
+ * Test that a checkpoint saved after any prefix of the input resumes scanning
+ * in a second parser, producing the same tokens at the same positions and
+ * offsets as scanning the whole input, even when the checkpoint falls within a
+ * token, comment, or line wrap.
+ */
+TEST(resume_at_every_offset)
+{
+    const string input(INPUT_STRING);
+    checkpoint_context expected;
+
+    /* feed the whole input, so that cursors have the feed name. */
+    {
+        checkpoint_scanner s(&expected);
+        TEST_ASSERT(nullptr != s.scanner);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_feed(s.ap(), input.data(), input.size()));
+        TEST_ASSERT(STATUS_SUCCESS == abstract_parser_finish(s.ap()));
+    }
+
+    TEST_ASSERT(expected.tokens.eof);
+    TEST_ASSERT(!expected.tokens.vals.empty());
+
+    for (size_t split = 1; split < input.size(); ++split)
+    {
+        checkpoint_context ctx;
+        abstract_parser_checkpoint ckpt;
+        checkpoint_scanner saved(&ctx);
+        checkpoint_scanner resumed(&ctx);
+
+        TEST_ASSERT(nullptr != saved.scanner);
+        TEST_ASSERT(nullptr != resumed.scanner);
+
+        /* feed a prefix of the input, and save a checkpoint. */
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_feed(saved.ap(), input.data(), split));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_checkpoint_save(&ckpt, saved.ap()));
+        TEST_ASSERT(split == ckpt.offset);
+
+        /* resume the rest of the input in a new parser. */
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resumed.run(input.substr(ckpt.offset), &ckpt));
+
+        TEST_EXPECT(ctx.tokens.eof);
+        TEST_EXPECT(expected.tokens.vals == ctx.tokens.vals);
+        TEST_EXPECT(expected.positions == ctx.positions);
+        TEST_EXPECT(expected.offsets == ctx.offsets);
+        TEST_EXPECT(expected.files == ctx.files);
+    }
+}
+
+/**
+ * Test that a checkpoint can be restored after the parser that saved it has
+ * been released, keeping the file name of its positions.
+ */
+TEST(restore_after_saver_released)
+{
+    const string input(INPUT_STRING);
+    const string name(CPARSE_CHECKPOINT_FILE_NAME_SIZE - 1, 'f');
+    const size_t split = input.find("main");
+    checkpoint_context expected, ctx;
+    abstract_parser_checkpoint ckpt;
+
+    /* feed the whole input under an overridden file name. */
+    {
+        checkpoint_scanner s(&expected);
+        TEST_ASSERT(nullptr != s.scanner);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_file_line_override(
+                        s.ap(), 1, name.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_feed(s.ap(), input.data(), input.size()));
+        TEST_ASSERT(STATUS_SUCCESS == abstract_parser_finish(s.ap()));
+    }
+
+    /* save a checkpoint, and release the parser that saved it. */
+    {
+        checkpoint_scanner saved(&ctx);
+        TEST_ASSERT(nullptr != saved.scanner);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_file_line_override(
+                        saved.ap(), 1, name.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_feed(saved.ap(), input.data(), split));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_checkpoint_save(&ckpt, saved.ap()));
+    }
+
+    /* the checkpoint holds the name, rather than a pointer to it. */
+    TEST_EXPECT(nullptr == ckpt.raw_file_line_override_filter.pos.pos.file);
+    TEST_EXPECT(name == ckpt.raw_file_line_override_filter.pos.file);
+
+    /* resume the rest of the input in a new parser. */
+    checkpoint_scanner resumed(&ctx);
+    TEST_ASSERT(nullptr != resumed.scanner);
+    TEST_ASSERT(
+        STATUS_SUCCESS == resumed.run(input.substr(ckpt.offset), &ckpt));
+
+    TEST_EXPECT(ctx.tokens.eof);
+    TEST_EXPECT(expected.tokens.vals == ctx.tokens.vals);
+    TEST_EXPECT(expected.positions == ctx.positions);
+    TEST_EXPECT(expected.files == ctx.files);
+}
+
+/**
+ * Test that restoring a checkpoint requires an input stream.
+ */
+TEST(restore_without_input)
+{
+    checkpoint_context ctx;
+    abstract_parser_checkpoint ckpt;
+    checkpoint_scanner s(&ctx);
+
+    TEST_ASSERT(nullptr != s.scanner);
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_feed(s.ap(), "int x", 5));
+    TEST_ASSERT(
+        STATUS_SUCCESS == abstract_parser_checkpoint_save(&ckpt, s.ap()));
+
+    checkpoint_context ctx2;
+    checkpoint_scanner s2(&ctx2);
+
+    TEST_ASSERT(nullptr != s2.scanner);
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_CHECKPOINT_INVALID
+            == abstract_parser_checkpoint_restore(s2.ap(), &ckpt));
+}
+
+/**
+ * Test that a checkpoint with an out of range state is rejected.
+ */
+TEST(restore_invalid_state)
+{
+    checkpoint_context ctx;
+    abstract_parser_checkpoint ckpt;
+    checkpoint_scanner s(&ctx);
+
+    TEST_ASSERT(nullptr != s.scanner);
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_feed(s.ap(), "int x", 5));
+    TEST_ASSERT(
+        STATUS_SUCCESS == abstract_parser_checkpoint_save(&ckpt, s.ap()));
+
+    ckpt.comment_scanner.state = -1;
+
+    checkpoint_context ctx2;
+    checkpoint_scanner s2(&ctx2);
+
+    TEST_ASSERT(nullptr != s2.scanner);
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_CHECKPOINT_INVALID == s2.run("", &ckpt));
+}
+
+/**
+ * Test that a partial token that does not fit in a checkpoint can't be saved.
+ */
+TEST(save_token_too_long)
+{
+    checkpoint_context ctx;
+    abstract_parser_checkpoint ckpt;
+    checkpoint_scanner s(&ctx);
+    const string ident(CPARSE_PREPROCESSOR_SCANNER_CHECKPOINT_TOKEN_SIZE, 'x');
+
+    TEST_ASSERT(nullptr != s.scanner);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_feed(s.ap(), ident.data(), ident.size()));
+    TEST_EXPECT(
+        STATUS_SUCCESS == abstract_parser_checkpoint_save(&ckpt, s.ap()));
+
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_feed(s.ap(), "x", 1));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_CHECKPOINT_TOKEN_TOO_LONG
+            == abstract_parser_checkpoint_save(&ckpt, s.ap()));
+}
+
+/**
+ * Test that a file name that does not fit in a checkpoint can't be saved.
+ */
+TEST(save_file_name_too_long)
+{
+    checkpoint_context ctx;
+    abstract_parser_checkpoint ckpt;
+    checkpoint_scanner s(&ctx);
+    const string name(CPARSE_CHECKPOINT_FILE_NAME_SIZE, 'f');
+
+    TEST_ASSERT(nullptr != s.scanner);
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_feed(s.ap(), "int x", 5));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_line_override(s.ap(), 1, name.c_str()));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_CHECKPOINT_FILE_NAME_TOO_LONG
+            == abstract_parser_checkpoint_save(&ckpt, s.ap()));
+}
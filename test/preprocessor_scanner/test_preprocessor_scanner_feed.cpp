@@ -0,0 +1,245 @@
+/**
+ * \file test/preprocessor_scanner/test_preprocessor_scanner_feed.cpp
+ *
+ * \brief Tests for feeding input to the \ref preprocessor_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+#include "test_preprocessor_scanner_helper.h"
+
+using namespace std;
+using namespace test_preprocessor_scanner_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+
+TEST_SUITE(preprocessor_scanner_feed);
+
+static const char* INPUT_STRING =
+    "#include <stdio.h>\n"
+    "/* comment */ int main(int argc, char* argv[])\n"
+    "{\n"
+    "    printf(\"%d\\n\", 0x1fu + 'a' + 1.5e3); // done\n"
+    "    return \\\n"
+    "        argc >= 2 ? 0 : -1;\n"
+    "}\n";
+
+namespace
+{
+    struct feed_context
+    {
+        test_context tokens;
+        vector<pair<int, int>> positions;
+    };
+}
+
+/**
+ * \brief Record the tokens and starting positions of events.
+ */
+static int feed_callback(void* context, const event* ev)
+{
+    auto ctx = (feed_context*)context;
+    const cursor* pos = event_get_cursor(ev);
+
+    ctx->positions.push_back(make_pair(pos->begin_line, pos->begin_col));
+
+    return dummy_callback(&ctx->tokens, ev);
+}
+
+/**
+ * \brief Scan the given input, either by running the scanner when \p chunk is
+ * zero, or by feeding the input \p chunk bytes at a time.
+ */
+static int scan(feed_context* ctx, const string& input, size_t chunk)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+
+    retval = preprocessor_scanner_create(&scanner);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = event_handler_init(&eh, &feed_callback, ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    retval =
+        abstract_parser_preprocessor_scanner_subscribe(
+            preprocessor_scanner_upcast(scanner), &eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* run the scanner over the whole input. */
+    if (0 == chunk)
+    {
+        retval = input_stream_create_from_string(&stream, input.c_str());
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+
+        retval =
+            abstract_parser_push_input_stream(
+                preprocessor_scanner_upcast(scanner), "stdin", stream);
+        if (STATUS_SUCCESS != retval)
+        {
+            release_retval = input_stream_release(stream);
+            (void)release_retval;
+            goto cleanup_eh;
+        }
+
+        retval = abstract_parser_run(preprocessor_scanner_upcast(scanner));
+        goto cleanup_eh;
+    }
+
+    /* feed the input a chunk at a time. */
+    for (size_t i = 0; i < input.size(); i += chunk)
+    {
+        retval =
+            abstract_parser_feed(
+                preprocessor_scanner_upcast(scanner), input.data() + i,
+                min(chunk, input.size() - i));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+    }
+
+    retval = abstract_parser_finish(preprocessor_scanner_upcast(scanner));
+
+cleanup_eh:
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_scanner:
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Test that finishing without feeding any input only produces EOF.
+ */
+TEST(finish_only)
+{
+    feed_context ctx;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&ctx, "", 1));
+    TEST_EXPECT(ctx.tokens.eof);
+    TEST_EXPECT(ctx.tokens.vals.empty());
+}
+
+/**
+ * Test that feeding the input in chunks of any size produces the same tokens at
+ * the same positions as running the scanner, even when tokens straddle chunks.
+ */
+TEST(matches_run)
+{
+    const size_t chunks[] = { 1, 2, 3, 5, 7, 64, 4096 };
+    feed_context expected;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&expected, INPUT_STRING, 0));
+    TEST_ASSERT(expected.tokens.eof);
+    TEST_ASSERT(!expected.tokens.vals.empty());
+
+    for (size_t chunk : chunks)
+    {
+        feed_context fed;
+
+        TEST_ASSERT(STATUS_SUCCESS == scan(&fed, INPUT_STRING, chunk));
+        TEST_EXPECT(fed.tokens.eof);
+        TEST_EXPECT(expected.tokens.vals == fed.tokens.vals);
+        TEST_EXPECT(expected.positions == fed.positions);
+    }
+}
+
+/**
+ * Test that tokens are delivered as soon as their input is fed, and that EOF is
+ * only delivered on finish.
+ */
+TEST(incremental)
+{
+    preprocessor_scanner* scanner;
+    event_handler eh;
+    feed_context ctx;
+
+    TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_create(&scanner));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &feed_callback, &ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_preprocessor_scanner_subscribe(
+                    preprocessor_scanner_upcast(scanner), &eh));
+
+    /* the identifier may continue, so nothing is delivered yet. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_feed(
+                    preprocessor_scanner_upcast(scanner), "ret", 3));
+    TEST_EXPECT(ctx.tokens.vals.empty());
+
+    /* the whitespace completes the keyword. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_feed(
+                    preprocessor_scanner_upcast(scanner), "urn x", 5));
+    TEST_EXPECT(1U == ctx.tokens.vals.size());
+    TEST_EXPECT(!ctx.tokens.eof);
+
+    /* finishing completes the identifier and delivers EOF. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_finish(preprocessor_scanner_upcast(scanner)));
+    TEST_EXPECT(2U == ctx.tokens.vals.size());
+    TEST_EXPECT(ctx.tokens.eof);
+
+    /* a later feed starts a new parse at the first line. */
+    ctx.tokens.vals.clear();
+    ctx.tokens.eof = false;
+    ctx.positions.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_feed(
+                    preprocessor_scanner_upcast(scanner), "y;", 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_finish(preprocessor_scanner_upcast(scanner)));
+    TEST_EXPECT(2U == ctx.tokens.vals.size());
+    TEST_EXPECT(ctx.tokens.eof);
+    TEST_ASSERT(!ctx.positions.empty());
+    TEST_EXPECT(make_pair(1, 1) == ctx.positions.front());
+
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+    TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+}
@@ -8,11 +8,15 @@
  */
 
 #include <libcparse/abstract_parser.h>
+#include <libcparse/event/identifier.h>
 #include <libcparse/event_handler.h>
 #include <libcparse/input_stream.h>
+#include <libcparse/intern_table.h>
 #include <libcparse/preprocessor_scanner.h>
 #include <libcparse/status_codes.h>
 #include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
 
 #include "test_preprocessor_scanner_helper.h"
 
@@ -20,12 +24,46 @@ using namespace std;
 using namespace test_preprocessor_scanner_helper;
 
 CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_identifier;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_intern_table;
 CPARSE_IMPORT_preprocessor_scanner;
 
 TEST_SUITE(preprocessor_scanner_identifier);
 
+namespace
+{
+    struct symbol_context
+    {
+        std::vector<const char*> ids;
+        std::vector<uint32_t> symbols;
+    };
+}
+
+/**
+ * \brief Record the interned string and symbol of each identifier.
+ */
+static int symbol_callback(void* context, const event* ev)
+{
+    auto ctx = (symbol_context*)context;
+    event_identifier* iev;
+
+    if (CPARSE_EVENT_TYPE_TOKEN_IDENTIFIER == event_get_type(ev))
+    {
+        if (
+            STATUS_SUCCESS
+                == event_downcast_to_event_identifier(&iev, (event*)ev))
+        {
+            ctx->ids.push_back(event_identifier_get(iev));
+            ctx->symbols.push_back(event_identifier_symbol_get(iev));
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * Test that we can scan an identifier.
  */
@@ -259,3 +297,70 @@ TEST(identifier3)
         STATUS_SUCCESS == preprocessor_scanner_release(scanner));
     TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
 }
+
+/**
+ * Test that identifiers are interned, so that repeated identifiers share a
+ * string and a symbol ID, and that a shared table can be used.
+ */
+TEST(identifier_symbols)
+{
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    symbol_context ctx;
+    intern_table* shared;
+    const char* str;
+    uint32_t sym;
+    const char* INPUT_STRING = "foo bar foo";
+
+    /* create a shared table which already holds an identifier. */
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&shared, false));
+    TEST_ASSERT(
+        STATUS_SUCCESS == intern_table_intern(&str, &sym, shared, "bar", 3));
+
+    /* Create the scanner instance. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_create(&scanner));
+    TEST_ASSERT(
+        nullptr != preprocessor_scanner_intern_table_get(scanner));
+
+    /* use the shared table. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_intern_table_set(scanner, shared));
+    TEST_EXPECT(shared == preprocessor_scanner_intern_table_get(scanner));
+
+    /* subscribe to the scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &symbol_callback, &ctx));
+    auto ap = preprocessor_scanner_upcast(scanner);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_preprocessor_scanner_subscribe(ap, &eh));
+
+    /* scan the input. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, INPUT_STRING));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* the repeated identifier has the same string and symbol. */
+    TEST_ASSERT(3 == ctx.symbols.size());
+    TEST_EXPECT(1U == ctx.symbols[0]);
+    TEST_EXPECT(sym == ctx.symbols[1]);
+    TEST_EXPECT(str == ctx.ids[1]);
+    TEST_EXPECT(ctx.symbols[0] == ctx.symbols[2]);
+    TEST_EXPECT(ctx.ids[0] == ctx.ids[2]);
+    TEST_EXPECT(2U == intern_table_count(shared));
+
+    /* clean up; the shared table outlives the scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_lookup(&str, shared, 0));
+    TEST_EXPECT(!strcmp("bar", str));
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(shared));
+}
@@ -0,0 +1,222 @@
+/**
+ * \file test/preprocessor_scanner/test_preprocessor_scanner_keyword_lookup.cpp
+ *
+ * \brief Tests for the generated \ref preprocessor_scanner keyword table.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event_type.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+#include "../../src/preprocessor_scanner/preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+TEST_SUITE(preprocessor_scanner_keyword_lookup);
+
+namespace
+{
+    struct keyword_type
+    {
+        const char* word;
+        int type;
+    };
+}
+
+/**
+ * \brief Return the event type produced by a keyword constructor, or -1 on
+ * failure.
+ */
+static int ctor_type(preprocessor_scanner_keyword_ctor ctor)
+{
+    event ev;
+    cursor c;
+    int type;
+
+    memset(&c, 0, sizeof(c));
+    if (STATUS_SUCCESS != ctor(&ev, &c))
+    {
+        return -1;
+    }
+
+    type = event_get_type(&ev);
+    if (STATUS_SUCCESS != event_dispose(&ev))
+    {
+        return -1;
+    }
+
+    return type;
+}
+
+/**
+ * \brief Look up a NUL-terminated word.
+ */
+static const preprocessor_scanner_keyword* lookup(const char* word)
+{
+    return preprocessor_scanner_keyword_lookup(word, strlen(word));
+}
+
+/**
+ * Test that every C11 keyword is found, and constructs the right event.
+ */
+TEST(c11_keywords)
+{
+    const keyword_type keywords[] = {
+        { "_Alignas", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__ALIGNAS },
+        { "_Alignof", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__ALIGNOF },
+        { "_Atomic", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__ATOMIC },
+        { "_Bool", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__BOOL },
+        { "_Complex", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__COMPLEX },
+        { "_Generic", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__GENERIC },
+        { "_Imaginary", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__IMAGINARY },
+        { "_Noreturn", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__NORETURN },
+        { "_Static_assert", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__STATIC_ASSERT },
+        { "_Thread_local", CPARSE_EVENT_TYPE_TOKEN_KEYWORD__THREAD_LOCAL },
+        { "auto", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_AUTO },
+        { "break", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_BREAK },
+        { "case", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_CASE },
+        { "char", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_CHAR },
+        { "const", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_CONST },
+        { "continue", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_CONTINUE },
+        { "default", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_DEFAULT },
+        { "do", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_DO },
+        { "double", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_DOUBLE },
+        { "else", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_ELSE },
+        { "enum", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_ENUM },
+        { "extern", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_EXTERN },
+        { "float", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_FLOAT },
+        { "for", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_FOR },
+        { "goto", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_GOTO },
+        { "if", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_IF },
+        { "inline", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_INLINE },
+        { "int", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_INT },
+        { "long", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_LONG },
+        { "register", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_REGISTER },
+        { "restrict", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_RESTRICT },
+        { "return", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_RETURN },
+        { "short", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_SHORT },
+        { "signed", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_SIGNED },
+        { "sizeof", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_SIZEOF },
+        { "static", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_STATIC },
+        { "struct", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_STRUCT },
+        { "switch", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_SWITCH },
+        { "typedef", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_TYPEDEF },
+        { "union", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_UNION },
+        { "unsigned", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_UNSIGNED },
+        { "void", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_VOID },
+        { "volatile", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_VOLATILE },
+        { "while", CPARSE_EVENT_TYPE_TOKEN_KEYWORD_WHILE },
+    };
+
+    TEST_ASSERT(44U == sizeof(keywords) / sizeof(keywords[0]));
+
+    for (const auto& kw : keywords)
+    {
+        auto entry = lookup(kw.word);
+
+        TEST_ASSERT(nullptr != entry);
+        TEST_EXPECT(!strcmp(kw.word, entry->word));
+        TEST_EXPECT(strlen(kw.word) == entry->size);
+        TEST_ASSERT(nullptr != entry->keyword_ctor);
+        TEST_EXPECT(kw.type == ctor_type(entry->keyword_ctor));
+        TEST_EXPECT(0 == entry->flags);
+    }
+}
+
+/**
+ * Test that every preprocessor keyword is found, and constructs the right
+ * event.
+ */
+TEST(preprocessor_keywords)
+{
+    const keyword_type keywords[] = {
+        { "define", CPARSE_EVENT_TYPE_TOKEN_PP_ID_DEFINE },
+        { "elif", CPARSE_EVENT_TYPE_TOKEN_PP_ID_ELIF },
+        { "else", CPARSE_EVENT_TYPE_TOKEN_PP_ID_ELSE },
+        { "endif", CPARSE_EVENT_TYPE_TOKEN_PP_ID_ENDIF },
+        { "error", CPARSE_EVENT_TYPE_TOKEN_PP_ID_ERROR },
+        { "if", CPARSE_EVENT_TYPE_TOKEN_PP_ID_IF },
+        { "ifdef", CPARSE_EVENT_TYPE_TOKEN_PP_ID_IFDEF },
+        { "ifndef", CPARSE_EVENT_TYPE_TOKEN_PP_ID_IFNDEF },
+        { "include", CPARSE_EVENT_TYPE_TOKEN_PP_ID_INCLUDE },
+        { "line", CPARSE_EVENT_TYPE_TOKEN_PP_ID_LINE },
+        { "pragma", CPARSE_EVENT_TYPE_TOKEN_PP_ID_PRAGMA },
+        { "undef", CPARSE_EVENT_TYPE_TOKEN_PP_ID_UNDEF },
+    };
+
+    for (const auto& kw : keywords)
+    {
+        auto entry = lookup(kw.word);
+
+        TEST_ASSERT(nullptr != entry);
+        TEST_ASSERT(nullptr != entry->preprocessor_ctor);
+        TEST_EXPECT(kw.type == ctor_type(entry->preprocessor_ctor));
+    }
+
+    /* only include changes the scanner state. */
+    TEST_EXPECT(
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_INCLUDE
+            == lookup("include")->flags);
+    TEST_EXPECT(0 == lookup("define")->flags);
+
+    /* words that are only preprocessor keywords are not C keywords. */
+    TEST_EXPECT(nullptr == lookup("define")->keyword_ctor);
+    TEST_EXPECT(nullptr == lookup("endif")->keyword_ctor);
+}
+
+/**
+ * Test that string and char prefixes are classified.
+ */
+TEST(prefixes)
+{
+    const int both =
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX
+      | CPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX;
+
+    TEST_ASSERT(nullptr != lookup("L"));
+    TEST_EXPECT(both == lookup("L")->flags);
+    TEST_ASSERT(nullptr != lookup("U"));
+    TEST_EXPECT(both == lookup("U")->flags);
+    TEST_ASSERT(nullptr != lookup("u"));
+    TEST_EXPECT(both == lookup("u")->flags);
+    TEST_ASSERT(nullptr != lookup("u8"));
+    TEST_EXPECT(
+        CPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX
+            == lookup("u8")->flags);
+    TEST_EXPECT(nullptr == lookup("u8")->keyword_ctor);
+    TEST_EXPECT(nullptr == lookup("u8")->preprocessor_ctor);
+}
+
+/**
+ * Test that plain identifiers are not classified, including near misses.
+ */
+TEST(plain_identifiers)
+{
+    const char* plain[] = {
+        "x", "l", "u16", "U8", "If", "iff", "i", "whilex", "whil", "elsif",
+        "_Static_asserx", "_Thread_local_", "signet", "strict", "includes",
+        "main", "printf", "size_t", "int32_t", "_", "__func__",
+    };
+
+    for (auto word : plain)
+    {
+        TEST_EXPECT(nullptr == lookup(word));
+    }
+
+    /* spans need not be NUL-terminated. */
+    TEST_ASSERT(nullptr != preprocessor_scanner_keyword_lookup("intx", 3));
+    TEST_EXPECT(
+        CPARSE_EVENT_TYPE_TOKEN_KEYWORD_INT
+            == ctor_type(
+                    preprocessor_scanner_keyword_lookup("intx", 3)
+                        ->keyword_ctor));
+    TEST_EXPECT(nullptr == preprocessor_scanner_keyword_lookup("int", 0));
+}
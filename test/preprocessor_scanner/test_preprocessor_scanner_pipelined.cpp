@@ -0,0 +1,286 @@
+/**
+ * \file test/preprocessor_scanner/test_preprocessor_scanner_pipelined.cpp
+ *
+ * \brief Tests for the pipelined \ref preprocessor_scanner.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_preprocessor_scanner_helper.h"
+
+using namespace std;
+using namespace test_preprocessor_scanner_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+
+TEST_SUITE(preprocessor_scanner_pipelined);
+
+#define FAILING_CALLBACK_ERROR 0x7777
+
+namespace
+{
+    struct pipelined_context
+    {
+        test_context tokens;
+        vector<string> positions;
+    };
+
+    struct failing_context
+    {
+        size_t remaining;
+        thread::id caller;
+        bool same_thread;
+    };
+}
+
+/**
+ * \brief Fail after a given number of events, recording whether every event
+ * was delivered on the calling thread.
+ */
+static int failing_callback(void* context, const event*)
+{
+    auto ctx = (failing_context*)context;
+
+    if (this_thread::get_id() != ctx->caller)
+    {
+        ctx->same_thread = false;
+    }
+
+    if (0 == ctx->remaining)
+    {
+        return FAILING_CALLBACK_ERROR;
+    }
+
+    --ctx->remaining;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Record the file name and position of each event, along with its
+ * token.
+ */
+static int position_callback(void* context, const event* ev)
+{
+    auto ctx = (pipelined_context*)context;
+    const cursor* pos = event_get_cursor(ev);
+    string desc = (nullptr != pos->file) ? pos->file : "(null)";
+
+    desc += " " + to_string(pos->begin_line);
+    desc += ":" + to_string(pos->begin_col);
+    desc += "-" + to_string(pos->end_line);
+    desc += ":" + to_string(pos->end_col);
+    ctx->positions.push_back(desc);
+
+    return dummy_callback(&ctx->tokens, ev);
+}
+
+/**
+ * \brief Build a large source file exercising every stage of the parser stack.
+ */
+static string build_input(size_t lines)
+{
+    string input;
+
+    for (size_t i = 0; i < lines; ++i)
+    {
+        string n = to_string(i);
+
+        input += "#include <stdio.h>\n";
+        input += "int x" + n + " = 0x" + n + "u; /* block " + n + " */\n";
+        input += "float f" + n + " = " + n + ".5e-3f; // line comment\n";
+        input += "const char* s" + n + " = \"str\\\"" + n + "\";\n";
+        input += "char c" + n + " = '\\n'; x" + n + " += a->b[" + n
+               + "] <<= 2; \\\n    y" + n + "++;\n";
+    }
+
+    return input;
+}
+
+/**
+ * \brief Scan the given input, recording the events it produces.
+ */
+static int scan(
+    pipelined_context* ctx, const string& input, bool pipelined,
+    size_t capacity)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+
+    retval =
+        pipelined
+            ? preprocessor_scanner_create_pipelined(&scanner, capacity)
+            : preprocessor_scanner_create(&scanner);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = event_handler_init(&eh, &position_callback, ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    retval =
+        abstract_parser_preprocessor_scanner_subscribe(
+            preprocessor_scanner_upcast(scanner), &eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    retval = input_stream_create_from_string(&stream, input.c_str());
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    retval =
+        abstract_parser_push_input_stream(
+            preprocessor_scanner_upcast(scanner), "stdin", stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval = input_stream_release(stream);
+        (void)release_retval;
+        goto cleanup_eh;
+    }
+
+    retval = abstract_parser_run(preprocessor_scanner_upcast(scanner));
+
+cleanup_eh:
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_scanner:
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Test that we can create and release a pipelined preprocessor scanner.
+ */
+TEST(create_release)
+{
+    preprocessor_scanner* scanner;
+
+    /* we can create the scanner with the default capacity. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_create_pipelined(&scanner, 0));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+}
+
+/**
+ * Test that a pipelined run with no input produces an EOF event.
+ */
+TEST(empty_run)
+{
+    pipelined_context t1;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&t1, "", true, 0));
+
+    /* postcondition: eof is true. */
+    TEST_EXPECT(t1.tokens.eof);
+    TEST_EXPECT(t1.tokens.vals.empty());
+}
+
+/**
+ * Test that the pipelined scanner produces the same events, in the same order
+ * and with the same file names and positions, as the serial scanner, whether
+ * or not the ring fills up.
+ */
+TEST(matches_serial)
+{
+    const string input = build_input(500);
+    pipelined_context serial;
+    pipelined_context small;
+    pipelined_context large;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&serial, input, false, 0));
+    TEST_ASSERT(STATUS_SUCCESS == scan(&small, input, true, 2));
+    TEST_ASSERT(STATUS_SUCCESS == scan(&large, input, true, 0));
+
+    /* the serial scan saw a large number of tokens. */
+    TEST_ASSERT(serial.tokens.eof);
+    TEST_ASSERT(serial.tokens.vals.size() > 10000);
+
+    /* both pipelined scans match it exactly. */
+    TEST_EXPECT(small.tokens.eof);
+    TEST_EXPECT(serial.tokens.vals == small.tokens.vals);
+    TEST_EXPECT(serial.positions == small.positions);
+    TEST_EXPECT(large.tokens.eof);
+    TEST_EXPECT(serial.tokens.vals == large.tokens.vals);
+    TEST_EXPECT(serial.positions == large.positions);
+}
+
+/**
+ * Test that a subscriber error stops a pipelined run, is returned from the run,
+ * and that subscribers are called on the thread that ran the parser.
+ */
+TEST(subscriber_error)
+{
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    failing_context ctx = { 100, this_thread::get_id(), true };
+    const string input = build_input(500);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == preprocessor_scanner_create_pipelined(&scanner, 16));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &failing_callback, &ctx));
+
+    auto ap = preprocessor_scanner_upcast(scanner);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_preprocessor_scanner_subscribe(ap, &eh));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, input.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* the run fails with the subscriber's error. */
+    TEST_EXPECT(FAILING_CALLBACK_ERROR == abstract_parser_run(ap));
+
+    /* every event was delivered on this thread. */
+    TEST_EXPECT(ctx.same_thread);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
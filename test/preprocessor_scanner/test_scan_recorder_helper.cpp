@@ -0,0 +1,201 @@
+/**
+ * \file test/preprocessor_scanner/test_scan_recorder_helper.cpp
+ *
+ * \brief Helpers for recording and comparing the events of a scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/abstract_parser.h>
+#include <libcparse/event/identifier.h>
+#include <libcparse/event/include.h>
+#include <libcparse/event/integer.h>
+#include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_float.h>
+#include <libcparse/event/raw_integer.h>
+#include <libcparse/event/raw_string.h>
+#include <libcparse/event/string.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+
+#include "test_scan_recorder_helper.h"
+
+using namespace std;
+using namespace test_scan_recorder_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_identifier;
+CPARSE_IMPORT_event_include;
+CPARSE_IMPORT_event_integer;
+CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_float;
+CPARSE_IMPORT_event_raw_integer;
+CPARSE_IMPORT_event_raw_string;
+CPARSE_IMPORT_event_string;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+
+string test_scan_recorder_helper::describe(const CPARSE_SYM(event)* ev)
+{
+    const cursor* pos = event_get_cursor(ev);
+    string desc = to_string(event_get_type(ev));
+    event_identifier* iev;
+    event_include* inev;
+    event_integer_token* itev;
+    event_raw_character* cev;
+    event_raw_float_token* fev;
+    event_raw_integer_token* riev;
+    event_raw_string_token* sev;
+    event_string* stev;
+
+    desc += " ";
+    desc += (nullptr != pos->file) ? pos->file : "(null)";
+    desc += " " + to_string(pos->file_id);
+    desc += " " + to_string(pos->begin_line);
+    desc += ":" + to_string(pos->begin_col);
+    desc += "-" + to_string(pos->end_line);
+    desc += ":" + to_string(pos->end_col);
+    desc += " @" + to_string(pos->begin_offset);
+    desc += "-" + to_string(pos->end_offset);
+
+    if (STATUS_SUCCESS == event_downcast_to_event_identifier(&iev, (event*)ev))
+    {
+        desc += " id=";
+        desc += event_identifier_get(iev);
+    }
+    else if (
+        STATUS_SUCCESS == event_downcast_to_event_include(&inev, (event*)ev))
+    {
+        desc += " include=";
+        desc += event_include_file_get(inev);
+    }
+    else if (
+        STATUS_SUCCESS
+            == event_downcast_to_event_integer_token(&itev, (event*)ev))
+    {
+        desc += " int=" + to_string(event_integer_token_coerce_int64(itev));
+    }
+    else if (
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_character(&cev, (event*)ev))
+    {
+        desc += " ch=" + to_string(event_raw_character_get(cev));
+    }
+    else if (
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_float_token(&fev, (event*)ev))
+    {
+        desc += " float=";
+        desc +=
+            string(
+                event_raw_float_token_string_get(fev),
+                event_raw_float_token_size_get(fev));
+        desc += fev->has_sign ? " signed" : "";
+    }
+    else if (
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_integer_token(&riev, (event*)ev))
+    {
+        desc += " raw_int=";
+        desc +=
+            string(
+                event_raw_integer_token_string_get(riev),
+                event_raw_integer_token_size_get(riev));
+    }
+    else if (
+        STATUS_SUCCESS
+            == event_downcast_to_event_raw_string_token(&sev, (event*)ev))
+    {
+        desc += " raw_string=";
+        desc +=
+            string(
+                event_raw_string_token_get(sev),
+                event_raw_string_token_size_get(sev));
+    }
+    else if (
+        STATUS_SUCCESS == event_downcast_to_event_string(&stev, (event*)ev))
+    {
+        desc += " string=";
+        desc += event_string_get(stev);
+    }
+
+    return desc;
+}
+
+int test_scan_recorder_helper::record_callback(
+    void* context, const CPARSE_SYM(event)* ev)
+{
+    auto rec = (recorder*)context;
+    event_identifier* iev;
+
+    rec->events.push_back(describe(ev));
+
+    if (STATUS_SUCCESS == event_downcast_to_event_identifier(&iev, (event*)ev))
+    {
+        rec->symbols.push_back(event_identifier_symbol_get(iev));
+    }
+
+    return STATUS_SUCCESS;
+}
+
+int test_scan_recorder_helper::direct_scan(
+    recorder* rec, const char* name, const string& input)
+{
+    preprocessor_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    int retval, release_retval;
+
+    retval = preprocessor_scanner_create(&scanner);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    auto ap = preprocessor_scanner_upcast(scanner);
+
+    retval = event_handler_init(&eh, &record_callback, rec);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+        release_retval = event_handler_dispose(&eh);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = input_stream_create_from_string(&stream, input.c_str());
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = abstract_parser_push_input_stream(ap, name, stream);
+        if (STATUS_SUCCESS != retval)
+        {
+            release_retval = input_stream_release(stream);
+            (void)release_retval;
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = abstract_parser_run(ap);
+    }
+
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
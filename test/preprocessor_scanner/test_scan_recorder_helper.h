@@ -0,0 +1,33 @@
+/**
+ * \file test/preprocessor_scanner/test_scan_recorder_helper.h
+ *
+ * \brief Helpers for recording and comparing the events of a scan.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libcparse/event.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace test_scan_recorder_helper
+{
+    struct recorder
+    {
+        std::vector<std::string> events;
+        std::vector<uint32_t> symbols;
+    };
+
+    /* describe an event's type, cursor, and value as a string. */
+    std::string describe(const CPARSE_SYM(event)* ev);
+
+    /* record the description of each event, and each identifier symbol. */
+    int record_callback(void* context, const CPARSE_SYM(event)* ev);
+
+    /* scan input directly with a preprocessor scanner, recording each event. */
+    int direct_scan(recorder* rec, const char* name, const std::string& input);
+}
@@ -267,6 +267,10 @@ TEST(line_override)
     TEST_EXPECT(TEST_LINE == t1.pos.begin_line);
     TEST_EXPECT(!strcmp(t1.pos.file, "stdin"));
 
+    /* postcondition: the offset still refers to the original input. */
+    TEST_EXPECT(6 == t1.pos.begin_offset);
+    TEST_EXPECT(6 == t1.pos.end_offset);
+
     /* clean up. */
     TEST_ASSERT(
         STATUS_SUCCESS == raw_file_line_override_filter_release(filter));
@@ -341,6 +345,14 @@ TEST(file_line_override)
     TEST_EXPECT(TEST_LINE == t1.pos.begin_line);
     TEST_EXPECT(!strcmp(t1.pos.file, TEST_FILE));
 
+    /* postcondition: the file ID is the parser's ID for this file. */
+    const char* file;
+    uint32_t file_id;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_file_intern(&file, &file_id, ap, TEST_FILE));
+    TEST_EXPECT(file_id == t1.pos.file_id);
+
     /* clean up. */
     TEST_ASSERT(
         STATUS_SUCCESS == raw_file_line_override_filter_release(filter));
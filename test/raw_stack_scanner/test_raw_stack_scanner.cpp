@@ -7,19 +7,26 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <libcparse/cursor.h>
 #include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_span.h>
+#include <libcparse/event_reactor.h>
 #include <libcparse/raw_stack_scanner.h>
 #include <libcparse/status_codes.h>
 #include <list>
 #include <minunit/minunit.h>
+#include <string.h>
 #include <string>
 
 using namespace std;
 
 CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
 CPARSE_IMPORT_event;
 CPARSE_IMPORT_event_handler;
 CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_span;
+CPARSE_IMPORT_event_reactor;
 CPARSE_IMPORT_input_stream;
 CPARSE_IMPORT_raw_stack_scanner;
 
@@ -30,6 +37,7 @@ namespace
     struct test_context
     {
         list<int> vals;
+        list<cursor> cursors;
         bool eof;
 
         test_context()
@@ -37,6 +45,21 @@ namespace
         {
         }
     };
+
+    struct span_test_context
+    {
+        string vals;
+        list<cursor> cursors;
+        list<string> files;
+        size_t span_count;
+        size_t newline_count;
+        bool eof;
+
+        span_test_context()
+            : span_count(0), newline_count(0), eof(false)
+        {
+        }
+    };
 }
 
 static int dummy_callback(void* context, const CPARSE_SYM(event)* ev)
@@ -58,6 +81,40 @@ static int dummy_callback(void* context, const CPARSE_SYM(event)* ev)
         }
 
         ctx->vals.push_back(event_raw_character_get(rev));
+        ctx->cursors.push_back(*event_get_cursor(ev));
+    }
+    else
+    {
+        return -1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static int span_callback(void* context, const CPARSE_SYM(event)* ev)
+{
+    int retval;
+    span_test_context* ctx = (span_test_context*)context;
+
+    if (CPARSE_EVENT_TYPE_EOF == event_get_type(ev))
+    {
+        ctx->eof = true;
+    }
+    else if (CPARSE_EVENT_TYPE_RAW_SPAN == event_get_type(ev))
+    {
+        event_raw_span* rsev;
+        retval = event_downcast_to_event_raw_span(&rsev, (event*)ev);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ctx->vals.append(
+            event_raw_span_get(rsev), event_raw_span_size_get(rsev));
+        ctx->cursors.push_back(*event_get_cursor(ev));
+        ctx->files.push_back(event_get_cursor(ev)->file);
+        ctx->span_count += 1;
+        ctx->newline_count += event_raw_span_newline_count_get(rsev);
     }
     else
     {
@@ -67,6 +124,28 @@ static int dummy_callback(void* context, const CPARSE_SYM(event)* ev)
     return STATUS_SUCCESS;
 }
 
+static int mixed_callback(void* context, const CPARSE_SYM(event)* ev)
+{
+    int retval;
+    span_test_context* ctx = (span_test_context*)context;
+
+    if (CPARSE_EVENT_TYPE_RAW_CHARACTER == event_get_type(ev))
+    {
+        event_raw_character* rev;
+        retval = event_downcast_to_event_raw_character(&rev, (event*)ev);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ctx->vals.push_back(event_raw_character_get(rev));
+
+        return STATUS_SUCCESS;
+    }
+
+    return span_callback(context, ev);
+}
+
 /**
  * Test that we can create and release a raw stack scanner.
  */
@@ -177,6 +256,66 @@ TEST(input_stream_1)
     TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
 }
 
+/**
+ * Test that each character carries its byte offset in the input stream.
+ */
+TEST(character_offsets)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    test_context t1;
+    const char* TEST_STRING = "ab\ncd";
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &dummy_callback, &t1));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe to the raw stack scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == abstract_parser_raw_stack_scanner_subscribe(ap, &eh));
+
+    /* create our input stream. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, TEST_STRING));
+
+    /* add our input stream to the scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: we received every character. */
+    TEST_ASSERT(strlen(TEST_STRING) == t1.cursors.size());
+
+    /* each character covers exactly its own byte, across lines. */
+    size_t offset = 0;
+    for (const auto& c : t1.cursors)
+    {
+        TEST_EXPECT(offset == c.begin_offset);
+        TEST_EXPECT(offset == c.end_offset);
+        ++offset;
+    }
+
+    /* the character after the newline is on the next line. */
+    auto c = t1.cursors.back();
+    TEST_EXPECT(2 == c.begin_line);
+    TEST_EXPECT(2 == c.begin_col);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
+
 /**
  * Test that we receive all input from multiple input streams.
  */
@@ -259,3 +398,325 @@ TEST(multiple_input_streams)
     TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
     TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
 }
+
+/**
+ * Test that a span subscriber receives each input stream as a single span.
+ */
+TEST(span_subscribe)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    span_test_context t1;
+    const char* TEST_STRING = "abc\n123\nx";
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &span_callback, &t1));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe to raw spans. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_span_subscribe(ap, &eh));
+
+    /* create our input stream. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, TEST_STRING));
+
+    /* add our input stream to the scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: eof is true. */
+    TEST_EXPECT(t1.eof);
+
+    /* postcondition: we received a single span holding the whole string. */
+    TEST_EXPECT(1 == t1.span_count);
+    TEST_EXPECT(t1.vals == TEST_STRING);
+    TEST_EXPECT(2 == t1.newline_count);
+
+    /* the span cursor runs from the first to the last character. */
+    TEST_ASSERT(1 == t1.cursors.size());
+    auto c = t1.cursors.front();
+    TEST_EXPECT("stdin" == t1.files.front());
+    TEST_EXPECT(1 == c.begin_line);
+    TEST_EXPECT(1 == c.begin_col);
+    TEST_EXPECT(3 == c.end_line);
+    TEST_EXPECT(1 == c.end_col);
+    TEST_EXPECT(0 == c.begin_offset);
+    TEST_EXPECT(8 == c.end_offset);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
+
+/**
+ * Test that span subscribers and raw character subscribers both receive all
+ * input.
+ */
+TEST(span_and_character_subscribers)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream1;
+    input_stream* stream2;
+    event_handler eh1, eh2;
+    test_context t1;
+    span_test_context t2;
+    const string TEST_STRING1 = "def\n";
+    const string TEST_STRING2 = "abc";
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handlers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh1, &dummy_callback, &t1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh2, &span_callback, &t2));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe to raw characters and raw spans. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_subscribe(ap, &eh1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_span_subscribe(ap, &eh2));
+
+    /* create and add our input streams. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream1, TEST_STRING1.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "1", stream1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream2, TEST_STRING2.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "2", stream2));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: both subscribers saw EOF. */
+    TEST_EXPECT(t1.eof);
+    TEST_EXPECT(t2.eof);
+
+    /* postcondition: the character subscriber saw every character. */
+    string out(t1.vals.begin(), t1.vals.end());
+    TEST_EXPECT(out == (TEST_STRING2 + TEST_STRING1));
+
+    /* postcondition: the span subscriber saw one span per stream. */
+    TEST_EXPECT(2 == t2.span_count);
+    TEST_EXPECT(t2.vals == (TEST_STRING2 + TEST_STRING1));
+    TEST_EXPECT(1 == t2.newline_count);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh1));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh2));
+}
+
+/**
+ * Test that a character subscriber which accepts spans receives each input
+ * stream as a span when the scanner is run.
+ */
+TEST(character_subscriber_accepts_spans)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    event_reactor_filter filter;
+    span_test_context t1;
+    const char* TEST_STRING = "abc\n123\nx";
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &mixed_callback, &t1));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe to raw characters, accepting spans. */
+    event_reactor_filter_clear(&filter);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_EOF);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_RAW_CHARACTER);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_RAW_SPAN);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_subscribe_filtered(
+                    ap, &eh, &filter));
+
+    /* create and add our input stream. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, TEST_STRING));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: we received a single span holding the whole string. */
+    TEST_EXPECT(t1.eof);
+    TEST_EXPECT(1 == t1.span_count);
+    TEST_EXPECT(t1.vals == TEST_STRING);
+
+    /* the span cursor runs from the first to the last character. */
+    TEST_ASSERT(1 == t1.cursors.size());
+    auto c = t1.cursors.front();
+    TEST_EXPECT(1 == c.begin_line);
+    TEST_EXPECT(1 == c.begin_col);
+    TEST_EXPECT(3 == c.end_line);
+    TEST_EXPECT(1 == c.end_col);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
+
+/**
+ * Test that every character subscriber receives characters if any of them does
+ * not accept spans.
+ */
+TEST(character_subscriber_spans_need_characters)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream;
+    event_handler eh1, eh2;
+    event_reactor_filter filter;
+    test_context t1;
+    span_test_context t2;
+    const string TEST_STRING = "abc\n123";
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handlers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh1, &dummy_callback, &t1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh2, &mixed_callback, &t2));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe with and without accepting spans. */
+    event_reactor_filter_clear(&filter);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_EOF);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_RAW_CHARACTER);
+    event_reactor_filter_add_type(&filter, CPARSE_EVENT_TYPE_RAW_SPAN);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_subscribe(ap, &eh1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_subscribe_filtered(
+                    ap, &eh2, &filter));
+
+    /* create and add our input stream. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == input_stream_create_from_string(&stream, TEST_STRING.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_push_input_stream(ap, "stdin", stream));
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: both subscribers saw every character, and no spans. */
+    TEST_EXPECT(t1.eof);
+    TEST_EXPECT(t2.eof);
+    string out(t1.vals.begin(), t1.vals.end());
+    TEST_EXPECT(out == TEST_STRING);
+    TEST_EXPECT(t2.vals == TEST_STRING);
+    TEST_EXPECT(0 == t2.span_count);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh1));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh2));
+}
+
+/**
+ * Test that streams with the same name share an interned file name and ID.
+ */
+TEST(stream_names_interned)
+{
+    raw_stack_scanner* scanner;
+    input_stream* stream;
+    event_handler eh;
+    span_test_context t1;
+    const char* names[] = { "a.c", "b.c", "a.c" };
+
+    /* create the raw_stack_scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_create(&scanner));
+
+    /* create our event handler. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &span_callback, &t1));
+
+    /* get the abstract parser. */
+    auto ap = raw_stack_scanner_upcast(scanner);
+
+    /* subscribe to raw spans. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_span_subscribe(ap, &eh));
+
+    /* push a stream for each name. */
+    for (const char* name : names)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == input_stream_create_from_string(&stream, "x"));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == abstract_parser_push_input_stream(ap, name, stream));
+    }
+
+    /* run the scanner. */
+    TEST_ASSERT(STATUS_SUCCESS == abstract_parser_run(ap));
+
+    /* postcondition: we received a span for each stream. */
+    TEST_ASSERT(3 == t1.cursors.size());
+    auto a1 = t1.cursors.front();
+    auto b = *next(t1.cursors.begin());
+    auto a2 = t1.cursors.back();
+
+    /* the same name has the same interned file and ID. */
+    TEST_EXPECT(a1.file == a2.file);
+    TEST_EXPECT(a1.file_id == a2.file_id);
+    TEST_EXPECT(a1.file_id != b.file_id);
+    TEST_EXPECT(!strcmp("b.c", b.file));
+
+    /* the IDs are assigned by the parser. */
+    const char* file;
+    TEST_ASSERT(
+        STATUS_SUCCESS == abstract_parser_file_lookup(&file, ap, b.file_id));
+    TEST_EXPECT(b.file == file);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == raw_stack_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
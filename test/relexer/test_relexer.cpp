@@ -0,0 +1,304 @@
+/**
+ * \file test/relexer/test_relexer.cpp
+ *
+ * \brief Tests for the \ref relexer.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/relexer.h>
+#include <libcparse/status_codes.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+#include "../preprocessor_scanner/test_scan_recorder_helper.h"
+
+using namespace std;
+using namespace test_scan_recorder_helper;
+
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_relexer;
+
+TEST_SUITE(relexer);
+
+namespace
+{
+    /* describe the events recorded by a relexer. */
+    vector<string> recorded(const relexer* rl)
+    {
+        vector<string> events;
+
+        for (size_t i = 0; i < relexer_event_count_get(rl); ++i)
+        {
+            events.push_back(describe(relexer_event_get(rl, i)));
+        }
+
+        return events;
+    }
+
+    /* a document long enough to hold several checkpoints. */
+    string document()
+    {
+        string doc = "#include <stdio.h>\n";
+
+        for (int i = 0; i < 40; ++i)
+        {
+            doc +=
+                "/* block " + to_string(i) + " */\n"
+                "int f" + to_string(i) + "(int x, char* s)\n"
+                "{\n"
+                "    printf(\"%d\\n\", x + 0x1fu * 'a' - 1.5e3); // done\n"
+                "    return \\\n"
+                "        x >= " + to_string(i) + " ? 0 : -1;\n"
+                "}\n";
+        }
+
+        return doc;
+    }
+
+    /* a simple deterministic random number generator. */
+    struct lcg
+    {
+        unsigned long state;
+
+        size_t next(size_t bound)
+        {
+            state = state * 6364136223846793005UL + 1442695040888963407UL;
+
+            return (size_t)((state >> 33) % bound);
+        }
+    };
+}
+
+/**
+ * Scanning a document records and reports the same events as scanning it
+ * directly.
+ */
+TEST(scan_matches_direct)
+{
+    const string doc = document();
+    recorder direct, added;
+    relexer* rl;
+    event_handler eh;
+    int release_retval;
+
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "doc.c", doc));
+    TEST_ASSERT(STATUS_SUCCESS == relexer_create(&rl, "doc.c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS == event_handler_init(&eh, &record_callback, &added));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == relexer_scan(rl, doc.data(), doc.size(), &eh));
+
+    TEST_ASSERT(!direct.events.empty());
+    TEST_EXPECT(direct.events == added.events);
+    TEST_EXPECT(direct.events == recorded(rl));
+
+    release_retval = event_handler_dispose(&eh);
+    (void)release_retval;
+    TEST_ASSERT(STATUS_SUCCESS == relexer_release(rl));
+}
+
+/**
+ * Each kind of edit leaves the relexer with the events of a direct scan of
+ * the edited document, and a local edit only reports a few events.
+ */
+TEST(edit_matches_rescan)
+{
+    struct edit
+    {
+        size_t offset;
+        size_t removed_size;
+        string inserted;
+        bool local;
+    };
+
+    const string doc = document();
+    const size_t mid = doc.find("int f20");
+    const edit edits[] = {
+        /* rename an identifier. */
+        { mid + 4, 3, "renamed", true },
+        /* split a line. */
+        { mid + 7, 0, "\n\n", true },
+        /* delete a few lines. */
+        { mid, doc.find("int f21") - mid, "", true },
+        /* open a comment that swallows the rest of the document. */
+        { mid, 0, "/* ", false },
+        /* edit at either end of the document. */
+        { 0, 1, "", false },
+        { doc.size(), 0, "int y;\n", true },
+    };
+
+    for (const auto& e : edits)
+    {
+        string text = doc;
+        recorder direct, removed, added;
+        relexer* rl;
+        event_handler reh, aeh;
+        size_t before;
+        int release_retval;
+
+        text.replace(e.offset, e.removed_size, e.inserted);
+
+        TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "doc.c", text));
+        TEST_ASSERT(STATUS_SUCCESS == relexer_create(&rl, "doc.c"));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == relexer_scan(rl, doc.data(), doc.size(), nullptr));
+        before = relexer_event_count_get(rl);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == event_handler_init(&reh, &record_callback, &removed));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == event_handler_init(&aeh, &record_callback, &added));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == relexer_edit(
+                        rl, e.offset, e.removed_size, e.inserted.data(),
+                        e.inserted.size(), &reh, &aeh));
+
+        TEST_EXPECT(direct.events == recorded(rl));
+        TEST_EXPECT(
+            before - removed.events.size() + added.events.size()
+                == relexer_event_count_get(rl));
+
+        if (e.local)
+        {
+            TEST_EXPECT(removed.events.size() + added.events.size() < 200);
+        }
+
+        release_retval = event_handler_dispose(&reh);
+        (void)release_retval;
+        release_retval = event_handler_dispose(&aeh);
+        (void)release_retval;
+        TEST_ASSERT(STATUS_SUCCESS == relexer_release(rl));
+    }
+}
+
+/**
+ * An edit that the scanner rejects fails, and leaves the document and its
+ * events as they were.
+ */
+TEST(edit_scan_error)
+{
+    const string doc = document();
+    string text = doc;
+    const size_t mid = doc.find("int f20");
+    recorder direct, edited;
+    relexer* rl;
+
+    /* a string can't span lines. */
+    text.insert(mid, "\"");
+
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "doc.c", doc));
+    TEST_ASSERT(STATUS_SUCCESS != direct_scan(&edited, "doc.c", text));
+    TEST_ASSERT(STATUS_SUCCESS == relexer_create(&rl, "doc.c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS == relexer_scan(rl, doc.data(), doc.size(), nullptr));
+
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            != relexer_edit(rl, mid, 0, "\"", 1, nullptr, nullptr));
+    TEST_EXPECT(direct.events == recorded(rl));
+
+    /* the relexer can still be edited. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == relexer_edit(rl, mid, 0, "\n", 1, nullptr, nullptr));
+
+    recorder after;
+    text = doc;
+    text.insert(mid, "\n");
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&after, "doc.c", text));
+    TEST_EXPECT(after.events == recorded(rl));
+
+    TEST_ASSERT(STATUS_SUCCESS == relexer_release(rl));
+}
+
+/**
+ * A series of edits, each applied to the result of the last, keeps the
+ * recorded events in step with a direct scan.
+ */
+TEST(edit_sequence)
+{
+    const char* fragments[] = {
+        "x", " ", "\n", "/*", "*/", "//", "\"", "'", "\\\n", "0x1f", "1.5e",
+        "#define A 1\n", "int", "(", "}",
+    };
+    string text = document();
+    lcg rng = { 42 };
+    relexer* rl;
+
+    TEST_ASSERT(STATUS_SUCCESS == relexer_create(&rl, "doc.c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == relexer_scan(rl, text.data(), text.size(), nullptr));
+
+    for (int i = 0; i < 50; ++i)
+    {
+        const string ins =
+            fragments[rng.next(sizeof(fragments) / sizeof(fragments[0]))];
+        const size_t offset = rng.next(text.size() + 1);
+        const size_t removed_size = rng.next(text.size() - offset + 1) % 8;
+        string edited = text;
+        recorder direct;
+        int retval;
+
+        edited.replace(offset, removed_size, ins);
+
+        /* an edit that the scanner rejects leaves the document as it was. */
+        retval =
+            relexer_edit(
+                rl, offset, removed_size, ins.data(), ins.size(), nullptr,
+                nullptr);
+        if (STATUS_SUCCESS == retval)
+        {
+            text = edited;
+        }
+
+        TEST_EXPECT(retval == direct_scan(&direct, "doc.c", edited));
+
+        direct = recorder();
+        TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "doc.c", text));
+        TEST_EXPECT(direct.events == recorded(rl));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == relexer_release(rl));
+}
+
+/**
+ * An edit must remove a range within the document.
+ */
+TEST(bad_edit)
+{
+    const string doc = "int x;\n";
+    relexer* rl;
+
+    TEST_ASSERT(STATUS_SUCCESS == relexer_create(&rl, "doc.c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS == relexer_scan(rl, doc.data(), doc.size(), nullptr));
+
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_RELEXER_BAD_EDIT
+            == relexer_edit(rl, doc.size() + 1, 0, "", 0, nullptr, nullptr));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_RELEXER_BAD_EDIT
+            == relexer_edit(rl, 2, doc.size(), "", 0, nullptr, nullptr));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_RELEXER_BAD_EDIT
+            == relexer_edit(rl, 2, (size_t)-1, "", 0, nullptr, nullptr));
+
+    /* the document is unchanged. */
+    recorder direct;
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "doc.c", doc));
+    TEST_EXPECT(direct.events == recorded(rl));
+
+    TEST_ASSERT(STATUS_SUCCESS == relexer_release(rl));
+}
@@ -190,3 +190,95 @@ TEST(clear)
     TEST_ASSERT(STATUS_SUCCESS == string_builder_release(builder));
     free(str);
 }
+
+/**
+ * Test that we can add spans to a string, including spans with no terminator.
+ */
+TEST(add_span)
+{
+    string_builder* builder;
+    const char* input = "Hello, World!";
+    char* str = nullptr;
+
+    /* we can create the string_builder. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_create(&builder));
+
+    /* add the string in two spans, and an empty span. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_add_span(builder, input, 5));
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_add_span(builder, input, 0));
+    TEST_ASSERT(
+        STATUS_SUCCESS == string_builder_add_span(builder, input + 5, 8));
+
+    /* we can build a string. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_build(&str, builder));
+    TEST_ASSERT(nullptr != str);
+    TEST_EXPECT(!strcmp(str, input));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_release(builder));
+    free(str);
+}
+
+/**
+ * Test that a view reflects the current string without allocating it.
+ */
+TEST(view)
+{
+    string_builder* builder;
+
+    /* we can create the string_builder. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_create(&builder));
+
+    /* an empty builder has an empty view. */
+    TEST_ASSERT(nullptr != string_builder_view(builder));
+    TEST_EXPECT(!strcmp(string_builder_view(builder), ""));
+
+    TEST_EXPECT(0 == string_builder_size(builder));
+
+    /* the view is terminated after each add. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_add_character(builder, 'a'));
+    TEST_EXPECT(!strcmp(string_builder_view(builder), "a"));
+    TEST_EXPECT(1 == string_builder_size(builder));
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_add_string(builder, "bc"));
+    TEST_EXPECT(!strcmp(string_builder_view(builder), "abc"));
+    TEST_EXPECT(3 == string_builder_size(builder));
+
+    /* the view is empty after a clear. */
+    string_builder_clear(builder);
+    TEST_EXPECT(!strcmp(string_builder_view(builder), ""));
+    TEST_EXPECT(0 == string_builder_size(builder));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_release(builder));
+}
+
+/**
+ * Test that a cleared builder reuses its buffer for a shorter string.
+ */
+TEST(clear_reuses_buffer)
+{
+    string_builder* builder;
+    const char* first;
+
+    /* we can create the string_builder. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_create(&builder));
+
+    /* build a long string. */
+    for (int i = 0; i < 1024; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == string_builder_add_character(builder, 'A'));
+    }
+
+    first = string_builder_view(builder);
+    TEST_EXPECT(1024U == strlen(first));
+
+    /* a shorter string after a clear lands in the same buffer. */
+    string_builder_clear(builder);
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_add_string(builder, "short"));
+    TEST_EXPECT(first == string_builder_view(builder));
+    TEST_EXPECT(!strcmp(string_builder_view(builder), "short"));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == string_builder_release(builder));
+}
@@ -0,0 +1,457 @@
+/**
+ * \file test/token_cache/test_token_cache.cpp
+ *
+ * \brief Tests for the \ref token_cache type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <dirent.h>
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_cache.h>
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../preprocessor_scanner/test_scan_recorder_helper.h"
+
+using namespace std;
+using namespace test_scan_recorder_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_cache;
+
+TEST_SUITE(token_cache);
+
+namespace
+{
+    /* run input through the cache, recording each event. */
+    int cached_scan(
+        recorder* rec, token_cache* cache, const char* name,
+        const char* input)
+    {
+        preprocessor_scanner* scanner;
+        event_handler eh;
+        int retval, release_retval;
+
+        retval = preprocessor_scanner_create(&scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        auto ap = preprocessor_scanner_upcast(scanner);
+
+        if (
+            STATUS_SUCCESS
+                == (retval = event_handler_init(&eh, &record_callback, rec)))
+        {
+            retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    token_cache_preprocessor_scanner_run(
+                        cache, scanner, name, input, strlen(input));
+            }
+
+            release_retval = event_handler_dispose(&eh);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        release_retval = preprocessor_scanner_release(scanner);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        return retval;
+    }
+
+    /* list the entry files in a cache directory. */
+    vector<string> entries(const string& dir)
+    {
+        vector<string> names;
+        DIR* d = opendir(dir.c_str());
+        struct dirent* ent;
+
+        while (nullptr != d && nullptr != (ent = readdir(d)))
+        {
+            string name = ent->d_name;
+            if (name.size() > 5 && name.substr(name.size() - 5) == ".cpts")
+            {
+                names.push_back(name);
+            }
+        }
+
+        if (nullptr != d)
+        {
+            closedir(d);
+        }
+
+        return names;
+    }
+
+    /* remove a cache directory and its entries. */
+    void remove_dir(const string& dir)
+    {
+        for (const auto& name : entries(dir))
+        {
+            unlink((dir + "/" + name).c_str());
+        }
+
+        rmdir(dir.c_str());
+    }
+
+    /* create a fresh, empty directory name for a cache. */
+    string temp_dir()
+    {
+        char tmpl[] = "/tmp/token_cache_test_XXXXXX";
+        string dir = mkdtemp(tmpl);
+
+        /* the cache creates its own directory. */
+        return dir + "/cache";
+    }
+
+    const char* INPUT =
+        "int main(int argc, char* argv[])\n{\n    return 0;\n}\n";
+}
+
+/**
+ * Creating a cache creates its directory.
+ */
+TEST(create_makes_directory)
+{
+    string dir = temp_dir();
+    token_cache* cache;
+    token_cache_stats stats;
+    struct stat st;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(0 == stat(dir.c_str(), &st));
+    TEST_EXPECT(S_ISDIR(st.st_mode));
+
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.hits);
+    TEST_EXPECT(0 == stats.misses);
+    TEST_EXPECT(0 == stats.entries);
+    TEST_EXPECT(0 == stats.size);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * A miss scans and writes through; the same input then hits, and both
+ * broadcast the same events as scanning directly.
+ */
+TEST(miss_then_hit)
+{
+    string dir = temp_dir();
+    recorder direct, miss, hit;
+    token_cache* cache;
+    token_cache_stats stats;
+
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "main.c", INPUT));
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&miss, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.hits);
+    TEST_EXPECT(1 == stats.misses);
+    TEST_EXPECT(1 == stats.entries);
+    TEST_EXPECT(stats.size > 0);
+    TEST_EXPECT(1 == entries(dir).size());
+
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&hit, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.hits);
+    TEST_EXPECT(1 == stats.misses);
+    TEST_EXPECT(strlen(INPUT) == stats.bytes_saved);
+
+    TEST_ASSERT(!direct.events.empty());
+    TEST_EXPECT(direct.events == miss.events);
+    TEST_EXPECT(direct.symbols == miss.symbols);
+    TEST_EXPECT(direct.events == hit.events);
+    TEST_EXPECT(direct.symbols == hit.symbols);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * A change to the input or to its name is a miss.
+ */
+TEST(key_covers_content_and_name)
+{
+    string dir = temp_dir();
+    recorder rec;
+    token_cache* cache;
+    token_cache_stats stats;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "a.c", "int x;"));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "a.c", "int y;"));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "b.c", "int x;"));
+
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.hits);
+    TEST_EXPECT(3 == stats.misses);
+    TEST_EXPECT(3 == stats.entries);
+    TEST_EXPECT(3 == entries(dir).size());
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * Entries persist across cache instances.
+ */
+TEST(persistent)
+{
+    string dir = temp_dir();
+    recorder first, second;
+    token_cache* cache;
+    token_cache_stats stats;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(
+        STATUS_SUCCESS == cached_scan(&first, cache, "main.c", INPUT));
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.entries);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == cached_scan(&second, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.hits);
+    TEST_EXPECT(0 == stats.misses);
+    TEST_EXPECT(first.events == second.events);
+    TEST_EXPECT(first.symbols == second.symbols);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * Temporary files left behind by an interrupted write are removed when the
+ * cache is loaded, and other files are left alone.
+ */
+TEST(removes_leftover_temp_files)
+{
+    string dir = temp_dir();
+    string temp = dir + "/.tmp-a1B2c3";
+    string other = dir + "/notes.txt";
+    token_cache* cache;
+    token_cache_stats stats;
+    struct stat st;
+    FILE* file;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+
+    /* leave a partial entry behind, along with an unrelated file. */
+    for (const auto& path : { temp, other })
+    {
+        file = fopen(path.c_str(), "w");
+        TEST_ASSERT(nullptr != file);
+        fputs("partial", file);
+        fclose(file);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.entries);
+    TEST_EXPECT(0 != stat(temp.c_str(), &st));
+    TEST_EXPECT(0 == stat(other.c_str(), &st));
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    unlink(other.c_str());
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * When the cache is full, the least recently used entry is evicted.
+ */
+TEST(lru_eviction)
+{
+    string dir = temp_dir();
+    recorder rec;
+    token_cache* cache;
+    token_cache_stats stats;
+    uint64_t entry_size;
+
+    /* measure the size of one entry. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "a.c", "int a;"));
+    token_cache_stats_get(&stats, cache);
+    entry_size = stats.size;
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+
+    /* the same sized entries, with room for two of them. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == token_cache_create(&cache, dir.c_str(), 2 * entry_size));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "b.c", "int b;"));
+
+    /* use a, so that b is the least recently used. */
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "a.c", "int a;"));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "c.c", "int c;"));
+
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.evictions);
+    TEST_EXPECT(2 == stats.entries);
+    TEST_EXPECT(2 == entries(dir).size());
+    TEST_EXPECT(stats.size <= 2 * entry_size);
+
+    /* a and c hit, and b misses. */
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "a.c", "int a;"));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "c.c", "int c;"));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(3 == stats.hits);
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "b.c", "int b;"));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(3 == stats.hits);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * A corrupt entry is a miss, and is replaced.
+ */
+TEST(corrupt_entry)
+{
+    string dir = temp_dir();
+    recorder direct, rec;
+    token_cache* cache;
+    token_cache_stats stats;
+
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "main.c", INPUT));
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+
+    /* truncate the entry. */
+    auto names = entries(dir);
+    TEST_ASSERT(1 == names.size());
+    TEST_ASSERT(0 == truncate((dir + "/" + names[0]).c_str(), 20));
+
+    rec = recorder();
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.hits);
+    TEST_EXPECT(2 == stats.misses);
+    TEST_EXPECT(direct.events == rec.events);
+    TEST_EXPECT(direct.symbols == rec.symbols);
+
+    /* the replacement hits. */
+    rec = recorder();
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.hits);
+    TEST_EXPECT(direct.events == rec.events);
+    TEST_EXPECT(direct.symbols == rec.symbols);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
+
+/**
+ * An entry with a valid header and string table but a corrupt payload column
+ * is a miss, and is replaced, without any of its events being replayed.
+ */
+TEST(corrupt_columns)
+{
+    string dir = temp_dir();
+    recorder direct, rec;
+    token_cache* cache;
+    token_cache_stats stats;
+    vector<uint8_t> bytes;
+    uint64_t offset = 0, size = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == direct_scan(&direct, "main.c", INPUT));
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_cache_create(&cache, dir.c_str(), 1 << 20));
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+
+    /* read the entry. */
+    auto names = entries(dir);
+    TEST_ASSERT(1 == names.size());
+    const string path = dir + "/" + names[0];
+    FILE* f = fopen(path.c_str(), "rb");
+    TEST_ASSERT(nullptr != f);
+    for (int ch; EOF != (ch = fgetc(f)); )
+    {
+        bytes.push_back((uint8_t)ch);
+    }
+    fclose(f);
+
+    /* overwrite its payload column, which is the fourth section. */
+    TEST_ASSERT(bytes.size() > 16 + 16 * 4);
+    for (int b = 7; b >= 0; --b)
+    {
+        offset = (offset << 8) | bytes[16 + 16 * 3 + b];
+        size = (size << 8) | bytes[24 + 16 * 3 + b];
+    }
+
+    TEST_ASSERT(size > 0 && offset + size <= bytes.size());
+    memset(bytes.data() + offset, 0xff, size);
+
+    f = fopen(path.c_str(), "wb");
+    TEST_ASSERT(nullptr != f);
+    TEST_ASSERT(bytes.size() == fwrite(bytes.data(), 1, bytes.size(), f));
+    fclose(f);
+
+    /* the entry is a miss, and nothing is replayed before the scan. */
+    rec = recorder();
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(0 == stats.hits);
+    TEST_EXPECT(2 == stats.misses);
+    TEST_EXPECT(direct.events == rec.events);
+    TEST_EXPECT(direct.symbols == rec.symbols);
+
+    /* the replacement hits. */
+    rec = recorder();
+    TEST_ASSERT(STATUS_SUCCESS == cached_scan(&rec, cache, "main.c", INPUT));
+    token_cache_stats_get(&stats, cache);
+    TEST_EXPECT(1 == stats.hits);
+    TEST_EXPECT(direct.events == rec.events);
+    TEST_EXPECT(direct.symbols == rec.symbols);
+
+    TEST_ASSERT(STATUS_SUCCESS == token_cache_release(cache));
+    remove_dir(dir);
+    rmdir(dir.substr(0, dir.rfind('/')).c_str());
+}
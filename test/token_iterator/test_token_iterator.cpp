@@ -0,0 +1,317 @@
+/**
+ * \file test/token_iterator/test_token_iterator.cpp
+ *
+ * \brief Tests for the \ref token_iterator type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/allocator.h>
+#include <libcparse/event.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_type.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_iterator.h>
+#include <minunit/minunit.h>
+#include <set>
+#include <stdlib.h>
+#include <string>
+
+#include "../preprocessor_scanner/test_preprocessor_scanner_helper.h"
+
+using namespace std;
+using namespace test_preprocessor_scanner_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_allocator;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_iterator;
+
+TEST_SUITE(token_iterator);
+
+static const char* INPUT_STRING =
+    "#include <stdio.h>\n"
+    "/* comment */ int main(int argc, char* argv[])\n"
+    "{\n"
+    "    printf(\"%d\\n\", 0x1fu + 'a' + 1.5e3); // done\n"
+    "    return \\\n"
+    "        argc >= 2 ? 0 : -1;\n"
+    "}\n";
+
+/**
+ * \brief Count raw characters.
+ */
+static int raw_count_callback(void* context, const event*)
+{
+    *(size_t*)context += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push the given string onto a parser stack.
+ */
+static int push_string(abstract_parser* ap, const char* str)
+{
+    int retval, release_retval;
+    input_stream* stream;
+
+    retval = input_stream_create_from_string(&stream, str);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = abstract_parser_push_input_stream(ap, "stdin", stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval = input_stream_release(stream);
+        (void)release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Track the blocks handed out by a counting allocator.
+ */
+struct counting_context
+{
+    set<void*> live;
+    size_t allocations = 0;
+};
+
+static void* counting_allocate(void* context, size_t size)
+{
+    auto ctx = (counting_context*)context;
+    void* block = malloc(size);
+
+    if (nullptr != block)
+    {
+        ctx->live.insert(block);
+        ++ctx->allocations;
+    }
+
+    return block;
+}
+
+static void* counting_reallocate(void* context, void* block, size_t size)
+{
+    auto ctx = (counting_context*)context;
+    void* resized = realloc(block, size);
+
+    if (nullptr != resized)
+    {
+        if (nullptr != block)
+        {
+            ctx->live.erase(block);
+        }
+        else
+        {
+            ++ctx->allocations;
+        }
+
+        ctx->live.insert(resized);
+    }
+
+    return resized;
+}
+
+static void counting_free(void* context, void* block)
+{
+    auto ctx = (counting_context*)context;
+
+    ctx->live.erase(block);
+    free(block);
+}
+
+/**
+ * Test that we can create and release a token iterator.
+ */
+TEST(create_release)
+{
+    token_iterator* it;
+
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_create(&it));
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_release(it));
+}
+
+/**
+ * Test that an iterator created with an allocator uses it for itself, its
+ * parser stack, and the events it hands out.
+ */
+TEST(custom_allocator)
+{
+    token_iterator* it;
+    event_copy* cpy;
+    ::allocator alloc;
+    counting_context ctx;
+    int retval;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == allocator_init(
+                    &alloc, &counting_allocate, &counting_reallocate,
+                    &counting_free, &ctx));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_iterator_create_with_allocator(&it, &alloc));
+    TEST_EXPECT(ctx.allocations > 0);
+
+    /* the parser stack uses this allocator. */
+    TEST_EXPECT(
+        &counting_allocate
+            == abstract_parser_allocator_get(
+                    token_iterator_upcast(it))->allocate);
+
+    /* pull every event, releasing each copy. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == push_string(token_iterator_upcast(it), INPUT_STRING));
+    while (STATUS_SUCCESS == (retval = token_iterator_next(it, &cpy)))
+    {
+        TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+    }
+
+    TEST_EXPECT(ERROR_LIBCPARSE_TOKEN_ITERATOR_END == retval);
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_release(it));
+
+    /* every block was returned to the allocator. */
+    TEST_EXPECT(ctx.live.empty());
+
+    TEST_ASSERT(STATUS_SUCCESS == allocator_dispose(&alloc));
+}
+
+/**
+ * Test that an iterator with no input returns EOF, and then the end.
+ */
+TEST(empty)
+{
+    token_iterator* it;
+    event_copy* cpy;
+
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_create(&it));
+
+    /* the first event is EOF. */
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_next(it, &cpy));
+    TEST_EXPECT(
+        CPARSE_EVENT_TYPE_EOF == event_get_type(event_copy_get_event(cpy)));
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+
+    /* after that, the iterator is at its end. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_ITERATOR_END == token_iterator_next(it, &cpy));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_ITERATOR_END == token_iterator_next(it, &cpy));
+
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_release(it));
+}
+
+/**
+ * Test that pulling every event yields the same events as running the
+ * preprocessor scanner.
+ */
+TEST(matches_run)
+{
+    preprocessor_scanner* scanner;
+    token_iterator* it;
+    event_handler eh;
+    event_copy* cpy;
+    test_context expected, pulled;
+    int retval;
+
+    /* run the scanner to collect the expected events. */
+    TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_create(&scanner));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_handler_init(&eh, &dummy_callback, &expected));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_preprocessor_scanner_subscribe(
+                    preprocessor_scanner_upcast(scanner), &eh));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == push_string(preprocessor_scanner_upcast(scanner), INPUT_STRING));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_run(preprocessor_scanner_upcast(scanner)));
+    TEST_ASSERT(STATUS_SUCCESS == preprocessor_scanner_release(scanner));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+
+    /* pull the same events from an iterator. */
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_create(&it));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == push_string(token_iterator_upcast(it), INPUT_STRING));
+    while (STATUS_SUCCESS == (retval = token_iterator_next(it, &cpy)))
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == dummy_callback(&pulled, event_copy_get_event(cpy)));
+        TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+    }
+
+    /* the iterator ended cleanly. */
+    TEST_EXPECT(ERROR_LIBCPARSE_TOKEN_ITERATOR_END == retval);
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_release(it));
+
+    /* the events match. */
+    TEST_ASSERT(expected.eof);
+    TEST_EXPECT(pulled.eof);
+    TEST_EXPECT(!expected.vals.empty());
+    TEST_EXPECT(expected.vals == pulled.vals);
+}
+
+/**
+ * Test that pulling a few events only scans the input that they need.
+ */
+TEST(stop_early)
+{
+    token_iterator* it;
+    event_handler eh;
+    event_copy* cpy;
+    size_t raw_count = 0;
+    string input;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += "int x" + to_string(i) + " = " + to_string(i) + ";\n";
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_create(&it));
+
+    /* count the raw characters that are scanned. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_handler_init(&eh, &raw_count_callback, &raw_count));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == abstract_parser_raw_stack_scanner_subscribe(
+                    token_iterator_upcast(it), &eh));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == push_string(token_iterator_upcast(it), input.c_str()));
+
+    /* pull the first declaration: int x0 = 0 ; */
+    for (int i = 0; i < 5; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == token_iterator_next(it, &cpy));
+        TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+    }
+
+    /* only the first line or so has been scanned. */
+    TEST_EXPECT(raw_count > 0);
+    TEST_EXPECT(raw_count < 20);
+
+    /* releasing the iterator abandons the rest of the input. */
+    TEST_ASSERT(STATUS_SUCCESS == token_iterator_release(it));
+    TEST_ASSERT(STATUS_SUCCESS == event_handler_dispose(&eh));
+}
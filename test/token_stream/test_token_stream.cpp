@@ -0,0 +1,439 @@
+/**
+ * \file test/token_stream/test_token_stream.cpp
+ *
+ * \brief Tests for the \ref token_stream and \ref token_stream_writer types.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event/include.h>
+#include <libcparse/event/integer.h>
+#include <libcparse/event/raw_character.h>
+#include <libcparse/event/raw_float.h>
+#include <libcparse/event/raw_string.h>
+#include <libcparse/event/string.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/event_type.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/intern_table.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_stream.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../preprocessor_scanner/test_scan_recorder_helper.h"
+
+using namespace std;
+using namespace test_scan_recorder_helper;
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_include;
+CPARSE_IMPORT_event_integer;
+CPARSE_IMPORT_event_raw_character;
+CPARSE_IMPORT_event_raw_float;
+CPARSE_IMPORT_event_raw_string;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_event_string;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_intern_table;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_stream;
+
+TEST_SUITE(token_stream);
+
+namespace
+{
+    /* scan input, recording each event and writing it to a token stream. */
+    int scan(recorder* rec, void** data, size_t* size, const char* input)
+    {
+        preprocessor_scanner* scanner;
+        token_stream_writer* writer;
+        input_stream* stream;
+        event_handler rec_eh, writer_eh;
+        int retval;
+
+        retval = preprocessor_scanner_create(&scanner);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = token_stream_writer_create(&writer);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        auto ap = preprocessor_scanner_upcast(scanner);
+
+        if (
+            STATUS_SUCCESS
+                != (retval =
+                        event_handler_init(&rec_eh, &record_callback, rec))
+         || STATUS_SUCCESS
+                != (retval =
+                        token_stream_writer_event_handler_init(
+                            &writer_eh, writer))
+         || STATUS_SUCCESS
+                != (retval =
+                        abstract_parser_preprocessor_scanner_subscribe(
+                            ap, &rec_eh))
+         || STATUS_SUCCESS
+                != (retval =
+                        abstract_parser_preprocessor_scanner_subscribe(
+                            ap, &writer_eh))
+         || STATUS_SUCCESS
+                != (retval = input_stream_create_from_string(&stream, input))
+         || STATUS_SUCCESS
+                != (retval =
+                        abstract_parser_push_input_stream(
+                            ap, "test.c", stream))
+         || STATUS_SUCCESS != (retval = abstract_parser_run(ap))
+         || STATUS_SUCCESS
+                != (retval = token_stream_writer_build(data, size, writer)))
+        {
+            return retval;
+        }
+
+        if (
+            STATUS_SUCCESS != (retval = preprocessor_scanner_release(scanner))
+         || STATUS_SUCCESS != (retval = token_stream_writer_release(writer))
+         || STATUS_SUCCESS != (retval = event_handler_dispose(&rec_eh))
+         || STATUS_SUCCESS != (retval = event_handler_dispose(&writer_eh)))
+        {
+            return retval;
+        }
+
+        return STATUS_SUCCESS;
+    }
+
+    /* replay a token stream into a recorder. */
+    int replay(recorder* rec, const token_stream* stream, intern_table* table)
+    {
+        event_reactor* reactor;
+        event_handler eh;
+        int retval, release_retval;
+
+        retval = event_reactor_create(&reactor);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (
+            STATUS_SUCCESS
+                == (retval = event_handler_init(&eh, &record_callback, rec)))
+        {
+            retval = event_reactor_add(reactor, &eh);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = token_stream_replay(stream, reactor, table);
+            }
+
+            release_retval = event_handler_dispose(&eh);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        release_retval = event_reactor_release(reactor);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        return retval;
+    }
+
+    const char* input =
+        "#define MAX(a, b) ((a) > (b) ? (a) : (b))\n"
+        "int x = 17; /* comment */\n"
+        "\"abc\" foo(1.5e3, 'c', x, 0x1F)\n"
+        "int y = x + x;\n";
+}
+
+/**
+ * Test that replaying a token stream broadcasts the same events as the scan
+ * that recorded it.
+ */
+TEST(round_trip)
+{
+    recorder scanned, replayed;
+    token_stream* stream;
+    void* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&scanned, &data, &size, input));
+    TEST_ASSERT(!scanned.events.empty());
+
+    /* we can view the encoded buffer as a token stream. */
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_create(&stream, data, size));
+    TEST_EXPECT(scanned.events.size() == token_stream_event_count_get(stream));
+
+    /* replay broadcasts the same events. */
+    TEST_ASSERT(STATUS_SUCCESS == replay(&replayed, stream, nullptr));
+    TEST_EXPECT(scanned.events == replayed.events);
+
+    /* without a table, identifiers carry their recorded symbols. */
+    TEST_EXPECT(scanned.symbols == replayed.symbols);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_release(stream));
+    free(data);
+}
+
+/**
+ * Test that replay can re-intern identifiers in a new intern table.
+ */
+TEST(reintern)
+{
+    recorder scanned, replayed;
+    token_stream* stream;
+    intern_table* table;
+    const char* str;
+    void* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == scan(&scanned, &data, &size, input));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_create(&stream, data, size));
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_create(&table, false));
+
+    /* intern an unrelated string first, so that the symbols differ. */
+    uint32_t unrelated;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == intern_table_intern(&str, &unrelated, table, "unrelated", 9));
+
+    TEST_ASSERT(STATUS_SUCCESS == replay(&replayed, stream, table));
+
+    /* the events are unchanged, but the symbols come from the new table. */
+    TEST_EXPECT(scanned.events == replayed.events);
+    TEST_ASSERT(scanned.symbols.size() == replayed.symbols.size());
+    TEST_ASSERT(!replayed.symbols.empty());
+    for (size_t i = 0; i < replayed.symbols.size(); ++i)
+    {
+        TEST_EXPECT(unrelated != replayed.symbols[i]);
+        TEST_EXPECT(
+            STATUS_SUCCESS
+                == intern_table_lookup(&str, table, replayed.symbols[i]));
+    }
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == intern_table_release(table));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_release(stream));
+    free(data);
+}
+
+/**
+ * Test that events of every encodable category survive a round trip.
+ */
+TEST(categories)
+{
+    recorder written, replayed;
+    token_stream_writer* writer;
+    token_stream* stream;
+    void* data;
+    size_t size;
+    cursor pos;
+    event base;
+    event_include inev;
+    event_integer_token itev;
+    event_raw_character cev;
+    event_raw_float_token fev;
+    event_raw_string_token sev;
+    event_string stev;
+
+    memset(&pos, 0, sizeof(pos));
+    pos.file = "categories.c";
+    pos.begin_line = pos.end_line = 3;
+    pos.begin_col = 1;
+    pos.end_col = 9;
+
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_writer_create(&writer));
+
+    /* build one event of each category, recording each as it is added. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_init_for_token_keyword_int(&base, &pos));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_include_init_for_system_include(&inev, &pos, "stdio.h"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_integer_token_init_for_signed_long_long(
+                    &itev, &pos, -12345678901LL));
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_character_init(&cev, &pos, -1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_float_token_init_for_view(
+                    &fev, &pos, "2.5f", 4));
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_float_token_sign_set(&fev, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_raw_string_token_init_for_system_view(
+                    &sev, &pos, "<a.h>", 5));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == event_string_init_for_system_string(&stev, &pos, "sys"));
+
+    const event* evs[] = {
+        &base, event_include_upcast(&inev), event_integer_token_upcast(&itev),
+        event_raw_character_upcast(&cev), event_raw_float_token_upcast(&fev),
+        event_raw_string_token_upcast(&sev), event_string_upcast(&stev) };
+
+    for (auto ev : evs)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == token_stream_writer_add(writer, ev));
+        TEST_ASSERT(STATUS_SUCCESS == record_callback(&written, ev));
+    }
+
+    /* replay the encoded events. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_stream_writer_build(&data, &size, writer));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_create(&stream, data, size));
+    TEST_ASSERT(STATUS_SUCCESS == replay(&replayed, stream, nullptr));
+
+    TEST_EXPECT(7 == token_stream_event_count_get(stream));
+    TEST_EXPECT(written.events == replayed.events);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_dispose(&base));
+    TEST_ASSERT(STATUS_SUCCESS == event_include_dispose(&inev));
+    TEST_ASSERT(STATUS_SUCCESS == event_integer_token_dispose(&itev));
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_character_dispose(&cev));
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_float_token_dispose(&fev));
+    TEST_ASSERT(STATUS_SUCCESS == event_raw_string_token_dispose(&sev));
+    TEST_ASSERT(STATUS_SUCCESS == event_string_dispose(&stev));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_release(stream));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_writer_release(writer));
+    free(data);
+}
+
+/**
+ * Test that an empty token stream can be built and replayed.
+ */
+TEST(empty)
+{
+    recorder replayed;
+    token_stream_writer* writer;
+    token_stream* stream;
+    void* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_writer_create(&writer));
+    TEST_ASSERT(
+        STATUS_SUCCESS == token_stream_writer_build(&data, &size, writer));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_create(&stream, data, size));
+
+    TEST_EXPECT(0 == token_stream_event_count_get(stream));
+    TEST_ASSERT(STATUS_SUCCESS == replay(&replayed, stream, nullptr));
+    TEST_EXPECT(replayed.events.empty());
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_release(stream));
+    TEST_ASSERT(STATUS_SUCCESS == token_stream_writer_release(writer));
+    free(data);
+}
+
+/**
+ * Test that a buffer with a bad magic number, version, or size is rejected.
+ */
+TEST(bad_format)
+{
+    recorder scanned;
+    token_stream* stream;
+    uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == scan(&scanned, (void**)&data, &size, input));
+
+    /* a truncated buffer is rejected. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT
+            == token_stream_create(&stream, data, 8));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT
+            == token_stream_create(&stream, data, size - 1));
+
+    /* a different version is rejected. */
+    data[4] += 1;
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_STREAM_BAD_VERSION
+            == token_stream_create(&stream, data, size));
+    data[4] -= 1;
+
+    /* a bad magic number is rejected. */
+    data[0] = 'X';
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT
+            == token_stream_create(&stream, data, size));
+
+    free(data);
+}
+
+/**
+ * Test that a buffer with corrupt event columns is rejected when it is viewed,
+ * before any of its events can be replayed.
+ */
+TEST(bad_columns)
+{
+    recorder scanned;
+    token_stream* stream;
+    uint8_t* data;
+    uint8_t* copy;
+    size_t size;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == scan(&scanned, (void**)&data, &size, input));
+
+    /* find a section by its header entry. */
+    auto section =
+        [&](int i, size_t* section_size) -> size_t
+        {
+            size_t offset = 0;
+
+            *section_size = 0;
+            for (int b = 7; b >= 0; --b)
+            {
+                offset = (offset << 8) | data[16 + 16 * i + b];
+                *section_size =
+                    (*section_size << 8) | data[24 + 16 * i + b];
+            }
+
+            return offset;
+        };
+
+    copy = (uint8_t*)malloc(size);
+    TEST_ASSERT(nullptr != copy);
+
+    /* each corrupt column is rejected. */
+    for (int i = 0; i < 4; ++i)
+    {
+        size_t section_size;
+        size_t offset = section(i, &section_size);
+
+        TEST_ASSERT(section_size > 0);
+
+        memcpy(copy, data, size);
+        memset(copy + offset, 0xff, section_size);
+
+        TEST_EXPECT(
+            ERROR_LIBCPARSE_TOKEN_STREAM_BAD_FORMAT
+                == token_stream_create(&stream, copy, size));
+    }
+
+    free(copy);
+    free(data);
+}
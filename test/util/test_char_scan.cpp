@@ -0,0 +1,173 @@
+/**
+ * \file test/util/test_char_scan.cpp
+ *
+ * \brief Tests for the character class and character set scans.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/util/char_scan.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string>
+
+#include "../../src/util/char_scan_internal.h"
+
+using namespace std;
+
+CPARSE_IMPORT_util_char_scan;
+CPARSE_IMPORT_util_char_scan_internal;
+
+TEST_SUITE(char_scan);
+
+/**
+ * \brief Build a pseudo-random block from the given alphabet.
+ */
+static string random_block(size_t size, const string& alphabet, unsigned seed)
+{
+    string block;
+
+    srand(seed);
+    for (size_t i = 0; i < size; ++i)
+    {
+        block.push_back(alphabet[rand() % alphabet.size()]);
+    }
+
+    return block;
+}
+
+/**
+ * Runs of each class stop at the first character outside of the class.
+ */
+TEST(char_scan_run_basics)
+{
+    TEST_EXPECT(
+        7 == char_scan_run("a_Z09zq+", 8, CPARSE_CHAR_SCAN_CLASS_IDENTIFIER));
+    TEST_EXPECT(
+        3 == char_scan_run("123a", 4, CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT));
+    TEST_EXPECT(
+        5 == char_scan_run("09aFfg", 6, CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT));
+    TEST_EXPECT(
+        5 == char_scan_run(
+                " \t\v\f\r\n", 6, CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE));
+    TEST_EXPECT(
+        6 == char_scan_run(" \t\v\f\r\nx", 7, CPARSE_CHAR_SCAN_CLASS_SPACE));
+    TEST_EXPECT(0 == char_scan_run("", 0, CPARSE_CHAR_SCAN_CLASS_IDENTIFIER));
+}
+
+/**
+ * The first character in a set is found, or the size if there is none.
+ */
+TEST(char_scan_any_basics)
+{
+    TEST_EXPECT(3 == char_scan_any("abc\"d\\", 6, "\"\\", 2));
+    TEST_EXPECT(5 == char_scan_any("abcde", 5, "\"\\", 2));
+    TEST_EXPECT(2 == char_scan_any("ab*", 3, "*", 1));
+    TEST_EXPECT(0 == char_scan_any("", 0, "*", 1));
+}
+
+/**
+ * The vectorized and scalar run scans return identical results.
+ */
+TEST(char_scan_run_vectorized_matches_scalar)
+{
+    const string alphabet = "az_09AFGg \t\n\v\f\r\x80\xff.";
+    const int classes[] = {
+        CPARSE_CHAR_SCAN_CLASS_IDENTIFIER,
+        CPARSE_CHAR_SCAN_CLASS_DECIMAL_DIGIT,
+        CPARSE_CHAR_SCAN_CLASS_HEX_DIGIT,
+        CPARSE_CHAR_SCAN_CLASS_HORIZONTAL_SPACE,
+        CPARSE_CHAR_SCAN_CLASS_SPACE };
+
+    for (int char_class : classes)
+    {
+        for (size_t size = 0; size < 200; ++size)
+        {
+            /* find the class members, so that long runs are likely. */
+            string members;
+            for (char ch : alphabet)
+            {
+                if (1 == char_scan_run_scalar(&ch, 1, char_class))
+                {
+                    members.push_back(ch);
+                }
+            }
+
+            auto block = random_block(size, members, size * 7 + char_class);
+            if (size > 0)
+            {
+                block[rand() % size] = alphabet[rand() % alphabet.size()];
+            }
+
+            size_t expected =
+                char_scan_run_scalar(block.data(), size, char_class);
+
+            /* the dispatched scan matches. */
+            TEST_EXPECT(
+                expected == char_scan_run(block.data(), size, char_class));
+
+#if CPARSE_CHAR_SCAN_X86
+            /* the SSE2 scan matches. */
+            TEST_EXPECT(
+                expected
+                    == char_scan_run_sse2(block.data(), size, char_class));
+
+            /* the AVX2 scan matches, if this CPU supports it. */
+            if (__builtin_cpu_supports("avx2"))
+            {
+                TEST_EXPECT(
+                    expected
+                        == char_scan_run_avx2(block.data(), size, char_class));
+            }
+#endif
+        }
+    }
+}
+
+/**
+ * The vectorized and scalar set scans return identical results.
+ */
+TEST(char_scan_any_vectorized_matches_scalar)
+{
+    const string set = " \t\n\"'\\*>";
+
+    for (size_t set_size = 1; set_size <= CPARSE_CHAR_SCAN_MAX_SET; ++set_size)
+    {
+        for (size_t size = 0; size < 200; ++size)
+        {
+            /* mostly misses, with an occasional match. */
+            auto block = random_block(size, "abcdefghij", size + set_size);
+            if (size > 0 && 0 != size % 5)
+            {
+                block[rand() % size] = set[rand() % CPARSE_CHAR_SCAN_MAX_SET];
+            }
+
+            size_t expected =
+                char_scan_any_scalar(
+                    block.data(), size, set.data(), set_size);
+
+            /* the dispatched scan matches. */
+            TEST_EXPECT(
+                expected
+                    == char_scan_any(block.data(), size, set.data(), set_size));
+
+#if CPARSE_CHAR_SCAN_X86
+            /* the SSE2 scan matches. */
+            TEST_EXPECT(
+                expected
+                    == char_scan_any_sse2(
+                            block.data(), size, set.data(), set_size));
+
+            /* the AVX2 scan matches, if this CPU supports it. */
+            if (__builtin_cpu_supports("avx2"))
+            {
+                TEST_EXPECT(
+                    expected
+                        == char_scan_any_avx2(
+                                block.data(), size, set.data(), set_size));
+            }
+#endif
+        }
+    }
+}
@@ -0,0 +1,147 @@
+/**
+ * \file test/util/test_cursor_advance.cpp
+ *
+ * \brief Tests for the cursor advance and newline scan methods.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/cursor.h>
+#include <libcparse/util/cursor_advance.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "../../src/util/cursor_advance_internal.h"
+
+using namespace std;
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_util_cursor_advance;
+CPARSE_IMPORT_util_cursor_advance_internal;
+
+TEST_SUITE(cursor_advance);
+
+/**
+ * \brief Build a pseudo-random block with the given newline density.
+ */
+static string random_block(size_t size, int newline_percent, unsigned seed)
+{
+    string block;
+
+    srand(seed);
+    for (size_t i = 0; i < size; ++i)
+    {
+        block.push_back((rand() % 100 < newline_percent) ? '\n' : 'a');
+    }
+
+    return block;
+}
+
+/**
+ * Scanning an empty block finds no newlines.
+ */
+TEST(newline_scan_empty)
+{
+    size_t last = 99;
+
+    TEST_EXPECT(0 == newline_scan("", 0, &last));
+    TEST_EXPECT(0 == last);
+}
+
+/**
+ * Scanning a long block finds every newline and the last one.
+ */
+TEST(newline_scan_basics)
+{
+    string block(100, 'x');
+    size_t last;
+
+    block[3] = '\n';
+    block[40] = '\n';
+    block[77] = '\n';
+
+    TEST_EXPECT(3 == newline_scan(block.data(), block.size(), &last));
+    TEST_EXPECT(77 == last);
+}
+
+/**
+ * The vectorized and scalar scans return identical results.
+ */
+TEST(newline_scan_vectorized_matches_scalar)
+{
+    const int densities[] = { 0, 1, 10, 50, 100 };
+
+    for (size_t size = 0; size < 300; ++size)
+    {
+        for (int density : densities)
+        {
+            auto block = random_block(size, density, size * 101 + density);
+            size_t scalar_last, last;
+            size_t scalar_count =
+                newline_scan_scalar(block.data(), size, &scalar_last);
+
+            /* the dispatched scan matches. */
+            TEST_EXPECT(
+                scalar_count == newline_scan(block.data(), size, &last));
+            TEST_EXPECT(scalar_last == last);
+
+#if CPARSE_NEWLINE_SCAN_X86
+            /* the SSE2 scan matches. */
+            TEST_EXPECT(
+                scalar_count == newline_scan_sse2(block.data(), size, &last));
+            TEST_EXPECT(scalar_last == last);
+
+            /* the AVX2 scan matches, if this CPU supports it. */
+            if (__builtin_cpu_supports("avx2"))
+            {
+                TEST_EXPECT(
+                    scalar_count
+                        == newline_scan_avx2(block.data(), size, &last));
+                TEST_EXPECT(scalar_last == last);
+            }
+#endif
+        }
+    }
+}
+
+/**
+ * Advancing a cursor over a block matches advancing it one character at a
+ * time.
+ */
+TEST(cursor_advance_matches_character_advance)
+{
+    const int densities[] = { 0, 2, 25 };
+
+    for (size_t size = 0; size < 200; size += 7)
+    {
+        for (int density : densities)
+        {
+            auto block = random_block(size, density, size * 31 + density);
+            cursor expected, actual;
+
+            memset(&expected, 0, sizeof(expected));
+            expected.begin_line = expected.end_line = 3;
+            expected.begin_col = expected.end_col = 5;
+            expected.begin_offset = expected.end_offset = 11;
+            memcpy(&actual, &expected, sizeof(actual));
+
+            for (char ch : block)
+            {
+                cursor_advance_character(&expected, ch);
+            }
+
+            cursor_advance(&actual, block.data(), block.size());
+
+            TEST_EXPECT(expected.begin_line == actual.begin_line);
+            TEST_EXPECT(expected.begin_col == actual.begin_col);
+            TEST_EXPECT(expected.end_line == actual.end_line);
+            TEST_EXPECT(expected.end_col == actual.end_col);
+            TEST_EXPECT(11 + size == actual.begin_offset);
+            TEST_EXPECT(expected.begin_offset == actual.begin_offset);
+            TEST_EXPECT(expected.end_offset == actual.end_offset);
+        }
+    }
+}
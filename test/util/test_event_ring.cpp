@@ -0,0 +1,216 @@
+/**
+ * \file test/util/test_event_ring.cpp
+ *
+ * \brief Tests for the \ref event_ring type.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/cursor.h>
+#include <libcparse/event.h>
+#include <libcparse/event_copy.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/util/event_ring.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <thread>
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_copy;
+CPARSE_IMPORT_util_event_ring;
+
+TEST_SUITE(event_ring);
+
+/**
+ * \brief Create a whitespace event copy at the given line.
+ */
+static int make_copy(event_copy** cpy, unsigned int line)
+{
+    int retval, release_retval;
+    cursor c;
+    event ev;
+
+    memset(&c, 0, sizeof(c));
+    c.begin_line = line;
+
+    retval = event_init_for_whitespace_token(&ev, &c);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = event_copy_create(cpy, &ev);
+    release_retval = event_dispose(&ev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Get the line of a copied event.
+ */
+static unsigned int copy_line(const event_copy* cpy)
+{
+    return event_get_cursor(event_copy_get_event(cpy))->begin_line;
+}
+
+/**
+ * Test that we can create and release an event ring.
+ */
+TEST(create_release)
+{
+    event_ring* ring;
+
+    /* we can create the ring. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_create(&ring, 16));
+
+    /* it is not closed. */
+    TEST_EXPECT(!event_ring_is_closed(ring));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_release(ring));
+}
+
+/**
+ * Test that copies are popped in the order they were pushed, and that a
+ * finished ring reports that it is finished once drained.
+ */
+TEST(push_pop_order)
+{
+    event_ring* ring;
+    event_copy* cpy;
+
+    /* a capacity of 3 is rounded up to 4. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_create(&ring, 3));
+
+    /* fill the ring. */
+    for (unsigned int i = 1; i <= 4; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == make_copy(&cpy, i));
+        TEST_ASSERT(STATUS_SUCCESS == event_ring_push(ring, cpy));
+    }
+
+    /* finish the ring. */
+    event_ring_finish(ring);
+
+    /* drain the ring in order. */
+    for (unsigned int i = 1; i <= 4; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == event_ring_pop(&cpy, ring));
+        TEST_EXPECT(i == copy_line(cpy));
+        TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+    }
+
+    /* the ring is now finished. */
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_EVENT_RING_FINISHED == event_ring_pop(&cpy, ring));
+
+    /* after a reset, the ring can be reused. */
+    event_ring_reset(ring);
+    TEST_ASSERT(STATUS_SUCCESS == make_copy(&cpy, 5));
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_push(ring, cpy));
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_pop(&cpy, ring));
+    TEST_EXPECT(5 == copy_line(cpy));
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_release(ring));
+}
+
+/**
+ * Test that pushing to a full, closed ring fails, leaving the copy with the
+ * caller.
+ */
+TEST(closed_push)
+{
+    event_ring* ring;
+    event_copy* cpy;
+
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_create(&ring, 2));
+
+    /* fill the ring. */
+    for (unsigned int i = 1; i <= 2; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == make_copy(&cpy, i));
+        TEST_ASSERT(STATUS_SUCCESS == event_ring_push(ring, cpy));
+    }
+
+    /* close the ring. */
+    event_ring_close(ring);
+    TEST_EXPECT(event_ring_is_closed(ring));
+
+    /* pushing fails instead of waiting for space. */
+    TEST_ASSERT(STATUS_SUCCESS == make_copy(&cpy, 3));
+    TEST_EXPECT(
+        ERROR_LIBCPARSE_EVENT_RING_CLOSED == event_ring_push(ring, cpy));
+    TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+
+    /* releasing the ring releases the copies it still holds. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_release(ring));
+}
+
+/**
+ * Test that a producer thread can hand many copies to a consumer through a
+ * small ring without losing or reordering any of them.
+ */
+TEST(threaded_order)
+{
+    event_ring* ring;
+    event_copy* cpy;
+    const unsigned int COUNT = 100000;
+    int producer_status = STATUS_SUCCESS;
+    unsigned int expected = 0;
+    bool in_order = true;
+
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_create(&ring, 8));
+
+    std::thread producer([&]() {
+        for (unsigned int i = 0; i < COUNT; ++i)
+        {
+            event_copy* tmp;
+            producer_status = make_copy(&tmp, i);
+            if (STATUS_SUCCESS != producer_status)
+            {
+                break;
+            }
+
+            producer_status = event_ring_push(ring, tmp);
+            if (STATUS_SUCCESS != producer_status)
+            {
+                if (STATUS_SUCCESS != event_copy_release(tmp))
+                {
+                    producer_status = ERROR_LIBCPARSE_OUT_OF_MEMORY;
+                }
+
+                break;
+            }
+        }
+
+        event_ring_finish(ring);
+    });
+
+    while (STATUS_SUCCESS == event_ring_pop(&cpy, ring))
+    {
+        if (expected++ != copy_line(cpy))
+        {
+            in_order = false;
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == event_copy_release(cpy));
+    }
+
+    producer.join();
+
+    /* every copy arrived, in order. */
+    TEST_EXPECT(STATUS_SUCCESS == producer_status);
+    TEST_EXPECT(COUNT == expected);
+    TEST_EXPECT(in_order);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == event_ring_release(ring));
+}
@@ -0,0 +1,221 @@
+/**
+ * \file tools/event_reactor_bench/src/main.c
+ *
+ * \brief Main entry point for the event_reactor_bench tool.
+ *
+ * event_reactor_bench measures the cost of broadcasting a single event through
+ * an \ref event_reactor with 1, 2, and 8 subscribers.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/status_codes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+CPARSE_IMPORT_cursor;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
+
+#define DEFAULT_ITERATIONS 10000000UL
+#define MAX_SUBSCRIBERS 8
+
+static int count_callback(void* context, const event* ev);
+static int run_benchmark(
+    size_t subscribers, unsigned long iterations, double* ns_per_event);
+static double elapsed_ns(
+    const struct timespec* start, const struct timespec* end);
+
+/**
+ * \brief Main entry point for event_reactor_bench.
+ *
+ * \param argc              The argument count.
+ * \param argv              The argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    int retval;
+    unsigned long iterations = DEFAULT_ITERATIONS;
+    const size_t subscriber_counts[] = { 1, 2, 8 };
+    double ns_per_event;
+
+    /* the iteration count can be overridden on the command-line. */
+    if (argc > 1)
+    {
+        iterations = strtoul(argv[1], NULL, 10);
+        if (0 == iterations)
+        {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("%lu broadcasts per run.\n", iterations);
+
+    for (size_t i = 0; i < sizeof(subscriber_counts) / sizeof(size_t); ++i)
+    {
+        retval = run_benchmark(subscriber_counts[i], iterations, &ns_per_event);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Benchmark failed with status %d.\n", retval);
+            return 1;
+        }
+
+        printf(
+            "%zu subscriber(s): %.2f ns per event, %.2f ns per delivery.\n",
+            subscriber_counts[i], ns_per_event,
+            ns_per_event / subscriber_counts[i]);
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Run a single benchmark pass.
+ *
+ * \param subscribers       The number of subscribers to add to the reactor.
+ * \param iterations        The number of events to broadcast.
+ * \param ns_per_event      Pointer to receive the mean cost of a broadcast.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int run_benchmark(
+    size_t subscribers, unsigned long iterations, double* ns_per_event)
+{
+    int retval, release_retval;
+    event_reactor* er;
+    event_handler eh;
+    event ev;
+    cursor c;
+    volatile unsigned long counts[MAX_SUBSCRIBERS];
+    struct timespec start, end;
+
+    /* create the reactor. */
+    retval = event_reactor_create(&er);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* add the subscribers, each with its own counter. */
+    for (size_t i = 0; i < subscribers; ++i)
+    {
+        counts[i] = 0;
+
+        retval = event_handler_init(&eh, &count_callback, (void*)&counts[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_er;
+        }
+
+        retval = event_reactor_add(er, &eh);
+        release_retval = event_handler_dispose(&eh);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_er;
+        }
+        else if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+            goto cleanup_er;
+        }
+    }
+
+    /* create a dummy event. */
+    memset(&c, 0, sizeof(c));
+    retval = event_init_for_whitespace_token(&ev, &c);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_er;
+    }
+
+    /* warm up. */
+    for (unsigned long i = 0; i < iterations / 10; ++i)
+    {
+        retval = event_reactor_broadcast(er, &ev);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_ev;
+        }
+    }
+
+    /* time the broadcasts. */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < iterations; ++i)
+    {
+        retval = event_reactor_broadcast(er, &ev);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_ev;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    *ns_per_event = elapsed_ns(&start, &end) / iterations;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_ev;
+
+cleanup_ev:
+    release_retval = event_dispose(&ev);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_er:
+    release_retval = event_reactor_release(er);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Count an event.
+ *
+ * \param context           The counter for this subscriber.
+ * \param ev                The event to count.
+ *
+ * \returns STATUS_SUCCESS.
+ */
+static int count_callback(void* context, const event* ev)
+{
+    volatile unsigned long* count = (volatile unsigned long*)context;
+    (void)ev;
+
+    *count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Compute the elapsed time between two timestamps in nanoseconds.
+ *
+ * \param start             The start time.
+ * \param end               The end time.
+ *
+ * \returns the elapsed time in nanoseconds.
+ */
+static double elapsed_ns(
+    const struct timespec* start, const struct timespec* end)
+{
+    return
+        (double)(end->tv_sec - start->tv_sec) * 1e9
+            + (double)(end->tv_nsec - start->tv_nsec);
+}
@@ -51,7 +51,7 @@ int create_scanner_and_files(import_enum_config* config)
     }
 
     /* create an input stream from this descriptor. */
-    retval = input_stream_create_from_descriptor(&stream, fd);
+    retval = input_stream_create_from_buffered_descriptor(&stream, fd, 0);
     if (STATUS_SUCCESS != retval)
     {
         goto close_fd;
@@ -0,0 +1,479 @@
+/**
+ * \file tools/keyword_hash_gen/src/main.c
+ *
+ * \brief Main entry point for the keyword_hash_gen tool.
+ *
+ * keyword_hash_gen generates the perfect hash table that the
+ * \ref preprocessor_scanner uses to classify identifiers as C keywords,
+ * preprocessor keywords, or string / char prefixes. The hash is keyed on the
+ * length and on the first, second, and last characters of a word. The
+ * generator searches for a table of per-character weights under which every
+ * word lands in its own slot.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEYWORD_SLOTS 64
+#define MAX_ITERATIONS 10000000UL
+
+#define FLAG_INCLUDE 0x0001
+#define FLAG_STRING_PREFIX 0x0002
+#define FLAG_CHAR_PREFIX 0x0004
+
+typedef struct keyword_spec keyword_spec;
+
+/**
+ * \brief A word to place in the table, along with its classification.
+ */
+struct keyword_spec
+{
+    const char* word;
+    const char* keyword_ctor;
+    const char* preprocessor_ctor;
+    int flags;
+};
+
+/**
+ * \brief Every word recognized by the preprocessor scanner.
+ */
+static const keyword_spec specs[] = {
+    { "L", NULL, NULL, FLAG_STRING_PREFIX | FLAG_CHAR_PREFIX },
+    { "U", NULL, NULL, FLAG_STRING_PREFIX | FLAG_CHAR_PREFIX },
+    { "_Alignas", "event_init_for_token_keyword__Alignas", NULL, 0 },
+    { "_Alignof", "event_init_for_token_keyword__Alignof", NULL, 0 },
+    { "_Atomic", "event_init_for_token_keyword__Atomic", NULL, 0 },
+    { "_Bool", "event_init_for_token_keyword__Bool", NULL, 0 },
+    { "_Complex", "event_init_for_token_keyword__Complex", NULL, 0 },
+    { "_Generic", "event_init_for_token_keyword__Generic", NULL, 0 },
+    { "_Imaginary", "event_init_for_token_keyword__Imaginary", NULL, 0 },
+    { "_Noreturn", "event_init_for_token_keyword__Noreturn", NULL, 0 },
+    { "_Static_assert",
+      "event_init_for_token_keyword__Static_assert", NULL, 0 },
+    { "_Thread_local", "event_init_for_token_keyword__Thread_local", NULL, 0 },
+    { "auto", "event_init_for_token_keyword_auto", NULL, 0 },
+    { "break", "event_init_for_token_keyword_break", NULL, 0 },
+    { "case", "event_init_for_token_keyword_case", NULL, 0 },
+    { "char", "event_init_for_token_keyword_char", NULL, 0 },
+    { "const", "event_init_for_token_keyword_const", NULL, 0 },
+    { "continue", "event_init_for_token_keyword_continue", NULL, 0 },
+    { "default", "event_init_for_token_keyword_default", NULL, 0 },
+    { "define", NULL, "event_init_for_token_preprocessor_id_define", 0 },
+    { "do", "event_init_for_token_keyword_do", NULL, 0 },
+    { "double", "event_init_for_token_keyword_double", NULL, 0 },
+    { "elif", NULL, "event_init_for_token_preprocessor_id_elif", 0 },
+    { "else", "event_init_for_token_keyword_else",
+      "event_init_for_token_preprocessor_id_else", 0 },
+    { "endif", NULL, "event_init_for_token_preprocessor_id_endif", 0 },
+    { "enum", "event_init_for_token_keyword_enum", NULL, 0 },
+    { "error", NULL, "event_init_for_token_preprocessor_id_error", 0 },
+    { "extern", "event_init_for_token_keyword_extern", NULL, 0 },
+    { "float", "event_init_for_token_keyword_float", NULL, 0 },
+    { "for", "event_init_for_token_keyword_for", NULL, 0 },
+    { "goto", "event_init_for_token_keyword_goto", NULL, 0 },
+    { "if", "event_init_for_token_keyword_if",
+      "event_init_for_token_preprocessor_id_if", 0 },
+    { "ifdef", NULL, "event_init_for_token_preprocessor_id_ifdef", 0 },
+    { "ifndef", NULL, "event_init_for_token_preprocessor_id_ifndef", 0 },
+    { "include", NULL, "event_init_for_token_preprocessor_id_include",
+      FLAG_INCLUDE },
+    { "inline", "event_init_for_token_keyword_inline", NULL, 0 },
+    { "int", "event_init_for_token_keyword_int", NULL, 0 },
+    { "line", NULL, "event_init_for_token_preprocessor_id_line", 0 },
+    { "long", "event_init_for_token_keyword_long", NULL, 0 },
+    { "pragma", NULL, "event_init_for_token_preprocessor_id_pragma", 0 },
+    { "register", "event_init_for_token_keyword_register", NULL, 0 },
+    { "restrict", "event_init_for_token_keyword_restrict", NULL, 0 },
+    { "return", "event_init_for_token_keyword_return", NULL, 0 },
+    { "short", "event_init_for_token_keyword_short", NULL, 0 },
+    { "signed", "event_init_for_token_keyword_signed", NULL, 0 },
+    { "sizeof", "event_init_for_token_keyword_sizeof", NULL, 0 },
+    { "static", "event_init_for_token_keyword_static", NULL, 0 },
+    { "struct", "event_init_for_token_keyword_struct", NULL, 0 },
+    { "switch", "event_init_for_token_keyword_switch", NULL, 0 },
+    { "typedef", "event_init_for_token_keyword_typedef", NULL, 0 },
+    { "u", NULL, NULL, FLAG_STRING_PREFIX | FLAG_CHAR_PREFIX },
+    { "u8", NULL, NULL, FLAG_STRING_PREFIX },
+    { "undef", NULL, "event_init_for_token_preprocessor_id_undef", 0 },
+    { "union", "event_init_for_token_keyword_union", NULL, 0 },
+    { "unsigned", "event_init_for_token_keyword_unsigned", NULL, 0 },
+    { "void", "event_init_for_token_keyword_void", NULL, 0 },
+    { "volatile", "event_init_for_token_keyword_volatile", NULL, 0 },
+    { "while", "event_init_for_token_keyword_while", NULL, 0 },
+};
+
+#define SPEC_COUNT (sizeof(specs) / sizeof(specs[0]))
+
+static uint8_t weights[256];
+static uint32_t rng_state = 0x2545F491;
+
+static size_t hash(const char* word);
+static size_t collisions(void);
+static uint32_t rng_next(void);
+static bool search(void);
+static int write_table(FILE* out);
+static void write_flags(FILE* out, int flags);
+
+/**
+ * \brief Main entry point for keyword_hash_gen.
+ *
+ * \param argc              The argument count.
+ * \param argv              The argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    FILE* out;
+    int retval;
+
+    if (2 != argc)
+    {
+        fprintf(stderr, "usage: %s output.c\n", argv[0]);
+        return 1;
+    }
+
+    /* find weights for which the hash is perfect. */
+    if (!search())
+    {
+        fprintf(stderr, "No perfect hash found.\n");
+        return 1;
+    }
+
+    /* open the output file. */
+    out = fopen(argv[1], "w");
+    if (NULL == out)
+    {
+        fprintf(stderr, "Could not open %s for writing.\n", argv[1]);
+        return 1;
+    }
+
+    /* write the table. */
+    retval = write_table(out);
+    if (0 != fclose(out))
+    {
+        retval = 1;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Hash a word using the current weights.
+ *
+ * This must match preprocessor_scanner_keyword_lookup.
+ *
+ * \param word              The word to hash.
+ *
+ * \returns the slot for this word.
+ */
+static size_t hash(const char* word)
+{
+    size_t size = strlen(word);
+    size_t slot = size;
+
+    slot += weights[(uint8_t)word[0]];
+    slot += weights[(uint8_t)word[size - 1]];
+    if (size > 1)
+    {
+        slot += weights[(uint8_t)word[1]];
+    }
+
+    return slot & (KEYWORD_SLOTS - 1);
+}
+
+/**
+ * \brief Count the words that share a slot with an earlier word.
+ *
+ * \returns the number of collisions under the current weights.
+ */
+static size_t collisions(void)
+{
+    bool used[KEYWORD_SLOTS];
+    size_t count = 0;
+
+    memset(used, 0, sizeof(used));
+    for (size_t i = 0; i < SPEC_COUNT; ++i)
+    {
+        size_t slot = hash(specs[i].word);
+
+        if (used[slot])
+        {
+            ++count;
+        }
+
+        used[slot] = true;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Get the next value from a fixed xorshift sequence, so that the
+ * generated table is the same on every run.
+ *
+ * \returns the next pseudo-random value.
+ */
+static uint32_t rng_next(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+/**
+ * \brief Search for weights which place every word in its own slot.
+ *
+ * Each step picks a word and re-rolls the weight of one of its hashed
+ * characters, keeping the change unless it adds collisions.
+ *
+ * \returns true if a perfect hash was found, or false otherwise.
+ */
+static bool search(void)
+{
+    size_t count = collisions();
+
+    for (unsigned long i = 0; i < MAX_ITERATIONS && count > 0; ++i)
+    {
+        const char* word = specs[rng_next() % SPEC_COUNT].word;
+        size_t size = strlen(word);
+        uint8_t ch;
+        uint8_t old;
+        size_t next;
+
+        switch (rng_next() % 3)
+        {
+            case 0:
+                ch = (uint8_t)word[0];
+                break;
+
+            case 1:
+                ch = (uint8_t)word[size - 1];
+                break;
+
+            default:
+                ch = (uint8_t)word[size > 1 ? 1 : 0];
+                break;
+        }
+
+        old = weights[ch];
+        weights[ch] = (uint8_t)(rng_next() % KEYWORD_SLOTS);
+
+        next = collisions();
+        if (next > count)
+        {
+            weights[ch] = old;
+        }
+        else
+        {
+            count = next;
+        }
+    }
+
+    return 0 == count;
+}
+
+/**
+ * \brief Write the generated source file.
+ *
+ * \param out               The output file.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int write_table(FILE* out)
+{
+    size_t max_size = 0;
+
+    fprintf(out,
+        "/**\n"
+        " * \\file src/preprocessor_scanner/"
+            "preprocessor_scanner_keyword_lookup.c\n"
+        " *\n"
+        " * \\brief Perfect hash lookup of preprocessor scanner keywords.\n"
+        " *\n"
+        " * This file is generated by tools/keyword_hash_gen. Do not edit "
+            "it by hand;\n"
+        " * instead, update the generator and run the keyword_hash "
+            "target.\n"
+        " *\n"
+        " * \\copyright 2023 Justin Handville.  Please see license.txt in "
+            "this\n"
+        " * distribution for the license terms under which this software "
+            "is distributed.\n"
+        " */\n"
+        "\n"
+        "#include <libcparse/event.h>\n"
+        "#include <stdint.h>\n"
+        "#include <string.h>\n"
+        "\n"
+        "#include \"preprocessor_scanner_internal.h\"\n"
+        "\n"
+        "CPARSE_IMPORT_event;\n"
+        "CPARSE_IMPORT_preprocessor_scanner_internal;\n"
+        "\n");
+
+    for (size_t i = 0; i < SPEC_COUNT; ++i)
+    {
+        size_t size = strlen(specs[i].word);
+        if (size > max_size)
+        {
+            max_size = size;
+        }
+    }
+
+    fprintf(out, "#define KEYWORD_SLOTS %d\n", KEYWORD_SLOTS);
+    fprintf(out, "#define KEYWORD_MAX_SIZE %zu\n\n", max_size);
+
+    /* write the character weights. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The hash weight of each character.\n"
+        " */\n"
+        "static const uint8_t weights[256] = {\n");
+    for (size_t i = 0; i < 256; i += 16)
+    {
+        fprintf(out, "   ");
+        for (size_t j = i; j < i + 16; ++j)
+        {
+            fprintf(out, " %2u,", weights[j]);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    /* write the keyword table. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The keyword table, indexed by hash slot.\n"
+        " */\n"
+        "static const preprocessor_scanner_keyword "
+            "keywords[KEYWORD_SLOTS] = {\n");
+    for (size_t slot = 0; slot < KEYWORD_SLOTS; ++slot)
+    {
+        for (size_t i = 0; i < SPEC_COUNT; ++i)
+        {
+            const keyword_spec* spec = &specs[i];
+
+            if (hash(spec->word) != slot)
+            {
+                continue;
+            }
+
+            fprintf(out, "    [%zu] = {\n", slot);
+            fprintf(
+                out, "        \"%s\", %zu,\n", spec->word, strlen(spec->word));
+            if (NULL != spec->keyword_ctor)
+            {
+                fprintf(out, "        &%s,\n", spec->keyword_ctor);
+            }
+            else
+            {
+                fprintf(out, "        NULL,\n");
+            }
+            if (NULL != spec->preprocessor_ctor)
+            {
+                fprintf(out, "        &%s,\n", spec->preprocessor_ctor);
+            }
+            else
+            {
+                fprintf(out, "        NULL,\n");
+            }
+            write_flags(out, spec->flags);
+        }
+    }
+    fprintf(out, "};\n\n");
+
+    /* write the lookup function. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief Classify an identifier as a keyword, a preprocessor "
+            "keyword, or a\n"
+        " * string or char prefix.\n"
+        " *\n"
+        " * \\param str               The identifier to look up.\n"
+        " * \\param size              The size of the identifier.\n"
+        " *\n"
+        " * \\returns the keyword entry for this identifier, or NULL if it "
+            "is a plain\n"
+        " * identifier.\n"
+        " */\n"
+        "const CPARSE_SYM(preprocessor_scanner_keyword)*\n"
+        "CPARSE_SYM(preprocessor_scanner_keyword_lookup)(\n"
+        "    const char* str, size_t size)\n"
+        "{\n"
+        "    const preprocessor_scanner_keyword* entry;\n"
+        "    size_t slot;\n"
+        "\n"
+        "    /* no keyword is empty or longer than the longest keyword. */\n"
+        "    if (0 == size || size > KEYWORD_MAX_SIZE)\n"
+        "    {\n"
+        "        return NULL;\n"
+        "    }\n"
+        "\n"
+        "    /* hash the length and the first, second, and last "
+            "characters. */\n"
+        "    slot = size;\n"
+        "    slot += weights[(uint8_t)str[0]];\n"
+        "    slot += weights[(uint8_t)str[size - 1]];\n"
+        "    if (size > 1)\n"
+        "    {\n"
+        "        slot += weights[(uint8_t)str[1]];\n"
+        "    }\n"
+        "\n"
+        "    /* only the word in this slot can match. */\n"
+        "    entry = &keywords[slot & (KEYWORD_SLOTS - 1)];\n"
+        "    if (entry->size != size || 0 != memcmp(entry->word, str, size))\n"
+        "    {\n"
+        "        return NULL;\n"
+        "    }\n"
+        "\n"
+        "    return entry;\n"
+        "}\n");
+
+    return ferror(out) ? 1 : 0;
+}
+
+/**
+ * \brief Write the flags of a table entry.
+ *
+ * \param out               The output file.
+ * \param flags             The flags to write.
+ */
+static void write_flags(FILE* out, int flags)
+{
+    const char* sep = "        ";
+
+    if (0 == flags)
+    {
+        fprintf(out, "        0 },\n");
+        return;
+    }
+
+    if (flags & FLAG_INCLUDE)
+    {
+        fprintf(out, "%sCPARSE_PREPROCESSOR_SCANNER_KEYWORD_INCLUDE", sep);
+        sep = "\n          | ";
+    }
+
+    if (flags & FLAG_STRING_PREFIX)
+    {
+        fprintf(
+            out, "%sCPARSE_PREPROCESSOR_SCANNER_KEYWORD_STRING_PREFIX", sep);
+        sep = "\n          | ";
+    }
+
+    if (flags & FLAG_CHAR_PREFIX)
+    {
+        fprintf(out, "%sCPARSE_PREPROCESSOR_SCANNER_KEYWORD_CHAR_PREFIX", sep);
+    }
+
+    fprintf(out, " },\n");
+}
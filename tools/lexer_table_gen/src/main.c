@@ -0,0 +1,1369 @@
+/**
+ * \file tools/lexer_table_gen/src/main.c
+ *
+ * \brief Main entry point for the lexer_table_gen tool.
+ *
+ * lexer_table_gen generates the tables that drive the \ref preprocessor_scanner
+ * raw character lexer: a 256-entry character class table, and a state by class
+ * transition table of action codes. The scanner's behavior is written here once
+ * as a decision function over a state and a single character. The generator
+ * evaluates this function for every character, checks that the characters in
+ * each class behave alike, and writes one transition per state and class.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../../src/preprocessor_scanner/preprocessor_scanner_internal.h"
+
+CPARSE_IMPORT_preprocessor_scanner_internal;
+
+#define STATE_COUNT CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT
+#define CLASS_COUNT CPARSE_PREPROCESSOR_SCANNER_CLASS_COUNT
+
+/**
+ * \brief Every token constructor that a transition can broadcast.
+ */
+static const char* tokens[] = {
+    "event_init_for_token_left_paren",
+    "event_init_for_token_right_paren",
+    "event_init_for_token_left_brace",
+    "event_init_for_token_right_brace",
+    "event_init_for_token_left_bracket",
+    "event_init_for_token_right_bracket",
+    "event_init_for_token_comma",
+    "event_init_for_token_colon",
+    "event_init_for_token_semicolon",
+    "event_init_for_token_question",
+    "event_init_for_token_dot",
+    "event_init_for_token_ellipsis",
+    "event_init_for_token_arrow",
+    "event_init_for_token_minus_equal",
+    "event_init_for_token_decrement",
+    "event_init_for_token_minus",
+    "event_init_for_token_plus_equal",
+    "event_init_for_token_increment",
+    "event_init_for_token_plus",
+    "event_init_for_token_times_equal",
+    "event_init_for_token_star",
+    "event_init_for_token_div_equal",
+    "event_init_for_token_forward_slash",
+    "event_init_for_token_mod_equal",
+    "event_init_for_token_percent",
+    "event_init_for_token_preprocessor_hash",
+    "event_init_for_token_preprocessor_string_concat",
+    "event_init_for_token_logical_and",
+    "event_init_for_token_and_equal",
+    "event_init_for_token_ampersand",
+    "event_init_for_token_logical_or",
+    "event_init_for_token_or_equal",
+    "event_init_for_token_pipe",
+    "event_init_for_token_xor_equal",
+    "event_init_for_token_caret",
+    "event_init_for_token_compl_equal",
+    "event_init_for_token_tilde",
+    "event_init_for_token_equal_compare",
+    "event_init_for_token_equal_assign",
+    "event_init_for_token_not_equal_compare",
+    "event_init_for_token_not",
+    "event_init_for_token_less_than_equal",
+    "event_init_for_token_less_than",
+    "event_init_for_token_left_shift_equal",
+    "event_init_for_token_bitshift_left",
+    "event_init_for_token_greater_than_equal",
+    "event_init_for_token_greater_than",
+    "event_init_for_token_right_shift_equal",
+    "event_init_for_token_bitshift_right",
+};
+
+#define TOKEN_COUNT (sizeof(tokens) / sizeof(tokens[0]))
+
+/* shorter names for the number states. */
+#define INTEGER_U CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U
+#define INTEGER_UL CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL
+#define INTEGER_L CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L
+#define INTEGER_LL CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL
+#define INTEGER_END CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END
+#define E_EXPECT_DIGIT CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_EXPECT_DIGIT
+#define E_SIGN_EXPECT_DIGIT \
+    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_SIGN_EXPECT_DIGIT
+#define E_WITH_DIGIT CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT
+#define HEX_P_EXPECT_DIGIT \
+    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT
+#define HEX_P_SIGN_EXPECT_DIGIT \
+    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_S_EXPECT_DIGIT
+#define HEX_P_WITH_DIGIT \
+    CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT
+
+/* shorter names for the punctuator actions. */
+#define SIMPLE CPARSE_PREPROCESSOR_SCANNER_ACTION_SIMPLE_TOKEN
+#define COMPOUND CPARSE_PREPROCESSOR_SCANNER_ACTION_COMPOUND_TOKEN
+#define CACHED CPARSE_PREPROCESSOR_SCANNER_ACTION_CACHED_TOKEN
+#define START CPARSE_PREPROCESSOR_SCANNER_ACTION_START_STATE
+#define TRANSITION CPARSE_PREPROCESSOR_SCANNER_ACTION_TRANSITION_STATE
+#define S(x) CPARSE_PREPROCESSOR_SCANNER_STATE_ ## x
+#define T(x) "event_init_for_token_" #x
+
+typedef struct punctuator_spec punctuator_spec;
+
+/**
+ * \brief How a punctuator state handles a character.
+ *
+ * A character of 0 matches any character not otherwise listed for the state.
+ * If a token is given, then the transition broadcasts it; otherwise, the
+ * transition enters the next state.
+ */
+struct punctuator_spec
+{
+    int state;
+    int ch;
+    int action;
+    int next;
+    const char* token;
+};
+
+/**
+ * \brief The punctuator characters in the init state.
+ */
+static const punctuator_spec init_specs[] = {
+    { S(INIT), '0', CPARSE_PREPROCESSOR_SCANNER_ACTION_START_ZERO_INTEGER, 0,
+      NULL },
+    { S(INIT), '(', SIMPLE, 0, T(left_paren) },
+    { S(INIT), ')', SIMPLE, 0, T(right_paren) },
+    { S(INIT), '{', SIMPLE, 0, T(left_brace) },
+    { S(INIT), '}', SIMPLE, 0, T(right_brace) },
+    { S(INIT), '[', SIMPLE, 0, T(left_bracket) },
+    { S(INIT), ']', SIMPLE, 0, T(right_bracket) },
+    { S(INIT), ',', SIMPLE, 0, T(comma) },
+    { S(INIT), ':', START, S(IN_COLON), NULL },
+    { S(INIT), ';', SIMPLE, 0, T(semicolon) },
+    { S(INIT), '.', START, S(IN_DOT), NULL },
+    { S(INIT), '-', START, S(IN_DASH), NULL },
+    { S(INIT), '+', START, S(IN_PLUS), NULL },
+    { S(INIT), '*', START, S(IN_STAR), NULL },
+    { S(INIT), '/', START, S(IN_SLASH), NULL },
+    { S(INIT), '%', START, S(IN_PERCENT), NULL },
+    { S(INIT), '&', START, S(IN_AMPERSAND), NULL },
+    { S(INIT), '|', START, S(IN_PIPE), NULL },
+    { S(INIT), '^', START, S(IN_CARET), NULL },
+    { S(INIT), '~', START, S(IN_TILDE), NULL },
+    { S(INIT), '?', SIMPLE, 0, T(question) },
+    { S(INIT), '=', START, S(IN_EQUAL), NULL },
+    { S(INIT), '!', START, S(IN_NOT), NULL },
+    { S(INIT), '<', CPARSE_PREPROCESSOR_SCANNER_ACTION_START_LT, 0, NULL },
+    { S(INIT), '>', START, S(IN_GT), NULL },
+    { S(INIT), '"', CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN,
+      S(IN_STRING), NULL },
+    { S(INIT), '\'', CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN,
+      S(IN_CHAR), NULL },
+    { S(INIT), '#', CPARSE_PREPROCESSOR_SCANNER_ACTION_START_INLINE_HASH, 0,
+      NULL },
+};
+
+#define INIT_SPEC_COUNT (sizeof(init_specs) / sizeof(init_specs[0]))
+
+/**
+ * \brief The characters which extend or end a punctuator.
+ */
+static const punctuator_spec punctuator_specs[] = {
+    { S(IN_DOT), '.', TRANSITION, S(IN_DOT_DOT), NULL },
+    { S(IN_DOT), 0, CACHED, 0, T(dot) },
+    { S(IN_DOT_DOT), '.', COMPOUND, 0, T(ellipsis) },
+    { S(IN_DOT_DOT), 0,
+      CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER, 0, NULL },
+    { S(IN_DASH), '>', COMPOUND, 0, T(arrow) },
+    { S(IN_DASH), '=', COMPOUND, 0, T(minus_equal) },
+    { S(IN_DASH), '-', COMPOUND, 0, T(decrement) },
+    { S(IN_DASH), 0, CACHED, 0, T(minus) },
+    { S(IN_COLON), '>', COMPOUND, 0, T(right_bracket) },
+    { S(IN_COLON), 0, CACHED, 0, T(colon) },
+    { S(IN_PLUS), '=', COMPOUND, 0, T(plus_equal) },
+    { S(IN_PLUS), '+', COMPOUND, 0, T(increment) },
+    { S(IN_PLUS), 0, CACHED, 0, T(plus) },
+    { S(IN_STAR), '=', COMPOUND, 0, T(times_equal) },
+    { S(IN_STAR), 0, CACHED, 0, T(star) },
+    { S(IN_SLASH), '=', COMPOUND, 0, T(div_equal) },
+    { S(IN_SLASH), 0, CACHED, 0, T(forward_slash) },
+    { S(IN_PERCENT), '=', COMPOUND, 0, T(mod_equal) },
+    { S(IN_PERCENT), '>', COMPOUND, 0, T(right_brace) },
+    { S(IN_PERCENT), ':', TRANSITION, S(IN_PERCENT_COLON), NULL },
+    { S(IN_PERCENT), 0, CACHED, 0, T(percent) },
+    { S(IN_PERCENT_COLON), '%', TRANSITION, S(IN_PERCENT_COLON_PERCENT),
+      NULL },
+    { S(IN_PERCENT_COLON), 0, CACHED, 0, T(preprocessor_hash) },
+    { S(IN_PERCENT_COLON_PERCENT), ':', COMPOUND, 0,
+      T(preprocessor_string_concat) },
+    { S(IN_PERCENT_COLON_PERCENT), 0,
+      CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_CHARACTER, 0, NULL },
+    { S(IN_AMPERSAND), '&', COMPOUND, 0, T(logical_and) },
+    { S(IN_AMPERSAND), '=', COMPOUND, 0, T(and_equal) },
+    { S(IN_AMPERSAND), 0, CACHED, 0, T(ampersand) },
+    { S(IN_PIPE), '|', COMPOUND, 0, T(logical_or) },
+    { S(IN_PIPE), '=', COMPOUND, 0, T(or_equal) },
+    { S(IN_PIPE), 0, CACHED, 0, T(pipe) },
+    { S(IN_CARET), '=', COMPOUND, 0, T(xor_equal) },
+    { S(IN_CARET), 0, CACHED, 0, T(caret) },
+    { S(IN_TILDE), '=', COMPOUND, 0, T(compl_equal) },
+    { S(IN_TILDE), 0, CACHED, 0, T(tilde) },
+    { S(IN_EQUAL), '=', COMPOUND, 0, T(equal_compare) },
+    { S(IN_EQUAL), 0, CACHED, 0, T(equal_assign) },
+    { S(IN_NOT), '=', COMPOUND, 0, T(not_equal_compare) },
+    { S(IN_NOT), 0, CACHED, 0, T(not) },
+    { S(IN_LT), '<', TRANSITION, S(IN_LT_LT), NULL },
+    { S(IN_LT), '=', COMPOUND, 0, T(less_than_equal) },
+    { S(IN_LT), ':', COMPOUND, 0, T(left_bracket) },
+    { S(IN_LT), '%', COMPOUND, 0, T(left_brace) },
+    { S(IN_LT), 0, CACHED, 0, T(less_than) },
+    { S(IN_LT_LT), '=', COMPOUND, 0, T(left_shift_equal) },
+    { S(IN_LT_LT), 0, CACHED, 0, T(bitshift_left) },
+    { S(IN_GT), '>', TRANSITION, S(IN_GT_GT), NULL },
+    { S(IN_GT), '=', COMPOUND, 0, T(greater_than_equal) },
+    { S(IN_GT), 0, CACHED, 0, T(greater_than) },
+    { S(IN_GT_GT), '=', COMPOUND, 0, T(right_shift_equal) },
+    { S(IN_GT_GT), 0, CACHED, 0, T(bitshift_right) },
+};
+
+#define PUNCTUATOR_SPEC_COUNT \
+    (sizeof(punctuator_specs) / sizeof(punctuator_specs[0]))
+
+typedef struct literal_states literal_states;
+
+/**
+ * \brief The states of a string or character literal.
+ *
+ * The digits of a little u escape are in the four states starting at
+ * little_u, and the digits of a big u escape are in the eight states starting
+ * at big_u.
+ */
+struct literal_states
+{
+    int base;
+    int slash;
+    int octal_1;
+    int octal_2;
+    int hex;
+    int hex_opt;
+    int little_u;
+    int big_u;
+    int quote;
+    int end;
+};
+
+static const literal_states string_states = {
+    S(IN_STRING), S(IN_STRING_SLASH), S(IN_STRING_OCTAL_1),
+    S(IN_STRING_OCTAL_2), S(IN_STRING_HEX), S(IN_STRING_HEX_OPT),
+    S(IN_STRING_LITTLE_U), S(IN_STRING_BIG_U), '"',
+    CPARSE_PREPROCESSOR_SCANNER_ACTION_END_STRING };
+
+static const literal_states char_states = {
+    S(IN_CHAR), S(IN_CHAR_SLASH), S(IN_CHAR_OCTAL_1), S(IN_CHAR_OCTAL_2),
+    S(IN_CHAR_HEX), S(IN_CHAR_HEX_OPT), S(IN_CHAR_LITTLE_U), S(IN_CHAR_BIG_U),
+    '\'', CPARSE_PREPROCESSOR_SCANNER_ACTION_END_CHAR };
+
+static uint8_t char_class(int ch);
+static bool is_alpha(int ch);
+static bool is_digit(int ch);
+static bool is_xdigit(int ch);
+static bool is_octal(int ch);
+static preprocessor_scanner_transition decide(int state, int ch);
+static preprocessor_scanner_transition act(int action, int state);
+static preprocessor_scanner_transition token(int action, const char* ctor);
+static preprocessor_scanner_transition decide_init(int ch);
+static preprocessor_scanner_transition decide_punctuator(int state, int ch);
+static preprocessor_scanner_transition decide_literal(int state, int ch);
+static preprocessor_scanner_transition decide_number(int state, int ch);
+static preprocessor_scanner_transition integer_suffix(int state, int ch);
+static preprocessor_scanner_transition float_suffix(int ch);
+static preprocessor_scanner_transition spec_transition(
+    const punctuator_spec* spec);
+static uint8_t run_of(int state);
+static bool in_run(int run, int ch);
+static bool build(preprocessor_scanner_transition* table);
+static bool verify_runs(const preprocessor_scanner_transition* table);
+static int write_tables(
+    FILE* out, const preprocessor_scanner_transition* table);
+
+/**
+ * \brief Main entry point for lexer_table_gen.
+ *
+ * \param argc              The argument count.
+ * \param argv              The argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    static preprocessor_scanner_transition table[STATE_COUNT * CLASS_COUNT];
+    FILE* out;
+    int retval;
+
+    if (2 != argc)
+    {
+        fprintf(stderr, "usage: %s output.c\n", argv[0]);
+        return 1;
+    }
+
+    /* build the transition table. */
+    if (!build(table))
+    {
+        return 1;
+    }
+
+    /* verify that each run only continues the current token. */
+    if (!verify_runs(table))
+    {
+        return 1;
+    }
+
+    /* open the output file. */
+    out = fopen(argv[1], "w");
+    if (NULL == out)
+    {
+        fprintf(stderr, "Could not open %s for writing.\n", argv[1]);
+        return 1;
+    }
+
+    /* write the tables. */
+    retval = write_tables(out, table);
+    if (0 != fclose(out))
+    {
+        retval = 1;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Return true if this is an ASCII letter.
+ */
+static bool is_alpha(int ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+/**
+ * \brief Return true if this is a decimal digit.
+ */
+static bool is_digit(int ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+/**
+ * \brief Return true if this is a hex digit.
+ */
+static bool is_xdigit(int ch)
+{
+    return
+        is_digit(ch) || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+}
+
+/**
+ * \brief Return true if this is an octal digit.
+ */
+static bool is_octal(int ch)
+{
+    return ch >= '0' && ch <= '7';
+}
+
+/**
+ * \brief Get the character class of a character.
+ *
+ * \param ch                The character to classify.
+ *
+ * \returns the class of this character.
+ */
+static uint8_t char_class(int ch)
+{
+    switch (ch)
+    {
+        case '0': return CPARSE_PREPROCESSOR_SCANNER_CLASS_ZERO;
+        case '8':
+        case '9': return CPARSE_PREPROCESSOR_SCANNER_CLASS_DECIMAL_DIGIT;
+        case 'a':
+        case 'b': return CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_ESCAPE;
+        case 'c':
+        case 'd':
+        case 'A':
+        case 'B':
+        case 'C':
+        case 'D': return CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_ALPHA;
+        case 'e':
+        case 'E': return CPARSE_PREPROCESSOR_SCANNER_CLASS_EXPONENT;
+        case 'f': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LITTLE_F;
+        case 'F': return CPARSE_PREPROCESSOR_SCANNER_CLASS_BIG_F;
+        case 'l':
+        case 'L': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LONG;
+        case 'u': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LITTLE_U;
+        case 'U': return CPARSE_PREPROCESSOR_SCANNER_CLASS_BIG_U;
+        case 'x':
+        case 'X': return CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_PREFIX;
+        case 'p':
+        case 'P': return CPARSE_PREPROCESSOR_SCANNER_CLASS_HEX_EXPONENT;
+        case 'n':
+        case 'r':
+        case 't':
+        case 'v': return CPARSE_PREPROCESSOR_SCANNER_CLASS_ESCAPE;
+        case '_': return CPARSE_PREPROCESSOR_SCANNER_CLASS_UNDERSCORE;
+        case '(': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_PAREN;
+        case ')': return CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_PAREN;
+        case '{': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_BRACE;
+        case '}': return CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_BRACE;
+        case '[': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LEFT_BRACKET;
+        case ']': return CPARSE_PREPROCESSOR_SCANNER_CLASS_RIGHT_BRACKET;
+        case ',': return CPARSE_PREPROCESSOR_SCANNER_CLASS_COMMA;
+        case ':': return CPARSE_PREPROCESSOR_SCANNER_CLASS_COLON;
+        case ';': return CPARSE_PREPROCESSOR_SCANNER_CLASS_SEMICOLON;
+        case '.': return CPARSE_PREPROCESSOR_SCANNER_CLASS_DOT;
+        case '-': return CPARSE_PREPROCESSOR_SCANNER_CLASS_DASH;
+        case '+': return CPARSE_PREPROCESSOR_SCANNER_CLASS_PLUS;
+        case '*': return CPARSE_PREPROCESSOR_SCANNER_CLASS_STAR;
+        case '/': return CPARSE_PREPROCESSOR_SCANNER_CLASS_SLASH;
+        case '%': return CPARSE_PREPROCESSOR_SCANNER_CLASS_PERCENT;
+        case '&': return CPARSE_PREPROCESSOR_SCANNER_CLASS_AMPERSAND;
+        case '|': return CPARSE_PREPROCESSOR_SCANNER_CLASS_PIPE;
+        case '^': return CPARSE_PREPROCESSOR_SCANNER_CLASS_CARET;
+        case '~': return CPARSE_PREPROCESSOR_SCANNER_CLASS_TILDE;
+        case '?': return CPARSE_PREPROCESSOR_SCANNER_CLASS_QUESTION;
+        case '=': return CPARSE_PREPROCESSOR_SCANNER_CLASS_EQUAL;
+        case '!': return CPARSE_PREPROCESSOR_SCANNER_CLASS_NOT;
+        case '<': return CPARSE_PREPROCESSOR_SCANNER_CLASS_LT;
+        case '>': return CPARSE_PREPROCESSOR_SCANNER_CLASS_GT;
+        case '"': return CPARSE_PREPROCESSOR_SCANNER_CLASS_DOUBLE_QUOTE;
+        case '\'': return CPARSE_PREPROCESSOR_SCANNER_CLASS_SINGLE_QUOTE;
+        case '#': return CPARSE_PREPROCESSOR_SCANNER_CLASS_HASH;
+        case '\\': return CPARSE_PREPROCESSOR_SCANNER_CLASS_BACKSLASH;
+    }
+
+    if (ch >= '1' && ch <= '7')
+    {
+        return CPARSE_PREPROCESSOR_SCANNER_CLASS_OCTAL_DIGIT;
+    }
+    else if (is_alpha(ch))
+    {
+        return CPARSE_PREPROCESSOR_SCANNER_CLASS_ALPHA;
+    }
+    else
+    {
+        return CPARSE_PREPROCESSOR_SCANNER_CLASS_OTHER;
+    }
+}
+
+/**
+ * \brief Build a transition with no token.
+ */
+static preprocessor_scanner_transition act(int action, int state)
+{
+    preprocessor_scanner_transition t = { action, state, 0 };
+
+    return t;
+}
+
+/**
+ * \brief Build a transition which broadcasts the named token.
+ */
+static preprocessor_scanner_transition token(int action, const char* ctor)
+{
+    preprocessor_scanner_transition t = { action, 0, 0 };
+
+    for (size_t i = 0; i < TOKEN_COUNT; ++i)
+    {
+        if (!strcmp(tokens[i], ctor))
+        {
+            t.token = (uint8_t)i;
+            return t;
+        }
+    }
+
+    fprintf(stderr, "Unknown token %s.\n", ctor);
+    exit(1);
+}
+
+/**
+ * \brief Decide how the scanner handles a character in a given state.
+ *
+ * \param state             The scanner state.
+ * \param ch                The raw character.
+ *
+ * \returns the transition for this state and character.
+ */
+static preprocessor_scanner_transition decide(int state, int ch)
+{
+    switch (state)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_BEGIN_LINE:
+            if ('#' == ch)
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_START_HASH, 0);
+            }
+            else
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_BEGIN_LINE, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_INIT:
+            return decide_init(ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HASH:
+            if (is_alpha(ch) || '_' == ch)
+            {
+                return
+                    act(CPARSE_PREPROCESSOR_SCANNER_ACTION_HASH_IDENTIFIER, 0);
+            }
+            else if ('#' == ch)
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_DOUBLE_HASH, 0);
+            }
+            else
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_END_HASH, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER:
+            if (is_alpha(ch) || '_' == ch || is_digit(ch))
+            {
+                return
+                    act(CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN,
+                        state);
+            }
+            else
+            {
+                return
+                    act(CPARSE_PREPROCESSOR_SCANNER_ACTION_END_IDENTIFIER, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT_DOT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DASH:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_COLON:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PLUS:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STAR:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_SLASH:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PERCENT_COLON_PERCENT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_AMPERSAND:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_PIPE:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CARET:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_TILDE:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_EQUAL:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_NOT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_LT_LT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_GT_GT:
+            return decide_punctuator(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_SLASH:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_OCTAL_2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_HEX_OPT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_LITTLE_U3:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U3:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U4:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U5:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U6:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING_BIG_U7:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_SLASH:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_OCTAL_2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_HEX_OPT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_LITTLE_U3:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U1:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U2:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U3:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U4:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U5:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U6:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR_BIG_U7:
+            return decide_literal(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_EXPECT_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_SIGN_EXPECT_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_S_EXPECT_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT:
+            return decide_number(state, ch);
+
+        default:
+            return
+                act(CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER, 0);
+    }
+}
+
+/**
+ * \brief Decide how the scanner handles a character in the init state.
+ */
+static preprocessor_scanner_transition decide_init(int ch)
+{
+    if (is_alpha(ch) || '_' == ch)
+    {
+        return
+            act(CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN,
+                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER);
+    }
+    else if (is_digit(ch) && '0' != ch)
+    {
+        return
+            act(CPARSE_PREPROCESSOR_SCANNER_ACTION_START_TOKEN,
+                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER);
+    }
+
+    for (size_t i = 0; i < INIT_SPEC_COUNT; ++i)
+    {
+        const punctuator_spec* spec = &init_specs[i];
+
+        if (spec->ch == ch)
+        {
+            return spec_transition(spec);
+        }
+    }
+
+    return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER, 0);
+}
+
+/**
+ * \brief Decide how the scanner handles a character which may extend a
+ * punctuator.
+ */
+static preprocessor_scanner_transition decide_punctuator(int state, int ch)
+{
+    const punctuator_spec* fallback = NULL;
+
+    /* a dot followed by a digit starts a float. */
+    if (CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DOT == state && is_digit(ch))
+    {
+        return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_UPGRADE_DOT, 0);
+    }
+
+    for (size_t i = 0; i < PUNCTUATOR_SPEC_COUNT; ++i)
+    {
+        const punctuator_spec* spec = &punctuator_specs[i];
+
+        if (spec->state != state)
+        {
+            continue;
+        }
+
+        if (spec->ch == ch)
+        {
+            return spec_transition(spec);
+        }
+        else if (0 == spec->ch)
+        {
+            fallback = spec;
+        }
+    }
+
+    if (NULL == fallback)
+    {
+        fprintf(stderr, "No punctuator fallback for state %d.\n", state);
+        exit(1);
+    }
+
+    return spec_transition(fallback);
+}
+
+/**
+ * \brief Build the transition for a punctuator spec.
+ */
+static preprocessor_scanner_transition spec_transition(
+    const punctuator_spec* spec)
+{
+    if (NULL != spec->token)
+    {
+        return token(spec->action, spec->token);
+    }
+    else
+    {
+        return act(spec->action, spec->next);
+    }
+}
+
+/**
+ * \brief Decide how the scanner handles a character in a string or character
+ * literal.
+ */
+static preprocessor_scanner_transition decide_literal(int state, int ch)
+{
+    const int cont = CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN;
+    const int error = CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER;
+    const literal_states* lit;
+
+    if (state < CPARSE_PREPROCESSOR_SCANNER_STATE_BEGIN_LINE)
+    {
+        lit = &string_states;
+    }
+    else
+    {
+        lit = &char_states;
+    }
+
+    if (lit->base == state)
+    {
+        if ('\\' == ch)
+        {
+            return act(cont, lit->slash);
+        }
+        else if (&string_states == lit && '"' == ch)
+        {
+            return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_QUOTE, 0);
+        }
+        else if (&string_states == lit && '>' == ch)
+        {
+            return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_STRING_GT, 0);
+        }
+        else if (lit->quote == ch)
+        {
+            return act(lit->end, 0);
+        }
+        else
+        {
+            return act(cont, lit->base);
+        }
+    }
+    else if (lit->slash == state)
+    {
+        if (0 != ch && NULL != strchr("'\"?\\abfnrtv", ch))
+        {
+            return act(cont, lit->base);
+        }
+        else if ('x' == ch || 'X' == ch)
+        {
+            return act(cont, lit->hex);
+        }
+        else if ('u' == ch)
+        {
+            return act(cont, lit->little_u);
+        }
+        else if ('U' == ch)
+        {
+            return act(cont, lit->big_u);
+        }
+        else if (is_octal(ch))
+        {
+            return act(cont, lit->octal_1);
+        }
+        else
+        {
+            return act(error, 0);
+        }
+    }
+    else if (lit->octal_1 == state || lit->octal_2 == state)
+    {
+        if (lit->quote == ch)
+        {
+            return act(lit->end, 0);
+        }
+        else if ('\\' == ch)
+        {
+            return act(cont, lit->slash);
+        }
+        else if (lit->octal_1 == state && is_octal(ch))
+        {
+            return act(cont, lit->octal_2);
+        }
+        else
+        {
+            return act(cont, lit->base);
+        }
+    }
+    else if (lit->hex_opt == state)
+    {
+        if (is_xdigit(ch))
+        {
+            return act(cont, state);
+        }
+        else if (lit->quote == ch)
+        {
+            return act(lit->end, 0);
+        }
+        else if ('\\' == ch)
+        {
+            return act(cont, lit->slash);
+        }
+        else
+        {
+            return act(cont, lit->base);
+        }
+    }
+
+    /* the remaining states each expect a single hex digit. */
+    if (!is_xdigit(ch))
+    {
+        return act(error, 0);
+    }
+    else if (lit->hex == state)
+    {
+        return act(cont, lit->hex_opt);
+    }
+    else if (lit->little_u + 3 == state || lit->big_u + 7 == state)
+    {
+        return act(cont, lit->base);
+    }
+    else
+    {
+        return act(cont, state + 1);
+    }
+}
+
+/**
+ * \brief Decide how the scanner handles a character in an integer or float.
+ */
+static preprocessor_scanner_transition decide_number(int state, int ch)
+{
+    const int cont = CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN;
+    const int expecting_digit =
+        CPARSE_PREPROCESSOR_SCANNER_ACTION_EXPECTING_DIGIT;
+    const int expecting_p =
+        CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_FLOAT_EXPECTING_P;
+    bool is_exponent = 'e' == ch || 'E' == ch;
+    bool is_hex_exponent = 'p' == ch || 'P' == ch;
+    bool is_sign = '+' == ch || '-' == ch;
+
+    switch (state)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER:
+            if (is_digit(ch))
+            {
+                return act(cont, state);
+            }
+            else if ('.' == ch)
+            {
+                return act(cont, CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT);
+            }
+            return integer_suffix(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER:
+            if ('x' == ch || 'X' == ch)
+            {
+                return
+                    act(cont, CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER);
+            }
+            else if ('.' == ch)
+            {
+                return act(cont, CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT);
+            }
+            /* fall through. */
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER:
+            if (is_octal(ch))
+            {
+                return
+                    act(cont,
+                        CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER);
+            }
+            return integer_suffix(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER:
+            if (is_xdigit(ch))
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_DIGIT, 0);
+            }
+            else if (is_hex_exponent)
+            {
+                return
+                    act(CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_EXPONENT,
+                        HEX_P_EXPECT_DIGIT);
+            }
+            else if ('.' == ch)
+            {
+                return
+                    act(cont, CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT);
+            }
+            return integer_suffix(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_END:
+            return integer_suffix(state, ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT:
+            if (is_digit(ch))
+            {
+                return act(cont, state);
+            }
+            else if (is_exponent)
+            {
+                return act(cont, E_EXPECT_DIGIT);
+            }
+            return float_suffix(ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_WITH_DIGIT:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_WITH_DIGIT:
+            if (is_digit(ch))
+            {
+                return act(cont, state);
+            }
+            return float_suffix(ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX:
+            if (is_xdigit(ch) || is_alpha(ch))
+            {
+                return
+                    act(CPARSE_PREPROCESSOR_SCANNER_ACTION_UNEXPECTED_CHARACTER,
+                        0);
+            }
+            else
+            {
+                return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_END_FLOAT, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_EXPECT_DIGIT:
+            if (is_digit(ch))
+            {
+                return act(cont, E_WITH_DIGIT);
+            }
+            else if (is_sign)
+            {
+                return act(cont, E_SIGN_EXPECT_DIGIT);
+            }
+            else
+            {
+                return act(expecting_digit, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_E_SIGN_EXPECT_DIGIT:
+            if (is_digit(ch))
+            {
+                return act(cont, E_WITH_DIGIT);
+            }
+            else
+            {
+                return act(expecting_digit, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT:
+            if (is_xdigit(ch))
+            {
+                return act(cont, state);
+            }
+            else if (is_hex_exponent)
+            {
+                return act(cont, HEX_P_EXPECT_DIGIT);
+            }
+            else
+            {
+                return act(expecting_p, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_EXPECT_DIGIT:
+            if (is_digit(ch))
+            {
+                return act(cont, HEX_P_WITH_DIGIT);
+            }
+            else if (is_sign)
+            {
+                return act(cont, HEX_P_SIGN_EXPECT_DIGIT);
+            }
+            else
+            {
+                return act(expecting_digit, 0);
+            }
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT_P_S_EXPECT_DIGIT:
+        default:
+            if (is_digit(ch))
+            {
+                return act(cont, HEX_P_WITH_DIGIT);
+            }
+            else
+            {
+                return act(expecting_digit, 0);
+            }
+    }
+}
+
+/**
+ * \brief Decide how the scanner handles a possible integer suffix.
+ */
+static preprocessor_scanner_transition integer_suffix(int state, int ch)
+{
+    const int cont = CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN;
+    const int end = CPARSE_PREPROCESSOR_SCANNER_ACTION_END_INTEGER;
+    bool is_unsigned = 'u' == ch || 'U' == ch;
+    bool is_long = 'l' == ch || 'L' == ch;
+
+    switch (state)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_0_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_OCTAL_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER:
+            if (is_unsigned)
+            {
+                return act(cont, INTEGER_U);
+            }
+            else if (is_long)
+            {
+                return act(cont, INTEGER_L);
+            }
+            break;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_U:
+            if (is_long)
+            {
+                return act(cont, INTEGER_UL);
+            }
+            break;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_L:
+            if (is_unsigned)
+            {
+                return act(cont, INTEGER_END);
+            }
+            else if (is_long)
+            {
+                return act(cont, INTEGER_LL);
+            }
+            break;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_UL:
+            if (is_long)
+            {
+                return act(cont, INTEGER_END);
+            }
+            break;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER_LL:
+            if (is_unsigned)
+            {
+                return act(cont, INTEGER_END);
+            }
+            break;
+    }
+
+    return act(end, 0);
+}
+
+/**
+ * \brief Decide how the scanner handles a possible float suffix.
+ */
+static preprocessor_scanner_transition float_suffix(int ch)
+{
+    if ('f' == ch || 'F' == ch || 'l' == ch || 'L' == ch)
+    {
+        return
+            act(CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN,
+                CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT_SUFFIX);
+    }
+    else
+    {
+        return act(CPARSE_PREPROCESSOR_SCANNER_ACTION_END_FLOAT, 0);
+    }
+}
+
+/**
+ * \brief Build the transition table.
+ *
+ * Every character is run through the decision function, and each character
+ * must agree with the first character seen in its class.
+ *
+ * \param table             The table to populate.
+ *
+ * \returns true on success, or false if two characters in the same class
+ * behave differently.
+ */
+static bool build(preprocessor_scanner_transition* table)
+{
+    bool seen[CLASS_COUNT];
+
+    for (int state = 0; state < STATE_COUNT; ++state)
+    {
+        memset(seen, 0, sizeof(seen));
+
+        for (int ch = 0; ch < 256; ++ch)
+        {
+            uint8_t cls = char_class(ch);
+            preprocessor_scanner_transition* entry =
+                &table[state * CLASS_COUNT + cls];
+            preprocessor_scanner_transition t = decide(state, ch);
+
+            if (!seen[cls])
+            {
+                *entry = t;
+                seen[cls] = true;
+            }
+            else if (
+                entry->action != t.action
+             || entry->state != t.state
+             || entry->token != t.token)
+            {
+                fprintf(
+                    stderr,
+                    "Character %d does not match class %u in state %d.\n",
+                    ch, cls, state);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Get the run of characters that a state can consume in bulk.
+ *
+ * \param state             The scanner state.
+ *
+ * \returns the \ref preprocessor_scanner_run for this state.
+ */
+static uint8_t run_of(int state)
+{
+    switch (state)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_IDENTIFIER:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_IDENTIFIER;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_DECIMAL_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_FLOAT:
+        case E_WITH_DIGIT:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_DECIMAL;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_INTEGER:
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_HEX_FLOAT:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_HEX;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_STRING:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_STRING;
+
+        case CPARSE_PREPROCESSOR_SCANNER_STATE_IN_CHAR:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_CHAR;
+
+        default:
+            return CPARSE_PREPROCESSOR_SCANNER_RUN_NONE;
+    }
+}
+
+/**
+ * \brief Return true if a character belongs to the given run.
+ *
+ * This must match the scans performed by the preprocessor scanner.
+ */
+static bool in_run(int run, int ch)
+{
+    switch (run)
+    {
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_IDENTIFIER:
+            return is_alpha(ch) || is_digit(ch) || '_' == ch;
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_DECIMAL:
+            return is_digit(ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_HEX:
+            return is_xdigit(ch);
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_STRING:
+            return '"' != ch && '\\' != ch && '\n' != ch && '>' != ch;
+
+        case CPARSE_PREPROCESSOR_SCANNER_RUN_CHAR:
+            return '\'' != ch && '\\' != ch && '\n' != ch;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * \brief Verify that every character in a state's run continues the current
+ * token in that state.
+ *
+ * \param table             The transition table to check.
+ *
+ * \returns true on success, or false if a run character changes the state or
+ * performs any other action.
+ */
+static bool verify_runs(const preprocessor_scanner_transition* table)
+{
+    for (int state = 0; state < STATE_COUNT; ++state)
+    {
+        int run = run_of(state);
+
+        for (int ch = 0; ch < 256; ++ch)
+        {
+            const preprocessor_scanner_transition* t =
+                &table[state * CLASS_COUNT + char_class(ch)];
+
+            if (!in_run(run, ch))
+            {
+                continue;
+            }
+
+            if (
+                CPARSE_PREPROCESSOR_SCANNER_ACTION_HEX_DIGIT == t->action
+             || (CPARSE_PREPROCESSOR_SCANNER_ACTION_CONTINUE_TOKEN == t->action
+              && state == t->state))
+            {
+                continue;
+            }
+
+            fprintf(
+                stderr, "Character %d does not continue run %d in state %d.\n",
+                ch, run, state);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Write the generated source file.
+ *
+ * \param out               The output file.
+ * \param table             The transition table to write.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int write_tables(
+    FILE* out, const preprocessor_scanner_transition* table)
+{
+    fprintf(out,
+        "/**\n"
+        " * \\file src/preprocessor_scanner/"
+            "preprocessor_scanner_transition_table.c\n"
+        " *\n"
+        " * \\brief Character class and transition tables for the "
+            "preprocessor scanner.\n"
+        " *\n"
+        " * This file is generated by tools/lexer_table_gen. Do not edit "
+            "it by hand;\n"
+        " * instead, update the generator and run the lexer_table "
+            "target.\n"
+        " *\n"
+        " * \\copyright 2023 Justin Handville.  Please see license.txt in "
+            "this\n"
+        " * distribution for the license terms under which this software "
+            "is distributed.\n"
+        " */\n"
+        "\n"
+        "#include <libcparse/event.h>\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"preprocessor_scanner_internal.h\"\n"
+        "\n"
+        "CPARSE_IMPORT_event;\n"
+        "CPARSE_IMPORT_preprocessor_scanner_internal;\n"
+        "\n");
+
+    /* write the character classes. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The character class of each raw character.\n"
+        " */\n"
+        "const uint8_t CPARSE_SYM(preprocessor_scanner_char_class)[256] = "
+            "{\n");
+    for (int i = 0; i < 256; i += 16)
+    {
+        fprintf(out, "   ");
+        for (int j = i; j < i + 16; ++j)
+        {
+            fprintf(out, " %2u,", char_class(j));
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    /* write the token constructors. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The token constructors referenced by the transition "
+            "table.\n"
+        " */\n"
+        "const preprocessor_scanner_keyword_ctor\n"
+        "CPARSE_SYM(preprocessor_scanner_token_ctors)[] = {\n");
+    for (size_t i = 0; i < TOKEN_COUNT; ++i)
+    {
+        fprintf(out, "    /* %2zu */ &%s,\n", i, tokens[i]);
+    }
+    fprintf(out, "};\n\n");
+
+    /* write the transitions, one row per state. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The raw character transition table.\n"
+        " *\n"
+        " * Each entry is { action, state, token }, indexed by scanner state "
+            "and by\n"
+        " * character class.\n"
+        " */\n"
+        "const preprocessor_scanner_transition\n"
+        "CPARSE_SYM(preprocessor_scanner_transitions)[\n"
+        "    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT]\n"
+        "    [CPARSE_PREPROCESSOR_SCANNER_CLASS_COUNT] = {\n");
+    for (int state = 0; state < STATE_COUNT; ++state)
+    {
+        fprintf(out, "    /* state %d */\n    {\n", state);
+        for (int cls = 0; cls < CLASS_COUNT; cls += 4)
+        {
+            fprintf(out, "       ");
+            for (int i = cls; i < cls + 4 && i < CLASS_COUNT; ++i)
+            {
+                const preprocessor_scanner_transition* t =
+                    &table[state * CLASS_COUNT + i];
+
+                fprintf(
+                    out, " { %2u, %2u, %2u },", t->action, t->state, t->token);
+            }
+            fprintf(out, "\n");
+        }
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n\n");
+
+    /* write the runs. */
+    fprintf(out,
+        "/**\n"
+        " * \\brief The run of characters that each state can consume in "
+            "bulk.\n"
+        " */\n"
+        "const uint8_t CPARSE_SYM(preprocessor_scanner_runs)[\n"
+        "    CPARSE_PREPROCESSOR_SCANNER_STATE_COUNT] = {\n");
+    for (int state = 0; state < STATE_COUNT; state += 16)
+    {
+        fprintf(out, "   ");
+        for (int i = state; i < state + 16 && i < STATE_COUNT; ++i)
+        {
+            fprintf(out, " %u,", run_of(i));
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n");
+
+    return ferror(out) ? 1 : 0;
+}
@@ -0,0 +1,497 @@
+/**
+ * \file tools/scanner_bench/src/main.c
+ *
+ * \brief Main entry point for the scanner_bench tool.
+ *
+ * scanner_bench measures the throughput of the \ref preprocessor_scanner over a
+ * corpus of C source files. Each file is scanned twice: once with raw spans
+ * carried through the filter chain, and once with a raw character subscriber
+ * on the \ref raw_stack_scanner, which forces every stage to process one
+ * character at a time. Finally, the events recorded from each file are
+ * replayed from a \ref token_stream, which measures what a token cache saves.
+ *
+ * \copyright 2023 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libcparse/event.h>
+#include <libcparse/event_handler.h>
+#include <libcparse/event_reactor.h>
+#include <libcparse/input_stream.h>
+#include <libcparse/preprocessor_scanner.h>
+#include <libcparse/status_codes.h>
+#include <libcparse/token_stream.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+CPARSE_IMPORT_abstract_parser;
+CPARSE_IMPORT_event;
+CPARSE_IMPORT_event_handler;
+CPARSE_IMPORT_event_reactor;
+CPARSE_IMPORT_input_stream;
+CPARSE_IMPORT_preprocessor_scanner;
+CPARSE_IMPORT_token_stream;
+
+#define PASSES 5
+#define MODES 3
+
+typedef struct corpus_file corpus_file;
+
+/**
+ * \brief A corpus file, loaded into memory.
+ */
+struct corpus_file
+{
+    const char* path;
+    char* text;
+    size_t size;
+    void* recording;
+    size_t recording_size;
+    bool skip;
+};
+
+static int load_file(corpus_file* file);
+static int scan_file(
+    corpus_file* file, bool per_character, bool record, unsigned long* tokens);
+static int replay_file(const corpus_file* file, unsigned long* tokens);
+static int count_callback(void* context, const event* ev);
+static int ignore_callback(void* context, const event* ev);
+static double elapsed_ns(
+    const struct timespec* start, const struct timespec* end);
+
+/**
+ * \brief Main entry point for scanner_bench.
+ *
+ * \param argc              The argument count.
+ * \param argv              The argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    int retval;
+    corpus_file* files;
+    size_t count = (size_t)(argc - 1);
+    size_t bytes = 0, skipped = 0;
+    unsigned long tokens;
+    double best_ns[MODES] = { 0.0, 0.0, 0.0 };
+    struct timespec start, end;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s file.c [file.c ...]\n", argv[0]);
+        return 1;
+    }
+
+    files = (corpus_file*)calloc(count, sizeof(*files));
+    if (NULL == files)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
+    }
+
+    /* load the corpus, skipping any file the scanner rejects. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        files[i].path = argv[i + 1];
+        if (STATUS_SUCCESS != load_file(&files[i])
+         || STATUS_SUCCESS != scan_file(&files[i], false, true, &tokens))
+        {
+            files[i].skip = true;
+            skipped += 1;
+            continue;
+        }
+
+        bytes += files[i].size;
+    }
+
+    printf(
+        "%zu files (%zu skipped), %.2f MB per pass.\n", count - skipped,
+        skipped, bytes / 1e6);
+
+    /* time each mode, keeping the best pass. */
+    for (int pass = 0; pass < PASSES; ++pass)
+    {
+        for (int mode = 0; mode < MODES; ++mode)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (files[i].skip)
+                {
+                    continue;
+                }
+
+                if (2 == mode)
+                {
+                    retval = replay_file(&files[i], &tokens);
+                }
+                else
+                {
+                    retval =
+                        scan_file(&files[i], 1 == mode, false, &tokens);
+                }
+
+                if (STATUS_SUCCESS != retval)
+                {
+                    fprintf(
+                        stderr, "Scanning %s failed with status %d.\n",
+                        files[i].path, retval);
+                    return 1;
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            double ns = elapsed_ns(&start, &end);
+            if (0 == pass || ns < best_ns[mode])
+            {
+                best_ns[mode] = ns;
+            }
+        }
+    }
+
+    printf("raw spans:       %8.2f MB/s\n", bytes * 1e3 / best_ns[0]);
+    printf("raw characters:  %8.2f MB/s\n", bytes * 1e3 / best_ns[1]);
+    printf("speedup:         %8.2fx\n", best_ns[1] / best_ns[0]);
+    printf("token stream:    %8.2f MB/s\n", bytes * 1e3 / best_ns[2]);
+    printf("replay speedup:  %8.2fx\n", best_ns[0] / best_ns[2]);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        free(files[i].text);
+        free(files[i].recording);
+    }
+    free(files);
+
+    return 0;
+}
+
+/**
+ * \brief Load a corpus file into memory.
+ *
+ * \param file              The corpus file to load.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int load_file(corpus_file* file)
+{
+    FILE* in;
+    long size;
+
+    in = fopen(file->path, "rb");
+    if (NULL == in)
+    {
+        return ERROR_LIBCPARSE_FILE_OPEN_ERROR;
+    }
+
+    if (0 != fseek(in, 0, SEEK_END) || (size = ftell(in)) < 0
+     || 0 != fseek(in, 0, SEEK_SET))
+    {
+        fclose(in);
+        return ERROR_LIBCPARSE_FILE_STAT;
+    }
+
+    file->text = (char*)malloc((size_t)size + 1);
+    if (NULL == file->text)
+    {
+        fclose(in);
+        return ERROR_LIBCPARSE_OUT_OF_MEMORY;
+    }
+
+    file->size = fread(file->text, 1, (size_t)size, in);
+    file->text[file->size] = 0;
+    fclose(in);
+
+    /* the input stream stops at the first NUL. */
+    file->size = strlen(file->text);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Scan a single corpus file.
+ *
+ * \param file              The corpus file to scan.
+ * \param per_character     If true, subscribe to raw characters so that each
+ *                          stage processes one character at a time.
+ * \param record            If true, record the scanner's events in the file's
+ *                          token stream.
+ * \param tokens            Pointer to receive the number of events seen.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int scan_file(
+    corpus_file* file, bool per_character, bool record, unsigned long* tokens)
+{
+    int retval, release_retval;
+    preprocessor_scanner* scanner;
+    token_stream_writer* writer = NULL;
+    input_stream* stream;
+    event_handler eh, raw_eh, writer_eh;
+
+    *tokens = 0;
+
+    /* create the scanner. */
+    retval = preprocessor_scanner_create(&scanner);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    abstract_parser* ap = preprocessor_scanner_upcast(scanner);
+
+    /* count the scanner's events. */
+    retval = event_handler_init(&eh, &count_callback, tokens);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scanner;
+    }
+
+    retval = abstract_parser_preprocessor_scanner_subscribe(ap, &eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* record the scanner's events. */
+    if (record)
+    {
+        retval = token_stream_writer_create(&writer);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+
+        retval = token_stream_writer_event_handler_init(&writer_eh, writer);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+
+        retval = abstract_parser_preprocessor_scanner_subscribe(ap, &writer_eh);
+        release_retval = event_handler_dispose(&writer_eh);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+        else if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+            goto cleanup_eh;
+        }
+    }
+
+    /* a raw character subscriber turns off raw spans. */
+    if (per_character)
+    {
+        retval = event_handler_init(&raw_eh, &ignore_callback, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+
+        retval = abstract_parser_raw_stack_scanner_subscribe(ap, &raw_eh);
+        release_retval = event_handler_dispose(&raw_eh);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_eh;
+        }
+        else if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+            goto cleanup_eh;
+        }
+    }
+
+    /* add the file contents. */
+    retval = input_stream_create_from_string(&stream, file->text);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    retval = abstract_parser_push_input_stream(ap, file->path, stream);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval = input_stream_release(stream);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        goto cleanup_eh;
+    }
+
+    /* scan the file. */
+    retval = abstract_parser_run(ap);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* encode the recording. */
+    if (record)
+    {
+        retval =
+            token_stream_writer_build(
+                &file->recording, &file->recording_size, writer);
+    }
+    goto cleanup_eh;
+
+cleanup_eh:
+    if (NULL != writer)
+    {
+        release_retval = token_stream_writer_release(writer);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_scanner:
+    release_retval = preprocessor_scanner_release(scanner);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Replay the events recorded from a single corpus file.
+ *
+ * \param file              The corpus file to replay.
+ * \param tokens            Pointer to receive the number of events seen.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int replay_file(const corpus_file* file, unsigned long* tokens)
+{
+    int retval, release_retval;
+    token_stream* stream;
+    event_reactor* reactor;
+    event_handler eh;
+
+    *tokens = 0;
+
+    /* view the recording. */
+    retval =
+        token_stream_create(&stream, file->recording, file->recording_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* count the replayed events. */
+    retval = event_reactor_create(&reactor);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    retval = event_handler_init(&eh, &count_callback, tokens);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reactor;
+    }
+
+    retval = event_reactor_add(reactor, &eh);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_eh;
+    }
+
+    /* replay the file. */
+    retval = token_stream_replay(stream, reactor, NULL);
+    goto cleanup_eh;
+
+cleanup_eh:
+    release_retval = event_handler_dispose(&eh);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_reactor:
+    release_retval = event_reactor_release(reactor);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_stream:
+    release_retval = token_stream_release(stream);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Count an event.
+ *
+ * \param context           The counter for this subscriber.
+ * \param ev                The event to count.
+ *
+ * \returns STATUS_SUCCESS.
+ */
+static int count_callback(void* context, const event* ev)
+{
+    unsigned long* count = (unsigned long*)context;
+    (void)ev;
+
+    *count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Ignore an event.
+ *
+ * \param context           Unused.
+ * \param ev                The event to ignore.
+ *
+ * \returns STATUS_SUCCESS.
+ */
+static int ignore_callback(void* context, const event* ev)
+{
+    (void)context;
+    (void)ev;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Compute the elapsed time between two timestamps in nanoseconds.
+ *
+ * \param start             The start time.
+ * \param end               The end time.
+ *
+ * \returns the elapsed time in nanoseconds.
+ */
+static double elapsed_ns(
+    const struct timespec* start, const struct timespec* end)
+{
+    return
+        (double)(end->tv_sec - start->tv_sec) * 1e9
+            + (double)(end->tv_nsec - start->tv_nsec);
+}